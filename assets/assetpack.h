@@ -0,0 +1,43 @@
+/* Asset pack layout
+ * One binary file holds every sprite. It starts with an assetPackHeader,
+ * followed by count assetPackEntry records and then the palette and texels
+ * of each sprite. A sprite with at most 16 colours stores 4 bit palette
+ * indices, two per byte with the left texel in the low nibble; one with at
+ * most 256 colours stores 8 bit indices; anything else stores RGB565 texels.
+ * Rows are row major and start on a byte boundary. Palettes hold RGB565
+ * colours, and a sprite with a colour key keeps it in palette slot 0, so its
+ * colorKey is index 0. Everything is little endian and starts at a multiple
+ * of ASSET_PACK_ALIGN from the beginning of the pack. Written by
+ * tools/assetpack.c, read by game_main.c.
+ */
+#ifndef ASSETPACK_H
+#define ASSETPACK_H
+
+#include <stdint.h>
+
+#define ASSET_PACK_MAGIC 0x4B504254  // "TBPK"
+#define ASSET_PACK_VERSION 2
+#define ASSET_PACK_ALIGN 16
+#define ASSET_NAME_LENGTH 24
+#define NO_COLOR_KEY -1
+
+typedef struct assetPackHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t count;  // entries following the header
+    uint32_t size;   // bytes in the whole pack
+} assetPackHeader;
+
+typedef struct assetPackEntry {
+    char name[ASSET_NAME_LENGTH];  // nul terminated
+    uint16_t width;
+    uint16_t height;
+    int32_t colorKey;              // texel value that is not drawn, or NO_COLOR_KEY
+    uint32_t offset;               // first row of texels
+    uint8_t bitsPerTexel;          // 4, 8 or 16
+    uint8_t reserved;
+    uint16_t paletteSize;          // colours at paletteOffset, 0 for 16 bits per texel
+    uint32_t paletteOffset;
+} assetPackEntry;
+
+#endif
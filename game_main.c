@@ -1,1525 +1,4728 @@
-#define SDRAM_BASE 0xC0000000
-#define FPGA_ONCHIP_BASE 0xC8000000
-#define FPGA_CHAR_BASE 0xC9000000
-
-/* Cyclone V FPGA devices */
-#define LEDR_BASE 0xFF200000
-#define HEX3_HEX0_BASE 0xFF200020
-#define HEX5_HEX4_BASE 0xFF200030
-#define SW_BASE 0xFF200040
-#define KEY_BASE 0xFF200050
-#define TIMER_BASE 0xFF202000
-#define PIXEL_BUF_CTRL_BASE 0xFF203020
-#define CHAR_BUF_CTRL_BASE 0xFF203030
-
-/* VGA colors */
-#define WHITE 0xFFFF
-#define YELLOW 0xFFE0
-#define RED 0xF800
-#define GREEN 0x07E0
-#define BLUE 0x001F
-#define CYAN 0x07FF
-#define MAGENTA 0xF81F
-#define GREY 0xC618
-#define PINK 0xFC18
-#define ORANGE 0xFC00
-#define BLACK 0x0
-
-#define ABS(x) (((x) > 0) ? (x) : -(x))
-
-/* Screen size. */
-#define RESOLUTION_X 320
-#define RESOLUTION_Y 240
-
-/* Constants for animation */
-#define BOX_LEN 2
-#define NUM_BOXES 8
-
-#define FALSE 0
-#define TRUE 1
-
-#include <stdbool.h>
-#include <stdio.h>
-#include <stdlib.h>
-#include <string.h>
-#include <time.h>
-#include <stdint.h>
-
-
-const uint16_t gametitle[60][160] = { {65227,63146,63114,65227,63179,63212,63146,63114,63081,63114,63146,63113,63113,63081,60935,63080,63016,63048,63048,63113,63080,63048,63048,60967,63015,60967,60935,60967,63080,63080,63015,60870,60870,60935,62983,58789,58757,58789,58757,58789,58757,58789,60870,56676,54500,56580,58693,56580,54468,58661,60806,58757,58725,56580,54500,56581,54436,56548,58693,54500,50211,54403,52291,52323,52323,52291,45986,43841,43842,48066,48066,48035,48034,45954,50147,52291,52291,52259,54436,50147,45985,54403,56612,48066,45890,43810,41729,50178,45954,43842,48067,45954,43841,39618,39585,48034,45954,43842,37505,37505,41697,45922,50178,41729,43810,39585,45890,45954,48002,43841,35426,39650,41730,45954,54403,54468,43873,37474,39586,45922,35393,41730,43778,41666,43842,43778,41698,43779,48067,45954,50178,37474,43810,45954,41698,29153,35394,27073,20801,31202,27074,33313,33314,27073,33313,27009,33313,41730,35457,27073,37537,39553,45858,39650,29090,22914,29186,24993,20770,14498}, {65227,63146,65292,63277,65293,65359,65292,63080,63048,63211,63178,63113,63113,63081,58119,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55525,55525,55493,55525,55493,55493,55493,47619,50212,39585,43778,39618,39617,39617,45954,43810,50147,48067,41762,48067,47971,31265,29153,29121,20802,27041,41730,43778,35426,27073,29121,24962,35393,33314,31234,33282,37538,31265,52227,29186,29185,16577,33345,20802,20738,16641}, {63212,63178,65293,65326,65292,65326,65325,63146,63081,65325,65226,63113,63113,63048,55493,55525,55525,55525,55525,55525,55525,55525,55525,55525,55525,55525,55525,55525,55525,55525,55525,55525,55525,55525,55525,55525,55525,55525,55525,55525,55525,55525,55525,55525,55525,55525,55525,55525,55525,55525,55525,55525,55525,55525,55525,55525,55525,55525,55525,55525,55525,55525,55556,55589,55589,55621,55589,55621,55620,55621,55621,55621,55588,55588,55525,55525,55588,55589,55493,55493,55493,55493,55493,55493,55525,55525,55525,55493,55525,55525,55525,55525,55525,55525,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55525,55525,55525,55493,55493,55493,55493,55493,55493,55493,55525,55525,55525,55493,55493,45889,41729,50147,35457,33345,45922,45922,45890,41762,43810,50115,50179,48034,48035,54468,41730,35425,22881,22850,29153,39585,43843,45922,35394,27073,22882,39617,33346,39617,37474,24961,14497,39585,31297,37473,24962,31233,16609,20801,27010}, {65292,65259,65293,65326,63277,63278,65292,63113,65226,65292,63146,63113,63146,55493,55493,55525,60614,60549,60614,58533,60581,58502,58501,58501,58501,58533,58534,58501,60549,60518,60550,60517,60549,60549,60550,60550,58469,58534,58534,60549,60517,60549,58469,58469,58437,58470,58469,60518,60485,60485,58437,60517,58437,58437,58437,60517,58470,60517,58437,58501,58437,58437,60485,60485,60485,58437,58469,58469,58438,58469,60517,60517,60485,60453,60485,60485,60485,60485,58437,58437,60453,60517,58437,60518,60486,58437,55493,55493,60581,60486,58405,60517,60549,58437,60485,58437,58470,60549,58437,58469,58469,58437,58469,58469,58470,58501,60582,60550,60549,60517,60518,60454,58469,58469,58533,55525,55525,55493,55685,41729,43778,39618,48034,39650,37473,45922,43778,48034,54436,43842,45922,50147,48099,43778,50146,45890,35393,35363,29154,31233,31202,43810,50082,39650,35394,29153,41730,33281,37538,33314,27105,22850,33346,29122,35393,29153,24961,18721,18658,24929}, {63244,65292,65292,65358,65358,65391,65325,63112,63178,65324,65258,65226,63082,55493,55525,60581,61125,61094,61094,61126,61126,61126,61094,61062,61126,61094,61094,61094,61094,61094,61094,61094,61093,61094,61094,61094,61094,61094,61094,61094,61094,61094,61061,61094,61093,61062,61094,61094,61126,61094,61094,61094,61093,61094,61094,61127,61093,61094,61062,61094,61094,61094,61125,61062,61062,61094,61094,61094,61094,61094,61093,63142,61094,63142,61094,61094,61062,61094,61094,61093,61125,61126,60773,58501,55589,55493,55493,58149,58564,61094,61093,61094,61062,63142,63142,63142,61094,61094,61094,61094,61094,61094,61062,61094,61094,61094,61093,61062,61094,61094,61061,60966,58437,58052,55493,55493,55493,58628,48099,37537,39618,37537,48034,43874,43778,45890,41698,45987,48067,39585,43842,43777,45922,39553,48066,45890,43810,41730,39617,29090,31234,31232,39619,35394,39585,39586,39585,35362,37505,29089,24961,35394,31202,31233,31234,29089,20802,22882,18657,24961}, {65292,65293,63243,65325,65325,65358,65293,63177,63178,63244,65226,63177,55525,55525,58213,60870,61126,61094,61126,61126,61094,61094,61094,61126,61094,61094,61062,61094,61093,61094,61094,61094,61094,61094,61094,61094,61094,61094,61126,61094,61094,61094,61062,61095,61094,61094,61062,61094,61094,61094,61094,61094,61093,61094,61094,61094,61062,61095,61094,61094,61094,61094,61093,61094,61094,61094,61093,61094,61094,61094,63142,61094,61094,61094,63142,61094,61093,61094,61062,61094,60933,60517,58021,55493,55493,55525,55557,60485,61062,61094,61094,61094,61094,61093,61094,61094,61094,61094,61094,61126,61094,61093,61095,61126,61094,61094,63142,63142,61094,61095,60615,58469,55557,55493,55493,53637,45922,54404,39681,29121,35426,37537,43746,43810,45922,45922,45922,39586,37506,43810,50147,45987,48002,43779,41697,37506,43809,41730,31234,35425,37505,27042,29153,31233,43810,37474,35394,33314,24962,27105,18658,27073,33314,31233,24961,29154,20801,24897,24962,27041}, {65293,65293,65293,65358,63310,65326,65259,65259,63146,63178,63179,55782,55493,55525,58533,59078,61094,61093,61094,61094,61094,61094,61094,61093,61094,61094,61094,61094,61094,61093,61094,61094,61126,61094,61094,61093,61094,61094,61126,61094,61094,61094,61093,61126,61094,61095,59046,61094,61126,61126,61093,61094,61093,61093,61094,61094,61062,61094,61094,61094,61094,61094,61094,61094,61126,61126,61094,61094,61126,61093,61093,61093,61094,61094,61094,61093,63110,61094,59012,58469,58309,55493,55493,55493,55493,55525,60518,60934,61094,61093,61093,61094,61126,61094,61094,61094,61093,61094,61094,61094,63142,61094,61125,61094,61094,63142,61126,61094,60999,58438,58054,55493,55493,55493,48034,48035,45890,43810,39586,37473,37474,33345,35394,41698,41666,37505,39618,35393,35426,43777,37538,41665,35425,35361,33346,33282,41666,50146,41699,35457,33313,31234,39586,31233,39586,39585,39585,35394,24962,27073,20770,22849,27042,33313,35362,22849,16610,22882,18689,18689}, {65327,65359,63311,65359,65393,65360,63212,65293,63178,63179,65260,55525,55493,58533,61062,61158,61158,61126,63174,63174,61094,61094,61126,61094,61126,61094,61126,61126,61126,61062,61093,61094,61094,61094,61094,61062,61094,61094,61094,61094,60997,58885,60934,58822,58821,58789,60903,60901,60805,60805,58757,60838,60806,60774,60806,60838,58694,58662,60678,60678,60709,60678,60710,58662,58597,60646,58597,60710,60645,58597,60517,58469,60613,58598,58565,60613,60549,58533,60581,55493,55525,55493,55493,55493,55493,57861,58437,60581,58564,58533,58597,58597,58565,60677,60646,58597,58533,58597,58598,58565,58565,60613,60582,60581,58598,60646,58630,60581,60485,55493,55525,55493,55557,48067,43809,39617,37569,39585,39585,43842,41666,39617,41698,48002,45922,43842,43842,43811,35394,35425,31233,27041,24961,31234,24993,24930,24898,31201,33281,29121,27041,37538,41666,43810,39618,39650,43810,37506,24961,24961,24993,27042,24961,29185,31201,18721,18689,20737,16610,16609}, {65327,65392,65392,65359,65426,65360,63278,65359,65293,63180,55589,55493,55525,60261,58278,58245,58214,58181,58149,58180,58149,58149,58213,58181,58117,58149,58149,58117,58117,58085,58085,58085,58084,58085,58533,60710,61094,61094,61094,60773,58373,55876,57893,55685,55685,55685,55685,55685,55685,55685,55685,55685,55685,55685,55653,55653,55653,55653,55621,55653,55653,55621,55621,55621,55621,55621,55620,55589,55589,55589,55589,55589,55589,55493,55589,55525,55525,55525,55493,55525,55525,60485,57989,55525,55525,55525,55525,55525,55493,55493,55493,55556,55589,55589,55621,55589,55588,55621,55589,55589,55621,55589,55525,55493,55557,55557,55525,55493,55493,55493,55493,52100,48035,48034,41730,35394,29090,39618,39585,39585,43810,48066,50147,50147,48035,50147,45954,48002,39618,37474,45955,35394,20769,31266,27073,24961,22850,29121,33345,33313,33249,29153,27042,33281,31201,31201,43778,41698,29122,27010,20705,18690,18658,27041,20770,16577,22882,20737,16610,16610}, {65293,63312,65393,65360,65392,65327,65326,65328,63245,58281,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55525,55525,55493,55621,60518,61094,61094,63110,61062,58500,55493,55525,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55525,55493,55493,55493,55493,55525,55493,55493,55493,55493,55525,55493,55493,58148,60518,60485,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55525,55525,55493,55493,55493,55525,55493,55525,55525,55493,55493,55493,55493,55493,55557,45922,50147,48067,48034,39586,29122,31233,41666,43810,41697,48067,52291,50115,48002,48067,50146,48035,50115,45890,45987,50147,43874,20801,39618,39586,35425,29121,37538,41667,39585,41698,43746,37537,41698,31233,31202,41697,39618,27073,18689,22881,16609,12417,20801,20802,20770,24961,27041,18721,16609}, {65295,65326,65360,65360,65327,65260,65293,65327,65294,63147,65260,65327,65294,65228,65294,65294,65261,65293,65294,65293,65293,63180,63080,63146,63178,63080,63048,63112,63047,60934,58215,55493,55493,60550,60997,61093,61093,61061,58565,56037,55493,55525,60967,60967,60902,58789,58789,56644,56612,58725,60837,58789,56645,56677,58757,56612,52323,52355,54500,56612,54436,54467,56613,54468,56548,56547,54468,56516,54436,54373,52195,54340,54372,50019,55493,55493,55493,55621,58437,61094,58437,55525,55493,55557,50178,45954,45859,43746,45890,45826,47971,54340,47970,50115,54372,48034,48067,48067,48067,50179,48035,41729,43810,45890,50115,45922,52227,48035,45922,39617,43843,48034,45922,43778,39618,33313,41665,50147,48099,54372,56549,54436,48035,48002,50147,54372,52227,48035,48035,48035,50147,52324,35426,37538,35393,31233,37538,37505,37537,39617,45858,48034,39586,45986,35394,33313,37506,31234,27042,20769,20866,20769,14498,14529,20802,18690,22881,27074,27041,20802}, {65327,65326,65326,63245,65326,63212,63212,65326,65294,65260,65260,65327,63278,65261,65326,65326,65261,65260,65261,65293,65325,65259,63113,63178,65259,63113,63080,63048,60967,60902,55493,55493,58180,58597,61062,61094,61094,60998,58502,55493,55493,58247,60711,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,54500,54499,55525,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,58469,62950,63110,60837,60261,55493,55493,54467,55717,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55525,54436,52291,50211,50147,45953,52323,50211,45922,48002,48066,54371,48034,54372,43810,41697,43778,48034,48067,45921,48067,48035,52292,54436,54436,54404,52292,48034,50179,50147,45955,43745,45890,41698,41697,48003,45922,41729,43810,43843,39618,39649,39586,43746,48003,45922,41698,37505,39554,35393,33313,29122,27073,27073,27074,24962,18689,14496,14498,22881,18657,16578,20801,22817,25025}, {65392,65392,63278,65260,65327,65327,65294,65294,63245,65260,65294,65360,65359,65261,65294,65293,65228,63212,65326,65326,65293,65260,63179,63146,63178,63080,63048,63047,60967,55782,55493,55557,58533,61094,61125,61062,61094,58469,55589,55525,55525,55525,55525,55493,55525,57797,57764,57796,57764,57764,57829,57829,55748,57829,57765,55525,55525,56037,55557,55525,55525,55813,58021,58021,58053,58117,58181,60261,58245,58213,58245,58277,55525,55493,58373,58534,61093,63109,61093,58469,55525,55525,55525,55525,55525,55525,58085,58245,58181,60229,55717,55525,55493,55493,54148,52323,56548,54371,52292,50179,45922,54436,54435,54404,50179,52259,50147,45922,45953,45922,48034,48099,50114,50179,50147,50147,52291,54436,52291,52323,50147,45954,48034,48099,45922,43778,45858,43810,41731,39585,48003,52260,45890,43778,41665,37505,37474,39585,37538,27041,37506,29122,31265,37570,31234,27041,24929,29153,27073,27010,24962,20737,18690,14466,22881,22881,18690,22913,16546,31266}, {63377,65459,65359,65261,65294,65359,63278,65326,63245,65261,65326,65392,65359,65326,65326,65293,65260,63212,65359,65359,65293,65260,65325,65259,65226,61000,63015,63047,60871,55525,55493,60582,60902,61094,61094,61062,60806,58373,55493,55493,55493,55493,55493,58213,60741,61030,61030,61030,60998,60997,60933,60966,60903,58566,55909,55493,55493,55493,55493,55493,60517,60677,61030,60997,60998,61030,61029,60998,61030,60965,58565,58021,55493,60517,61029,61061,61062,61093,58533,55813,55493,55493,55493,55493,57797,60549,61062,61062,60518,57893,55493,55493,55589,50178,50179,52291,54404,50178,50147,50147,48034,50211,50211,50147,43777,48003,43810,52259,54340,52292,52259,52259,52259,52259,54436,54468,52291,52324,54372,50147,52260,48002,52292,41730,45891,45954,50147,48035,48034,45890,43811,41698,41762,37505,39585,35425,35425,39586,35425,29153,35393,39650,33217,35426,29153,27042,27073,29090,29153,22850,20801,22849,22849,16609,18657,20802,22850,20769,20801,27041}, {65425,65492,65427,65326,65260,65327,65359,65294,65326,65294,65326,65360,65327,65294,65360,65359,65326,65260,65358,65392,65327,65358,65326,65292,65227,63081,60967,60999,55493,55493,55780,60549,61062,61094,61062,61062,58501,55493,55493,55493,55493,55589,58501,60614,60678,60741,60741,60742,60743,60773,61061,61062,61030,58469,55493,55493,55493,55493,58085,60486,58596,58597,60678,58629,58630,60646,60901,61095,61064,61030,58534,55493,58309,61061,61094,61062,61062,63046,58404,55493,55493,55493,55525,60517,58918,61062,60933,58405,55493,55493,55525,52260,52259,48035,50146,50179,48066,50115,50147,48066,41730,43810,48034,48034,45954,48098,48067,50211,52259,52259,52292,54404,54403,54404,54404,54371,54372,50146,54372,48034,50147,54372,52259,45890,48035,54404,48099,39617,41665,37506,35425,35425,48003,37506,31201,33282,37474,39586,37537,37474,33314,39585,39650,33314,29154,22849,27074,27073,29153,20834,24961,27042,22849,16609,20769,18658,22849,16642,20833,29121}, {65359,65426,65459,65392,65326,65294,65326,63311,63311,65360,65326,65327,65327,65326,65392,65359,65359,65293,63311,63311,65326,65358,65358,63277,65226,63112,63080,60552,55493,55525,58598,61094,61062,61094,61062,58533,55940,55525,55493,55525,55525,55525,55556,55557,55556,55557,55557,55557,58437,61094,61062,61062,60549,55525,55525,55525,55525,58470,60902,61030,58436,55557,55557,55557,55556,58469,61093,61062,61062,60549,55557,55621,58597,61094,61094,61094,61093,58437,55493,55525,55525,60294,60677,61062,61030,60485,55589,55525,55493,55653,56548,52259,52259,48066,48034,48034,45954,45922,45890,45922,41698,43809,50180,50147,50178,48099,54403,52291,52291,54340,52291,52291,50179,52323,52323,52291,48002,50147,52227,50115,48034,50179,43841,45922,39585,41730,35361,35394,37506,35426,31201,35458,35426,37505,39618,37537,35393,39618,33346,37537,33313,37505,33345,31233,27073,20834,24962,27010,29122,20802,20768,27074,18690,16609,24993,20801,22849,16609,16610,24962}, {65327,65392,65425,65393,65392,63245,65293,65392,63344,65393,65391,65360,65327,65326,65392,65327,65359,65326,65391,65358,65325,65326,65325,65292,63146,61064,65193,55525,55493,58277,60742,61094,61094,61094,63078,60550,55525,55525,55493,55525,55525,55525,55908,58374,58437,58406,58405,58437,58630,61030,61094,60966,58308,55493,55525,56293,56453,61029,59013,60612,55525,55525,55525,55493,57988,60966,61062,63142,60870,58244,55525,60517,61093,61093,61094,61062,60806,57988,55493,57957,58597,63110,61062,58662,58085,55525,55493,55493,54371,56612,54468,45953,50146,48034,43809,48034,48002,50147,45921,45890,50211,52323,48065,50146,52259,48034,56548,56516,56516,54371,52259,52291,50146,45923,45955,48067,48035,48066,50179,52260,50115,41730,39585,43778,37473,41762,41730,39617,33281,31201,33345,37506,33313,41666,41666,33281,37506,39618,35426,39618,33314,33314,29186,31201,22849,20770,27009,31234,29121,20802,20802,22849,20769,14498,18690,18721,18626,14497,18657,24993}, {65393,65392,65392,65359,65392,65358,63278,65360,65392,65393,63377,65393,65359,65326,63311,65327,65359,65326,63278,65293,65325,65326,65259,63113,65194,63145,55685,55493,55588,58501,61093,61093,61062,61126,60518,55493,55493,55493,55493,55493,55556,58501,60933,61062,61094,61094,61094,61094,61094,61062,61062,58534,55493,55781,58501,59013,61062,61062,60838,58148,55493,55493,55493,55493,58596,61061,61093,61094,58469,55493,58212,60965,61094,61093,61062,61094,58500,55556,60517,61030,61061,60997,60549,55493,55493,55525,51844,54372,54403,54467,52387,43841,48002,48066,45922,50146,48002,52259,50178,48034,48066,50211,52324,52259,48066,48067,52323,54468,56484,52258,54372,52259,54404,48066,45954,45890,45922,52260,54372,52259,48034,39650,37537,43809,41666,50179,48035,47971,35426,33345,35393,41698,41698,45922,39649,33346,31233,33346,31265,31201,29122,24961,24961,35362,24929,22882,29122,31233,24930,18721,20737,24961,22849,16577,24962,20801,16610,16578,22881,29122}, {65426,65458,65393,65294,65326,65360,65359,65294,65359,65361,65392,63376,65359,63212,65293,65325,65326,65325,65294,65325,65293,65292,63146,63145,65226,65193,55493,55525,58533,60966,63142,61094,61094,60742,58341,55493,55525,55525,55493,58341,58662,59013,61062,61030,61062,59013,61062,61094,61062,61062,60901,55909,55525,58469,61029,61031,61029,61062,58469,55525,55525,55525,55525,58404,61094,61063,61062,60549,55748,55525,58533,61093,61093,61093,61062,58565,58502,60804,61061,61093,60581,57892,55525,55493,55653,56548,54435,56516,52291,54403,54371,52259,50178,50179,50178,45986,43842,50211,48066,52260,48098,50179,45954,48034,52226,50147,50179,52291,54404,52258,50179,45954,52291,54468,54436,52259,48035,45922,50147,52291,48035,45890,50147,48035,48034,48002,43842,35425,37505,43843,35424,45859,50114,41698,29121,27042,29153,31233,27010,33249,33281,33346,27009,29122,18722,20801,20738,29153,18689,16609,16641,27009,18721,16609,27042,18689,18690,27041,27041,18689}, {65425,65459,65426,65326,65359,65391,63310,63244,65326,65392,65393,65360,65392,63278,65326,65326,65359,65392,65358,65359,65292,63178,63113,65194,63178,55557,55493,57957,60582,61094,61094,61094,61061,60613,55525,55493,55525,55653,60549,61030,58886,58372,58117,58117,58181,58404,58501,61093,63110,63110,58437,55525,60517,59013,61094,61093,59014,58630,55717,55493,55525,55525,57733,58789,61061,61062,58564,60485,55493,58405,61094,61062,61061,61062,60965,58532,61093,63110,61030,61127,58500,55493,55493,56036,58757,52322,54436,54403,50210,54403,52323,50146,45922,45954,52291,52323,50179,52323,50177,50178,52259,45921,48067,54436,54372,45921,43809,45890,54403,50211,45922,45954,48067,56548,56548,50210,50179,48066,45922,43842,41697,45891,43842,41697,48067,48035,43843,39586,41698,41698,39585,39586,37506,29185,27042,33345,35393,35394,27041,35425,39587,33345,27041,27041,24961,27042,20738,24993,16577,14465,14465,29154,22850,20769,27041,24961,20769,33281,27073,16641}, {65425,65458,65458,65425,65426,65458,65425,65326,65326,65391,65392,65358,65392,65359,65359,65359,65358,65327,63277,65326,65292,63178,65226,65227,60553,55493,55525,58501,61094,61094,61094,61093,58597,55781,55525,55493,58405,60838,63078,61093,58533,55525,55493,55493,55493,58470,60998,61094,61062,58596,55588,55845,58661,61094,61062,61062,61126,60421,55493,55493,55525,55525,58437,58981,63047,58437,58020,55493,57925,60774,59013,61094,61061,61062,61093,61063,61029,60549,58757,61062,60902,58245,55493,55493,56612,50242,52323,54435,56548,54403,48099,43841,41730,48034,52324,52323,50243,54468,54436,50211,48098,48066,50211,54403,52291,50146,52260,52227,52259,48066,41698,41729,45890,45953,43843,43778,45923,48097,41698,43810,41730,37505,41729,43778,45890,41698,37473,35393,37473,37538,35426,29153,29154,27074,33314,39553,41666,35393,31234,37538,41729,29121,22818,22881,31201,31265,29121,27073,14529,14466,14498,22849,27073,31233,27009,27042,20834,29154,22881,16577}, {65458,65457,63409,65459,65491,63475,65491,65393,65359,63276,65325,63245,65326,65359,65358,65358,65293,63211,65292,65259,65292,65292,65259,63210,55525,55493,60422,60902,61062,61093,61094,60966,58533,55493,58022,60518,63142,61061,61093,60613,57893,55493,55493,55493,55589,58565,61062,61094,61000,58245,55493,60581,61093,61062,61062,61094,58501,55493,55493,55493,55493,58085,60997,60517,60486,55493,55493,55493,60581,61093,61094,61094,61094,61093,61093,58597,58053,55493,60549,60965,63110,60613,55845,55493,55621,52355,54500,56580,56580,52324,43842,41698,45954,52291,50178,52291,52291,54404,50178,45954,50210,56548,54467,54436,50147,45889,52260,52290,48035,48065,41730,37537,50115,45954,37473,43810,52259,54436,50179,39618,39618,37442,41698,48067,45890,45891,41698,37537,41666,37473,35393,29122,29122,31265,35426,43810,35425,35425,29153,35361,31202,24961,22882,22881,31202,29153,33282,35394,18690,14465,12450,18689,31201,35426,27041,29153,16609,20770,16578,16545}, {65425,65359,65425,65491,65491,65491,65458,65424,65424,63342,65325,65258,63211,65325,65392,65358,65326,65324,63211,65193,65292,65292,63178,55685,55525,55620,60517,61094,61094,61062,61093,60549,55493,55493,60614,63110,61094,61062,60998,58533,55525,55525,55493,55493,60549,61061,61062,61061,58534,55493,58277,58918,63142,61062,61030,60902,58149,55493,55493,55493,55556,58437,58502,55525,55493,55525,55525,60421,58949,61061,61062,61094,63078,60934,58566,55525,55525,55493,55493,58501,63143,61063,58469,55493,55493,58693,58790,56644,56580,48099,39618,43874,52291,54467,50211,50211,48034,48034,48098,52291,54500,56580,54499,54468,45954,41697,56549,54467,52259,48034,43810,39618,39586,43809,41730,39617,45922,45987,56483,48035,33313,31265,39617,45890,41666,41665,39618,41729,41697,35458,39586,35362,35426,45923,43778,48066,37537,31202,31233,33313,29121,33314,33281,22882,29122,31234,31169,29121,16609,16513,16641,22850,27073,35426,27041,24929,18625,18657,14498,14465}, {65393,65359,65458,63443,63410,65425,65425,65458,65458,65457,65425,65326,63210,65292,65392,65359,65293,63212,65260,65258,65226,65258,65227,55493,55493,58533,61030,61094,61126,61094,58661,58245,55493,58534,61126,61094,61062,61094,60838,60902,60870,60805,58726,58694,58821,61094,61094,58662,55717,55557,58598,61095,61062,61061,61094,60549,55493,55493,55493,55493,58437,58213,55493,55493,55493,55493,55493,58596,61062,61094,61093,61126,58436,55781,55493,55493,55557,55846,55493,55557,58565,61061,61094,60549,55493,55525,56645,58693,54436,41761,39649,52291,50210,52291,50179,45954,45954,48066,50210,56548,56612,54466,56580,50243,48034,50211,56547,50178,50146,52323,52324,45986,45954,48066,45954,45890,48035,37505,48002,39617,33282,31202,39554,43778,41730,41697,41666,43778,41729,35458,37537,33345,31233,37473,37505,37506,35425,33282,41730,41698,37474,41698,39618,27042,35425,35362,35426,27074,18657,14498,16610,29153,29122,31202,20737,22882,14497,18722,14465,10305}, {65359,65359,65492,65493,65458,65425,65425,65458,65458,65457,65425,65359,63146,65226,65325,65260,63178,63243,65325,63243,63211,63243,55525,55493,57925,58597,61094,61094,61062,61062,60614,55525,55941,60870,61093,61094,61094,61093,61062,61094,61062,61062,61094,61061,61062,60966,58469,57989,55493,56420,61062,61094,61094,61062,58661,55588,55525,55493,55493,55493,55493,55525,55493,55493,55493,55493,58500,59013,61062,61061,61062,58661,58053,55493,55525,50242,50243,54436,55589,55525,55813,60677,61062,60838,58246,55493,55525,54435,45954,41730,45922,50179,50179,50210,43841,48098,52323,52323,52290,56548,56548,54500,56580,56580,54403,50178,54436,52291,48099,52323,54403,50178,48034,50179,52291,48098,45922,39586,48035,41730,37537,39618,43746,45858,45922,43842,37537,39617,45890,41634,33280,35394,37474,45954,35394,29185,27042,29184,35425,37537,37538,43809,48067,39586,39585,37474,35393,22881,18690,16578,24929,35426,31202,27009,24993,31266,14465,18722,16546,10338}, {65425,65425,65491,65492,65458,65459,65491,65458,65425,65424,65392,65325,63178,63211,65358,65326,65260,65293,65360,63310,65292,58216,55493,55493,58598,61094,61094,61061,61094,60582,55589,55525,58533,61094,61094,61126,61093,61062,61094,61126,61062,61062,61062,59078,58501,58469,55525,55525,57956,58821,59013,61062,61029,61062,58374,55525,55525,55525,55493,55525,55525,55525,60806,55493,55525,58085,60869,61029,61061,61062,63142,58500,55525,55493,58693,54500,54500,54468,52355,55524,55493,58277,60998,61094,58501,57861,55493,53669,43874,48067,50210,52259,48066,50147,48034,52291,54499,56580,54468,54435,54435,54435,52322,54468,56548,50178,50211,50179,43810,48066,50179,48035,45889,48002,48066,45890,45890,39586,43778,35362,31202,33345,43778,37537,43778,37505,29121,27073,35425,35426,31265,37506,35394,43810,39586,33346,24962,33314,35457,35362,39586,43778,35457,33345,33314,39585,35426,22850,22849,24962,35393,27041,20769,16642,24929,37538,18690,16609,14498,12385}, {65491,65426,65425,65425,65392,65425,65459,65458,65425,65392,65358,65326,65326,65326,65359,65360,65293,65293,65293,65293,65226,55525,55493,60422,60805,61094,61094,61062,60934,60517,55493,60423,58501,58437,60517,58533,58501,58469,58469,58469,58469,58501,58469,58566,55588,55493,55493,55493,60549,58468,58469,58470,60517,60550,55493,55493,55493,55493,55493,55493,56613,56645,55525,55493,55493,58533,58566,58501,60581,58533,60582,55525,55493,55750,58757,58757,58789,60870,58757,56613,55493,55493,58533,58502,58533,58535,55493,55493,52099,54403,50211,48066,48066,50179,50179,50178,52355,56613,54435,50179,54404,52291,48066,56484,56580,54435,52259,52259,41698,52291,45890,39618,50147,48034,43809,37506,39586,37505,37537,35393,37506,45922,45858,43777,41698,35393,29153,24993,24993,31170,24930,24961,27073,31233,35361,35393,29089,29121,29186,24929,35394,35425,24993,35393,35426,31298,39522,22881,27073,33345,29122,20801,22818,24993,24962,45858,20801,20801,14497,14497}, {65458,65458,65393,65393,65424,65425,65459,65459,65393,65393,65359,63276,65326,65325,65293,65326,63244,63211,65293,65259,55589,55493,55653,58469,61126,61094,61094,61094,58501,55557,55493,55525,55525,55493,55525,55493,55525,55525,55493,55525,55525,55525,55525,55493,55525,55525,55525,55525,55493,55525,55525,55525,55525,55493,55525,55525,55525,55525,55718,60870,60902,56357,55525,55493,55525,55525,55525,55525,55493,55525,55525,55493,55525,56612,56612,56612,58757,60870,58789,60903,58150,55493,55525,55493,55525,55525,55493,55493,55493,50211,48066,52291,52323,54404,52258,54371,56548,56612,54435,50178,54435,54436,45953,52291,54468,52355,48066,50146,37537,45922,41730,41697,48067,45922,43809,43810,45890,43842,39618,41730,43873,50147,48035,41762,39618,45955,37506,35458,39554,35458,39585,24961,27009,22882,22882,24961,24994,24961,24962,20769,39586,37537,29154,37538,33314,29152,35393,27041,37506,41666,29122,29090,27073,27073,22882,33345,24897,20769,16578,14466}, {63378,65458,65393,65360,65425,65393,65458,65459,65425,65393,65360,63277,65327,65293,63212,65293,65327,65293,65260,62922,55493,55493,60549,61094,61061,61094,61093,60709,58117,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55525,55493,55493,55493,55493,55493,55493,54340,54500,54500,56580,56676,58821,60902,60967,60934,55782,55621,55589,55621,55589,55589,55653,53573,55653,56548,56579,54467,54403,52290,52323,56580,54499,54500,50211,54435,52290,50179,48034,50210,56580,52324,50179,39681,43811,50179,45954,45922,43842,50180,52259,50147,45922,39586,43843,50147,48002,45922,41698,37473,48035,43810,48035,50147,45890,37570,33345,29154,27009,29121,35362,27041,29089,29122,22849,41665,47971,43810,45922,29185,33346,31201,35458,27041,31202,27073,27074,27041,27010,20802,24929,27041,22914,16609,12417}, {65427,65459,65393,65358,65393,65425,65457,65459,65457,65392,65392,65360,65425,65359,65294,65293,65259,65259,63212,55525,55493,58085,58597,61062,61093,61094,61062,58533,55493,55525,55493,55525,55525,55493,55525,55493,55525,55525,55493,55525,55525,55525,55525,55493,55525,55525,55525,55525,55493,55525,55525,55525,55525,55493,55525,55525,55525,55525,55493,55525,55525,55525,55525,55493,55493,55621,52387,54468,56580,54500,54468,50243,48130,52323,52387,58693,58822,60934,60966,60999,60902,58790,54532,54499,58757,58789,54468,50179,50178,52355,58725,54500,56580,54467,52355,54403,54435,56580,56613,50210,54436,54403,48098,50115,54371,56547,54468,52355,54371,56483,50115,43842,50147,52291,52259,48002,50211,52259,41698,43810,50116,45890,50147,48003,45923,45923,45923,43810,39650,37506,31234,31201,35425,37506,37506,33313,24962,31201,29121,22882,29154,35394,43873,39554,27041,39618,39586,35393,22882,20769,35426,22849,24961,24898,20801,24961,24993,18626,14465,14465}, {65459,63411,65393,65327,65360,65359,63345,65425,65424,65359,65358,65392,65425,65392,65326,65294,65195,63146,60328,55525,55493,58501,61094,61062,61094,61093,60549,55557,55493,55525,58532,58501,58469,58501,58533,58501,58469,60550,58469,58534,58501,58437,58500,58437,58437,58502,58501,58502,60582,60582,58469,58469,58501,58502,58469,60518,60518,60518,58502,58501,55525,55525,55525,55493,52324,56645,54500,50179,50211,52323,56580,56644,56548,54532,56612,56645,58790,60934,60902,60870,58821,58756,54500,56548,58725,58724,52323,54371,54532,56580,60805,56580,54404,52322,52323,52323,54403,54436,54404,48066,48067,52291,48066,50146,52227,52291,54467,54436,54500,54371,41729,41730,48034,50147,50147,50115,50115,45954,43810,45922,50147,45922,52291,45890,41698,43810,43778,41730,45922,39618,33314,35393,33281,39617,41698,33314,33346,29089,22882,24961,27074,29121,31201,24962,20737,33378,41602,29122,22850,24897,37537,31234,22849,24961,18626,18689,20769,16609,12386,14498}, {65426,65426,65393,65360,65360,65359,63345,63344,65392,65327,63245,65326,65360,65359,65326,65326,65293,63180,55493,55525,58437,60902,61094,61094,63110,60870,58373,55493,55493,57988,58501,61061,61062,61062,61094,61062,61062,61094,61061,61062,61062,61062,61062,61063,61062,61094,61062,61094,61062,61062,61094,61094,61062,61062,61062,61062,61030,58469,57861,55493,55525,55493,53924,52324,54436,56645,54532,56613,56645,58758,60870,58789,58725,60870,58789,58789,60870,58821,58789,58757,56613,56580,54468,54435,52355,54468,52323,52387,56580,54499,56612,56165,55717,52323,56548,50178,45954,48066,50146,50146,48066,52259,50179,52259,52258,50178,54404,52290,52355,50178,43874,39650,45954,45921,50115,48035,45890,43810,48034,43809,41698,41698,48099,43842,39618,52259,48067,39649,45954,45955,41730,45922,35394,39619,39585,37538,37506,35394,29154,33314,33281,35457,33314,29153,33377,31201,37473,24961,22882,22913,29121,33281,20770,18689,16577,16578,18658,16609,16577,14497}, {63344,65393,65393,65393,65360,65359,65425,65425,65425,65360,63245,65293,65293,65326,63310,65391,65393,55525,55493,55747,58534,61094,61094,61093,61094,58501,55525,55525,55524,58501,61062,61094,61094,61094,61094,61094,61062,61094,61062,61094,61062,61062,61062,61094,61094,61062,61062,61062,61094,61094,61062,61094,61062,61062,61094,58598,60486,55525,55493,55493,55557,54500,54532,54532,54468,58757,58789,58757,56709,58757,58757,56644,56644,60902,60902,60902,58822,60870,55718,55493,56485,56580,50243,54435,54467,54435,56580,56644,56613,56548,55493,55525,52291,48098,52290,52323,52324,50179,48066,48035,50178,52259,45921,45953,48066,48034,48034,52324,58661,54435,48067,35393,43810,45922,45922,43809,45858,45922,41698,39553,41666,43810,56516,50178,37441,50212,43810,39618,43810,45922,41697,41698,39618,37505,37506,37505,41665,39619,31234,33281,37506,41731,31169,31265,41666,35426,43778,22786,24962,20801,18690,24929,18657,18689,16578,16577,22881,20770,16578,22849}, {65392,65392,65360,65426,65392,65359,65425,65425,65426,65425,65326,65260,63244,65359,65426,65459,63057,55493,55525,58501,63110,61094,61094,61093,58661,57925,55525,55525,58438,60806,61094,61062,61094,61094,61126,61093,61093,61126,61094,61094,61094,61093,61093,61094,61093,61126,61126,61093,61126,61063,61094,61062,61062,60998,58534,55621,55525,55493,55493,54404,56580,56645,58757,60870,58725,60902,60935,58854,58757,56644,56580,56580,56644,58822,60902,58822,60806,55493,55493,55685,54467,56580,52355,54436,56612,52355,54499,54436,55781,55493,55525,54212,54404,52291,48098,52290,52291,52258,50179,48034,45922,48034,43810,37505,39554,43777,45922,48034,54436,52322,52259,39650,41730,43810,43810,45891,48003,45954,48067,53541,55493,55493,55493,55493,55493,55493,55493,55493,55493,49924,43810,35425,37506,37505,39618,39585,41697,35393,27106,29154,41762,41730,37538,39618,39618,31234,35394,20801,18690,20705,16610,20769,22881,18658,18690,20769,20770,22881,24929,27041}, {65458,65426,65393,65360,65359,63312,65459,63442,65491,65459,63278,65292,65326,65426,65459,65458,55525,55493,58181,60774,63142,61062,61061,61062,58501,55493,55525,57764,58533,61094,61094,61094,61062,60517,58534,58501,60550,60581,58501,58501,58501,58534,58469,58501,58534,58501,58501,58534,61095,61062,61094,61094,58438,58277,55493,55525,55493,55653,56612,56612,58822,58822,58789,58757,56644,58757,58822,58821,58757,58725,58725,56612,54500,56677,58725,55557,55493,55493,55525,56580,54500,54500,56613,54500,56548,52322,54340,55493,55493,55493,55557,54403,52260,50242,52290,52323,52290,54435,52290,54435,52291,54403,54403,48034,45921,50147,48002,43810,45986,45953,50147,43810,48003,48066,52259,54404,54371,52101,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,48003,50179,41698,41730,37537,39650,41666,41730,29185,27074,37505,45923,31265,37506,41666,22849,24929,22818,20738,22818,18657,16577,20801,24929,18690,18657,18689,20706,20769,22848,22849}, {65392,65394,65393,63311,65325,65359,65393,65458,65425,65360,63245,65294,65360,65426,65459,55880,55493,55557,58501,59078,61094,61094,61094,60518,55493,55493,55493,58597,61061,61062,61094,61062,58630,58309,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55621,58533,60870,59013,61094,61094,60741,60550,55493,55493,55493,55525,54596,56645,56612,58758,60967,60935,58822,56709,58725,58757,60870,60934,58789,58757,58757,56645,56612,56070,55525,55493,55493,55493,56356,58725,56644,56644,56612,54467,56548,55557,55493,55493,55493,55493,52323,48066,48066,52323,56548,56548,56580,56548,56548,54467,45953,50179,50146,48035,48034,48034,50179,48002,41697,48035,50146,52259,50115,48034,52259,52258,55525,55493,55493,55493,55493,58501,60549,58502,60517,55941,55493,55493,50147,45922,50147,45954,37537,41730,43811,37506,45859,37506,24961,37506,35393,24930,27010,29185,31202,27073,24897,27073,20802,16578,14465,22882,24930,16577,16578,16545,14465,18689,27043,16609}, {65393,63344,65425,65425,65391,65359,65359,65360,65326,65327,65391,65361,65424,65392,63216,55493,55525,58502,60966,61062,61126,61061,58757,58308,55525,55493,58181,58693,61095,61062,61062,61030,58565,55493,55525,55493,55525,55525,55493,55525,55525,55525,55525,56293,60581,61125,61094,61093,61030,60581,58022,55525,55525,55493,56165,58757,60902,58790,54532,58790,60934,63015,60902,60902,60903,56709,58789,60902,60935,60935,58822,56677,55493,55525,55525,55525,55493,55525,60870,60902,58821,58789,56644,56165,55493,55525,55525,55525,55493,53957,54435,50210,50211,50211,54403,56612,56580,54435,54499,56580,52259,50211,45954,43810,50147,48066,52259,48034,45922,45954,48066,52259,45954,45922,51909,55493,55493,55493,58182,55493,58053,61061,61061,61062,60549,55493,55493,53733,45922,39617,48035,54372,37505,39586,35425,29121,35457,31201,22882,27009,27042,27041,33313,37506,37506,33314,29058,37538,20801,14497,14434,16577,20737,12417,14465,16610,14497,16577,20737,16577}, {65426,65427,65459,65458,65459,65425,63277,65294,65359,65394,65425,63410,65426,65393,55525,55493,57860,60581,61062,61093,61094,61062,58533,55493,55525,55493,58501,61094,61062,61093,61094,58501,57893,55493,55525,63145,63112,60999,55493,55525,55525,57828,60485,60965,61062,61094,61094,58630,60550,55493,55525,55493,55525,60902,58822,58822,63047,60871,58758,60870,58854,58822,58789,58757,60903,58822,58789,60870,58854,60935,55557,55493,55493,55493,60741,55493,55525,58757,60902,60902,60901,60870,55525,55493,55493,57893,56357,55493,55493,52323,52323,50211,52323,50178,54404,54435,56516,54435,54435,54435,50146,48065,50179,48098,52259,52258,50179,45954,41697,43777,48066,54404,52291,55525,55493,55525,55685,58469,55493,55493,58598,61094,61061,58468,55588,55493,55525,41698,45923,39586,39586,41730,41666,33345,27041,24930,24961,24930,29121,29153,20802,20769,33281,37506,24930,29185,27010,24961,16578,14465,14465,16610,18658,14498,16545,18689,20737,16609,20770,20769}, {65459,65492,65458,65391,65392,65392,65326,65359,65393,65425,65393,65393,65392,60427,55525,55493,60550,61094,61094,61094,61062,58597,55780,55493,55525,60550,60999,61094,61062,61062,58629,58469,55525,55493,60647,63210,55749,55525,55493,55525,58437,60710,61094,61061,58982,58885,58469,55813,55493,55525,55493,58502,58822,60902,60967,58789,58757,56645,60838,60871,60870,58789,58757,56644,58758,60870,58725,58757,56326,55493,55525,55525,58149,58501,55525,55493,57958,58821,58789,58790,55814,55493,55525,55620,60517,58437,55525,55493,52259,52291,50211,54403,52323,54467,56548,52354,52323,50146,48033,48066,48098,52226,54371,52291,52259,50179,45921,48002,43809,41730,48034,53669,55493,55525,55525,60453,58406,58213,55493,58469,61030,60742,60453,55493,55493,55493,37473,37474,39586,37474,29121,29121,27009,22850,24994,27041,35362,31201,27074,26978,18657,16609,20738,20801,24930,22849,20737,20737,20770,16577,16578,18657,31234,18657,16641,20769,18721,16642,16577,16609}, {65460,65458,65392,65326,65392,65459,65426,63476,65458,65391,65358,65392,65426,55525,55493,58437,60838,61126,61094,61062,60965,60485,55493,55493,57893,60646,61094,61094,61062,61062,60581,55493,55493,55493,60551,55493,55493,55493,57925,58565,60997,61094,61094,61062,58565,58437,55493,55493,55493,55589,58822,60902,63047,63047,60999,60902,58757,54564,56644,54564,54532,54532,56613,58693,58725,58758,54532,55525,55493,55493,55781,58468,58469,60293,55493,55525,60870,58789,56390,55493,55493,55493,58245,58534,58501,58021,55493,55685,52323,52291,50210,56580,52323,54500,56581,52355,54436,52291,52291,52323,50178,50115,48067,45954,45889,45953,52323,54436,41665,41539,55493,55525,55493,57861,58469,61030,58469,55493,57861,60582,58438,57733,55493,55493,55493,55525,31202,29185,31201,27009,24962,27074,22882,27009,29120,29153,33281,29121,22850,31201,20769,18689,24930,22881,29154,24961,18722,22849,22881,26978,22849,22850,27073,18658,16546,18657,20738,22914,22850,18690}, {65426,63311,65393,65393,63411,65492,65459,65524,65492,65425,63311,65424,55525,55493,57765,60614,61093,61093,61094,61061,60549,55525,55525,55493,58501,61094,61094,61094,61094,58469,58117,55525,55525,55493,55525,55493,55557,58501,58629,61093,59046,61094,60774,58533,55621,55525,55525,55525,55493,55525,55525,63015,63080,55686,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55525,55525,55493,58501,60677,61094,58470,55493,55525,55525,55525,55525,55493,55525,55621,58533,60998,61030,58534,55525,55525,55525,55525,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55556,58565,60901,61061,58533,55652,55493,58471,56068,55493,55493,55493,55493,55493,31233,49510,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,47460,33282,53477,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,45540,29121}, {65491,65425,65426,65457,65458,63409,65425,65493,65526,65525,65458,60621,55493,55493,58533,61094,61094,61094,61095,58693,58084,55493,55493,58500,60902,61062,61094,63142,58757,58533,55493,55493,55493,55493,55493,58084,58438,61030,61062,61063,61094,56421,58246,55493,55493,55493,55493,55493,55493,55493,57926,58439,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,57990,58469,61061,61062,58596,57765,55493,55493,55493,55493,55493,55493,58469,58565,59013,61093,58533,55589,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,58341,58469,60997,61062,58951,58437,55493,58277,55493,55493,58116,60485,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,47557,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,31202,29153}, {65492,65491,65425,65426,65459,65392,65391,65491,65526,65526,65491,55493,55493,58213,60774,61126,61094,61094,61062,60614,55493,55493,55716,58533,61094,61062,61094,61094,58501,55557,55493,55493,55493,55620,58534,58598,61093,61062,61062,60645,58502,58501,58245,58181,58117,58117,56068,55493,55493,55493,55493,55493,55493,55653,58468,58405,58405,60422,58373,58373,58373,58373,58405,58342,58373,55493,57701,60549,61062,61062,61030,58437,58469,58533,58501,60581,58501,58501,58502,61030,61062,59046,60773,58438,58533,60549,58469,60517,58501,58533,58533,58565,60518,58501,55589,55493,60262,60517,58501,58501,58501,58501,58469,60581,60581,58533,58501,60581,55493,58373,60966,61093,61062,59014,56421,55493,55493,55493,57861,58501,58436,55525,55493,55493,55493,55493,55493,58181,58469,60549,60485,58469,60549,60581,58469,60582,58501,60549,55493,55493,55493,55493,55493,55652,60517,60613,60613,58533,58533,58565,58501,58534,58565,58501,58533,55493,55493,31202,27041,24962}, {65492,65523,65491,65491,65491,65424,63311,65425,65492,65492,55654,55493,55493,60550,61094,61094,61062,61094,60550,55556,55493,55525,58596,63142,61062,61093,59013,58533,58181,55525,55493,55525,56165,58501,61030,61062,61062,61094,61062,61094,61062,61062,61094,61062,61030,58758,60453,55493,55493,55493,55525,55525,58277,60613,61094,61094,61062,63142,61062,61030,61061,61093,61061,60613,55909,55525,58469,61062,61062,61061,61061,61062,61094,61094,61062,61094,61094,61062,61062,61062,61062,61094,63142,61093,61094,61094,61094,61061,61062,61029,61062,58533,58342,55493,55493,58501,58950,61094,61093,61094,61062,61094,61094,61062,61094,61062,58501,55493,55652,60517,61030,61094,61062,58629,55940,55493,55493,58438,60935,60901,58117,55493,55493,55493,55493,55621,58501,61093,61126,61125,61126,61094,61094,61062,61094,63110,60869,55973,55493,55493,55493,55493,60357,60613,61094,61094,61094,61126,61094,61094,61062,59014,61094,58502,55493,55493,41348,24930,22882,20801}, {65491,65492,63445,65525,65525,65490,65457,65458,65492,63219,55493,55557,60582,63078,61094,61094,61094,60933,60357,55525,55493,58373,58854,61093,61094,61094,60998,58533,55493,55525,55557,60581,58501,60998,58950,61030,61062,61062,61062,61062,61062,61062,61062,61062,61093,58500,55525,55525,55493,55525,55749,58469,58437,58470,60517,60517,60549,60550,58501,58437,61093,61061,63013,58534,55525,58116,60837,61094,61093,60773,58437,58373,58341,58341,58373,58436,58502,60484,63142,61062,61061,56452,58373,58373,58341,58373,58309,58309,58341,58309,58309,55621,55525,55525,60261,60325,60357,58341,58341,58341,58372,58469,60934,61062,61062,60870,58276,55493,58501,61062,61094,61062,60998,60549,55493,57989,60549,61061,61094,58533,55493,55493,55493,55493,58277,58790,58949,58501,58277,58245,58341,58405,60517,61061,61061,63110,58533,55493,55493,55493,55653,60485,63078,60581,58340,58245,58245,58309,58468,58533,61126,61062,60902,58181,55493,55524,22848,18689,20769,18721}, {65426,65492,65526,65526,65527,65525,65524,65492,65524,55525,55493,57925,58502,61062,61094,63174,63174,58533,55525,55525,55556,58438,61093,61062,61094,61094,60517,55557,55493,55525,58148,58213,58277,58341,58373,58405,58437,56388,58374,60549,60966,61063,61094,61062,60709,58084,55525,55525,55493,55525,55525,55525,55525,55493,55525,55525,55525,55525,57925,60838,61062,61126,58437,55525,55525,58468,60997,63141,61062,58469,55525,55525,55525,55493,55525,55525,58373,60869,61061,61062,63078,60517,55525,55525,55525,55525,55525,55525,55525,55525,55525,55525,55525,55525,55525,55525,55525,55525,55525,55525,55525,58598,61062,61062,59046,58437,55493,58148,58725,61030,61062,61062,60485,55588,55525,58597,59013,61062,60742,57764,55493,55493,55908,58565,61062,61061,58501,55493,55493,55493,55493,58437,63015,63110,61094,58565,55557,55493,55493,58468,60806,63143,61029,58565,55493,55493,55493,55493,60550,61062,61062,61062,58469,55493,55493,18721,27042,20801,29122,18689}, {65392,65525,65528,65528,65495,65524,65526,65525,57961,55525,55493,60582,61125,61094,61094,63110,58693,57829,55525,55525,58565,61062,61094,61094,61126,60710,58341,55493,55493,55525,55493,55525,55493,55493,55525,55493,55525,55493,55813,60645,61094,61061,61062,61094,58501,55525,55525,55493,55493,55493,55525,55781,58596,58533,60613,60645,60645,58629,58501,63142,61062,58693,58341,55493,58437,60997,61062,61061,58533,55620,55525,55621,54181,55493,55493,55652,58533,61030,61062,61094,60550,55525,55493,56134,56261,56229,56133,54021,55974,55493,55525,55493,55493,55557,58437,60742,60773,60870,60838,60837,58725,61062,61093,61061,60581,55877,55493,58437,61093,61094,61029,58821,58245,55493,58501,61062,61030,58982,60519,55493,55493,60518,60966,61062,61063,60742,55621,55493,55493,55493,57860,60614,61061,61093,60934,58309,55493,58020,58533,63141,61093,63141,60549,55525,55493,55493,55493,58180,60901,61062,61094,60613,55589,55493,51493,22849,18721,22882,29121,16577}, {65392,65493,65529,65527,65526,65525,65527,63412,55493,55525,60486,60933,63141,61062,61062,61062,58308,55525,55525,58214,60742,61094,61093,61094,63078,60517,55525,55525,55493,55718,55654,55589,55589,55525,55525,55493,55525,55525,60486,59046,61094,61062,59014,58500,55715,55525,55525,55525,55493,55588,58469,61062,61094,61062,61094,61094,61062,61094,61062,61094,61094,58500,55525,55845,58565,61093,61061,62950,58277,55525,55525,56645,58246,55493,55525,58469,61061,61094,61093,60741,58117,55525,55589,54501,56677,58758,58758,58726,55589,55525,55525,55525,60357,58597,61062,61061,61062,61094,61094,61094,61062,61062,61094,61030,58469,55525,60518,61062,61062,61094,61126,58437,55493,57925,60965,61093,61094,58469,55493,55557,58469,61094,61094,63142,61061,58468,55493,55493,55493,55493,58501,61094,61062,61094,58469,55493,58053,58693,61093,61094,61061,60805,58052,55493,55493,55493,55493,58405,61094,61062,60998,58340,55493,55493,18722,22882,18689,22945,27009,14530}, {65392,65492,65528,65527,65527,65527,65529,55525,55525,55621,60581,61126,61094,61094,63142,60613,55525,55525,55525,58533,61094,61094,61093,61061,60581,55748,55525,55525,63276,63112,60967,63145,65259,63177,63080,55493,55525,58405,60901,61094,61093,61094,58886,58405,55525,55525,55525,55525,58244,58756,60774,60774,58757,58757,60869,60870,58854,61093,61062,61094,60549,57828,55525,58533,61094,61061,61093,58468,55493,55525,58694,56645,55525,55493,58116,58757,61062,61094,61125,58501,55525,55525,54469,50211,52420,56613,56453,55493,55525,55525,55716,58500,60967,58533,58565,58597,58597,60645,60614,60582,61093,61094,61061,58470,55525,57828,60709,63110,61093,61094,58469,55684,55493,58501,61063,59013,60966,58180,55493,60549,60998,61062,61093,61062,58565,55493,55493,55493,55493,58310,58885,61061,61063,58597,57861,55493,58500,61062,61061,61062,61126,58500,55493,55493,55493,55493,60517,63142,61126,61061,58405,55493,55493,28994,22817,29122,22882,14466,24929,16545}, {65393,65491,65494,65527,65526,65526,58220,55493,55525,60581,61093,63174,61093,61094,60806,55749,55493,55493,60549,61030,61093,61094,61093,60869,60517,55493,55525,58313,65358,63145,63047,63112,65226,65225,55525,55493,55717,58597,61062,61093,61094,61125,58501,55524,55493,55525,55589,60613,61094,60806,55845,55588,55557,55589,55589,55589,60517,61094,61094,60869,60453,55525,58309,60838,61093,61061,60677,55589,55493,55493,56645,55557,55493,55493,58468,61093,61061,61061,58501,57765,55493,54213,50242,52324,54436,55525,55493,55493,55493,58469,60838,61061,58631,55556,55493,55525,55493,55493,58180,60997,61094,61094,60773,58341,55493,60516,61094,61061,61062,60901,60518,55493,60389,61029,61093,61030,58501,55493,57988,60709,61094,61094,61094,60933,57957,55493,55493,55493,55493,58469,61094,61094,61061,58469,55493,60484,61125,61125,61094,61094,60516,55556,55493,55493,55493,57828,60678,61062,61093,60772,57925,55493,55525,22914,22849,29154,20769,16641,27041,22849}, {65393,65425,63477,65528,65526,65525,55493,55493,60421,62917,63110,61094,61095,63142,60550,55493,55493,58053,60644,63142,61094,61093,61094,58533,55493,55493,55493,60425,55621,55653,55653,55653,55653,55525,55493,55493,58564,61127,61093,61094,61094,58662,56037,55493,55493,58438,60966,61093,61094,60519,55493,55493,55493,55493,55493,58180,60997,61093,61093,60549,55493,55589,60548,59045,61061,60997,60485,55493,55493,55621,55878,55493,55493,58437,60998,61094,61062,60934,58373,55493,55493,55877,53892,55941,55525,55493,55493,58213,60741,61093,61062,60966,60262,55493,55493,55493,55493,55557,60677,61093,61094,61062,58501,55493,60294,60966,61094,61094,61094,58468,55525,55588,60805,61030,61061,58694,55717,55493,60518,61094,61094,61094,61094,60582,55493,55493,55493,55493,58469,61094,61062,61062,60581,55493,57765,58757,61062,61061,61062,60997,58277,55493,55493,55493,55493,60517,61093,61062,60550,55716,55493,55525,31202,22882,27106,31201,27042,20801,24961,24929}, {65393,65393,65493,65526,65526,55493,55493,55589,60581,63142,61094,61062,61093,58532,55525,55493,55525,58501,61094,61094,61094,61094,58501,57731,55525,55493,65228,55525,55493,55525,55493,55525,55525,55493,55525,58277,58757,61094,61126,61093,63110,60581,55525,58117,60709,61094,61094,61126,60581,55525,55525,55525,55525,55493,55557,60645,61094,61062,58629,57924,55525,58469,61125,61062,61094,60548,55525,55525,55493,55525,55525,55525,55812,60646,61094,61093,61125,60582,55493,55525,55525,55525,55525,55525,55525,55525,58567,61061,61061,61061,61062,58564,55525,55525,55525,55525,55525,58469,61093,61062,61062,58533,55685,55493,58534,61093,61061,61062,58533,58022,55493,60613,61062,61093,61094,58437,55493,60454,60998,61094,61094,61062,60678,55620,55493,55525,55525,57925,60709,61061,61061,63013,58213,55493,60549,61061,61062,61094,61093,60517,55493,55493,55493,55493,58276,60902,58661,58182,55493,55493,55493,29090,29121,33249,35394,27041,22881,14498,18690,22913}, {65459,65393,65492,65526,60430,55493,55493,60613,61093,61094,61093,61094,60965,58309,55525,55493,60582,63078,61094,61094,61095,60869,58469,55493,55525,57927,55525,55493,55493,58309,60389,58309,58277,58277,58276,60551,61094,61093,61093,61062,60614,55557,55780,60646,61126,61094,61094,60870,58501,55525,57828,55525,55493,55493,60549,61125,61094,60998,60581,55493,58116,60773,61094,61029,60709,60486,57828,55493,55493,55588,55525,55525,60581,61126,61062,61061,60709,56164,55493,57796,55652,55493,55493,55493,55493,58340,60965,61094,61093,61094,58533,58406,55908,57957,55877,57988,60230,58789,61062,61029,60935,58373,55493,60549,63142,61094,63142,63046,60582,55493,58053,60997,61093,61062,58533,55525,55652,60645,63142,63142,61094,60965,60549,58533,60485,58468,60549,58436,61094,61094,61094,58533,55493,58181,61030,61093,61094,61093,60741,55781,55493,55493,55493,55493,60518,58501,55493,55493,55493,55557,29154,22850,33313,33314,35458,33346,20738,18689,22882,20801}, {65527,65426,65492,65496,55525,55493,60133,60741,61093,61094,61126,61126,60645,55525,55525,55813,58597,61093,61094,61094,61094,58501,55525,55493,55525,60457,55525,55525,60357,60870,61030,61062,61062,61029,61029,63142,61094,61094,61126,58534,58406,55525,60613,61095,61094,61094,61094,60966,61030,61029,61030,58918,60902,60837,61030,61061,60870,58565,55525,55525,60550,61062,61061,61061,61061,61061,61094,60517,58181,55525,55525,58181,60869,63142,61062,61094,61062,61061,61062,58501,58244,55525,55525,55525,55525,58469,61094,61061,61125,61093,61062,61061,61093,61094,61093,61094,61062,61061,61062,60742,58469,55493,57829,62854,61094,61094,63142,60518,55588,55493,60645,63141,63110,62950,58149,55493,60550,61061,61062,61094,61094,61094,61062,61093,61094,61094,61094,61094,61094,61061,60581,57797,55493,58596,63110,63110,61062,61062,60518,55493,55493,55493,55493,58532,57828,55493,55493,55493,31202,31265,27073,24961,22881,31234,35394,31202,14497,14529,20769,20802}, {65527,65458,65458,55687,55525,55493,60581,61126,61126,61094,61093,60677,55557,55493,55493,60581,63142,63142,61094,61094,60549,57861,55493,55493,63182,55493,55493,55525,58533,61093,61062,61094,61094,61093,61093,61094,61094,60902,60581,57861,55493,58309,60966,61094,61126,61094,61094,61094,61094,61126,61094,61094,61094,61094,63110,60677,60132,55493,55493,60454,60966,61094,61062,61094,61062,58789,58469,55493,55493,55493,55493,58469,61094,61094,61094,61094,61095,60902,58469,55493,55493,55493,55493,55493,58501,61062,61062,61094,61097,61062,61062,61061,61094,61062,61094,61094,61061,61062,58533,58117,55493,55493,58468,63141,61094,61093,60837,60389,55493,60421,61093,63142,61094,60581,55493,57893,60806,61093,61094,63142,61094,61094,61094,61094,61094,61094,61094,61094,61030,60549,55653,55493,60486,61093,61062,61094,61093,60549,55493,55493,55493,55493,55493,55493,55493,55493,43396,27041,24962,39521,31297,37506,37473,33283,29185,31234,16609,16578,20770,20770}, {65528,65458,63088,55493,55525,60614,60773,61062,61093,61030,60901,60486,55525,55525,60390,58502,60710,60774,60710,60614,58404,55525,55525,55525,55525,55493,55525,58533,58725,60933,60965,60966,60997,60998,61062,61062,58533,60356,55493,55525,55557,60486,61029,61062,61094,61062,61126,61093,61094,61126,61125,59078,61093,58661,60549,55525,55525,55525,57861,60581,61062,61093,61094,60965,58469,55845,55525,55525,55493,55525,60486,63109,61062,61093,61062,61061,58501,55908,55493,55525,55525,55525,55525,55940,60709,59045,61094,61094,61094,61094,61094,61094,61126,61093,61125,61126,62725,60389,55525,55525,55493,58245,60805,60997,63014,62950,60549,55525,55685,60614,60838,62982,60581,55653,55493,60516,63014,60998,60998,61062,61031,61029,60998,61030,60998,60933,60966,58564,58085,55493,55493,57861,58501,58757,60741,60741,58629,58117,55493,55493,55493,55493,55493,55493,53476,31169,29154,20769,18689,27010,22882,20738,24961,18689,18689,20802,22849,20737,24993,20737}, {65497,65492,55525,55525,55493,60293,58213,58245,58213,58277,58181,55493,55493,55493,55557,57764,55557,57861,57861,57861,55493,55493,55493,60750,55493,55493,55493,57893,57956,57989,57989,57989,58085,58053,58117,56100,55525,55493,55493,55493,57860,58085,58213,58213,58309,58309,58405,58405,58502,58501,60486,60550,60517,57893,55493,55493,55493,55493,58564,60486,58501,58469,58501,58405,55493,55493,55493,55493,55493,55620,58405,58437,58469,58501,58437,60422,55525,55493,55493,58311,56102,55493,55493,58405,58469,60485,60453,58405,58405,58373,58405,58437,58437,60453,58405,58405,55524,55493,55493,55493,55493,58214,58214,58213,58278,60262,55653,55493,58053,58053,58021,58054,57925,55493,55525,55845,57925,57924,57957,55909,55942,57957,55908,57924,55844,55780,57828,55525,55493,55493,55493,57828,55557,57861,55557,55557,55557,55493,55493,55493,55493,55493,55493,27009,22882,20769,18721,16609,18722,18721,29154,18689,24962,22849,31202,22849,31201,27010,22913,18690}, {65527,55686,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,62894,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55685,55653,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55525,58790,58758,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,55493,49444,22913,20738,18657,16610,16609,24962,18625,18690,37505,29121,29122,27041,39618,31233,24961,22818,20769,20770}, {65525,60330,60297,60297,58250,60331,58283,60332,58285,60332,58250,60331,60331,60331,60331,60330,60330,60331,60331,60331,58284,60428,62990,60329,58282,60363,60362,60362,60330,60297,58184,58150,60263,58249,60297,58183,58183,58151,58150,58118,58085,58183,58216,58183,58150,58183,58183,60231,58183,58151,58118,58118,58150,58118,58118,58150,58151,58150,58151,58118,55973,55973,58086,58118,61032,58855,55973,58053,56005,56005,58118,58086,58086,58086,56005,58085,58631,58790,56677,56421,56005,58053,56005,56005,56005,53860,53828,53828,53796,53796,53828,53796,53860,55940,53828,55973,58310,54308,53828,53828,55941,53828,53796,53796,53796,53796,53764,53828,53828,53828,53860,53828,53796,51716,49572,47524,49604,47524,45412,45412,41284,43364,49604,49604,45444,47524,47588,49668,49732,49732,51877,45540,45476,41316,39236,39268,43364,39268,41349,43396,31202,22850,16641,16578,20802,16578,27009,39650,18657,20802,37473,39650,20738,24993,29121,24994,24929,29185,18657,18689}, {65493,65490,65425,65424,65492,65526,63476,65492,65528,65525,65490,65492,65492,65523,65523,65523,65524,65526,65525,65525,65526,65492,63343,65390,65490,65491,63409,65457,65424,65424,65325,63144,65325,65391,65391,65292,63211,63112,65225,63179,61032,65259,63179,63145,61065,63211,63178,63179,65292,63179,61064,63112,63048,63113,63113,61000,61000,60968,61032,61032,58822,56677,60871,58855,61000,61000,60968,58823,56678,56742,58855,58855,60903,58855,56709,56709,58758,56645,56645,58758,58790,58790,58790,58790,56677,54500,56581,50242,48130,48099,48131,54436,58694,60838,52419,58725,58725,56580,50212,48098,52323,50242,54436,54404,48066,43809,45954,50210,52291,52259,52323,50146,39618,37473,41698,50147,52290,52291,45922,37506,35394,43810,50146,45922,41698,39586,37537,43810,45922,48003,45857,37505,31233,24962,20801,20738,20737,20738,22850,27073,22913,16642,16610,18689,27073,18690,24929,43778,29153,29121,31202,37506,22881,24962,31234,24962,31202,22817,20801,14497}, };
-const uint16_t presskeytostart[20][160]= { {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8288,22816,20736,4160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4160,2080,0,0,0,0,0,0,0}, {12448,45632,47712,47712,47680,33184,10368,0,35264,47712,47712,47712,45632,26944,2080,10368,45632,47712,47712,47712,47712,47712,20736,0,2080,29024,49792,60128,51840,60128,4128,0,10368,35264,56000,56000,53920,43552,0,0,0,0,0,0,0,0,0,39424,47712,47712,18656,45632,47712,45632,12448,45632,47712,47712,47712,47712,47712,20736,8288,45632,47712,43552,16608,47712,47712,22816,0,18656,62208,64288,64288,56000,10368,0,0,0,0,0,0,0,0,0,41472,47712,47712,47712,47712,47712,47680,2048,2048,33184,53920,58080,45632,10368,0,0,0,0,0,0,0,0,0,0,10368,35264,56000,56000,53920,43552,0,24896,47712,47712,47712,47712,47712,47712,16576,10368,45632,47712,47712,24896,0,0,6208,45632,47712,47712,47712,39424,16576,0,10368,47712,47712,47712,47712,47712,47712,33184,0,0,0,60160,49760,0,0,0,0,0,0,0}, {18656,64288,64288,64288,64288,64288,60128,6208,51872,64288,64288,64288,64288,64288,33184,14528,64288,64288,64288,64288,64288,64288,33184,0,29024,64288,60128,47712,64288,64288,8288,0,49792,64288,53920,53920,64288,49792,0,0,0,0,0,0,0,0,0,58080,64288,64288,29056,64288,64288,62208,18656,64288,64288,64288,64288,64288,64288,33184,12416,64288,64288,62240,26976,64288,64288,35264,0,56000,64288,33184,41504,64288,43552,0,0,0,0,0,0,0,0,0,64288,64288,64288,64288,64288,64288,64288,8288,39424,64288,64288,64288,64288,62208,8288,0,0,0,0,0,0,0,0,0,49792,64288,53920,53920,64288,49792,0,43552,64288,64288,64288,64288,64288,64288,29056,14528,64288,64288,64288,64288,6208,0,10368,64288,64288,64288,64288,64288,64288,10368,20736,64288,64288,64288,64288,64288,64288,51840,0,0,0,64288,51840,0,0,0,0,0,0,0}, {0,41472,64288,14528,16576,60128,64288,20736,8320,64288,43552,4160,35264,64288,45632,0,37344,64288,14496,16576,12448,64288,33184,0,53920,64288,24896,0,29024,64288,4160,10368,64288,64288,4128,2080,47712,47712,0,0,0,0,0,0,0,0,0,14528,64288,43552,22816,64288,51840,6208,0,37344,64288,14496,16576,12448,64288,33184,0,18656,64288,49760,12448,64288,41472,0,12448,64288,56000,0,6208,64288,62240,0,0,0,0,0,0,0,0,2080,64288,35264,26944,64288,33184,26976,64288,18656,64288,64288,16576,2080,47712,64288,37344,0,0,0,0,0,0,0,0,10368,64288,64288,4128,2080,47712,47712,0,45632,56000,6208,64288,53920,8288,64288,31136,0,22816,64288,58080,64288,29024,0,0,31104,64288,22816,8288,53920,64288,24864,22816,64288,14528,45632,64288,14528,47712,53920,0,0,0,60160,47712,0,0,0,0,0,0,0}, {0,39392,64288,20736,20736,60160,64288,16608,8288,64288,51840,31104,51840,64288,31104,0,35264,64288,45632,60160,39424,22816,8288,0,43552,64288,64288,49760,29024,6208,0,2080,62208,64288,60160,43552,24864,2080,0,0,0,0,0,0,0,0,0,14496,64288,58080,64288,53920,4128,0,0,35264,64288,45632,60160,39424,22816,8288,0,0,45632,64288,53920,62208,6240,0,20736,64288,43552,0,0,56000,64288,8288,0,0,0,0,0,0,0,2048,62208,26976,22816,64288,31104,18656,64288,26976,64288,51872,0,0,22816,64288,51872,0,0,0,0,0,0,0,0,2080,62208,64288,60160,43552,24864,2080,0,41472,49760,2080,64288,53920,0,60160,29024,0,41472,62240,14528,64288,51872,0,0,29056,64288,39424,33184,60160,64288,10368,20736,64288,6240,45632,64288,10368,39424,49792,0,0,0,58048,43552,0,0,0,0,0,0,0}, {0,39392,64288,64288,64288,64288,43552,0,8288,64288,64288,64288,64288,47712,2080,0,35264,64288,56000,64288,39424,0,0,0,8288,43552,62240,64288,64288,60160,6208,0,18688,51872,64288,64288,64288,45632,0,0,0,0,0,0,0,0,0,14496,64288,64288,64288,62240,16608,0,0,35264,64288,56000,64288,39424,0,0,0,0,10368,64288,64288,33184,0,0,20736,64288,43552,0,0,56000,64288,8288,0,0,0,0,0,0,0,0,2080,0,22816,64288,31104,0,2080,26976,64288,45632,0,0,14528,64288,56000,0,0,0,0,0,0,0,0,0,18688,51872,64288,64288,64288,45632,0,0,2080,2080,64288,53920,0,2080,0,4128,62208,60128,35264,62240,64288,10368,0,29056,64288,64288,64288,64288,22816,0,0,2080,0,45632,64288,10368,2048,2080,0,0,0,53920,41472,0,0,0,0,0,0,0}, {0,39392,64288,31104,20736,4160,0,0,8288,64288,47712,22816,64288,60160,6240,0,35264,64288,12448,29024,18656,60128,26976,0,53920,22816,2080,20736,58080,64288,26976,16576,53920,8288,6208,31104,64288,64288,6208,0,0,0,0,0,0,0,0,14496,64288,49760,31104,64288,53920,0,0,35264,64288,12448,29024,18656,60128,26976,0,0,0,45632,64288,10368,0,0,12448,64288,56000,0,4160,64288,62208,0,0,0,0,0,0,0,0,0,0,0,22816,64288,31104,0,0,16608,64288,60160,0,0,31104,64288,45632,0,0,0,0,0,0,0,0,16576,53920,8288,6208,31104,64288,64288,6208,0,0,2080,64288,53920,0,0,0,24896,64288,60160,60128,60160,64288,35232,0,29056,64288,26944,41504,64288,45632,0,0,0,0,45632,64288,10368,0,0,0,0,0,26976,18688,0,0,0,0,0,0,0}, {8288,53920,64288,41472,14528,0,0,0,31104,64288,56000,12448,41472,64288,51840,18656,49792,64288,41472,35264,35264,64288,33184,2080,64288,64288,29056,20736,53920,64288,20736,22816,64288,56000,22816,26944,64288,60128,4128,0,0,0,0,0,0,0,0,37312,64288,53920,10368,47712,64288,43552,10368,49792,64288,41472,35264,35264,64288,33184,0,6208,35264,56000,64288,41472,20736,0,0,51840,64288,49792,53920,64288,39392,0,0,0,0,0,0,0,0,0,4128,35264,47712,64288,51840,37312,6240,0,51840,64288,53920,43552,64288,64288,18656,0,0,0,0,0,0,0,0,22816,64288,56000,22816,26944,64288,60128,4128,0,24896,39392,64288,60128,37344,18656,12448,53920,64288,29056,0,37344,64288,58080,20736,47712,64288,45632,6240,58080,64288,39424,4128,14496,37344,56000,64288,41472,31104,0,0,0,18656,64288,62208,6208,0,0,0,0,0,0}, {18656,64288,64288,64288,29024,0,0,0,51840,64288,64288,26944,4160,51872,64288,39392,64288,64288,64288,64288,64288,64288,29056,0,62208,64288,64288,64288,58080,35264,0,20736,64288,64288,64288,64288,51840,20736,0,0,0,0,0,0,0,0,0,58080,64288,64288,20736,10368,56000,62208,26944,64288,64288,64288,64288,64288,64288,29056,0,14528,64288,64288,64288,64288,41504,0,0,10368,56000,64288,64288,47712,4160,0,0,0,0,0,0,0,0,0,8288,62208,64288,64288,64288,62240,16576,0,6240,47712,64288,64288,60160,24896,0,0,0,0,0,0,0,0,0,20736,64288,64288,64288,64288,51840,20736,0,0,49760,64288,64288,64288,64288,35264,26944,64288,64288,51872,2048,60128,64288,64288,39424,62240,64288,62208,6240,18656,60160,62208,12416,26976,64288,64288,64288,64288,58048,0,0,0,16576,62240,60160,6240,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8288,4128,10368,10368,0,0,0,0,10368,2080,10368,6208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8288,6208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4160,10368,0,0,0,0,0,0,0,0,0,0,0,0,10368,2080,10368,6208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4128,2080,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, };
-const uint16_t switch00[15][40] = { {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4160,0,0,0}, {0,10368,33184,45632,39424,31104,20736,35264,33184,0,12448,35264,35264,6208,24864,62208,64288,51840,8288,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24864,62208,64288,51840,8288,0}, {2080,58080,62208,49760,64288,47712,41472,64288,62240,2080,26976,64288,64288,18656,62208,53920,31104,64288,39424,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4160,62208,53920,31104,64288,39424,0}, {18688,64288,41472,2048,31104,39392,2080,64288,26976,43552,24864,51872,39392,20736,64288,26976,0,51872,60128,0,0,0,37312,39392,2080,0,0,0,0,0,0,0,0,20736,64288,26976,0,51872,60128,0}, {6208,62208,64288,62208,45632,12448,0,56000,43552,64288,53920,56000,31104,26976,64288,14528,0,41472,64288,2080,0,6208,64288,64288,10368,0,0,0,0,0,0,0,0,26976,64288,14528,0,41472,64288,2080}, {8288,22816,29024,47712,64288,56000,0,49760,64288,37344,60160,64288,22816,16576,64288,22816,0,47712,53920,0,0,0,12448,14496,0,0,0,0,0,0,0,0,0,16576,64288,22816,0,47712,53920,0}, {29056,64288,22816,6240,56000,62208,2080,41472,64288,14528,41504,64288,16576,0,60160,51840,29024,62208,35264,0,0,4128,56000,58080,6208,0,0,0,0,0,0,0,0,0,60160,51840,29024,62208,35264,0}, {26976,64288,64288,64288,56000,24896,0,33184,56000,0,18688,64288,6240,0,26944,64288,64288,53920,8288,0,0,2080,56000,60128,6240,0,0,0,0,0,0,0,0,0,26944,64288,64288,53920,8288,0}, {2080,6208,6208,8288,0,0,0,0,0,0,0,0,0,0,0,2080,8288,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2080,8288,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, };
-const uint16_t switch01[15][40] = { {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6208,0,0,0}, {0,10368,33184,45632,39424,31104,20736,35264,33184,0,12448,35264,35264,6208,24864,62208,64288,51840,8288,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26944,56000,64288,12448,0,0}, {2080,58080,62208,49760,64288,47712,41472,64288,62240,2080,26976,64288,64288,18656,62208,53920,31104,64288,39424,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24896,43552,64288,12448,0,0}, {18688,64288,41472,2048,31104,39392,2080,64288,26976,43552,24864,51872,39392,20736,64288,26976,0,51872,60128,0,0,0,37312,39392,2080,0,0,0,0,0,0,0,0,0,0,16608,64288,12448,0,0}, {6208,62208,64288,62208,45632,12448,0,56000,43552,64288,53920,56000,31104,26976,64288,14528,0,41472,64288,2080,0,6208,64288,64288,10368,0,0,0,0,0,0,0,0,0,0,16608,64288,12448,0,0}, {8288,22816,29024,47712,64288,56000,0,49760,64288,37344,60160,64288,22816,16576,64288,22816,0,47712,53920,0,0,0,12448,14496,0,0,0,0,0,0,0,0,0,0,0,16608,64288,12448,0,0}, {29056,64288,22816,6240,56000,62208,2080,41472,64288,14528,41504,64288,16576,0,60160,51840,29024,62208,35264,0,0,4128,56000,58080,6208,0,0,0,0,0,0,0,0,0,12448,31104,64288,29024,10368,0}, {26976,64288,64288,64288,56000,24896,0,33184,56000,0,18688,64288,6240,0,26944,64288,64288,53920,8288,0,0,2080,56000,60128,6240,0,0,0,0,0,0,0,0,0,56000,64288,64288,64288,43552,0}, {2080,6208,6208,8288,0,0,0,0,0,0,0,0,0,0,0,2080,8288,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, };
-const uint16_t bigPurpleTankUp[40][40] = { {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2081,2081,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,32,32,4194,16491,14443,4194,32,32,2112,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,14537,14568,4162,20812,43958,43958,20812,4162,14600,14569,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,2113,4194,14378,16554,6180,24878,48247,48247,24878,6180,16522,14378,4226,2113,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,12455,16491,16395,16427,16491,39764,46134,46133,39764,16491,16396,16395,16491,10407,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,6339,18699,20622,16396,16395,16395,41877,46134,46134,41877,16395,14347,16396,20622,18700,6339,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,4226,10502,8388,2178,16586,37653,41782,18508,14347,16395,39796,46134,46134,39797,16395,14347,18509,39734,39669,16586,4226,6340,10470,4226,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,32,14696,14536,16554,14474,16395,39637,39733,18508,14347,14347,41845,46166,46166,41877,14346,14347,18508,39734,37588,14347,16522,16554,14568,14696,32,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,32,16744,18858,16459,16396,18508,37620,39701,16460,14347,18540,39796,44053,42005,39796,18540,14347,18508,39702,37620,18508,16396,16459,18858,14664,32,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,2081,12519,8325,14346,20622,37621,41846,39702,14347,16492,44022,20971,16776,14728,20971,44022,18508,14347,39701,41814,37621,20621,14346,8325,12519,2081,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,2081,12519,10406,12298,20622,39766,39669,37556,20653,22830,46134,18889,12582,12614,18889,44086,22861,18604,37556,39701,39766,20653,14346,10406,12519,2081,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,33,16713,18858,14378,20622,39734,20621,18507,43990,46134,44053,25196,18954,18954,25196,44053,46134,43990,18508,20621,39734,20621,14378,18858,16713,32,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,2081,12552,10406,12298,20654,41814,20589,16427,44022,46134,44053,25196,21002,21002,25196,44053,46135,44022,16427,20589,41814,20653,14346,10406,12551,2081,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,2113,12519,8293,12298,20654,39702,20589,16460,43990,46134,44054,25196,21001,21002,25164,44053,46134,41941,16460,20589,39702,20653,14346,8293,12519,2081,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,32,14664,16809,14346,16396,18508,14347,16459,41909,46134,46134,25196,21002,21002,25196,46134,46134,41941,16460,14347,18509,16395,14346,18858,14664,32,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,2081,14568,14536,18636,18573,14347,18540,20749,44022,46134,41877,25164,21034,21034,25164,41877,46134,44021,20749,18540,14347,18573,18636,14536,14568,2080,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,2112,14441,16492,44054,41846,16427,39765,46134,46134,41878,14378,20875,23083,23115,20876,14378,41877,46134,46134,39765,16459,41877,46103,16491,12393,2112,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,64,14473,20589,46134,41877,16427,41877,44054,20717,18540,14347,16427,16458,16459,16427,14347,18572,20717,44086,39829,16427,41877,46134,18541,14441,64,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,64,14473,18541,44054,39828,16427,39797,43990,16395,14347,16460,16428,16428,16396,16428,16428,14347,16460,46102,39796,16427,41844,44054,18541,14441,64,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,2112,14473,18541,44054,39828,16459,39796,44021,16427,16492,31443,31443,31411,31411,31443,31443,16460,18508,46102,39796,16427,39828,44054,18541,14441,64,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,64,14473,18541,44054,39828,16459,39796,44022,16427,16492,33555,31539,31507,31507,31539,33555,16492,18508,46102,39796,16427,39828,44054,18541,14441,64,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,2112,14473,18541,44054,39828,16459,39796,44022,16427,16492,31475,31507,31475,31475,31475,31475,16460,18508,46102,39796,16427,39828,44054,18541,14441,64,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,2112,14473,18541,44054,39828,16459,39796,44022,16427,16492,31475,31507,31475,31475,31475,31475,16492,18508,46102,39796,16427,39828,44054,18541,14441,64,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,64,14473,18541,44054,39796,16459,39828,43990,16395,16492,31475,31475,31475,31475,31507,31475,16460,18508,46102,39796,16427,39797,44054,18541,14441,64,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,64,14473,18541,44054,39796,16427,39828,43990,14347,14380,33556,33587,31507,31507,31539,33556,14379,16395,46103,39796,16427,39797,44054,18541,14441,64,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,64,14473,18541,46134,41877,16427,39796,44021,20684,20717,29298,31379,29330,29330,31378,31346,18637,20717,44054,39797,16459,41877,46134,18541,14441,64,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,64,14473,18541,46102,41877,16459,39764,46134,46134,41877,14411,14379,16459,16459,16427,16458,41877,46134,44086,37716,16459,41845,46103,18541,14441,64,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,64,14506,16396,20653,18572,16394,39829,46166,46102,44022,39796,39796,39796,39764,39764,39796,44022,44054,46166,39797,16395,18572,20653,16428,14474,64,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,2112,16554,16396,14347,14347,16460,39764,44054,44022,44022,46134,46134,46134,46134,46134,46134,44022,44021,44054,39765,16460,14347,14347,16396,14506,64,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,2112,16554,16396,16395,20621,39702,20653,18571,44022,46166,44021,44021,44021,44022,44021,44021,46166,44022,18539,20685,39701,20621,14347,16396,14506,64,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,2112,16554,16396,14347,20653,41846,22766,18573,39764,41909,44054,44021,44021,44021,44021,44053,41909,39765,18572,22766,41814,20653,14348,16397,14506,64,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,2112,16554,16396,16491,20749,39734,41814,37653,16427,18572,44023,44054,44021,44021,44053,44054,18572,14379,37653,41814,39734,20749,16491,16396,16554,64,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,2112,16523,16460,6339,8388,18669,39702,41782,16396,14347,20653,41909,46134,46166,41909,20653,14347,16396,41782,39702,18668,6339,6307,16491,16523,2112,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,32,14601,16618,32,0,14505,35540,39701,18635,14442,14441,37716,46102,46070,39764,14442,14443,18635,39669,37589,14537,32,32,14569,16649,2080,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,2113,2113,0,0,4226,14506,18636,4259,2113,2145,14473,20589,20557,14473,2145,2113,6307,18636,16523,4258,0,0,2145,2113,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,10407,14569,2112,0,0,8294,14442,14474,8294,0,0,2112,14569,12456,32,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,32,32,0,0,0,32,32,32,32,0,0,0,32,32,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, };
-const uint16_t bigBrownTankUp[40][40] = { {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4226,8484,6339,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6307,16839,10533,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6339,18952,10565,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6339,18984,10565,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,4194,8452,12645,16871,14758,8452,8452,8452,8452,8452,8452,8452,8452,4226,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,32,2113,6339,12645,14726,16839,16839,16839,14726,14726,14726,14726,14726,14726,14758,14726,12646,8420,32,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,4226,10532,14726,23145,35823,21097,14694,21097,37936,35856,35856,35856,35856,35856,35823,33710,21097,10532,8452,2113,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,4194,4226,4194,4194,8452,18920,33775,40049,40082,23178,12645,23178,40082,40049,37969,37969,37969,37969,37969,40049,37969,23178,12645,8452,2145,4194,4226,2145,0,0,0,0,0,0}, {0,0,0,0,0,0,19049,35953,35920,29614,10533,25291,38001,37969,40049,21097,12645,23177,40049,37969,37968,37936,37936,37936,37936,37936,40081,33743,10532,25356,35921,33840,35921,16936,0,0,0,0,0,0}, {0,0,0,0,0,0,21130,48598,48599,40147,10532,25259,37969,37969,40017,21097,12645,23178,40049,37969,37937,37969,37937,37937,37937,37937,38001,33710,10500,33743,48599,46518,48566,21130,0,0,0,0,0,0}, {0,0,0,0,2113,6306,12645,12613,12613,12613,12613,25291,37969,37969,40017,23145,12646,23178,38001,40049,40050,40049,40049,40082,38001,37937,38001,33711,12613,12613,12613,12613,12645,12646,6339,0,0,0,0,0}, {0,0,0,0,10532,10565,16839,23178,23178,21065,12613,25259,37969,37969,40082,21065,10500,21097,40114,27404,25259,25291,25291,25258,29485,40049,40049,33710,12613,18920,23178,23178,16839,12613,12645,2081,0,0,0,0}, {0,0,0,0,10565,12613,18984,35856,37904,31630,12580,25259,37969,37969,37969,21033,10468,21065,40082,16839,10500,10532,12580,8419,18952,38001,40049,33710,10532,27371,37936,37936,25259,12581,12645,2081,0,0,0,0}, {0,0,0,0,10565,12613,18952,35791,35823,31565,12580,25259,40050,33710,12613,23146,29485,23146,14694,21097,25259,23210,25258,25259,21065,12645,33743,33743,10532,25291,35824,35823,25258,12613,12645,33,0,0,0,0}, {0,0,0,0,10565,12613,18952,35791,35791,29517,12580,25291,40050,31630,10468,23178,31598,23178,10468,25259,29517,29485,29485,29517,23178,10500,33711,33775,10532,25291,35823,35823,23210,12613,12645,33,0,0,0,0}, {0,0,0,0,10533,12613,18952,35791,35791,31565,12580,25291,40049,31630,10532,23178,31565,23178,10500,25259,29485,29452,29452,29485,23178,10532,33743,33775,10532,25291,35823,35823,23210,12613,12645,32,0,0,0,0}, {0,0,0,0,10533,12613,18952,35791,35823,29517,12580,25259,40049,31662,10532,23178,31597,23178,10532,25258,29485,29452,29452,29485,23178,10532,33711,33775,10532,25291,35823,35823,23210,12613,12645,33,0,0,0,0}, {0,0,0,0,10532,12613,18952,35791,35823,29517,12581,25259,40049,31662,10532,23178,31597,23178,10532,25258,29485,29452,29452,29485,23178,10532,33711,33775,10532,25291,35823,35823,23210,12613,12613,33,0,0,0,0}, {0,0,0,0,10532,12613,18952,35791,35791,29517,12581,25259,40049,31662,10532,23178,31597,23178,10532,25258,29485,29452,29452,29485,23178,10532,33711,33775,10532,25291,35823,35823,23210,12613,12613,32,0,0,0,0}, {0,0,0,0,10532,12613,18952,35791,35791,29517,12581,25259,40049,31662,10532,23178,31597,23178,10532,25258,29485,29452,29452,29485,23178,10532,33711,33775,10532,25291,35823,35823,23210,12613,12613,32,0,0,0,0}, {0,0,0,0,10533,12613,18952,35791,35791,29517,12580,25259,40049,31662,10532,23178,31597,23178,10532,25258,29485,29452,29452,29485,23178,10532,33711,33775,10532,25291,35823,35823,23210,12613,12613,32,0,0,0,0}, {0,0,0,0,10533,12613,18952,35791,35791,29517,12580,25259,40050,31662,10532,23178,31597,23178,10532,25258,29485,29452,29452,29485,23178,10532,33711,33775,10532,25291,35823,35823,23210,12613,12613,32,0,0,0,0}, {0,0,0,0,10533,12613,18952,35791,35791,29517,12580,25259,40050,31662,10532,23178,31597,23178,10532,25259,29485,29452,29452,29485,23178,10532,33711,33775,10532,25291,35823,35823,23210,12613,12613,32,0,0,0,0}, {0,0,0,0,10533,12613,18952,35791,35823,29517,12580,25259,40050,31662,10532,23178,31597,23178,10500,25259,29485,29452,29452,29485,23178,10532,33711,33775,10532,25291,35823,35823,23210,12613,12613,32,0,0,0,0}, {0,0,0,0,10533,12613,18952,35791,35791,29517,12580,25259,40050,31630,8387,23178,31630,23178,8387,25291,31597,29485,29485,31597,23178,8387,33710,35823,10532,25291,35823,35823,23178,12613,12613,32,0,0,0,0}, {0,0,0,0,10565,12613,18952,35791,35791,29517,12580,25259,40049,35824,25258,21065,21032,21097,25259,21065,21032,21065,21065,21033,21065,25258,35856,33743,10532,25291,35823,35823,23178,12613,12613,32,0,0,0,0}, {0,0,0,0,10565,12613,18952,35791,35823,29517,12581,25259,37937,38001,42195,21033,8323,21065,44275,18887,10500,12581,12613,10468,21033,42195,40082,33710,10532,25291,35824,35823,23210,12613,12613,32,0,0,0,0}, {0,0,0,0,10565,12613,18984,35856,37904,31630,12580,25291,37969,37969,37969,35824,33711,35824,37969,35791,33743,33743,33743,33743,35824,37969,40049,33710,10500,27371,37904,35888,25258,12613,12645,32,0,0,0,0}, {0,0,0,0,10533,12613,16871,27436,27436,25291,12580,27404,40081,37936,37936,37969,40049,37969,37937,37969,38001,38001,38001,40049,37969,37936,40049,33710,12581,21097,29484,27436,21064,12613,12645,2081,0,0,0,0}, {0,0,0,0,4226,8452,12645,12613,10533,12613,10532,27436,40114,37969,37936,37936,37936,37936,37937,37937,37937,37937,37937,37937,37937,37936,40049,33743,12645,12613,12613,12580,12613,12645,8452,0,0,0,0,0}, {0,0,0,0,0,2081,16839,25323,23243,25323,18984,16839,33743,37969,40049,40049,40049,40049,40049,40049,40049,40049,40049,40049,40049,40049,40082,31662,12613,18984,25323,25291,25323,16871,2081,0,0,0,0,0}, {0,0,0,0,0,32,16871,27436,25356,27436,21130,10500,12613,21033,33743,33711,33711,33711,33711,33711,33711,33711,33711,33711,33711,33743,33710,16839,10533,19017,27404,25356,27436,14823,33,0,0,0,0,0}, {0,0,0,0,0,0,6307,10532,8452,10532,8452,33,6307,10532,12613,12645,12645,12645,12645,12645,12645,12645,12645,12645,12645,12645,12613,10532,6339,6371,10532,8484,10533,6307,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,2081,6339,6339,6339,6339,6339,6339,6339,6339,6339,6339,6339,6339,6307,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, };
-const uint16_t heart[14][14] = { {63422,63422,63422,63422,63422,63422,63422,63422,63422,63422,63422,63422,63422,63422}, {63422,63422,63422,52857,50744,50744,63422,63422,50744,50744,52857,63422,63422,63422}, {63422,63422,63422,60040,60008,60008,0,0,60008,60008,57992,63422,63422,63422}, {63422,63422,0,60008,63422,60008,60008,60008,60008,60008,60008,0,63422,63422}, {63422,0,60008,63422,60008,60008,60008,60008,60008,60008,60008,60008,0,63422}, {63422,0,60008,60008,60008,60008,60008,60008,60008,60008,60008,60008,0,63422}, {63422,0,60008,60008,60008,60008,60008,60008,60008,60008,60008,60008,0,63422}, {63422,63422,0,60008,60008,60008,60008,60008,60008,60008,60008,0,63422,63422}, {63422,63422,63422,60040,60008,60008,60008,60008,60008,60008,57992,63422,63422,63422}, {63422,63422,63422,63422,0,60008,60008,60008,60008,0,63422,63422,63422,63422}, {63422,63422,63422,63422,63422,0,60008,60008,0,63422,63422,63422,63422,63422}, {63422,63422,63422,63422,63422,63422,0,0,63422,63422,63422,63422,63422,63422}, {63422,63422,63422,63422,63422,63422,63422,63422,63422,63422,63422,63422,63422,63422}, {63422,63422,63422,63422,63422,63422,63422,63422,63422,63422,63422,63422,63422,63422}, };
-const uint16_t player1[20][80] = { {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12416,26944,4160,0,0,0,0,2080,18656,4128,0,0,0,0,0,0,0,0,0,0,0,0,0}, {12448,45632,47712,47712,47680,33184,10368,4128,43552,47712,47712,45632,8288,0,0,0,24864,47712,47712,45632,10368,0,0,8288,45632,47712,43552,16608,47712,47712,22816,24864,47712,47712,47712,47712,47712,47712,6208,20736,47712,47712,47712,47712,33184,8288,0,0,0,0,0,0,0,0,0,4128,56000,64288,64288,18688,0,0,0,0,29024,64288,39424,0,0,0,0,0,0,0,0,0,0,0,0,0}, {18656,64288,64288,64288,64288,64288,60128,10368,64288,64288,64288,64288,14496,0,0,0,35264,64288,64288,64288,47712,0,0,12416,64288,64288,62240,26976,64288,64288,35264,35264,64288,64288,64288,64288,64288,64288,12448,31104,64288,64288,64288,64288,64288,53920,0,0,0,0,0,0,0,0,0,2048,37344,45632,64288,18688,0,0,0,0,18656,60160,29024,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,41472,64288,14528,16576,60128,64288,20736,4128,56000,64288,4128,0,0,0,0,0,43552,64288,60128,64288,8288,0,0,18656,64288,49760,12448,64288,41472,0,0,58080,56000,2048,20736,26944,64288,10368,0,51872,64288,2080,16608,64288,64288,2080,0,0,0,0,0,0,0,0,0,0,29024,64288,18688,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,39392,64288,20736,20736,60160,64288,16608,0,53920,64288,0,0,0,0,0,2080,60160,45632,33184,64288,31104,0,0,0,45632,64288,53920,62208,6240,0,0,56000,62208,45632,64288,22816,24896,0,0,51840,64288,29024,41472,64288,53920,0,0,0,0,0,0,0,0,0,0,0,29024,64288,18688,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,39392,64288,64288,64288,64288,43552,0,0,53920,64288,0,0,4128,24864,2080,22816,64288,49760,43552,64288,53920,0,0,0,10368,64288,64288,33184,0,0,0,56000,64288,58048,64288,18656,0,0,0,51840,64288,64288,64288,62208,10368,0,0,0,0,0,0,0,0,0,0,0,29024,64288,18688,0,0,0,0,6208,31104,10368,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,39392,64288,31104,20736,4160,0,0,0,53920,64288,0,0,20736,64288,14528,45632,64288,60128,60128,62208,64288,12448,0,0,0,45632,64288,10368,0,0,0,56000,56000,4128,35264,24896,62208,8288,0,51840,64288,10368,58080,64288,24896,0,0,0,0,0,0,0,0,0,0,0,29024,64288,18688,0,0,0,0,31104,64288,41472,0,0,0,0,0,0,0,0,0,0,0,0,0}, {8288,53920,64288,41472,14528,0,0,2080,33184,60128,64288,37312,37312,47680,64288,35232,64288,58080,14528,8288,51840,64288,47712,6208,6208,35264,56000,64288,41472,20736,0,16608,62208,60160,35264,35264,45632,64288,12448,14528,58080,64288,26944,20736,64288,60160,26944,0,0,0,0,0,0,0,0,8288,33184,47712,64288,43552,31104,0,0,0,8288,37344,14496,0,0,0,0,0,0,0,0,0,0,0,0,0}, {18656,64288,64288,64288,29024,0,0,6208,62208,64288,64288,64288,64288,64288,64288,51840,64288,64288,31104,18656,64288,64288,62208,16576,14528,64288,64288,64288,64288,41504,0,35264,64288,64288,64288,64288,64288,62240,8288,29056,64288,64288,47680,0,35264,64288,51840,0,0,0,0,0,0,0,0,20736,64288,64288,64288,64288,60160,4160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, };
-const uint16_t player2[20][80] = { {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6208,22816,22816,4128,0,0,0,0,2080,18656,4128,0,0,0,0,0,0,0,0,0,0,0,0,0}, {12448,45632,47712,47712,47680,33184,10368,4128,43552,47712,47712,45632,8288,0,0,0,24864,47712,47712,45632,10368,0,0,8288,45632,47712,43552,16608,47712,47712,22816,24864,47712,47712,47712,47712,47712,47712,6208,20736,47712,47712,47712,47712,33184,8288,0,0,0,0,0,0,0,0,0,22816,62240,64288,64288,62208,24896,0,0,0,29024,64288,39424,0,0,0,0,0,0,0,0,0,0,0,0,0}, {18656,64288,64288,64288,64288,64288,60128,10368,64288,64288,64288,64288,14496,0,0,0,35264,64288,64288,64288,47712,0,0,12416,64288,64288,62240,26976,64288,64288,35264,35264,64288,64288,64288,64288,64288,64288,12448,31104,64288,64288,64288,64288,64288,53920,0,0,0,0,0,0,0,0,0,39424,64288,22816,35264,64288,51872,0,0,0,18656,60160,29024,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,41472,64288,14528,16576,60128,64288,20736,4128,56000,64288,4128,0,0,0,0,0,43552,64288,60128,64288,8288,0,0,18656,64288,49760,12448,64288,41472,0,0,58080,56000,2048,20736,26944,64288,10368,0,51872,64288,2080,16608,64288,64288,2080,0,0,0,0,0,0,0,0,14496,18656,0,8320,64288,56000,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,39392,64288,20736,20736,60160,64288,16608,0,53920,64288,0,0,0,0,0,2080,60160,45632,33184,64288,31104,0,0,0,45632,64288,53920,62208,6240,0,0,56000,62208,45632,64288,22816,24896,0,0,51840,64288,29024,41472,64288,53920,0,0,0,0,0,0,0,0,0,0,0,0,37344,64288,37344,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,39392,64288,64288,64288,64288,43552,0,0,53920,64288,0,0,4128,24864,2080,22816,64288,49760,43552,64288,53920,0,0,0,10368,64288,64288,33184,0,0,0,56000,64288,58048,64288,18656,0,0,0,51840,64288,64288,64288,62208,10368,0,0,0,0,0,0,0,0,0,0,0,35264,64288,51872,4128,0,0,0,6208,31104,10368,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,39392,64288,31104,20736,4160,0,0,0,53920,64288,0,0,20736,64288,14528,45632,64288,60128,60128,62208,64288,12448,0,0,0,45632,64288,10368,0,0,0,56000,56000,4128,35264,24896,62208,8288,0,51840,64288,10368,58080,64288,24896,0,0,0,0,0,0,0,0,0,0,41472,64288,47712,8288,12416,0,0,0,31104,64288,41472,0,0,0,0,0,0,0,0,0,0,0,0,0}, {8288,53920,64288,41472,14528,0,0,2080,33184,60128,64288,37312,37312,47680,64288,35232,64288,58080,14528,8288,51840,64288,47712,6208,6208,35264,56000,64288,41472,20736,0,16608,62208,60160,35264,35264,45632,64288,12448,14528,58080,64288,26944,20736,64288,60160,26944,0,0,0,0,0,0,0,0,41472,64288,64288,39424,49792,62208,0,0,0,8288,37344,14496,0,0,0,0,0,0,0,0,0,0,0,0,0}, {18656,64288,64288,64288,29024,0,0,6208,62208,64288,64288,64288,64288,64288,64288,51840,64288,64288,31104,18656,64288,64288,62208,16576,14528,64288,64288,64288,64288,41504,0,35264,64288,64288,64288,64288,64288,62240,8288,29056,64288,64288,47680,0,35264,64288,51840,0,0,0,0,0,0,0,0,56000,64288,64288,64288,64288,58080,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, };
-// const uint16_t fire[20][20] = { {32,32,32,32,4128,0,0,0,4161,2113,8322,0,25095,64331,39593,0,8289,32,2080,2080}, {32,32,2080,4161,0,37608,41834,163,0,0,0,33320,45803,51491,31077,33,6176,32,2080,2080}, {32,32,2112,8192,3,54119,62506,10694,6177,14693,421,51686,59748,454,0,4096,33,2080,2080,2080}, {32,32,32,2080,0,22980,27141,0,43494,59943,55719,60195,62337,57927,39594,0,8257,0,2080,2080}, {32,32,2080,32,6209,0,12290,37415,55651,63680,63904,62209,62208,63520,41642,0,8257,0,32,32}, {32,32,32,32,6176,0,31044,63908,63713,61889,64322,61889,61440,63974,35205,0,8257,32,32,32}, {32,2080,2080,8224,130,43235,59809,62176,64224,64256,64481,64064,57635,33352,20837,0,4161,32,32,32}, {32,32,2081,8192,0,51524,63904,64288,64288,64320,64449,64064,55523,0,0,4161,0,32,32,32}, {2080,2080,0,8322,454,49444,63904,64288,64288,64288,64288,64000,57700,4485,8289,8224,32,2080,2080,2080}, {32,8257,0,29094,57960,61442,63904,64481,64288,64192,64321,61888,61442,57798,31077,0,8257,32,2080,32}, {32,8257,0,33157,63712,63968,62177,64416,62561,62561,64288,62145,62048,64000,51815,35335,0,2080,2080,2080}, {32,8257,0,33189,61700,62305,64513,62112,62850,64994,62144,64480,64513,62241,64001,55587,97,6144,4128,2080}, {32,8257,0,33189,63778,63840,61889,61440,62081,62465,64993,62497,62304,65026,64385,53250,225,6144,4128,2080}, {32,6209,0,26949,49768,59684,63904,62370,62560,62688,64931,62690,62561,62754,64256,53248,193,6144,4128,2080}, {2080,2080,4129,0,291,49349,64256,63008,65348,65254,60228,64963,62913,59392,63715,55749,98,2048,4128,2080}, {2080,2080,2081,10240,193,53317,64288,65280,54861,52718,65251,65120,62817,63744,47687,18789,2048,2080,2080,2080}, {2080,2080,2080,6144,193,34819,52002,65283,48557,27434,59083,63172,62944,47364,24803,0,6177,32,32,2080}, {2080,2080,32,0,10432,0,27461,65191,50605,0,232,61228,63206,3,0,8321,0,2080,2080,2080}, {2080,2080,2080,2080,2145,0,18916,37961,23206,0,4194,33801,35880,8193,4128,32,2080,32,32,2080}, {2080,32,32,32,0,2145,0,0,0,4257,4192,0,0,2080,2080,2080,2080,2080,2080,2080}, };
-const uint16_t leftright[20][20] = { {32,32,32,8257,0,0,30949,47463,53673,57801,57801,53673,47528,31013,0,0,10305,32,2080,2080}, {32,2080,8257,97,28965,55785,64043,64075,64043,64043,64043,64075,63849,63946,55818,28836,0,8257,2080,2080}, {32,8225,0,40964,63849,63881,63849,61801,63849,63849,63881,63623,62383,64205,63656,64107,41254,0,8257,32}, {8257,0,41254,64334,64367,62286,64366,64366,64366,64366,64367,64205,65340,65437,62318,63494,64108,41286,0,8257}, {195,28672,64529,65502,65502,65470,65502,65502,65502,65502,65502,65502,65503,65535,65470,64659,63492,64010,28900,0}, {227,55300,64659,63487,65535,65535,65535,65535,65535,65535,65535,65535,65535,65502,65535,65535,62870,63946,55753,0}, {31078,63591,64626,65535,65502,65503,65503,65503,65503,65503,65503,65503,65503,65535,65502,65535,65535,64399,63817,31046}, {47560,63559,62610,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65502,65535,65502,64723,61801,64075,47463}, {53737,63817,64464,65372,65373,65373,65373,65372,65373,65373,65373,65372,65502,65535,65373,64431,63494,64043,64011,53673}, {57801,64043,63913,63913,64075,63849,63816,64107,63913,63978,64042,63494,65178,65275,63978,63688,64107,64010,64010,57801}, {57801,64010,64010,64107,63688,63978,65275,65210,63494,64010,63978,63913,64107,63817,63849,64075,63913,63913,64043,57801}, {53673,64011,64043,63494,64431,65373,65535,65502,65373,65373,65373,65373,65372,65373,65373,65373,65372,64432,63817,53737}, {47463,64075,61768,64691,65502,65535,65502,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,62610,63559,47560}, {31046,63784,64464,65535,65535,65502,65535,65503,65503,65503,65503,65503,65503,65503,65503,65502,65535,64626,63591,31078}, {0,55753,64011,62935,65535,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,63487,64659,55300,227}, {0,28901,63978,63492,64756,65502,65535,65503,65502,65502,65502,65502,65502,65502,65470,65502,65502,64529,28672,195}, {10305,0,41286,64108,63493,62351,65437,65307,64172,64367,64366,64366,64366,64366,62286,64367,64334,41254,0,8257}, {32,8257,0,41254,64107,63591,64205,62351,63623,63881,63849,63849,61801,63849,63881,63849,40964,0,8257,32}, {2080,2080,8225,0,28836,55818,63946,63881,64075,64043,64043,64043,64075,64043,55785,28965,97,8257,2080,2080}, {2080,32,32,8225,0,0,31013,47528,53673,57801,57801,53673,47463,30949,0,0,8257,32,32,2080}, };
-const uint16_t updown[20][20] = { {2080,2080,32,10305,0,0,31046,47463,53673,57801,57801,53737,47560,31078,227,195,8257,32,32,32}, {32,2080,8257,0,28901,55753,63784,64075,64011,64010,64043,63817,63559,63591,55300,28672,0,8225,2080,32}, {32,8225,0,41286,63978,64011,64464,61768,64043,64010,63913,64464,62610,64626,64659,64529,41254,0,8257,32}, {8225,0,41254,64108,63492,62935,65535,64691,63494,64107,63913,65372,65535,65535,63487,65502,64334,40964,97,8257}, {0,28836,64107,63493,64756,65535,65535,65502,64431,63688,64075,65373,65535,65502,65535,65470,64367,63849,28965,0}, {0,55818,63591,62351,65502,65535,65502,65535,65373,63978,63849,65373,65535,65503,65535,65470,62286,63881,55785,0}, {31013,63946,64205,65437,65535,65502,65535,65502,65535,65275,63816,65373,65535,65503,65535,65502,64366,63849,64043,30949}, {47528,63881,62351,65307,65503,65535,65503,65535,65502,65210,64107,65372,65535,65503,65535,65502,64366,61801,64075,47463}, {53673,64075,63623,64172,65502,65535,65503,65535,65372,63494,63913,65373,65535,65503,65535,65502,64366,63849,64043,53673}, {57801,64043,63881,64367,65502,65535,65503,65535,65373,64010,63978,65373,65535,65503,65535,65502,64366,63849,64043,57801}, {57801,64043,63849,64366,65502,65535,65503,65535,65373,63978,64042,65373,65535,65503,65535,65502,64367,63881,64043,57801}, {53673,64043,63849,64366,65502,65535,65503,65535,65373,63913,63494,65372,65535,65503,65535,65502,64205,63623,64075,53673}, {47463,64075,61801,64366,65502,65535,65503,65535,65372,64107,65178,65502,65535,65503,65535,65503,65340,62383,63849,47528}, {30949,64043,63849,64366,65502,65535,65503,65535,65373,63817,65275,65535,65502,65535,65502,65535,65405,64205,63946,31013}, {0,55785,63881,62286,65470,65535,65503,65535,65373,63849,63978,65373,65535,65502,65535,65470,62286,63656,55818,0}, {0,28965,63849,64367,65470,65535,65502,65535,65373,64075,63688,64431,65502,65535,65535,64659,63494,64107,28836,0}, {8257,97,40964,64302,65502,63487,65535,65535,65372,63913,64107,63494,64723,65535,62870,63492,64108,41254,0,10305}, {32,8257,0,41254,64529,64659,64626,62610,64432,63913,64010,64043,61801,64399,63946,64010,41286,0,8257,32}, {32,2080,8257,0,28672,55300,63591,63559,63817,64043,64010,64011,64075,63817,55753,28900,0,8257,2080,2080}, {2080,2080,32,8257,195,227,31078,47560,53737,57801,57801,53673,47463,31046,0,0,8257,32,2080,2080}, };
-const uint16_t stop[20][20] = { {32,32,32,4096,4291,130,0,30720,38912,36864,36864,38912,30720,0,97,4323,4096,32,2080,2080}, {32,32,4096,260,0,22528,47691,58774,65243,63130,63130,63163,58807,47755,24576,0,260,6144,32,2080}, {32,4096,227,0,47852,58644,63195,58580,56045,56175,56175,56045,58515,63195,58677,47885,4096,260,6144,32}, {4096,228,0,47885,65470,60952,53252,53255,53254,53254,53254,53253,53255,53252,60855,65502,50095,0,260,4096}, {195,0,47820,65470,60920,53248,55561,55593,55593,55593,55593,55593,55593,55593,53248,58807,65502,47950,0,227}, {130,24576,58677,60952,53248,55625,55593,53480,55560,53512,53512,55528,55528,55561,55657,53248,60887,60790,26624,130}, {0,47755,63195,53251,55625,55593,55560,55560,55560,55560,55560,55560,55560,55560,55561,55689,53248,63162,49998,0}, {30722,58774,58547,53254,53288,53255,53255,53255,53255,53255,53255,53255,53255,53255,53255,53320,53254,58515,58839,35013}, {40963,65275,53609,58644,63389,63292,63324,63324,63324,63324,63324,63324,63324,63324,63292,63389,58742,53254,65275,45384}, {38915,63162,53771,60822,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,60952,53448,63195,43303}, {38915,63162,53771,58774,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,60920,53448,63195,43303}, {40963,65243,53609,58709,65535,65438,65470,65470,65470,65470,65470,65470,65470,65470,65438,65535,60855,53254,65275,43335}, {32769,58872,58450,53545,55884,55851,55851,55851,55851,55851,55851,55851,55851,55851,55851,55884,55625,56305,60952,37094}, {0,49868,63195,53248,55528,53288,53255,53256,53256,53256,53256,53256,53256,53255,53255,55593,53248,63162,52111,0}, {64,26625,58710,58742,53248,55722,55593,55561,55593,55593,55593,55593,55593,55593,55722,53248,58677,60822,30885,0}, {227,0,50030,65503,58709,53248,55690,55593,55560,55560,55560,55560,55593,55722,53248,58612,65535,52208,0,260}, {4096,260,10240,52240,65503,58774,53248,53255,55400,53255,53255,55368,53255,53248,58709,65535,54418,16384,292,4096}, {32,6144,227,12288,52208,60822,63162,58450,53545,55883,55883,53609,56337,63162,60855,54289,16384,195,6144,32}, {2080,32,6144,260,4096,30853,52176,58871,65275,63162,63162,65243,60952,52144,32901,6144,260,6144,32,2080}, {2080,2080,32,4096,227,97,0,35078,45545,43465,43465,45513,35078,0,32,260,6144,32,2080,2080}, };
-const uint16_t manualText[20][80] = { {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,2080,4128,4160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2080,4128,4160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2080,4128,4160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,2048,41472,62208,62240,64288,18688,60160,62208,16608,16608,62208,60160,8288,0,0,0,0,0,2048,41472,62208,62240,64288,18688,60160,62208,16608,16608,62208,60160,8288,0,0,0,0,0,2048,41472,62208,62240,64288,18688,60160,62208,16608,16608,62208,60160,8288,0,0,0,0,0,41472,62208,49792,45632,62208,41472,39424,62208,62208,62208,62208,31104,37344,62208,49760,43552,62208,33184,0,0,0,0,0}, {0,0,0,22816,64288,29024,6208,49792,10368,37312,47712,31136,31104,47712,35264,0,0,0,0,0,0,22816,64288,29024,6208,49792,10368,37312,47712,31136,31104,47712,35264,0,0,0,0,0,0,22816,64288,29024,6208,49792,10368,37312,47712,31136,31104,47712,35264,0,0,0,0,0,0,10368,64288,24896,53920,43552,2080,10368,64288,16608,29056,43552,33184,2080,56000,41472,37312,51840,2048,0,0,0,0,0}, {0,0,0,10368,64288,64288,56000,31104,2048,29024,49792,60128,60128,49792,26976,0,0,0,0,0,0,10368,64288,64288,56000,31104,2048,29024,49792,60128,60128,49792,26976,0,0,0,0,0,0,10368,64288,64288,56000,31104,2048,29024,49792,60128,60128,49792,26976,0,0,0,0,0,0,8288,64288,62240,60160,2080,0,8288,64288,58048,64288,10368,4128,0,24864,62240,62208,18656,0,0,0,0,0,0}, {0,0,0,10368,22816,35264,58080,64288,20736,20736,64288,49792,51840,64288,20736,0,0,0,0,0,0,10368,22816,35264,58080,64288,20736,20736,64288,49792,51840,64288,20736,0,0,0,0,0,0,10368,22816,35264,58080,64288,20736,20736,64288,49792,51840,64288,20736,0,0,0,0,0,0,8288,64288,53920,64288,35264,0,8288,64288,35264,62208,18656,12448,0,0,56000,51872,0,0,0,0,0,0,0}, {0,0,0,33184,58080,10368,18656,64288,29024,14528,64288,31104,33184,64288,14528,0,0,0,0,0,0,33184,58080,10368,18656,64288,29024,14528,64288,31104,33184,64288,14528,0,0,0,0,0,0,33184,58080,10368,18656,64288,29024,14528,64288,31104,33184,64288,14528,0,0,0,0,0,0,16576,64288,24896,41472,62208,12448,16576,64288,26944,16576,49760,33184,0,12448,51840,51840,12448,0,0,0,0,0,0}, {0,0,0,31104,64288,64288,64288,49792,4128,6240,64288,12448,12448,64288,6240,0,0,0,0,0,0,31104,64288,64288,64288,49792,4128,6240,64288,12448,12448,64288,6240,0,0,0,0,0,0,31104,64288,64288,64288,49792,4128,6240,64288,12448,12448,64288,6240,0,0,0,0,0,0,43552,64288,51872,8288,58048,51840,43552,64288,64288,64288,64288,31104,0,58048,64288,64288,56000,0,0,0,0,0,0}, {0,0,0,2080,4160,8288,4128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2080,4160,8288,4128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2080,4160,8288,4128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,8320,26976,20736,2080,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4128,20736,22816,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4160,24896,24896,4128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4160,24896,24896,4128,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,8288,64288,53920,62208,47712,0,0,0,0,0,0,0,0,0,0,0,0,0,0,45632,62208,53920,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2080,53920,62208,62208,53920,2080,0,0,0,0,0,0,0,0,0,0,0,0,2080,53920,62208,62208,53920,2080,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,2080,18688,0,35264,62240,2048,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33184,53920,0,0,0,0,0,0,0,0,0,0,0,0,0,0,22816,64288,14496,14496,64288,22816,0,0,0,0,0,0,0,0,0,0,0,0,22816,64288,14496,14496,64288,22816,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,8288,60128,43552,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33184,53920,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31104,64288,2080,2080,64288,31104,0,0,0,0,0,0,0,0,0,0,0,0,31104,64288,2080,2080,64288,31104,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,8288,56000,53920,4160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33184,53920,0,0,0,0,0,0,0,0,0,0,0,0,0,0,20736,64288,8288,8288,64288,20736,0,0,0,0,0,0,0,0,0,0,0,0,20736,64288,8288,8288,64288,20736,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,6208,56000,62208,24864,49792,4160,0,0,0,0,0,0,0,0,0,0,0,0,0,12448,41472,56000,14528,0,0,0,0,0,0,0,0,0,0,0,0,0,4160,64288,39392,39392,64288,4160,0,0,0,0,0,0,0,0,0,0,0,0,4160,64288,39392,39392,64288,4160,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,24896,64288,64288,64288,64288,4160,0,0,0,0,0,0,0,0,0,0,0,0,2048,62208,64288,64288,64288,10368,0,0,0,0,0,0,0,0,0,0,0,0,0,37312,64288,64288,35264,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37312,64288,64288,35264,0,0,0,0,0,0,0,0,0,0,0,0}, };
-const uint16_t manualTextDown[20][80] = { {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,2080,4128,4160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2080,4128,4160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2080,4128,4160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,2048,41472,62208,62240,64288,18688,60160,62208,16608,16608,62208,60160,8288,0,0,0,0,0,2048,41472,62208,62240,64288,18688,60160,62208,16608,16608,62208,60160,8288,0,0,0,0,0,2048,41472,62208,62240,64288,18688,60160,62208,16608,16608,62208,60160,8288,0,0,0,0,0,41472,62208,49792,45632,62208,41472,39424,62208,62208,62208,62208,31104,37344,62208,49760,43552,62208,33184,0,0,0,0,0}, {0,0,0,22816,64288,29024,6208,49792,10368,37312,47712,31136,31104,47712,35264,0,0,0,0,0,0,22816,64288,29024,6208,49792,10368,37312,47712,31136,31104,47712,35264,0,0,0,0,0,0,22816,64288,29024,6208,49792,10368,37312,47712,31136,31104,47712,35264,0,0,0,0,0,0,10368,64288,24896,53920,43552,2080,10368,64288,16608,29056,43552,33184,2080,56000,41472,37312,51840,2048,0,0,0,0,0}, {0,0,0,10368,64288,64288,56000,31104,2048,29024,49792,60128,60128,49792,26976,0,0,0,0,0,0,10368,64288,64288,56000,31104,2048,29024,49792,60128,60128,49792,26976,0,0,0,0,0,0,10368,64288,64288,56000,31104,2048,29024,49792,60128,60128,49792,26976,0,0,0,0,0,0,8288,64288,62240,60160,2080,0,8288,64288,58048,64288,10368,4128,0,24864,62240,62208,18656,0,0,0,0,0,0}, {0,0,0,10368,22816,35264,58080,64288,20736,20736,64288,49792,51840,64288,20736,0,0,0,0,0,0,10368,22816,35264,58080,64288,20736,20736,64288,49792,51840,64288,20736,0,0,0,0,0,0,10368,22816,35264,58080,64288,20736,20736,64288,49792,51840,64288,20736,0,0,0,0,0,0,8288,64288,53920,64288,35264,0,8288,64288,35264,62208,18656,12448,0,0,56000,51872,0,0,0,0,0,0,0}, {0,0,0,33184,58080,10368,18656,64288,29024,14528,64288,31104,33184,64288,14528,0,0,0,0,0,0,33184,58080,10368,18656,64288,29024,14528,64288,31104,33184,64288,14528,0,0,0,0,0,0,33184,58080,10368,18656,64288,29024,14528,64288,31104,33184,64288,14528,0,0,0,0,0,0,16576,64288,24896,41472,62208,12448,16576,64288,26944,16576,49760,33184,0,12448,51840,51840,12448,0,0,0,0,0,0}, {0,0,0,31104,64288,64288,64288,49792,4128,6240,64288,12448,12448,64288,6240,0,0,0,0,0,0,31104,64288,64288,64288,49792,4128,6240,64288,12448,12448,64288,6240,0,0,0,0,0,0,31104,64288,64288,64288,49792,4128,6240,64288,12448,12448,64288,6240,0,0,0,0,0,0,43552,64288,51872,8288,58048,51840,43552,64288,64288,64288,64288,31104,0,58048,64288,64288,56000,0,0,0,0,0,0}, {0,0,0,2080,4160,8288,4128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2080,4160,8288,4128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2080,4160,8288,4128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,2080,20736,16576,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4128,22816,22816,4128,0,0,0,0,0,0,0,0,0,0,0,0,0,6208,20736,20736,20736,16576,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8320,24896,22816,2080,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,2080,56000,53920,58048,45632,0,0,0,0,0,0,0,0,0,0,0,0,0,4160,58080,53920,53920,58080,4128,0,0,0,0,0,0,0,0,0,0,0,0,29024,60160,56000,62208,49760,0,0,0,0,0,0,0,0,0,0,0,0,0,2080,60128,49792,60160,45632,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,16608,64288,12448,22816,64288,10368,0,0,0,0,0,0,0,0,0,0,0,0,10368,64288,26944,26944,64288,12448,0,0,0,0,0,0,0,0,0,0,0,0,4128,4128,0,49792,31136,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4160,47712,51872,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,4128,62208,51840,53920,64288,14528,0,0,0,0,0,0,0,0,0,0,0,0,0,43552,64288,64288,45632,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8288,64288,12448,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51840,64288,29056,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,16608,45632,56000,64288,6208,0,0,0,0,0,0,0,0,0,0,0,0,8320,64288,37344,37344,64288,10368,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31136,58080,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4160,39424,60160,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,10368,56000,45632,0,0,0,0,0,0,0,0,0,0,0,0,0,14528,64288,22816,22816,64288,18656,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56000,41472,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8288,29056,14496,41472,60160,2080,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,6208,51840,64288,47680,6208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41472,62240,62240,43552,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12448,64288,22816,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12448,60160,64288,60128,26976,0,0,0,0,0,0,0,0,0,0,0,0}, };
-const uint16_t pause[20][40] = { {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8288,26944,12448,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,43552,64288,39392,62240,64288,31104,64288,64288,64288,64288,12448,58080,64288,35264,64288,47680,0,47712,62208,29024,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,14528,64288,29056,58080,12448,0,64288,22816,31136,49792,10368,12448,64288,26944,60160,6208,0,0,49792,29024,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,14528,64288,64288,47680,0,0,62240,60160,58080,0,0,0,39392,64288,26976,0,0,0,49792,29024,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,14528,64288,20736,62208,26944,0,64288,18656,20736,53920,12448,0,16576,64288,8288,0,0,2080,49792,29056,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,45632,64288,33184,29056,64288,35264,64288,64288,64288,64288,12448,14528,64288,64288,64288,8288,4160,62208,64288,64288,39424,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,31104,64288,64288,56000,29024,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,4128,64288,16576,35264,62240,2080,47712,58080,60160,24896,0,53920,43552,22816,58080,16576,4160,51840,56000,60160,29056,0,20736,49760,58080,39424,2080,0,0,0,0,0,0,0}, {0,0,0,0,0,0,2080,64288,53920,62208,43552,0,29056,35264,49792,49792,0,33184,47712,2048,60160,18656,16576,64288,43552,37312,14528,4160,60160,43552,31104,62240,26944,0,0,0,0,0,0,0}, {0,0,0,0,0,0,4128,64288,26976,6240,0,18656,64288,22816,39392,53920,0,26976,53920,8288,64288,20736,10368,39392,33184,56000,43552,4128,60160,41472,22816,35264,18656,0,0,0,0,0,0,0}, {0,0,0,0,0,0,31104,64288,62240,6208,0,6208,58080,62208,53920,64288,18656,10368,58080,62208,62208,49760,22816,64288,53920,58080,24896,0,24864,56000,64288,56000,16576,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,4160,0,0,0,0,2048,2080,0,0,2048,2080,6208,0,0,0,0,0,4128,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, };
-
-//arrows and texts
-const uint16_t up[16][16] = { {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,63454,63454,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,42227,40114,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,31858,52108,52237,31858,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,36083,47654,61923,62379,50125,36083,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,31987,47622,62022,59974,59875,64428,50158,31987,65535,65535,65535,65535}, {65535,65535,65535,44308,51750,64102,62021,59973,59941,59776,64460,52205,46388,65535,65535,65535}, {65535,65535,35985,25063,45574,41446,49670,61956,62283,51946,41184,47948,25193,33873,65535,65535}, {65535,65535,46518,44470,44535,29842,37350,61889,64526,39789,29712,44471,44438,46518,65535,65535}, {65535,65535,65535,65535,65535,50842,41478,61922,64526,43884,50712,65535,65535,65535,65535,65535}, {65535,65535,65503,63422,65535,46616,39398,59842,62445,43884,46486,65535,63422,65503,65535,65535}, {65535,65535,65535,65535,65535,50777,20935,31272,31369,21000,50777,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65503,61309,59293,59261,59261,65503,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, };
-const uint16_t down[16][16] = { {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65503,59261,59261,59293,61309,65503,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,50777,21000,31369,31272,20935,50777,65535,65535,65535,65535,65535}, {65535,65535,65503,63422,65535,46486,43884,62445,59842,39398,46616,65535,63422,65503,65535,65535}, {65535,65535,65535,65535,65535,50712,43884,64526,61922,41478,50842,65535,65535,65535,65535,65535}, {65535,65535,46518,44438,44471,29712,39789,64526,61889,37350,29842,44535,44470,46518,65535,65535}, {65535,65535,33873,25193,47948,41184,51946,62283,61956,49670,41446,45574,25063,35985,65535,65535}, {65535,65535,65535,46388,52205,64460,59776,59941,59973,62021,64102,51750,44308,65535,65535,65535}, {65535,65535,65535,65535,31987,50158,64428,59875,59974,62022,47622,31987,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,36083,50125,62379,61923,47654,36083,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,31858,52237,52108,31858,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,40114,42227,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,63454,63454,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, };
-const uint16_t left[16][16] = { {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,33873,46518,65535,65503,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,46388,25193,44438,65535,63422,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,31987,52205,47948,44471,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,36083,50158,64460,41184,29712,50712,46486,50777,65503,65535,65535}, {65535,65535,65535,65535,31858,50125,64428,59776,51946,39789,43884,43884,21000,59261,65535,65535}, {65535,65535,63454,40114,52237,62379,59875,59941,62283,64526,64526,62445,31369,59261,65535,65535}, {65535,65535,63454,42227,52108,61923,59974,59973,61956,61889,61922,59842,31272,59293,65535,65535}, {65535,65535,65535,65535,31858,47654,62022,62021,49670,37350,41478,39398,20935,61309,65535,65535}, {65535,65535,65535,65535,65535,36083,47622,64102,41446,29842,50842,46616,50777,65503,65535,65535}, {65535,65535,65535,65535,65535,65535,31987,49702,45574,44535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,44308,25063,44470,65535,63422,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,35985,46518,65535,65503,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, };
-const uint16_t right[16][16] = { {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65503,65535,46518,35985,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,63422,65535,44470,25063,44308,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,44535,45574,49702,31987,65535,65535,65535,65535,65535,65535}, {65535,65535,65503,50777,46616,50842,29842,41446,64102,47622,36083,65535,65535,65535,65535,65535}, {65535,65535,61309,20935,39398,41478,37350,49670,62021,62022,47654,31858,65535,65535,65535,65535}, {65535,65535,59293,31272,59842,61922,61889,61956,59973,59974,61923,52108,42227,63454,65535,65535}, {65535,65535,59261,31369,62445,64526,64526,62283,59941,59875,62379,52237,40114,63454,65535,65535}, {65535,65535,59261,21000,43884,43884,39789,51946,59776,64428,50125,31858,65535,65535,65535,65535}, {65535,65535,65503,50777,46486,50712,29712,41184,64460,50158,36083,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,44471,47948,52205,31987,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,63422,65535,44438,25193,46388,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65503,65535,46518,33873,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, };
-const uint16_t fire[16][16] = { {32,32,32,2080,6436,2243,4096,10305,14336,422,56042,47785,32,8257,32,2080}, {32,32,4096,0,52105,45929,0,129,292,49737,45478,18432,2081,4128,32,2080}, {32,32,2048,1,45766,37542,18660,47622,47623,62177,51845,29192,4160,4128,32,2080}, {32,2080,32,6208,0,12516,49605,63747,63970,62305,64032,47689,194,8192,0,2080}, {32,32,2080,8257,16481,49604,63906,61920,64289,61728,61829,39366,0,6176,32,2080}, {2080,32,6176,6176,51428,64096,64288,64320,64449,63905,39301,324,8192,2080,32,32}, {32,32,4096,292,51492,64096,64320,64320,64320,63906,33027,0,12288,32,2080,32}, {6209,0,16644,49736,59394,64192,64384,64160,64288,61664,57701,33189,33,8224,32,2080}, {6209,0,20804,59715,64128,62305,64609,62689,64192,62209,64000,55814,35270,0,6208,2080}, {6209,0,22852,59651,64288,64160,62401,62818,62560,64448,62593,64321,51202,129,8192,2080}, {6209,0,18692,53767,61570,61824,62144,62496,64994,62401,62786,64545,49152,193,8192,2080}, {2080,4129,4128,16773,53348,64576,63171,65189,62500,64995,62432,63491,49572,33,8224,2080}, {2080,33,6144,224,51205,64832,59114,50637,65253,63040,64321,47302,16772,0,2080,2080}, {2080,2080,4128,8449,24579,56672,61132,19082,48554,65351,50210,12291,2272,4128,32,2080}, {2080,2080,32,8352,0,37927,48426,2,8454,52747,29604,0,10465,0,2080,2080}, {2080,32,2080,32,6144,8355,2,4192,10496,3,6146,6208,0,2080,32,2080}, };
-// const uint16_t p1Text[20][80] = { {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,6208,4128,0,0,0,0,0,0,0,0,0,0,0,0,4128,4128,4128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2080,4128,4160,0,0,0,0,0,0,0,0,0,0,0,0,6208,4128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,8288,56000,58080,64288,24896,64288,39424,14528,64288,43552,0,0,0,0,0,39424,58080,62208,35264,56000,62208,2080,53920,64288,6208,0,0,0,0,0,0,0,0,0,29024,60128,60160,49760,43552,64288,14496,39424,64288,18656,0,0,0,0,8288,56000,58080,64288,24896,64288,39424,14528,64288,43552,0,0,0,0,20736,64288,43552,62208,60128,33184,64288,64288,64288,39392,43552,64288,39392,64288,26976,0,0}, {0,31104,60128,12448,35264,6208,53920,31104,39392,51840,14528,0,0,0,0,4160,64288,31104,18688,24896,26976,39392,47712,33184,39424,0,0,0,0,0,0,0,0,0,0,56000,41472,14496,33184,14528,49792,39424,31104,53920,0,0,0,0,0,31104,60128,12448,35264,6208,53920,31104,39392,51840,14528,0,0,0,0,0,58080,35264,58048,10368,8288,62240,18656,33184,35264,6208,62208,31104,51840,0,0,0}, {0,10368,56000,64288,53920,6208,45632,56000,58048,56000,8288,0,0,0,0,0,41472,64288,62208,22816,20736,56000,60128,56000,33184,0,0,0,0,0,0,0,0,0,0,29056,62208,64288,33184,8288,56000,58080,56000,45632,0,0,0,0,0,10368,56000,64288,53920,6208,45632,56000,58048,56000,8288,0,0,0,0,0,58080,64288,45632,0,6240,64288,62208,29056,0,0,35264,64288,18656,0,0,0}, {0,33184,22816,14496,62240,22816,39424,58080,31136,64288,0,0,0,0,0,10368,45632,6240,45632,49760,14496,64288,24896,64288,26944,0,0,0,0,0,0,0,0,0,0,51840,8288,35264,62208,2048,64288,31104,60128,39392,0,0,0,0,0,33184,22816,14496,62240,22816,39424,58080,31136,64288,0,0,0,0,0,0,58080,29024,62208,18656,8288,62208,10368,29024,37344,0,12448,62240,0,0,0,0}, {0,37344,64288,56000,53920,6208,31104,37344,12448,56000,0,0,0,0,0,12448,64288,58048,58080,24896,6208,60160,2080,49792,18656,0,0,0,0,0,0,0,0,0,0,64288,60128,58048,35264,0,58048,12448,37344,31104,0,0,0,0,0,37344,64288,56000,53920,6208,31104,37344,12448,56000,0,0,0,0,0,20736,64288,41472,31104,62208,35264,64288,64288,64288,39392,6240,64288,64288,56000,0,0,0}, {0,2080,4128,6208,0,0,0,0,0,0,0,0,0,0,0,0,4160,6208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4160,4160,2080,0,0,0,0,0,0,0,0,0,0,0,2080,4128,6208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,14496,22816,4160,0,0,0,0,0,0,0,0,0,0,0,6240,22816,12448,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14528,14528,0,0,0,0,0,0,0,0,0,0,0,0,4128,18656,2048,0,0,0,0,0,0,0,0,0,0,0,0,16608,8288,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,12416,49792,45632,49792,0,0,0,0,0,0,0,0,0,0,0,58080,43552,62208,14496,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,20736,56000,41504,0,0,0,0,0,0,0,0,0,0,0,8288,60160,53920,56000,0,0,0,0,0,0,0,0,0,0,0,43552,56000,62208,18656,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,2080,35264,51840,0,0,0,0,0,0,0,0,0,0,0,12448,0,56000,24896,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26976,41504,0,0,0,0,0,0,0,0,0,0,0,26944,47712,0,60160,12448,0,0,0,0,0,0,0,0,0,2080,62208,8320,35264,39392,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,10368,51872,45632,0,0,0,0,0,0,0,0,0,0,0,0,33184,56000,4160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26976,41504,0,0,0,0,0,0,0,0,0,0,0,35264,41472,0,53920,22816,0,0,0,0,0,0,0,0,0,10368,64288,2080,26976,47712,0,0,0,0,0,0,0,0,0,0}, {0,0,0,4160,6208,12448,64288,2080,0,0,0,0,0,0,0,0,0,0,31136,58048,20736,12448,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26976,41504,0,0,0,0,0,0,0,0,0,0,0,20736,53920,10368,62208,8288,0,0,0,0,0,0,0,0,0,0,60128,18656,43552,33184,0,0,0,0,0,0,0,0,0,0}, {0,0,0,22816,62240,62208,37344,0,0,0,0,0,0,0,0,0,0,6240,64288,64288,64288,29056,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35264,64288,64288,43552,0,0,0,0,0,0,0,0,0,0,4128,45632,62240,37344,0,0,0,0,0,0,0,0,0,0,0,26976,60160,51872,10368,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,2080,4128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4128,0,0,0,0,0,0,0,0,0,0,0,0,0,2080,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, };
-const uint16_t p1Text[20][80] = { {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,6208,4128,0,0,0,0,0,0,0,0,0,0,0,0,4128,4128,4128,0,0,0,0,0,0,0,0,0,0,0,0,4160,4160,0,0,0,0,0,0,0,0,0,0,0,0,4160,4128,2080,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,8288,56000,58080,64288,24896,64288,39424,14528,64288,43552,0,0,0,0,0,39424,58080,62208,35264,56000,62208,2080,53920,64288,6208,0,0,0,0,18656,58080,58080,62208,31104,64288,26944,26976,64288,31104,0,0,0,0,2080,49792,58080,64288,26976,62240,51872,2080,62240,56000,0,0,0,0,8288,64288,53920,51840,64288,24896,64288,64288,64288,51840,31104,64288,39392,64288,39424,0,0,0,0,0}, {0,0,0,31104,60128,12448,35264,6208,53920,31104,39392,51840,14528,0,0,0,0,4160,64288,31104,18688,24896,26976,39392,47712,33184,39424,0,0,0,0,0,43552,49792,12416,37344,2080,62240,29024,29024,64288,2080,0,0,0,0,16608,64288,18656,26976,14528,41472,33184,47712,39392,26976,0,0,0,0,0,45632,39392,58080,18656,0,58080,20736,29024,47712,0,53920,31104,60128,4160,0,0,0,0,0}, {0,0,0,10368,56000,64288,53920,6208,45632,56000,58048,56000,8288,0,0,0,0,0,41472,64288,62208,22816,20736,56000,60128,56000,33184,0,0,0,0,0,18656,60128,64288,45632,0,60128,51872,53920,58080,0,0,0,0,0,4128,49792,64288,58080,14496,33184,56000,60128,56000,20736,0,0,0,0,0,45632,64288,56000,4128,0,58080,62208,41504,0,0,22816,64288,31104,0,0,0,0,0,0}, {0,0,0,33184,22816,14496,62240,22816,39424,58080,31136,64288,0,0,0,0,0,10368,45632,6240,45632,49760,14496,64288,24896,64288,26944,0,0,0,0,0,43552,14528,24896,64288,10368,51872,45632,45632,51872,0,0,0,0,0,22816,35264,8288,56000,35264,26944,64288,24896,64288,14496,0,0,0,0,0,45632,35264,56000,31104,0,58080,16576,22816,49760,0,0,62240,12416,0,0,0,0,0,0}, {0,0,0,37344,64288,56000,53920,6208,31104,37344,12448,56000,0,0,0,0,0,12448,64288,58048,58080,24896,6208,60160,2080,49792,18656,0,0,0,0,0,51840,62208,56000,47712,0,45632,24864,24896,43552,0,0,0,0,0,24896,64288,56000,58048,12448,18656,49792,2080,60160,6208,0,0,0,0,8288,64288,53920,18656,62240,31104,64288,64288,64288,51840,0,58048,64288,64288,6208,0,0,0,0,0}, {0,0,0,2080,4128,6208,0,0,0,0,0,0,0,0,0,0,0,0,4160,6208,0,0,0,0,0,0,0,0,0,0,0,0,4160,4128,4128,0,0,0,0,0,0,0,0,0,0,0,2048,4128,6208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,14496,22816,4160,0,0,0,0,0,0,0,0,0,0,0,6240,22816,12448,0,0,0,0,0,0,0,0,0,0,0,0,12448,18688,0,0,0,0,0,0,0,0,0,0,0,0,2048,18688,4128,0,0,0,0,0,0,0,0,0,0,0,0,12448,12448,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,12416,49792,45632,49792,0,0,0,0,0,0,0,0,0,0,0,58080,43552,62208,14496,0,0,0,0,0,0,0,0,0,0,10368,53920,56000,0,0,0,0,0,0,0,0,0,0,0,0,56000,53920,60160,8288,0,0,0,0,0,0,0,0,0,0,31104,60128,60128,31104,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,2080,35264,51840,0,0,0,0,0,0,0,0,0,0,0,12448,0,56000,24896,0,0,0,0,0,0,0,0,0,0,0,14496,56000,0,0,0,0,0,0,0,0,0,0,0,12448,60160,0,47712,26944,0,0,0,0,0,0,0,0,0,0,51840,22816,22816,51840,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,10368,51872,45632,0,0,0,0,0,0,0,0,0,0,0,0,33184,56000,4160,0,0,0,0,0,0,0,0,0,0,0,14496,56000,0,0,0,0,0,0,0,0,0,0,0,22816,53920,0,41472,35264,0,0,0,0,0,0,0,0,0,0,62208,14528,14528,62208,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,4160,6208,12448,64288,2080,0,0,0,0,0,0,0,0,0,0,31136,58048,20736,12448,0,0,0,0,0,0,0,0,0,0,0,14496,56000,0,0,0,0,0,0,0,0,0,0,0,8288,62208,10368,53920,20736,0,0,0,0,0,0,0,0,0,0,47680,31104,31104,47680,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,22816,62240,62208,37344,0,0,0,0,0,0,0,0,0,0,6240,64288,64288,64288,29056,0,0,0,0,0,0,0,0,0,0,22816,64288,64288,58048,0,0,0,0,0,0,0,0,0,0,0,39392,64288,45632,4128,0,0,0,0,0,0,0,0,0,0,18656,58048,56000,18656,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,2080,4128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4128,0,0,0,0,0,0,0,0,0,0,0,0,0,2048,2048,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, };
-const uint16_t p2Text[20][80] = { {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,6208,4128,0,0,0,0,0,0,0,0,0,0,0,0,4128,4128,4128,0,0,0,0,0,0,0,0,0,0,0,0,4160,4160,0,0,0,0,0,0,0,0,0,0,0,0,4160,4128,2080,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,8288,56000,58080,64288,24896,64288,39424,14528,64288,43552,0,0,0,0,0,39424,58080,62208,35264,56000,62208,2080,53920,64288,6208,0,0,0,0,18656,58080,58080,62208,31104,64288,26944,26976,64288,31104,0,0,0,0,2080,49792,58080,64288,26976,62240,51872,2080,62240,56000,0,0,0,0,8288,64288,53920,51840,64288,24896,64288,64288,64288,51840,31104,64288,39392,64288,39424,0,0,0,0,0}, {0,0,0,31104,60128,12448,35264,6208,53920,31104,39392,51840,14528,0,0,0,0,4160,64288,31104,18688,24896,26976,39392,47712,33184,39424,0,0,0,0,0,43552,49792,12416,37344,2080,62240,29024,29024,64288,2080,0,0,0,0,16608,64288,18656,26976,14528,41472,33184,47712,39392,26976,0,0,0,0,0,45632,39392,58080,18656,0,58080,20736,29024,47712,0,53920,31104,60128,4160,0,0,0,0,0}, {0,0,0,10368,56000,64288,53920,6208,45632,56000,58048,56000,8288,0,0,0,0,0,41472,64288,62208,22816,20736,56000,60128,56000,33184,0,0,0,0,0,18656,60128,64288,45632,0,60128,51872,53920,58080,0,0,0,0,0,4128,49792,64288,58080,14496,33184,56000,60128,56000,20736,0,0,0,0,0,45632,64288,56000,4128,0,58080,62208,41504,0,0,22816,64288,31104,0,0,0,0,0,0}, {0,0,0,33184,22816,14496,62240,22816,39424,58080,31136,64288,0,0,0,0,0,10368,45632,6240,45632,49760,14496,64288,24896,64288,26944,0,0,0,0,0,43552,14528,24896,64288,10368,51872,45632,45632,51872,0,0,0,0,0,22816,35264,8288,56000,35264,26944,64288,24896,64288,14496,0,0,0,0,0,45632,35264,56000,31104,0,58080,16576,22816,49760,0,0,62240,12416,0,0,0,0,0,0}, {0,0,0,37344,64288,56000,53920,6208,31104,37344,12448,56000,0,0,0,0,0,12448,64288,58048,58080,24896,6208,60160,2080,49792,18656,0,0,0,0,0,51840,62208,56000,47712,0,45632,24864,24896,43552,0,0,0,0,0,24896,64288,56000,58048,12448,18656,49792,2080,60160,6208,0,0,0,0,8288,64288,53920,18656,62240,31104,64288,64288,64288,51840,0,58048,64288,64288,6208,0,0,0,0,0}, {0,0,0,2080,4128,6208,0,0,0,0,0,0,0,0,0,0,0,0,4160,6208,0,0,0,0,0,0,0,0,0,0,0,0,4160,4128,4128,0,0,0,0,0,0,0,0,0,0,0,2048,4128,6208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,8288,18656,2048,0,0,0,0,0,0,0,0,0,0,0,4128,20736,12448,0,0,0,0,0,0,0,0,0,0,0,12416,16608,16608,10368,0,0,0,0,0,0,0,0,0,0,0,0,12448,24864,6208,0,0,0,0,0,0,0,0,0,0,0,12448,12448,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,10368,60160,43552,49792,0,0,0,0,0,0,0,0,0,0,0,53920,43552,56000,24896,0,0,0,0,0,0,0,0,0,0,47712,47680,56000,37344,0,0,0,0,0,0,0,0,0,0,0,31104,56000,26976,2080,0,0,0,0,0,0,0,0,0,0,31104,60128,60128,31104,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,26944,49792,6208,64288,6208,0,0,0,0,0,0,0,0,0,0,58080,31104,49760,33184,0,0,0,0,0,0,0,0,0,0,4160,0,45632,20736,0,0,0,0,0,0,0,0,0,0,0,58080,37344,14496,0,0,0,0,0,0,0,0,0,0,0,51840,22816,22816,51840,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,6240,60128,62208,64288,6208,0,0,0,0,0,0,0,0,0,0,39424,60160,64288,14528,0,0,0,0,0,0,0,0,0,0,0,4160,62208,4128,0,0,0,0,0,0,0,0,0,0,10368,64288,45632,62240,10368,0,0,0,0,0,0,0,0,0,0,62208,14528,14528,62208,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,2080,31136,47712,0,0,0,0,0,0,0,0,0,0,2048,62240,12448,39392,39424,0,0,0,0,0,0,0,0,0,0,0,26944,49792,0,0,0,0,0,0,0,0,0,0,0,4128,64288,4128,51872,22816,0,0,0,0,0,0,0,0,0,0,47680,31104,31104,47680,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,10368,47712,58080,16576,0,0,0,0,0,0,0,0,0,0,0,37344,58080,58080,18656,0,0,0,0,0,0,0,0,0,0,0,47712,31136,0,0,0,0,0,0,0,0,0,0,0,0,37344,58080,51872,4128,0,0,0,0,0,0,0,0,0,0,18656,58048,56000,18656,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,2048,6208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4128,0,0,0,0,0,0,0,0,0,0,0,0,0,2080,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4128,0,0,0,0,0,0,0,0,0,0,0,0,0,2048,2048,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, };
-
-//purple small tank 
-const uint16_t psup[14][14] = { {0,0,0,0,0,0,2050,2082,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,32,0,10438,20558,39700,39700,20558,10438,0,32,0,0}, {0,0,2113,14506,35412,26960,27246,27246,26960,35380,14506,2113,0,0}, {0,0,16586,14505,29073,37620,27309,27309,37620,29073,14505,16586,0,0}, {0,0,16586,16586,20621,41845,29389,29389,41845,20621,16586,16586,0,0}, {0,31281,16586,31249,35539,29168,16523,16523,29201,35539,29201,16586,31281,0}, {0,31281,16586,31281,35571,22830,29330,29330,24911,37619,31281,16586,31281,0}, {0,31281,16586,31281,35539,22862,29427,29427,24911,35539,31281,16586,31281,0}, {0,31281,16586,27056,35506,37651,27120,27088,37651,35506,27056,16586,31281,0}, {0,0,16586,16396,27024,44022,46134,46134,44022,27024,16396,16586,0,0}, {0,0,4130,14442,31281,26992,43990,43989,26992,31281,14441,4130,0,0}, {0,0,2081,33,10438,8293,14536,14536,8293,10406,32,2081,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0}, };
-const uint16_t psru[14][14] = { {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65503,65534,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,29488,35667,35699,48504,65503,65535,65535,65535}, {65535,65535,65535,65535,65535,35794,24943,33394,33457,41909,46391,65535,65535,65535}, {65535,65535,65535,65535,44182,37651,35570,35666,31503,31313,39957,65535,65503,65535}, {65535,65535,65535,42166,35603,35602,27184,23052,35666,33395,29360,61341,65535,65535}, {65535,65535,52761,22894,37683,29329,29362,27152,35603,22862,35826,65535,65535,65535}, {65535,65535,63390,35603,39828,39828,29297,35602,37684,37875,65535,65535,65535,65535}, {65535,65535,65535,50746,35634,43989,39796,37651,37843,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,54906,35667,29169,29328,65503,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,63422,50616,59165,65535,65503,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, };
-
-//brown small tank
-const uint16_t bsup[14][14] = { {0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,6307,2113,0,0,0,0,0,0,0}, {0,0,0,0,0,12646,8420,4226,6306,32,0,0,0,0}, {0,0,6339,8420,27371,23178,29517,37936,35856,23145,8420,6339,0,0}, {0,2080,23243,25291,37969,25258,33710,40049,40082,33710,25356,25291,32,0}, {0,6306,27339,25258,33711,23178,23178,18984,25258,29517,27339,21065,2113,0}, {0,6274,29485,27372,27404,23145,21032,29484,23178,23210,31597,23178,2081,0}, {0,4226,29484,27371,29484,23145,21032,29484,23210,25259,29517,23178,2081,0}, {0,4226,29484,27372,27436,23145,21032,29517,23178,25259,29517,23178,2081,0}, {0,6274,29485,27372,29485,21065,18952,25291,23145,25291,31565,23178,2081,0}, {0,6306,27404,25259,35856,31597,31597,25258,31597,31630,27404,23145,2081,0}, {0,2113,18984,21065,33743,42194,40082,42162,42195,31630,18984,18984,32,0}, {0,0,6371,8420,6307,14758,14758,14758,14758,8452,8420,6371,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0}, };
-
-//bricks
-const uint16_t brickMain[20][20] = { {48173,50188,50220,50188,50188,50155,50155,50155,48140,16904,50220,50220,50188,50188,50188,50155,50155,50155,43980,16904}, {45766,49827,49827,49827,49827,49827,49827,49827,45765,0,47780,49827,49827,49827,49827,49827,49827,49827,39557,32}, {45766,49827,49827,49827,49827,49827,49827,49827,45765,0,47780,49827,49827,49827,49827,49827,49827,49827,39557,32}, {45766,49827,49827,49827,49827,49827,49827,49827,45765,0,47780,49827,49827,49827,49827,49827,49827,49827,39557,32}, {4096,6144,6144,6144,6144,6144,6144,6144,4096,0,6144,6144,6144,6144,6144,6144,6144,6144,4096,32}, {20803,22850,22850,22850,0,20803,22850,22850,22850,22850,22850,22850,22850,20770,0,22850,22850,22850,22850,20803}, {45766,49827,49827,47780,2048,47780,49827,49827,49827,49827,49827,49827,49827,45700,2048,47780,49827,49827,49827,47812}, {45766,49827,49827,47780,2048,47780,49827,49827,49827,49827,49827,49827,49827,45700,2048,47780,49827,49827,49827,47812}, {45765,49827,49827,47780,2048,47780,49827,49827,49827,49827,49827,49827,49827,45700,2048,47780,49827,49827,49827,47812}, {14562,16577,16577,16577,0,16577,16577,16577,16577,16577,16577,16577,16577,16577,0,16577,16577,16577,16577,16577}, {10336,10304,10304,12352,12352,12352,10304,12352,10336,0,10304,12352,12352,10304,12352,12352,12352,12352,8256,32}, {45765,49827,49827,49827,49827,49827,49827,49827,45765,0,47780,49827,49827,49827,49827,49827,49827,49827,39557,32}, {45766,49827,49827,49827,49827,49827,49827,49827,45765,0,47780,49827,49827,49827,49827,49827,49827,49827,39557,32}, {45766,49827,49827,49827,49827,49827,49827,49827,45765,0,47780,49827,49827,49827,49827,49827,49827,49827,39557,32}, {27076,29091,29091,29091,29091,29091,29091,29091,27076,0,27043,29091,29091,29091,29091,29091,29091,29091,22915,32}, {4096,4096,4096,4096,0,4096,4096,4096,4096,4096,4096,4096,4096,4096,0,4096,4096,4096,4096,4096}, {45766,49827,49827,47780,2048,47780,49827,49827,49827,49827,49827,49827,49827,45700,2048,47780,49827,49827,49827,47780}, {45766,49827,49827,47780,2048,47780,49827,49827,49827,49827,49827,49827,49827,45700,2048,47780,49827,49827,49827,47812}, {45766,49827,49827,47780,2048,47780,49827,49827,49827,49827,49827,49827,49827,45700,2048,47780,49827,49827,49827,47812}, {37543,39557,39557,39557,2048,39557,39557,39557,39557,39557,39557,39557,39557,37477,2048,39557,39557,39557,39557,39590}, };
-
-//victory page
-const uint16_t p1Won[120][160] = { {19288,19255,19255,19223,21271,21271,19191,21239,21239,21207,21207,21175,21174,21174,21142,21142,21142,21110,21109,21077,21077,21045,21045,21045,21012,18964,18964,18964,18932,18931,18931,18899,18899,18899,18899,18867,18866,18866,18834,18834,18834,18834,18801,18801,18801,16721,16720,16720,16720,16720,16687,16687,16687,16687,16687,16655,16654,14606,14606,14606,14606,14605,14606,14605,14605,14573,14573,14573,14572,12524,12524,12524,12524,12523,12523,12523,12523,12491,10443,10442,10442,10442,10442,10442,10442,10442,10441,10441,10441,10441,10441,10441,10441,10441,10441,8393,8393,8393,8393,8393,8393,8393,8393,8393,8393,8393,8393,8393,8393,8393,8393,8393,8393,8393,8425,8425,8425,8425,8425,10473,10473,10473,10474,10474,10506,10506,10506,10506,10506,10506,10506,10507,10539,10539,10539,10539,10539,10540,12588,12620,12620,12620,12621,12621,12621,12621,12653,12653,14701,14702,14734,14702,14734,14735,14735,14735,14767,16815,16816,16816}, {19287,19255,19255,19255,19223,19223,19191,21239,21239,21207,21207,21174,21174,21174,21142,21142,21142,21109,21109,21077,21077,21077,21045,18996,18996,18964,18964,18932,18932,18931,18931,18899,18899,18899,18867,18866,18866,18866,18834,18834,18834,18801,18801,18801,16752,16720,16720,16720,16720,16720,16687,16687,16687,16687,16686,14606,14606,14606,14606,14606,14606,14605,14605,14573,14605,14573,14573,14572,12524,12524,12524,12524,12523,12523,12523,12491,12491,12491,10442,10442,10442,10442,10442,10442,10442,10441,10441,10441,10441,10441,10441,10441,10441,8393,10441,8393,8393,8393,8393,8393,8393,8392,8392,8393,8393,8393,8393,8393,8393,8393,8393,8425,8393,8393,8425,8425,8425,8425,10473,10473,10473,10473,10474,10474,10506,10474,10506,10506,10506,10506,10506,10507,10539,10539,10539,10539,12587,12588,12588,12620,12620,12620,12620,12621,12621,12621,12653,12653,14702,14702,14702,14702,14734,14735,14735,14735,14767,16816,16816,16816}, {19287,19287,19255,19255,19223,19223,21271,21271,21239,21207,21207,21174,21174,21174,21174,21142,19093,21109,19061,21109,19029,19029,18997,18996,18996,18964,18964,18964,18931,18931,18931,18899,18899,18899,18898,18866,18866,18866,18834,18834,18833,18801,18801,16753,16752,16720,16720,16720,16719,16687,16687,16687,16687,16687,16654,16686,14606,14606,14606,14605,14605,14605,14605,14573,14573,14573,14573,14572,12524,12524,12524,12523,12523,12523,12523,12491,12491,12490,10442,10442,10442,10442,10442,10442,10442,10441,10441,10441,10441,10441,10441,10441,10441,8393,8393,8393,8393,8393,8393,8393,8393,8393,8393,8392,8392,8393,8393,8393,8393,8393,8393,8425,8393,8425,8425,8425,8425,8425,10473,10473,10473,10474,10474,10474,10506,10506,10506,10506,10506,10506,10507,10507,10507,10539,10539,10539,10539,12588,12620,12588,12620,12620,12621,12621,12621,12653,12653,14701,14702,14702,14702,14734,14734,14735,14735,14735,14767,16816,16816,16816}, {19287,19288,19287,19255,19255,21271,21271,21239,21239,21239,21206,21206,21174,21174,21174,19094,19094,19061,19061,19029,19029,19029,19028,18996,18996,18964,18964,18964,18931,18931,18931,18899,18899,18899,18898,18866,18866,18866,18834,18833,18833,18833,16753,16753,16720,16720,16720,16720,16719,16687,16687,16687,14638,14638,14638,14606,14606,14606,14605,14606,14605,14573,14605,14573,14573,14573,14573,12524,12524,12524,12524,12523,12523,12523,12491,12491,12491,10442,10442,10442,10442,10442,10442,10442,10441,10441,10441,10441,10441,10441,10441,10441,10441,8393,8393,8393,8393,8393,8393,8393,8393,8393,8393,8392,8393,8393,8392,8393,8393,8393,8393,8393,8393,8425,8425,8425,8425,8425,8425,10473,10473,10473,10474,10506,10506,10506,10506,10506,10506,10506,10507,10507,10539,10539,10539,10539,10540,12588,12588,12620,12620,12620,12620,12621,12621,12653,12653,14702,14702,14702,14702,14734,14735,14735,14735,14767,16815,16816,16816,16816}, {19320,19287,19287,19255,19255,19255,19223,19223,21239,19191,21207,19158,19126,19126,19126,19126,19093,19093,19061,19061,19029,19028,19028,18996,18996,18964,18964,18963,18963,18931,18931,18899,18899,18898,18866,18866,18866,18866,18866,18833,18833,16785,16753,16752,16720,16720,16720,16719,16719,16687,16687,16687,16687,14638,14606,14606,14606,14606,14605,14573,14605,14573,14573,14573,14572,12524,14572,12524,12524,12524,12523,12523,12491,12523,12491,12491,10442,10442,10442,10442,10442,10442,10442,10441,10441,10441,10441,10441,10441,10441,10441,10441,8393,8393,8393,8393,8393,8392,8392,8393,8392,8392,8392,8393,8393,8392,8393,8393,8393,8393,8393,8393,8425,8393,8425,8425,8425,8425,8425,10473,10473,10473,10473,10474,10506,10506,10506,10506,10506,10506,10507,10507,10539,10539,10539,10539,12588,12588,12588,12620,12620,12620,12621,12621,12621,12653,12653,14701,14702,14702,14734,14734,14735,14735,14735,14735,16816,16816,16816,16816}, {19320,19288,19287,19287,19255,19223,19223,21271,19191,19191,21206,21206,19158,21174,19126,19126,19094,19093,19061,19061,19061,19029,18996,18996,18996,18996,18964,18963,18963,18931,18931,18931,18899,18898,18898,18866,18866,18866,18834,18833,16785,16785,16752,16752,16752,16720,16720,16719,16719,16687,16687,14638,14638,14606,14606,14606,14605,14605,14605,14605,14573,14573,14573,14573,14573,12524,12524,12524,12524,12524,12524,12523,12523,12523,12491,12491,10442,10442,10442,10442,10442,10442,10442,10441,10441,10441,10441,10441,10441,10441,10441,8393,8393,8393,8393,8393,8393,8393,8392,8393,8393,8392,8393,8392,8392,8392,8393,8393,8393,8393,8393,8425,8393,8425,8425,8425,8425,8425,8425,8425,10473,10473,10474,10474,10506,10506,10506,10506,10506,10506,10507,10507,10539,10539,10539,10539,12588,12588,12588,12620,12620,12620,12621,12621,12621,12653,12653,12654,14702,14702,14702,14734,14735,14735,14735,14767,14768,16816,16816,16816}, {19320,19320,19288,19287,19287,19255,19223,19223,19191,19191,19158,19158,19158,19126,19126,19126,19093,19093,19061,19061,19060,19028,19028,18996,18996,18996,18963,18963,18931,18931,18931,18931,18898,18898,18898,18866,18866,18865,18833,16785,16785,16753,16752,16752,16752,16720,16719,16719,16687,16687,16687,14638,14638,14638,14606,14605,14605,14605,14605,14605,14573,14573,14573,14572,12524,12524,12524,12524,12524,12524,12523,12523,12491,12491,12491,10442,10442,10442,10442,10442,10442,10442,10442,10441,10441,10441,10441,10441,10441,10441,8393,8393,8393,8393,8393,8392,8393,8392,8393,8392,8392,8392,8392,8392,8392,8392,8392,8393,8393,8393,8393,8393,8393,8425,8425,8425,8425,8425,10473,8425,10473,10474,10473,10506,10506,10506,10506,10506,10506,10506,10507,10507,10539,10539,10539,10539,12587,12588,12588,12620,12620,12620,12621,12621,12621,12653,12653,14702,14702,14702,14734,14734,14735,14735,14735,16815,16816,16816,16816,16816}, {19352,19320,19287,19287,19287,19255,19255,19223,19223,19191,19190,19190,19158,19126,19126,19125,19093,19093,19061,19061,19060,19028,19028,19028,18996,18996,18963,18963,18963,18931,18931,18930,18898,18898,18898,18866,18866,16817,16817,16785,16785,16785,16752,16752,16720,16720,16719,16719,16687,16687,14638,14638,14638,14606,14606,14605,14605,14605,14605,14605,14573,14573,12524,12524,12524,12524,12524,12524,12524,12524,12523,12523,12523,12491,12491,10442,10442,10442,10442,10442,10442,10442,10441,10441,10441,10441,10441,10441,10441,8393,8393,8393,8393,8393,8393,8393,8392,8392,8392,8392,8392,8392,8392,8392,8393,8393,8392,8393,8393,8393,8393,8393,8425,8425,8425,8425,8425,8425,10473,10473,10473,10473,10474,10506,10474,10506,10506,10506,10506,10506,10507,10507,10539,10539,10539,12587,12588,12588,12620,12620,12620,12621,12621,12621,12653,12653,14701,14702,14702,14702,14734,14735,14735,14735,14735,16816,16816,16816,16816,16849}, {19352,19320,19288,19288,19287,19255,19255,19223,19223,19190,19190,19158,19158,19158,19126,19125,19093,19093,19093,19061,19060,19060,19028,19028,18996,18996,18963,18963,18963,18963,18930,18930,18898,18898,18898,18898,16818,16817,16817,16785,16785,16752,16752,16752,16752,16719,16719,16719,16687,14638,14638,14638,14638,14638,14605,14605,14605,14605,14573,12557,14573,12524,12524,12524,12524,12524,12524,12524,12524,12523,12523,12523,12491,12491,10443,10442,10442,10442,10442,10442,10442,10441,10441,10441,10441,10441,10441,10441,8393,10441,8393,8393,8393,8393,8393,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8393,8392,8393,8393,8393,8425,8393,8425,8425,8425,8425,8425,8425,10473,10473,10474,10474,10506,10506,10506,10506,10506,10506,10507,10507,10539,10539,10539,10539,10539,12588,12588,12620,12620,12620,12621,12621,12621,12653,12653,12654,14702,14702,14734,14734,14735,14735,14735,14735,14768,16816,16816,16816,16817}, {19352,19320,19320,19319,19287,19287,19255,19223,19223,19223,19190,19190,19158,19158,19125,19125,19125,19093,19093,19061,19060,19028,19028,19028,18996,18995,18995,18963,18963,18963,18930,18930,18898,16850,18898,16850,16817,16817,16817,16785,16784,16784,16752,16752,16752,16719,14671,16719,14638,14638,14638,14638,14638,14605,14605,14605,14605,14605,14605,14572,14572,12524,12524,12524,12524,12524,12524,12524,12523,12523,12491,12491,12491,12491,12490,10442,10442,10442,10442,10442,10442,10441,10441,10441,10441,10441,10441,10441,10441,8393,8393,8393,8393,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8393,8393,8393,8393,8425,8425,8425,8425,8425,8425,10473,10473,10473,10474,10474,10506,10506,10506,10506,10506,10506,10507,10539,10539,10539,10539,10539,12587,12588,12620,12620,12620,12620,12621,12621,12653,12653,12653,12653,14702,14702,14702,14734,14735,14735,14735,14767,16816,16816,16816,16816,16817}, {19352,19352,19320,19320,19287,19287,19255,19255,19223,19222,19190,19190,19158,19158,19126,19125,19125,19093,19093,19061,19060,19060,19028,19028,18996,18995,18995,18963,18963,18931,18930,18930,18930,16850,16850,16818,16817,16817,16817,16785,16785,16784,16752,16752,16751,16719,14671,14639,14639,14638,14638,14638,14637,14637,14605,14605,14605,14605,12524,14605,12524,12524,12524,12524,12524,12523,12524,12491,12523,12523,12523,12523,12491,10443,10442,10442,10442,10442,10442,10442,10442,10441,10441,10441,10441,10441,10441,8393,10441,8393,8393,8393,8393,8393,8393,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8393,8393,8393,8393,8425,8425,8425,8425,8425,8425,8425,8425,10473,10474,10474,10506,10506,10506,10506,10506,10506,10507,10539,10507,10539,10539,10539,12588,12588,12620,12620,12620,12621,12621,12621,12621,12653,12653,14702,14702,14702,14734,14734,14735,14735,14735,14767,16816,16816,16816,16849,16849}, {19352,19352,19320,19320,19288,19287,19255,19255,19223,19222,19222,19190,19158,19158,19157,19125,19125,19125,19093,19093,19060,19060,19060,19028,19027,18995,18995,18963,18963,18962,16882,16882,16882,16850,16850,16849,16817,16817,16817,16785,16784,16784,16752,16752,16751,14671,14671,14670,14638,14638,14638,14638,14605,14605,14605,14605,14605,14605,12557,12524,12524,12524,12524,12524,12524,12523,12523,12523,12523,12523,12491,12491,12491,12490,10442,10442,10442,10442,10442,10442,10442,10441,10441,10441,10441,10441,10441,8393,8393,8393,8393,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8393,8392,8393,8393,8425,8393,8425,8425,8425,8425,8425,8425,10473,10473,10473,10506,10506,10506,10506,10506,10506,10507,10507,10507,10539,10539,10539,10539,12588,12588,12588,12620,12620,12620,12621,12621,12653,12653,12653,14702,14702,14702,14734,14734,14735,14735,14735,14768,16816,16816,16816,16817,16849}, {19384,19352,19352,19320,19319,19287,19287,19255,19255,19222,19222,19190,19158,19158,19158,19125,19125,19125,19093,19092,19060,19060,19028,19028,19027,18995,18995,18995,16915,18963,16882,16882,16882,16850,16849,16849,16817,16817,16817,16784,16784,16784,16752,16751,16719,14703,14671,14670,14638,14638,14638,14637,14605,14605,14605,14605,14605,12557,12524,12524,12524,12524,12524,12524,12523,12523,12523,12491,12523,12523,12491,12491,10443,10442,10442,10442,10442,10442,10442,10441,10441,10441,10441,10441,10441,10441,10441,10441,8393,8393,8393,8393,8392,8392,8360,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8393,8393,8393,8393,8393,8425,8425,8425,8425,10473,10473,10473,10473,10474,10506,10506,10506,10506,10506,10506,10506,10539,10507,10539,10539,10539,10539,12588,12588,12620,12620,12620,12621,12621,12621,12653,12653,12653,14702,14702,14702,14734,14735,14735,14735,14735,14768,16816,16816,16816,16817,16849}, {19384,19384,19352,19320,19319,19287,19287,19255,19255,19222,19222,19190,19190,19158,19157,19125,19125,19125,19093,19092,19092,19060,19060,16979,19027,18995,16947,16947,16915,16914,16914,16882,16882,16882,16850,16849,16849,16817,16817,16784,16784,16752,16752,14703,14671,14671,14670,14670,14670,14638,14638,14637,14637,14605,14605,12557,12556,12524,12556,12524,12524,12524,12524,12523,12523,12523,12523,12491,12491,12491,12491,12491,10442,10442,10442,10442,10442,10442,10442,10441,10441,10441,10441,10441,10441,10441,8393,8393,8393,8393,8393,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8393,8393,8425,8425,8425,8425,8425,8425,10473,8425,8425,10473,10474,10506,10506,10506,10506,10506,10506,10506,10539,10539,10539,10539,10539,12587,12588,12588,12620,12620,12620,12621,12621,12621,12653,12653,14701,14702,14702,14734,14734,14735,14735,14735,14735,14768,16816,16816,16816,16849,16849}, {19384,19384,19352,19320,19319,19319,19287,19255,19255,19222,19222,19222,19190,19190,19157,19157,19125,19125,19093,19092,19092,17012,19060,19028,16979,18995,16947,16915,16914,16914,16914,16882,16882,16850,16849,16849,16817,16817,16816,16784,16784,16752,16751,14703,14703,14671,14670,14670,14638,14638,14637,14637,14637,12557,14605,14605,12556,12524,12524,12524,12524,12524,12523,12523,12523,12523,12491,12491,12491,12491,10443,12491,10442,10442,10442,10442,10442,10442,10442,10441,10441,10441,10441,10409,10441,8393,10441,8393,8393,8393,8392,8360,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8393,8393,8393,8393,8425,8425,8425,8425,8425,8425,10473,10473,10473,10474,10474,10506,10506,10506,10506,10506,10507,10507,10539,10539,10539,12587,10539,12588,12620,12620,12620,12620,12621,12621,12621,12653,12653,12653,14702,14702,14734,14734,14735,14735,14735,14736,16816,16816,16816,16816,16849,16849}, {19384,19384,19352,19352,19320,19319,19287,19287,19255,19254,19222,19222,19190,19190,19157,19157,19125,19125,19125,19092,19092,19060,19060,19060,16979,16979,16947,16947,16914,16914,16914,16882,16882,16881,16849,16849,16849,16817,16816,16784,16784,16783,16751,14703,14671,14670,14670,14670,14638,14637,14637,14637,14637,14605,14605,12556,12556,12556,12556,12524,12524,12523,12523,12523,12523,12523,12491,12491,10443,12490,10442,10442,10442,10442,10442,10442,10442,10442,10441,10441,10441,10441,10441,10441,10441,10441,10441,8393,8360,8393,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8393,8392,8393,8425,8425,8425,8425,8425,8425,8425,10473,10473,10473,10473,10474,10506,10506,10506,10506,10506,10506,10507,10539,10539,10539,10539,10539,12588,12588,12620,12620,12620,12620,12621,12621,12653,12653,12653,14702,14702,14702,14734,14735,14735,14735,14735,14767,16816,16816,16816,16816,16849,16849}, {19416,19384,19384,19352,19319,19319,19287,19287,19255,19254,19222,19222,19190,19190,19158,19157,19125,19125,19093,19092,17044,19060,17012,16979,16979,16979,16947,16947,16946,16914,16914,16914,16882,16881,16849,16849,16849,16817,16816,16784,16784,16751,14703,14703,14703,14670,14670,14670,14638,14638,14637,14637,12557,12557,12557,12524,12556,12556,12524,12524,12524,12523,12523,12523,12523,12491,12491,12491,12490,10442,10442,10442,10442,10442,10442,10442,10442,10441,10441,10441,10441,10441,10409,10441,8393,8393,8393,8393,8393,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8393,8425,8393,8425,8425,8425,8425,8425,8425,10473,10473,10474,10474,10506,10506,10506,10506,10506,10506,10507,10507,10539,10539,10539,10539,12588,12588,12620,12620,12620,12621,12621,12621,12653,12653,14701,14702,14702,14734,14734,14735,14735,14735,14735,16815,16816,16816,16816,16817,16849,16849}, {19416,19384,19384,19352,19352,19319,19319,19287,19287,19254,19222,19222,19190,19190,19189,19157,19125,19125,19124,17044,17044,17044,17012,17011,16979,16979,16947,16947,16946,16914,16914,16882,16881,16881,16849,16849,16849,16849,16816,14768,16784,16783,14703,14703,14671,14670,14670,14670,14638,14637,14637,14637,12557,12556,12556,12556,12556,12524,12524,12523,12523,12523,12523,12523,12523,12523,12491,10442,10442,10442,10442,10442,10442,10442,10442,10442,10442,10442,10441,10441,10441,10441,10441,10441,8361,8393,8393,8361,8392,8392,8360,8392,8392,8392,8392,8360,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8393,8393,8425,8425,8425,8425,8425,8425,10473,10473,10473,10473,10506,10506,10506,10506,10506,10506,10506,10507,10539,10539,10539,10539,12587,12588,12620,12620,12620,12620,12620,12621,12621,12653,12653,12653,14702,14702,14702,14734,14735,14735,14735,14767,16816,16816,16816,16816,16849,16849,16849}, {19416,19416,19384,19384,19352,19319,19319,19287,19287,19255,19254,19222,19222,19190,19189,19157,19157,19125,17076,17076,17044,17044,17011,17011,16979,16979,16979,16947,16946,16914,16914,16914,16881,16881,16849,16849,16849,16816,16816,14736,14735,14735,14703,14703,14702,14670,14670,14670,14669,14637,14637,14637,12557,12556,12556,12556,12556,12556,12524,12523,12523,12523,12523,12523,12491,12491,10443,10442,10442,10442,10442,10442,10442,10442,10442,10442,10442,10441,10441,10441,10441,10441,10441,10441,8361,8393,8392,8361,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8393,8393,8393,8425,8425,8425,8425,8425,8425,10473,10473,10473,10474,10506,10506,10506,10506,10506,10506,10507,10507,10539,10539,10539,10539,12587,12588,12620,12620,12620,12620,12621,12621,12621,12653,12653,14701,14702,14702,14734,14735,14735,14735,14735,14767,16816,16816,16816,16816,16849,16849,16849}, {19448,19416,19384,19384,19352,19351,19319,19287,19287,19254,19254,19222,19222,19190,19189,17109,17109,17077,17076,17076,17044,17044,17012,17011,16979,16979,16947,16947,16946,16914,16914,16914,16881,16881,16881,16849,16849,16816,16816,14736,14735,14735,14703,14702,14702,14670,14670,14670,14669,14637,14637,12589,12557,12556,12556,12556,12524,12524,12523,12523,12523,12523,12523,12523,12523,10442,10442,10442,10442,10442,10442,10442,10442,10442,10442,10442,10441,10441,10441,10441,10441,10441,10441,8393,8361,8393,8360,8392,8392,8360,8360,8392,8360,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8393,8393,8425,8425,8425,8425,8425,8425,8425,10473,10474,10474,10506,10474,10506,10506,10506,10506,10506,10539,10539,10539,10539,10539,12588,12588,12588,12620,12620,12620,12621,12621,12653,12653,12653,14702,14702,14702,14734,14735,14735,14735,14735,14767,16816,16816,16816,16817,16849,16849,16849}, {19449,19416,19384,19384,19352,19351,19319,19319,19287,17238,19254,19222,19222,19222,17141,19157,17109,17077,17076,17076,17044,17044,17044,17011,17011,16979,16979,16946,16946,16946,16914,16914,16881,16881,16881,16849,16848,16816,14768,14768,14735,14735,14703,14702,14702,14670,14670,14669,14637,12589,12589,12589,12556,12556,12556,12556,12524,12524,12523,12523,12523,12523,12523,12523,12491,10442,10442,10442,10442,10442,10442,10442,10442,10442,10442,10441,10441,10441,10441,10441,10441,8361,10441,8393,8361,8392,8392,8392,8392,8392,8392,8360,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8393,8393,8393,8393,8425,8425,8425,8425,8425,8425,10473,10473,10474,10506,10506,10506,10506,10506,10506,10507,10507,10539,10539,10539,10539,12588,12588,12588,12620,12620,12621,12621,12653,12621,12653,14701,14702,14702,14734,14734,14734,14735,14735,14735,16816,14768,16816,16816,16848,16849,16849,16849}, {19448,19416,19416,19384,19352,19351,19319,19319,19287,19286,19254,19254,17174,19222,17141,17141,17109,17109,17076,17076,17076,17044,17043,17011,17011,16979,16979,16946,16946,16946,16914,16914,16913,16881,16881,16849,16848,16848,14768,14735,14735,14735,14735,14702,14702,14670,14670,14669,12621,12589,12589,12589,12556,12556,12556,12556,12524,12556,12523,12523,12523,10475,10475,10443,10442,10442,10442,10442,10442,10442,10442,10442,10442,10442,10441,10442,10441,10441,10441,10441,10441,10409,8393,8361,8393,8393,8360,8392,8360,8392,8392,8360,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8393,8393,8425,8425,8425,8425,8425,8425,8425,8425,10473,10473,10474,10506,10506,10506,10506,10506,10506,10507,10539,10507,10539,10539,10539,12588,12588,12620,12620,12620,12620,12621,12621,12621,12653,14701,14702,14702,14702,14734,14735,14735,14735,14767,16784,16816,16816,16816,16849,16849,16849,16849}, {19449,19416,19416,19384,19384,19352,19351,19319,17271,17239,17238,17206,17174,17174,17141,17141,17141,17109,17108,17076,17076,17044,17044,17011,17011,16979,16979,16978,16946,16946,16914,16913,16913,16881,16881,16849,16848,14800,14768,14768,14735,14735,14702,14702,14702,14702,14670,14669,12621,12589,12589,12588,12556,12556,12556,12556,12556,12523,12523,12523,12523,12523,10475,10442,10442,10442,10442,10442,10442,10442,10442,10442,10441,10441,10441,10441,10441,10441,10441,10409,8393,10441,8393,8361,8392,8360,8392,8360,8392,8360,8360,8392,8360,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8393,8392,8425,8393,8425,8425,8425,8425,10473,8425,10473,10474,10506,10474,10506,10506,10506,10506,10506,10507,10539,10539,10539,10539,10539,12588,12588,12620,12620,12620,12620,12621,12621,12653,12653,14701,14702,14734,14734,14734,14735,14735,14735,14735,14768,16816,16816,16848,16817,16849,16849,16849}, {19449,19448,19416,19416,17336,19351,19351,17303,19319,19286,19286,17206,19254,17173,17173,17141,17141,17109,17108,17076,17076,17044,17044,17043,17011,17011,16978,16978,16946,16946,16914,16913,16913,16881,16881,16881,14800,14800,14768,14767,14735,14735,14735,14702,14702,14669,12621,12621,12589,12589,12589,12588,12556,12556,12556,12556,12555,12555,10475,12523,10475,10475,10475,10442,10442,10442,10442,10442,10442,10442,10442,10442,10442,10441,10441,10441,10441,10441,10441,10441,10409,8393,8393,8361,8392,8360,8392,8392,8392,8392,8392,8392,8360,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8393,8393,8425,8425,8425,8425,8425,8425,8425,10473,10473,10473,10506,10506,10506,10506,10506,10506,10507,10539,10539,10539,10539,10539,10539,12588,12620,12620,12620,12620,12621,12621,12621,12653,12653,14702,14702,14702,14734,14734,14735,14735,14735,16815,16816,16816,16816,16816,16849,16849,16849,16849}, {19481,17400,19448,19416,19384,19384,17303,17271,19319,17270,17238,17206,17206,17174,17173,17141,17141,17109,17108,17076,17076,17076,17043,17043,17011,17011,16979,16978,16978,16946,16946,16913,16913,16881,16881,14801,14800,14800,14768,14767,14735,14735,14702,14702,14702,14702,12621,12621,12621,12589,12588,12588,12556,12556,12556,12556,12523,12523,12523,10475,10475,10474,10474,10442,10442,10442,10442,10442,10442,10442,10441,10441,10441,10441,10441,10441,10409,10441,10441,10409,8393,8361,8361,8393,8360,8360,8360,8360,8360,8360,8360,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8425,8425,8425,8425,8425,8425,8425,8425,10473,10473,10474,10474,10506,10506,10506,10506,10506,10507,10507,10539,10539,10539,10539,12588,12588,12588,12620,12620,12620,12621,12621,12621,12653,12653,14702,14702,14702,14702,14735,14735,14735,14735,14768,16816,16816,16816,16848,16849,16849,16849,16849}, {19481,19449,19448,19416,19384,19383,17303,17303,17271,17271,17238,17238,17206,17206,17173,17141,17141,17141,17108,17108,17076,17076,17043,17043,17011,17011,16978,16978,16978,16946,16946,16913,16913,16913,16881,14832,14800,14800,14767,14767,14767,14735,14702,14702,14702,12653,12621,12621,12589,12589,12588,12588,12556,12556,12556,12555,12523,12523,10475,10475,10475,10474,10474,10474,10442,10442,10442,10442,10442,10441,10441,10441,10441,10441,10441,10441,10441,10441,10441,10441,10441,8393,8392,8392,8360,8360,8392,8360,8360,8392,8360,8360,8392,8392,8360,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8425,8425,8425,8425,8425,8425,8425,8425,8425,10473,10506,10474,10506,10506,10506,10506,10506,10507,10539,10539,10539,10539,10539,12588,12588,12620,12620,12620,12620,12621,12621,12653,12653,12653,14702,14702,14734,14734,14734,14735,14735,14767,16816,16816,16816,16816,16817,16849,16849,16849,16849}, {19481,17432,17400,19448,19416,17336,17335,17303,17303,17271,17238,17238,17206,17206,17173,17173,17141,17141,17108,17108,17076,17076,17043,17043,17011,17011,17011,16978,16978,16946,16945,16945,16913,14865,14865,14833,14800,14800,14767,14767,14767,14735,14734,12654,12654,12653,12621,12621,12621,12588,12588,12588,12556,12556,12555,12555,12555,10475,10475,10475,10474,10474,10474,10442,10442,10442,10442,10442,10442,10441,10441,10441,10441,10409,10409,10441,10441,10441,10409,8361,8393,8361,8360,8360,8360,8360,8360,8392,8360,8360,8392,8360,8392,8360,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8393,8425,8425,8425,8425,8425,8425,8425,10473,10473,10506,10506,10506,10506,10506,10506,10506,10506,10539,10539,10539,10539,10539,12588,12588,12620,12620,12620,12621,12621,12653,12653,12653,14702,14702,14702,14702,14734,14735,14735,14735,14767,14768,16816,16816,16816,16849,16849,16849,16849,16882}, {19513,19481,19448,19448,17368,17335,17335,19351,17303,17271,17238,17238,17238,17206,17205,17173,17141,17141,17108,17108,17076,17076,17075,17043,17043,17011,17010,17010,16978,16946,16945,16945,16913,16913,14833,14832,14800,14800,14767,14767,14735,14735,14734,14702,12654,12653,12621,12621,12621,12588,12588,12588,12588,12556,12555,12555,12555,10475,10475,10474,10474,10474,10442,10442,10442,10442,10442,10442,10441,10441,10441,10441,10441,10409,10409,10409,10441,10441,10409,10409,8393,8360,8392,8360,8360,8392,8360,8360,8360,8360,8360,8392,8392,8360,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8424,8393,8425,8425,8425,8425,8425,8425,10473,10473,10473,10474,10506,10506,10506,10506,10506,10506,10507,10539,10539,10539,10539,12587,10540,12588,12620,12620,12620,12621,12621,12621,12653,12653,14701,14702,14702,14702,14734,14735,14735,14767,14767,16816,16816,16816,16816,16849,16849,16849,16849,16882}, {17465,17433,17432,17400,17368,17368,17335,17303,17303,17303,17270,17238,17238,17206,17206,17173,17173,17141,17140,17108,17108,17076,17075,17043,17043,17011,17011,16978,16978,16978,16945,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,10507,10507,10539,10539,10539,10539,12588,12620,12620,12620,12620,12621,12621,12653,12653,12653,14702,14702,14702,14734,14734,14735,14735,14735,16815,16816,16816,16816,16816,16849,16849,16849,16849,18898}, {19513,17465,19480,17400,19448,17368,17335,17335,17303,17303,17270,17270,17238,17238,17205,17173,17173,17141,17140,17108,17108,17076,17075,17075,17043,17011,17011,17010,16978,16978,16946,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,10539,10539,10539,10539,10539,12587,12588,12620,12620,12620,12620,12621,12621,12653,12653,14701,14702,14702,14702,14734,14735,14735,14735,14735,16815,16816,16816,16816,16849,16849,16849,16849,16882,18930}, {17465,17465,17432,17400,17400,17368,17368,17335,17303,17303,17270,17270,17238,17206,17206,17205,17173,17173,17140,17108,17108,17076,17075,17075,17043,17043,17010,17010,16978,16978,16945,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,10507,10539,10539,10539,12587,12588,12620,12620,12620,12620,12621,12621,12653,12653,12653,12653,14702,14702,14702,14734,14735,14735,14735,14767,14768,16816,16816,16816,16849,16849,16849,16849,16850,18930}, {19545,19513,17432,17432,17400,17368,17367,17335,17335,17303,17270,17270,17238,17238,17206,17205,17173,17173,17140,17140,17108,17108,17075,17075,17043,17043,17010,17010,14930,16978,14897,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,10507,10539,10539,10539,10539,12588,12588,12620,12620,12620,12620,12621,12621,12653,12653,14702,14702,14702,14702,14734,14735,14735,14735,14767,16816,16816,16816,16848,16849,16849,16849,16849,16850,16882}, {17497,17465,17465,17432,17400,17400,17368,17335,17335,17303,17302,17270,17270,17238,17206,17205,17173,17173,17172,17140,17108,17108,17076,17075,17043,17043,17043,17010,17010,14930,16978,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,10539,10539,10539,10539,10539,12588,12620,12620,12620,12620,12621,12621,12621,12653,12653,14702,14702,14702,14734,14735,14735,14735,14735,14735,16816,16816,16816,16817,16849,16849,16849,16881,18930,18930}, {17497,17465,17465,17432,17432,17400,17368,17367,17335,17335,17303,17270,17270,17238,17237,17205,17205,17173,17173,17140,17140,17108,17076,17075,17075,17043,17042,17010,14962,14930,14929,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,10539,10539,10539,10539,10539,12588,12620,12620,12620,12620,12621,12621,12653,12653,12653,14702,14702,14734,14734,14734,14735,14735,14767,14767,16816,16816,16816,16849,16849,16849,16849,16850,18930,18930}, {17497,17497,17465,17433,17432,17400,17400,17367,17335,17335,17303,17302,17270,17238,17238,17237,17205,17173,17173,17140,17140,17108,17076,17075,17075,17043,14994,14962,14962,14962,14929,42207,42207,42207,42207,42207,42207,14831,14799,12751,12718,12718,12686,12685,12653,12653,12653,12653,12620,12620,12588,12588,10539,10539,10507,10507,10506,10474,10474,10474,10474,10474,10474,10441,10441,10441,10441,10441,10441,8393,8393,8393,8360,8360,8360,8360,8360,8360,8360,8392,8360,8360,8360,8360,8360,8392,8360,8392,8360,8360,8360,8360,8392,8360,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8393,8424,8393,8425,8425,8425,8425,8425,10473,10473,10506,10474,10506,42207,42207,42207,42207,42207,42207,10539,10539,10539,10539,12588,12588,12620,12620,12620,12620,12621,12621,12653,12653,12653,14702,14702,14734,14734,14735,14735,14735,14735,14768,16816,16816,16816,16849,16849,16849,16849,16850,18930,18930}, {17529,17497,17497,17465,17432,17432,17400,17367,17367,17335,17303,17302,17270,17270,17238,17205,17205,17205,17173,17140,17140,17108,17107,17075,17075,17075,14995,14994,14962,14962,14929,42207,42207,42207,42207,42207,42207,14799,12751,12750,12718,12718,12685,12685,12653,12653,12653,12620,12620,12620,12588,10540,10539,10539,10507,10507,10506,10474,10474,10474,10474,10474,10473,10441,10441,10441,10441,8393,10441,8393,8393,8392,8361,8392,8360,8360,8360,8360,8360,8360,8360,8360,8360,8360,8360,8360,8360,8360,8360,8392,8360,8392,8360,8360,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8393,8425,8425,8425,8425,8425,8425,10473,8425,10474,10506,10506,42207,42207,42207,42207,42207,42207,10539,10539,10539,10539,12588,12588,12620,12620,12620,12620,12621,12653,12653,12653,14702,14702,14702,14702,14734,14735,14735,14735,14735,16816,16816,16816,16816,16849,16849,16849,16849,16850,18930,18930}, {17529,17497,17497,17465,17432,17432,17400,17400,17367,17335,17335,17302,17270,17270,17238,17237,17205,17205,17173,17172,17140,17140,17107,17107,17075,17075,14994,14994,14962,14962,14930,42207,42207,42207,42207,42207,42207,14831,12751,12751,12718,12718,12686,12685,12653,12653,12653,12652,12620,12620,10540,10539,10539,10539,10507,10507,10506,10474,10474,10474,10474,10474,10473,10441,10441,8393,10441,8393,8393,8393,8392,8360,8360,8392,8360,8360,8360,8360,8360,8360,8360,8360,8360,8360,8360,8360,8360,8360,8360,8360,8360,8360,8392,8360,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8424,8393,8425,8425,8425,8425,8425,8425,10473,10473,10506,10506,10506,42207,42207,42207,42207,42207,42207,10539,10539,10539,10539,12588,12588,12620,12620,12620,12621,12621,12653,12653,12653,12654,14702,14702,14734,14734,14735,14735,14735,16815,16816,16816,16816,16817,16849,16849,16849,16849,18930,18930,18930}, {17530,17529,17497,17465,17464,17432,17400,17400,17367,17367,17335,17303,17302,17270,17270,17237,17237,17205,17173,17172,17140,17140,17108,15059,17075,15027,15027,14994,14962,14962,14929,42207,42207,42207,42207,42207,42207,14831,12751,12751,12718,42207,42207,42207,42207,42207,42207,12652,12620,10572,10539,42207,42207,10539,10507,10506,10506,10506,10474,10474,10474,10473,8425,42207,42207,42207,42207,8393,8393,8393,8361,42207,42207,8392,8360,8360,8360,8360,8360,42207,42207,8360,8360,42207,42207,42207,42207,42207,42207,42207,42207,8360,8360,42207,42207,42207,42207,42207,42207,8392,8392,8392,8392,8392,8392,8392,8392,8392,8393,8425,8425,8425,8425,42207,42207,8425,10473,10474,10474,10506,42207,42207,42207,42207,42207,42207,10539,10539,10539,12587,12588,12588,12620,12620,12620,12621,12621,12653,12653,12653,14702,14702,14702,14734,14735,14735,14735,14735,14767,16816,16816,16816,16817,16849,16849,16849,16850,16882,18930,18930}, {17562,17529,17529,17497,17464,17432,17432,17400,17367,17367,17335,17335,17302,17270,17270,17238,17237,17205,17205,17172,17172,17140,17108,15059,17075,15027,15026,14994,14994,14962,14962,42207,42207,42207,42207,42207,42207,12783,12751,12750,12718,42207,42207,42207,42207,42207,42207,12620,10572,10572,10572,42207,42207,10539,10507,10506,10506,10506,10474,10474,10474,10473,10473,42207,42207,42207,42207,8393,8393,8392,8360,42207,42207,8360,8360,8360,8360,8360,8360,42207,42207,8360,8360,42207,42207,42207,42207,42207,42207,42207,42207,8360,8360,42207,42207,42207,42207,42207,42207,8392,8392,8392,8392,8392,8392,8392,8392,8392,8425,8425,8425,8425,8425,42207,42207,10473,10473,10506,10506,10506,42207,42207,42207,42207,42207,42207,10539,10539,10539,12587,12620,12588,12620,12620,12620,12621,12621,12621,12653,12653,12654,14702,14702,14734,14735,14735,14735,14735,16816,16816,16816,16816,16817,16849,16849,16849,16850,18930,18930,18930}, {17562,17530,17529,17497,17465,17464,17432,17400,17400,17367,17367,17335,17302,17302,17270,17270,17237,17205,17205,17173,17172,17140,17140,17107,17107,15027,15027,14994,14994,14962,14961,42207,42207,42207,42207,42207,42207,12783,12783,12751,12750,42207,42207,12685,12685,12653,12652,42207,42207,10572,10572,42207,42207,10539,10507,10507,10506,10506,10474,10474,10474,42207,42207,10473,8393,8393,8393,42207,42207,8392,8392,42207,42207,8360,8360,8392,8360,8360,8360,42207,42207,8360,8360,42207,42207,8360,8360,8360,8360,8360,8360,8360,8360,42207,42207,8392,8392,8392,8392,42207,42207,8392,8392,8392,8392,8392,8424,8424,8425,8425,8425,42207,42207,42207,42207,10473,10505,10474,10506,10506,42207,42207,42207,42207,42207,42207,10539,10539,10539,12588,12588,12588,12620,12620,12621,12621,12653,12653,12653,14701,14702,14702,14734,14734,14735,14735,14735,14735,16816,16816,16816,16816,16849,16849,16849,16849,18898,18930,18930,18931}, {17562,17562,17529,17497,17497,17464,17432,17432,17400,17367,17367,17335,17302,17302,17270,17270,17237,17237,17205,17204,17172,17172,15092,15059,15059,15027,15026,15026,14994,14994,14961,42207,42207,42207,42207,42207,42207,12783,12783,12750,12750,42207,42207,12685,12685,12653,12652,42207,42207,10572,10572,42207,42207,10539,10507,10506,10506,10506,10474,10474,10473,42207,42207,10441,8393,8393,8393,42207,42207,8392,8392,42207,42207,8360,8360,8360,8360,8360,8360,42207,42207,8360,8360,42207,42207,8360,8360,8360,8360,8360,8360,8392,8392,42207,42207,8360,8392,8392,8392,42207,42207,8392,8392,8392,8392,8392,8392,8393,8425,8425,8425,42207,42207,42207,42207,10473,10506,10506,10506,10506,42207,42207,42207,42207,42207,42207,10539,10539,10539,12588,12588,12620,12620,12620,12621,12621,12621,12621,12653,14702,14702,14702,14734,14734,14735,14735,14735,14767,16816,16816,16816,16848,16849,16849,16849,16881,16882,18930,18930,18931}, {17594,17562,17529,17529,17497,17465,17432,17432,17400,17399,17367,17335,17335,17302,17302,17270,17237,17237,17205,17205,17172,17140,17140,17108,15059,15059,15027,15026,14994,14994,14962,42207,42207,42207,42207,42207,42207,12783,12751,12750,12750,42207,42207,42207,42207,42207,42207,10604,10572,10572,10571,42207,42207,10539,10506,10506,10506,10506,10474,10474,10473,42207,42207,42207,42207,42207,42207,42207,42207,8392,8392,8360,8360,42207,42207,42207,42207,42207,42207,8360,8360,8360,8360,42207,42207,42207,42207,42207,42207,8360,8360,8360,8392,42207,42207,42207,42207,42207,42207,8392,8392,8392,8392,8392,8392,8392,8392,8424,8393,8425,8425,8425,8425,42207,42207,10473,10474,10474,10506,10506,42207,42207,42207,42207,42207,42207,10539,10539,10539,12588,12620,12620,12620,12620,12620,12621,12621,12653,14701,14702,14702,14734,14734,14734,14735,14735,14735,16815,16816,16816,16816,16817,16849,16849,16849,16849,18930,18930,18930,18931}, {17594,17562,17562,17529,17497,17497,17464,17432,17432,17399,17367,17367,17335,17302,17302,17270,17270,17237,17237,17205,17172,17172,15092,15091,15059,15059,15027,15027,14994,14994,14962,42207,42207,42207,42207,42207,42207,12783,12783,12750,12750,42207,42207,42207,42207,42207,42207,10604,10572,10571,10571,42207,42207,10539,10538,10506,10506,10506,10506,10474,8425,42207,42207,42207,42207,42207,42207,42207,42207,8392,8392,8392,8392,42207,42207,42207,42207,42207,42207,8360,8360,8360,8360,42207,42207,42207,42207,42207,42207,8360,8360,8360,8360,42207,42207,42207,42207,42207,42207,8392,8392,8392,8392,8392,8392,8392,8392,8424,8425,8425,8425,8425,8425,42207,42207,10473,10474,10506,10506,10506,42207,42207,42207,42207,42207,42207,10539,10539,12587,12588,12620,12620,12620,12620,12621,12653,12653,12653,12653,14702,14702,14702,14734,14734,14735,14735,14767,14768,16816,16816,16816,16817,16849,16849,16849,16850,16882,18930,18931,18931}, {17594,17594,17562,17529,17497,17497,17464,17464,17432,17399,17399,17367,17334,17334,17302,17302,17270,17237,17237,17205,15156,15124,15124,15091,15059,15059,15027,15026,14994,14994,14961,42207,42207,42207,42207,42207,42207,12783,12783,12750,12750,42207,42207,12685,10637,10637,10604,10604,10572,10572,10571,42207,42207,10539,10538,10506,10506,10506,10506,10473,10473,42207,42207,8393,8393,8393,8393,42207,42207,8392,8360,8392,8392,8360,8360,42207,42207,8360,8360,8360,8360,8360,8360,42207,42207,8360,8360,8360,8360,8360,8360,8360,8360,42207,42207,8392,8392,42207,42207,8392,8392,8392,8392,8392,8392,8392,8392,8425,8425,8425,8425,8425,8425,42207,42207,10505,10474,10506,10506,10506,42207,42207,42207,42207,42207,42207,10539,10539,10540,12588,12588,12620,12620,12620,12621,12621,12653,12653,14701,14702,14702,14734,14734,14735,14735,14735,14767,16816,16816,16816,16848,16849,16849,16849,16849,16882,18930,18930,18930,18931}, {17626,17594,17562,17529,17529,17497,17464,17464,17432,17431,17399,17367,17367,17334,17302,17302,17270,17269,17237,15157,15156,17172,15124,15092,15091,15059,15059,15026,15026,14994,14961,42207,42207,42207,42207,42207,42207,12783,12782,12782,12750,42207,42207,12717,12685,10636,10636,10604,10604,10572,10571,42207,42207,10539,10538,10506,10506,10506,10506,10473,8425,42207,42207,8425,8393,8393,8392,42207,42207,8392,8360,8392,8360,8360,8360,42207,42207,8360,8360,8360,8360,8360,8360,42207,42207,8360,8360,8360,8360,8360,8360,8360,8360,42207,42207,8392,8392,42207,42207,8392,8392,8392,8392,8392,8392,8392,8392,8393,8425,8425,8425,8425,8425,42207,42207,10473,10473,10506,10506,10506,42207,42207,42207,42207,42207,42207,10539,10539,12588,12620,12620,12620,12620,12621,12621,12621,12653,12653,14701,14702,14702,14734,14734,14735,14735,14767,14767,14768,16816,16816,16816,16849,16849,16849,16849,16882,16882,18930,18931,18931}, {17626,17594,17594,17562,17529,17497,17497,17464,17432,17432,17399,17399,17367,17334,17334,17302,17302,17269,17237,17237,17204,17172,15124,15091,15091,15059,15059,15026,15026,14994,14994,42207,42207,42207,42207,42207,42207,12815,12783,12782,12750,42207,42207,12717,12685,10636,10636,10604,10604,10572,10571,42207,42207,42207,42207,42207,42207,42207,42207,8425,8425,42207,42207,8425,8393,8424,8392,42207,42207,8392,8392,8392,8360,8360,8392,42207,42207,8360,8360,8360,8360,8360,8360,42207,42207,42207,42207,42207,42207,42207,42207,8360,8392,42207,42207,8392,8392,8392,8392,42207,42207,8392,8392,8392,8392,8392,8424,8425,8425,8425,8425,42207,42207,42207,42207,42207,42207,10506,10506,10506,42207,42207,42207,42207,42207,42207,10539,10539,12588,12620,12620,12620,12620,12621,12621,12621,12653,12653,12654,14702,14702,14734,14735,14735,14735,14735,14767,16816,16816,16816,16848,16849,16849,16849,16881,18930,18930,18930,18931,18963}, {17627,17594,17594,17561,17529,17529,17497,17464,17464,17432,17399,17399,17367,17367,17334,17302,17302,17269,17269,15189,15157,15156,15124,15124,15091,15059,15059,15026,15026,15026,14994,42207,42207,42207,42207,42207,42207,12815,12782,12750,12750,42207,42207,12717,10669,10637,10636,10604,10604,10571,10571,42207,42207,42207,42207,42207,42207,42207,42207,8425,8425,42207,42207,8425,8393,8393,8392,42207,42207,8392,8392,8392,8360,8360,8360,42207,42207,8360,8360,8360,8360,8360,8360,42207,42207,42207,42207,42207,42207,42207,42207,8360,8360,42207,42207,8392,8392,8392,8392,42207,42207,8392,8392,8392,8392,8392,8393,8425,8425,8425,8425,42207,42207,42207,42207,42207,42207,10506,10506,10506,42207,42207,42207,42207,42207,42207,10539,10539,12588,12588,12620,12620,12620,12621,12621,12621,12653,14701,14702,14702,14734,14734,14735,14735,14735,14767,14768,16816,16816,16816,16817,16849,16849,16849,16850,18930,18930,18930,18931,18963}, {17627,17626,17594,17594,17561,17529,17529,17497,17464,17432,17431,17399,17367,17367,17334,17334,17302,17269,17269,17237,15189,15156,15124,15124,15091,15091,15059,15059,15026,15026,14993,42207,42207,42207,42207,42207,42207,12815,12783,12782,12750,12750,12749,12717,10637,10637,10636,10604,10604,10571,10571,10571,10571,10539,10538,10538,10506,8458,8458,8457,8425,8425,8425,8425,8393,8393,8392,8392,8392,8392,8392,8392,8392,8360,8360,8360,8360,8360,8360,8360,8360,8360,8360,8360,8360,8360,8360,8360,8360,8360,8360,8360,8360,8360,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8425,8393,8425,8425,8425,8425,8425,10473,10473,10506,10506,10506,10506,42207,42207,42207,42207,42207,42207,10539,12587,12588,12620,12620,12620,12620,12621,12621,12653,12653,12653,14702,14702,14702,14734,14735,14735,14735,14735,16816,16816,16816,16816,16849,16849,16849,16849,16882,16882,18930,18930,18931,18963}, {17659,17626,17626,17594,17561,17529,17529,17497,17464,17464,17432,17399,17399,17367,17366,17334,17302,17302,17269,17269,15189,15156,15156,15124,15124,15091,15059,15059,15026,15026,14993,42207,42207,42207,42207,42207,42207,12815,12783,12782,12750,12750,12717,10669,10669,10637,10636,10604,10604,10604,10571,10571,10571,10538,10538,10538,10506,10506,8457,8457,8425,8425,8425,8425,8392,8392,8392,8392,8392,8392,8360,8392,8392,8360,8360,8360,8360,8360,8360,8360,8360,8360,8360,8359,8360,8360,8360,8360,8360,8360,8360,8392,8392,8360,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8425,8425,8425,8425,8425,8425,8425,10473,10506,10506,10506,10506,10506,42207,42207,42207,42207,42207,42207,10539,10540,12588,12620,12620,12620,12620,12621,12621,12653,12653,12653,14702,14734,14734,14734,14735,14735,14735,14767,16816,16816,16816,16816,16849,16849,16849,16849,16882,18930,18930,18931,18963,18963}, {17659,17658,17626,17594,17562,17561,17529,17497,17496,17464,17432,17431,17399,17367,17366,17334,17302,17302,17269,15221,15189,15188,15156,15124,15123,15091,15091,15059,15058,15026,14994,42207,42207,42207,42207,42207,42207,12815,12782,12782,12782,12750,12749,12717,10669,10637,10636,10604,10604,10603,10571,10571,10539,10538,10538,10538,10506,10506,8457,8457,8425,42207,42207,8425,8424,8424,8392,8392,8392,42207,42207,8392,8360,8392,8360,42207,42207,42207,42207,8359,8360,8360,8359,42207,42207,8359,8360,8360,8360,42207,42207,8360,8360,8392,8360,42207,42207,8392,8392,8392,8392,8392,8392,8392,8392,8392,8425,8425,8425,8425,8425,8425,8425,10473,10505,10506,10506,10506,10506,10506,42207,42207,42207,42207,42207,42207,10539,12588,12588,12620,12620,12620,12621,12621,12621,12653,12653,14702,14702,14734,14734,14734,14735,14735,14735,14767,16816,16816,16816,16848,16849,16849,16849,16850,16882,18930,18930,18931,18931,18963}, {17691,17659,17626,17626,17594,17561,17529,17529,17496,17464,17464,17431,17399,17367,17367,17334,17334,17302,15221,17269,15189,15188,15156,15156,15124,15123,15091,15059,15058,15026,15025,42207,42207,42207,42207,42207,42207,12815,12815,12782,12782,12750,12749,10669,10669,10636,10636,10604,10604,10603,10571,10571,10571,10538,10538,8490,8458,8458,8457,8457,8457,42207,42207,8425,8392,8392,8392,8392,8392,42207,42207,8392,8360,8360,8360,42207,42207,42207,42207,8359,8359,8360,8359,42207,42207,8359,8359,8360,8360,42207,42207,8360,8392,8392,8392,42207,42207,8392,8392,8392,8392,8392,8392,8392,8392,8392,8424,8393,8425,8425,8425,8425,8425,10473,10473,10506,10506,10506,10506,10506,42207,42207,42207,42207,42207,42207,10539,12588,12588,12620,12620,12620,12621,12621,12621,12653,12653,12654,14702,14702,14734,14735,14735,14735,14767,14768,16816,16816,16816,16848,16849,16849,16849,16882,16882,18930,18930,18931,18963,18963}, {17691,17659,17658,17626,17594,17562,17561,17529,17497,17496,17464,17432,17431,17399,17367,17366,17334,17302,15253,15221,15189,15189,15156,15156,15124,15123,15091,15091,15058,15026,15025,42207,42207,42207,42207,42207,42207,12815,12814,12782,12782,12750,12749,10669,10669,10636,10636,10636,10604,10603,10603,10571,10571,10570,10538,8490,8490,8458,8457,8457,8425,42207,42207,8425,8424,8392,8424,8392,8392,42207,42207,8392,8360,42207,42207,8360,8360,8360,8359,42207,42207,8359,8359,42207,42207,42207,42207,8360,8360,42207,42207,8360,8360,8360,8392,42207,42207,8392,8392,8392,8392,8392,8392,8392,8392,8392,8425,8425,8425,8425,8425,8425,8425,8425,10473,10506,10506,10506,10506,10506,42207,42207,42207,42207,42207,42207,10539,12588,12620,12620,12620,12620,12621,12621,12653,12653,12653,14702,14702,14734,14734,14735,14735,14735,14767,16816,16816,16816,16816,16849,16849,16849,16849,16849,18930,18930,18931,18931,18963,18963}, {17691,17691,17658,17626,17594,17594,17561,17529,17529,17496,17464,17432,17431,17399,17399,17366,17334,15286,15254,17301,15221,15189,15188,15156,15156,15123,15091,15091,15058,15058,15026,42207,42207,42207,42207,42207,42207,12847,12814,12814,12782,10701,10701,10669,10669,10668,10636,10636,10604,10603,10603,10571,10571,10538,10538,8490,8490,8458,8457,8457,8457,42207,42207,8425,8425,8392,8392,8392,8392,42207,42207,8392,8392,42207,42207,8360,8360,8359,8359,42207,42207,8359,8359,42207,42207,42207,42207,8360,8360,42207,42207,8360,8392,8392,8392,42207,42207,8392,8392,8392,8392,8392,8392,8392,8392,8424,8425,8425,8425,8425,8425,8425,8425,8425,10506,10506,10506,10506,10506,10506,42207,42207,42207,42207,42207,42207,10540,12588,12620,12620,12620,12621,12621,12621,12653,12653,14701,14702,14702,14734,14734,14735,14735,14735,14767,14768,16816,16816,16816,16849,16849,16849,16849,16882,18930,18930,18930,18963,18963,18963}, {17723,17691,17659,17626,17626,17594,17561,17561,17529,17497,17496,17464,17431,17399,17399,17367,17366,17334,15254,15253,15221,15221,15188,15156,15124,15124,15123,15091,15058,15026,15026,42207,42207,42207,42207,42207,42207,12847,12815,12782,12782,10734,12749,10701,10669,10669,10668,10636,10604,10603,10603,10571,10571,10570,8490,8490,8490,8458,8457,8457,8457,42207,42207,8425,8424,42207,42207,8392,8392,42207,42207,8392,8392,42207,42207,8360,8360,8360,8359,42207,42207,8359,8359,42207,42207,8359,8359,42207,42207,42207,42207,8360,8392,8392,8392,42207,42207,8392,8392,8392,8392,8392,8392,8392,8392,8424,8424,8425,8425,8425,8425,8425,8425,10473,10505,10474,10506,10506,10506,10506,42207,42207,42207,42207,42207,42207,10540,12588,12620,12620,12620,12620,12621,12653,12653,12653,14701,14702,14702,14734,14734,14735,14735,14767,14767,16816,16816,16816,16817,16849,16849,16849,16849,16882,18930,18930,18931,18963,18963,18964}, {17723,17691,17691,17658,17626,17594,17562,17561,17529,17529,17496,17464,17464,17431,17399,17367,17366,15286,15286,15253,15221,15221,15189,15156,15156,15123,15123,15091,15059,15058,15025,42207,42207,42207,42207,42207,42207,12847,12815,12814,12782,10734,10701,10701,10669,10668,10636,10636,10636,10603,10603,10603,10571,8522,10538,8490,8490,8489,8457,8457,8457,42207,42207,8424,8424,42207,42207,8392,8392,42207,42207,8392,8360,42207,42207,8359,8359,8359,8359,42207,42207,8359,8359,42207,42207,8359,8359,42207,42207,42207,42207,8392,8360,8392,8392,42207,42207,8392,8392,8392,8392,8392,8392,8392,8392,8424,8425,8425,8425,8425,8425,8425,8425,10505,10506,10506,10506,10506,10506,10506,42207,42207,42207,42207,42207,42207,12588,12620,12620,12620,12620,12621,12621,12653,12653,12653,14702,14702,14702,14734,14735,14735,14735,14735,14767,16816,16816,16816,16816,16849,16849,16849,16850,16882,18930,18930,18931,18963,18963,18963}, {17724,17723,17691,17659,17626,17626,17594,17561,17561,17529,17496,17496,17464,17431,17431,17399,17366,15286,17334,15254,15253,15221,15221,15188,15156,15156,15123,15091,15090,15058,15026,42207,42207,42207,42207,42207,42207,12847,12847,12814,12782,12782,10701,10701,10701,10668,10636,10636,10636,10603,10603,10603,10571,8522,8490,8490,8490,8490,8457,8457,8457,42207,42207,42207,42207,8424,8424,42207,42207,42207,42207,8392,8392,42207,42207,8360,8360,8359,8359,42207,42207,8359,8359,42207,42207,8359,8359,8359,8359,42207,42207,8360,8360,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8425,8425,8425,8425,8425,10473,8425,8425,10506,10506,10506,10506,10506,10506,42207,42207,42207,42207,42207,42207,12588,12620,12620,12620,12620,12621,12621,12621,12653,12653,14702,14702,14734,14734,14735,14735,14735,14767,14768,16816,16816,16816,16849,16849,16849,16849,16882,18930,18930,18930,18931,18963,18963,18964}, {17756,17723,17691,17659,17658,17626,17594,17561,17561,17529,17496,17496,17464,17463,17431,17399,17366,15318,15286,15286,15253,15221,15189,15188,15156,15156,15124,15091,15091,15058,15026,42207,42207,42207,42207,42207,42207,12847,12847,12814,12814,10734,10701,10701,10669,10668,10668,10636,10636,10603,10603,10603,10570,8522,8490,8490,8490,8490,8457,8457,8457,42207,42207,42207,42207,8424,8424,42207,42207,42207,42207,8392,8392,42207,42207,8359,8359,8359,8359,42207,42207,8359,8359,42207,42207,8359,8359,8359,8359,42207,42207,8359,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8424,8425,8425,8425,8425,8425,8425,10473,10473,10474,10506,10506,10506,10506,10506,42207,42207,42207,42207,42207,42207,12588,12588,12620,12620,12621,12621,12621,12653,12653,12653,14702,14702,14702,14734,14735,14735,14735,14735,16816,16816,16816,16816,16849,16849,16849,16849,16882,18930,18930,18930,18963,18963,18963,18964}, {17756,17724,17691,17691,17658,17626,17626,17594,17561,17561,17529,17496,17464,17464,17431,17399,17399,15318,15318,15286,15253,15253,15221,15188,15188,15156,15123,15123,15090,15058,12978,42207,42207,42207,42207,42207,42207,12847,12847,12814,10766,10734,10701,10701,10701,10669,10668,10636,10636,10603,10603,10603,8523,8522,8522,8490,8490,8490,8489,8457,8457,42207,42207,8424,8424,8424,8392,8392,8392,42207,42207,8392,8392,8392,8360,42207,42207,42207,42207,8359,8359,8359,8359,42207,42207,8359,8359,8359,8359,42207,42207,8360,8392,8392,8392,42207,42207,8392,8392,8392,8392,8392,8392,8392,8424,8425,8425,8425,8425,8425,8425,8425,10473,10505,10506,10506,10506,10506,10506,10506,42207,42207,42207,42207,42207,42207,12588,12620,12620,12620,12620,12621,12621,12653,12653,14701,14702,14734,14702,14734,14735,14735,14735,16815,16816,16816,16816,16816,16849,16849,16849,16849,16882,18930,18930,18931,18963,18963,18964,18964}, {17756,17756,17723,17691,17691,17658,17626,17594,17593,17561,17529,17528,17496,17464,17431,17431,17399,17366,15318,15286,15254,15253,15221,15221,15188,15156,15156,15123,15090,15058,13010,42207,42207,42207,42207,42207,42207,12847,12847,12815,10766,10734,10733,10701,10701,10668,10668,10636,10636,10603,10603,10603,8523,8522,8522,8522,8490,8489,8489,8457,8457,42207,42207,8425,8424,8424,8424,8424,8392,42207,42207,8392,8392,8392,8391,42207,42207,42207,42207,8359,8359,8359,8359,42207,42207,8359,8359,8359,8359,42207,42207,8360,8392,8360,8392,42207,42207,8392,8392,8392,8392,8392,8392,8392,8392,8392,8425,8425,8425,8425,8425,8425,8457,10474,10506,10506,10506,10506,10506,10506,42207,42207,42207,42207,42207,42207,12620,12620,12620,12620,12621,12621,12653,12653,12653,14702,14702,14702,14734,14734,14735,14735,14735,14767,16816,16816,16816,16817,16849,16849,16849,16882,18930,18930,18930,18931,18963,18963,18963,21012}, {17788,17756,17724,17691,17691,17658,17626,17594,17594,17561,17529,17529,17496,17464,17463,17431,17399,15350,15318,15286,15286,15253,15221,15221,15188,15156,15155,15123,15091,15058,13010,42207,42207,42207,42207,42207,42207,12879,12847,12814,10766,10734,10733,10701,10701,10668,10668,10636,10636,10635,10603,8555,10571,8522,8522,8490,8490,8489,8489,8457,8457,8457,8425,8425,8424,8424,8424,8392,8392,8392,8392,8392,8392,8392,8391,8359,8359,8359,8359,8359,8359,8359,8359,8359,8359,8359,8359,8359,8359,8359,8359,8392,8392,8360,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8425,8425,8425,8425,8425,8425,10473,10473,10474,10506,10506,10506,10506,10506,10506,42207,42207,42207,42207,42207,42207,12588,12620,12620,12620,12621,12621,12653,12653,12653,14702,14702,14702,14734,14735,14735,14735,14767,16816,16816,16816,16816,16817,16849,16849,16849,16850,18930,18930,18930,18963,18963,18963,18964,18964}, {17788,17756,17756,17723,17691,17691,17658,17626,17594,17593,17561,17529,17496,17496,17464,17431,15383,15351,15318,15318,15286,15253,15253,15221,15220,15188,15156,15123,15123,15090,13010,42207,42207,42207,42207,42207,42207,12879,10799,10766,10766,10766,10733,10733,10701,10701,10668,10668,10636,10635,10603,10603,8555,8522,8522,8522,8490,8490,8489,8457,8457,8457,8457,8424,8424,8424,8424,8424,8392,8392,8392,8392,8392,8392,8392,8391,8359,8359,8359,8359,8359,8359,8359,8359,8359,8359,8359,8359,8359,8359,8359,8360,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8424,8425,8425,8425,8425,8425,8425,10473,10506,10506,10506,10506,10506,10506,10507,42207,42207,42207,42207,42207,42207,12620,12620,12620,12620,12621,12621,12653,12653,12653,14702,14702,14734,14734,14735,14735,14735,14767,14768,16816,16816,16816,16849,16849,16849,16849,16882,18930,18930,18931,18931,18963,18963,21012,21012}, {17789,17788,17756,17723,17723,17691,17658,17626,17626,17593,17561,17529,17528,17496,17464,17463,17431,17399,15350,15318,15286,15285,15253,15221,15220,15188,15156,15123,15123,13042,13042,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,12620,12620,12620,12621,12621,12621,12653,12653,14701,14702,14702,14734,14734,14735,14735,14735,14767,16816,16816,16816,16816,16849,16849,16849,16849,16882,18930,18930,18931,18963,18963,18963,18964,21012}, {17821,17788,17756,17756,17723,17691,17659,17658,17626,17594,17593,17561,17529,17496,17496,17463,15383,15383,15350,15318,15318,15286,15253,15253,15220,15188,15188,15155,15123,13042,13042,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,12620,12620,12620,12620,12621,12621,12653,12653,12654,14702,14702,14734,14734,14735,14735,14735,14767,16816,16816,16816,16848,16849,16849,16849,16849,18930,18930,18930,18931,18963,18963,18964,21012,21012}, {17821,17821,17788,17756,17723,17723,17691,17658,17626,17626,17593,17561,17529,17528,17496,17464,17431,17431,15351,15350,15318,15286,15285,15253,15221,15220,15188,15155,15123,13042,13042,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,12620,12620,12620,12621,12621,12621,12653,12653,14702,14702,14734,14734,14735,14735,14735,14735,16815,16816,16816,16816,16817,16849,16849,16849,16882,18930,18930,18930,18931,18963,18963,18964,18964,21044}, {17853,17821,17788,17756,17756,17723,17691,17659,17658,17626,17593,17593,17561,17528,17496,17464,17463,15383,15383,15350,15318,15286,15285,15253,15221,15220,15188,15155,15123,13074,13042,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,12620,12620,12620,12621,12621,12653,12653,14701,14702,14702,14702,14734,14735,14735,14735,14735,14768,16816,16816,16816,16849,16849,16849,16849,16882,18930,18930,18931,18931,18963,18963,18964,21012,21044}, {17853,17821,17788,17788,17756,17723,17691,17691,17658,17626,17626,17593,17561,17529,17528,17496,17464,15383,15383,15350,15350,15318,15286,15253,15253,15220,15188,15155,13107,13042,13042,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,12620,12620,12620,12621,12621,12653,12653,12653,14702,14702,14734,14734,14735,14735,14735,14767,14768,16816,16816,16816,16849,16849,16849,16849,18930,18930,18930,18931,18931,18963,18964,18964,21012,21044}, {17853,17853,17821,17788,17756,17756,17723,17691,17658,17626,17626,17593,17561,17561,17528,17496,15416,17463,15383,15383,15350,15318,15286,15285,15253,15221,15188,15155,13107,13074,13042,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,42207,12620,12620,12621,12621,12621,12653,12653,12654,14702,14734,14734,14734,14735,14735,14735,14767,16816,16816,16816,16817,16849,16849,16849,16881,18898,18930,18930,18931,18963,18963,18964,18964,21044,21044}, {17885,17853,17821,17788,17756,17756,17723,17691,17691,17658,17626,17626,17593,17561,17528,17496,17496,15415,15383,15383,15350,15318,15318,15285,15253,15220,15220,15188,15155,13075,13074,13042,13009,13009,12977,12944,12944,12911,12879,10830,10798,10798,10765,10765,10733,10701,10700,10668,10668,10667,8587,8587,8555,8554,8522,8522,8522,8521,8489,8489,8489,8457,8457,8456,8456,8456,8424,8424,8424,8424,8424,8392,8392,8392,8391,8391,8391,8391,6343,8359,6311,8359,8359,8359,6311,8359,8359,8359,8359,8391,8359,8392,8360,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8424,8425,8425,8425,8425,8425,8425,8425,10473,10506,10506,10506,10506,10506,10506,10507,10539,10539,10539,10539,10540,12588,12588,12620,12620,12621,12621,12653,12653,12653,14702,14702,14702,14734,14735,14735,14735,14735,16816,16816,16816,16816,16849,16849,16849,16849,16850,16882,18930,18930,18963,18963,18963,18964,18964,21044,21045}, {17886,17853,17821,17821,17788,17756,17755,17723,17691,17658,17626,17626,17593,17593,17561,17528,17496,17464,15415,15383,15383,15350,15318,15286,15253,15253,15220,15187,15187,15123,13074,13042,13009,12977,12976,12944,12944,12911,10863,10831,10798,10798,10766,10765,10733,10733,10700,10700,10668,8619,8587,8587,8587,8554,8554,8522,8522,8490,8489,8489,8489,8457,8457,8456,8456,8424,8424,8424,8424,8424,8424,8392,8392,8391,8392,8391,6343,8391,6343,6343,8391,8359,8359,8391,8359,8391,8359,8359,8359,8359,8359,8391,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8424,8425,8425,8425,8425,8425,8425,8425,8425,10505,10506,10506,10506,10506,10506,10538,10507,10539,10539,10539,10539,12588,12620,12620,12620,12620,12621,12621,12653,12653,12653,14702,14702,14734,14734,14734,14735,14735,14735,14768,16816,16816,16816,16849,16849,16849,16849,16882,18930,18930,18931,18931,18963,18963,18964,21012,21044,21045}, {17918,17886,17853,17821,17788,17756,17756,17723,17691,17691,17658,17626,17593,17593,17561,17528,17528,17496,15415,15383,15383,15350,15318,15318,15285,15253,15220,15188,13107,13107,13074,13042,13041,13009,12976,12976,12944,12911,12911,10831,10798,10798,10766,10765,10733,10733,10701,10700,10668,10668,8587,8587,8587,8555,8554,8554,8522,8522,8489,8489,8489,8489,8457,8456,8456,8424,8456,8424,8424,8424,8424,8392,8392,8391,8392,8391,6343,8391,8391,6343,8391,8391,6311,6343,8359,8359,8359,8391,8359,8391,8391,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8424,8425,8425,8425,8425,8425,10473,10473,10506,10506,10506,10506,10506,10506,10507,10507,10539,10539,10539,10539,12588,12620,12620,12620,12620,12621,12621,12653,12653,12653,14702,14702,14734,14734,14735,14735,14735,14767,16816,16816,16816,16817,16849,16849,16849,16849,16850,18930,18930,18931,18963,18963,18963,18964,21012,21044,21045}, {17918,17886,17885,17853,17821,17788,17756,17755,17723,17691,17658,17626,17626,17593,17561,17561,15480,17496,15415,15415,15383,15350,15350,15318,15285,15253,15220,15220,13139,13107,13074,13042,13041,13009,12977,12976,12944,12943,10863,10831,10830,10798,10766,10765,10765,10733,10700,10700,8620,8620,8619,8587,8587,8555,8554,8554,8522,8522,8521,8489,8489,8489,8489,8456,8456,8456,8456,8424,8424,8424,8424,8424,8391,8392,8391,6343,6343,8391,6343,6343,6343,8359,8391,8359,8391,8359,8359,8391,8359,8359,8391,8359,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8424,8425,8425,8425,8425,8425,8425,10473,10506,10506,10506,10506,10506,10506,10507,10539,10539,10539,10539,10539,12588,12588,12620,12620,12620,12621,12621,12653,12653,14701,14702,14702,14734,14734,14735,14735,14735,14768,16816,16816,16816,16816,16849,16849,16849,16849,16882,18930,18930,18931,18931,18963,18964,18964,21044,21044,21045}, {17918,17918,17886,17853,17821,17788,17788,17756,17723,17691,17690,17658,17626,17593,17593,17561,17528,17496,17496,15415,15383,15382,15350,15318,15285,15253,15252,15220,15187,13107,13074,13074,13042,13009,13009,12976,12944,12943,10863,10831,10830,10798,10798,10765,10765,10733,10700,10700,10700,8620,8619,8587,8587,8555,8554,8554,8522,8522,8521,8489,8489,8489,8457,8457,8456,8456,8424,8424,8424,8424,8424,8424,8424,6344,8391,8391,8391,6343,6343,8391,8391,6343,8391,8359,8391,8359,8391,8359,8359,8391,8391,8392,8360,8392,8392,8392,8392,8392,8392,8392,8392,8392,8424,8425,8425,8425,8425,8425,8425,8425,10473,10506,10506,10506,10506,10506,10506,10507,10539,10539,10539,10539,12587,12588,12588,12620,12620,12621,12621,12653,12653,12653,14702,14702,14734,14734,14735,14735,14735,14767,14767,16816,16816,16816,16849,16849,16849,16849,16882,18930,18930,18930,18931,18963,18963,18964,21012,21012,21044,21045}, {17950,17918,17886,17853,17821,17821,17788,17756,17755,17723,17691,17658,17626,17626,17593,17561,17529,15480,15448,15415,15415,15383,15350,15318,15285,15285,15252,13172,13139,13139,13074,13074,13042,13009,12977,12976,12944,10896,10863,10863,10830,10798,10798,10765,10765,10733,10733,10700,10700,8620,8619,8619,8587,8587,8554,8554,8554,8522,8521,8521,8489,8489,8457,8457,8456,8456,8424,8456,8424,8424,8424,8424,8424,6343,6344,6343,6343,6343,8391,6343,8391,6343,6343,8391,6343,6343,8391,8391,8391,8391,8359,8391,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8424,8424,8425,8425,8425,8425,8425,8425,10474,10506,10506,10506,10506,10506,10506,10539,10539,10539,10539,10539,12587,12620,12620,12620,12620,12621,12621,12653,12653,12653,12654,14702,14734,14734,14735,14735,14735,14735,14768,16816,16816,16816,16817,16849,16849,16849,16882,18930,18930,18930,18931,18963,18963,18964,21012,21044,21045,21045}, {17950,17918,17918,17885,17853,17821,17788,17756,17756,17723,17691,17690,17658,17626,17593,17593,17561,17528,15448,15448,15415,15383,15350,15350,15317,15285,15252,15220,15187,13139,13106,13074,13042,13009,13009,12976,12976,12944,10863,10863,10831,10830,10798,10765,10765,10733,10733,10700,10700,8620,8619,8619,8587,8587,8554,8554,8554,8522,8522,8521,8489,8489,8489,8456,8456,8456,8456,8456,8424,8424,8424,8424,6344,8424,8391,6343,6343,8391,6343,8391,8391,8391,6343,8391,8359,8391,8359,8359,8391,8391,8391,8391,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8424,8425,8425,8425,8425,8425,10473,8457,10506,10506,10506,10506,10506,10506,10507,10539,10539,10539,10539,12588,12588,12620,12620,12620,12621,12621,12653,12653,12653,14702,14702,14702,14734,14735,14735,14735,14767,16816,16816,16816,16848,16849,16849,16849,16849,16850,18930,18930,18931,18963,18963,18963,18964,21044,21044,21045,21045}, {17950,17950,17918,17886,17853,17853,17821,17788,17756,17755,17723,17691,17658,17626,17626,17593,17561,17560,17528,15448,15415,15415,15383,15350,15318,15285,15252,15252,13171,13139,13107,13074,13074,13041,13009,12977,12976,10896,10895,10863,10831,10830,10798,10797,10765,10765,10733,10700,8652,8652,8619,8619,8587,8587,8554,8554,8554,8522,8522,8522,8489,8489,8489,8457,8456,8456,8456,8424,8424,8424,6376,8424,6376,6376,6343,6343,8391,8391,6343,6343,6343,6343,8391,6343,8391,8391,6343,8391,8391,8391,8391,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8424,8425,8425,8425,8425,8425,10473,10473,10506,10506,10506,10506,10506,10506,10507,10539,10539,10539,10539,10539,12588,12620,12620,12620,12621,12621,12653,12653,12653,14701,14702,14702,14734,14734,14735,14735,14735,14767,16816,16816,16816,16816,16849,16849,16849,16849,18930,18930,18930,18931,18963,18963,18963,18964,21012,21045,21045,21045}, {17919,17950,17918,17918,17886,17853,17821,17788,17756,17756,17723,17691,17690,17658,17626,17625,17561,17560,15480,17496,15447,15415,15383,15350,15318,15285,15285,15252,15220,13139,13107,13106,13074,13041,13009,13009,12976,10928,10895,10863,10863,10830,10798,10798,10765,10765,10733,10732,10700,8652,8619,8619,8587,8587,8586,8554,8554,8522,8522,8521,8489,8489,8489,8489,8457,8456,8456,8456,8424,8424,8424,8424,6376,8424,8424,6344,6343,6343,8391,8391,8391,6343,8391,8391,6343,6343,8391,8391,8391,8391,8391,8391,8392,8392,8392,8392,8392,8392,8392,8392,8392,8424,8424,8425,8425,8425,8425,8425,8425,8425,10505,10506,10506,10506,10506,10506,10507,10539,10539,10539,10539,10539,12588,12620,12620,12620,12621,12621,12621,12653,12653,14702,14702,14734,14734,14734,14735,14735,14735,14768,16816,16816,16816,16849,16849,16849,16849,16882,16882,18930,18930,18931,18963,18963,18964,21012,21012,21044,21045,21045}, {17950,17950,17950,17918,17886,17853,17821,17820,17788,17756,17723,17723,17691,17658,17626,17625,17593,17561,17528,15480,15447,15415,15383,15382,15350,15317,15285,15252,13172,13139,13107,13106,13074,13041,13009,13009,12976,10928,10895,10863,10863,10830,10798,10797,10765,10765,10765,8684,8652,8652,8619,8619,8587,8587,8586,8554,8554,8554,8522,8521,8521,8489,8489,8489,8456,8456,8456,8456,8456,6376,8424,8424,6376,8423,8392,8391,6343,8391,8391,6343,6343,6343,6343,6343,6343,8391,8391,8391,8391,8391,8391,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8424,8424,8425,8425,8425,8425,8425,8425,10505,10506,10506,10506,10506,10506,10506,10506,10539,10539,10539,10539,10540,12620,12620,12620,12620,12621,12621,12621,12653,12653,14702,14702,14734,14734,14734,14735,14735,14735,16816,16816,16816,16816,16849,16849,16849,16849,16850,18930,18930,18931,18931,18963,18963,18964,21012,21044,21045,21045,21045}, {17918,19998,17951,17918,17918,17886,17853,17821,17788,17756,17756,17723,17691,17690,17658,17626,17593,17561,17561,17528,15448,15447,15415,15382,15350,15317,15285,15252,42207,42207,42207,13106,13074,42207,42207,42207,12976,10928,42207,42207,42207,42207,10830,10798,42207,42207,42207,10732,8652,42207,42207,42207,8619,8587,8586,42207,8554,8554,42207,8521,42207,42207,42207,42207,8456,42207,8456,8456,8456,42207,8424,8424,42207,42207,6376,6375,8391,6343,42207,42207,42207,42207,42207,8391,8391,42207,42207,6343,8391,8391,8391,42207,42207,42207,8392,8392,42207,42207,42207,42207,8424,8424,42207,42207,42207,8425,42207,42207,42207,42207,42207,10506,10506,42207,42207,10506,10539,42207,42207,42207,10539,12587,42207,42207,42207,42207,42207,12621,12621,42207,12653,14702,14734,14702,14734,14735,14735,14735,14767,14768,16816,16816,16816,16849,16849,16849,16849,16882,18930,18930,18931,18931,18963,18963,18964,21044,21044,21045,21045,21077}, {17950,17950,17950,17918,17918,17886,17853,17821,17821,17788,17756,17755,17723,17691,17658,17626,17626,17593,17561,15480,15480,15447,15415,15382,15350,15318,15285,15252,42207,13171,13139,42207,13074,42207,13041,13009,42207,10928,42207,10895,10863,10830,10830,42207,10797,10765,10765,10732,42207,8652,8652,8619,8619,8587,8587,42207,8554,42207,8522,8521,42207,8521,8489,8489,8489,42207,8456,8456,8424,42207,8424,42207,8424,8424,42207,6376,6375,6343,6343,8391,42207,6343,6343,6343,42207,6343,8391,42207,8391,8392,8391,42207,8392,8392,42207,8392,42207,8392,8392,8392,8392,42207,8424,8425,8425,8425,8425,8425,42207,10505,10506,10506,42207,10506,10506,42207,10539,42207,10539,10539,42207,12588,12588,12620,42207,12620,12621,12621,12653,42207,12653,14702,14702,14734,14734,14735,14735,14735,14767,16816,16816,16816,16816,16849,16849,16849,16849,16850,18930,18930,18931,18963,18963,18964,18964,21012,21044,21045,21045,21045}, {17918,17950,17950,17951,17918,17918,17886,17853,17821,17788,17788,17756,17723,17691,17690,17658,17626,17593,17593,17560,15480,15448,15415,15414,15350,15317,15317,15284,42207,42207,42207,13107,13074,42207,42207,42207,10961,10928,42207,42207,42207,10862,10830,10830,42207,42207,10765,10732,10732,42207,42207,8619,8619,8619,8587,42207,42207,8554,8554,8521,42207,42207,42207,8489,8489,8488,42207,42207,42207,8456,8424,42207,8424,6376,42207,8424,6343,6343,6343,6343,42207,6343,8391,8391,42207,8391,8391,42207,8391,8391,8391,42207,42207,42207,8392,8392,42207,42207,42207,8392,8392,8424,42207,42207,8425,8425,8425,8425,42207,10506,10506,10506,42207,42207,42207,42207,10539,42207,42207,42207,10539,12588,12620,12620,42207,12620,12621,12621,12653,42207,14702,14702,14702,14734,14735,14735,14735,14735,14767,16816,16816,16816,16849,16849,16849,16849,16882,18930,18930,18930,18931,18963,18963,18964,18964,21044,21045,21045,21045,21077}, {17950,17950,17950,19998,17950,17918,17886,17853,17821,17820,17788,17756,17755,17723,17691,17658,17626,17625,17593,17560,15480,15448,15415,15382,15382,15350,15317,15285,42207,13172,13139,13139,13106,42207,13041,42207,13008,10928,42207,10895,10863,10862,10830,10830,10797,10765,42207,10733,8684,8684,8652,42207,8619,8619,8587,42207,8554,42207,8554,8554,42207,8521,8521,8489,8489,8456,8456,42207,8456,8456,8424,42207,8424,6376,42207,6376,6375,6343,8391,6343,42207,6343,8391,8391,42207,8391,8391,42207,8392,8391,8391,42207,8392,42207,8392,8392,42207,8392,8392,8392,8424,8424,8425,8425,42207,8425,8425,8425,42207,10505,10506,10506,42207,10506,10506,42207,10539,42207,10539,42207,12588,12588,12620,12620,42207,12621,12621,12653,12653,12653,14702,14702,14702,14734,14734,14735,14735,14735,16816,16816,16816,16816,16849,16849,16849,16849,16850,18930,18930,18930,18931,18963,18963,18964,21012,21044,21045,21045,21077,21077}, {17950,17950,17950,17918,17950,17950,17886,17886,17853,17821,17788,17788,17755,17723,17691,17690,17658,17626,17593,17561,15512,15480,15447,15415,15382,15350,15317,15285,42207,13204,13171,13139,13106,42207,13073,13041,42207,10960,42207,42207,42207,42207,10830,42207,42207,42207,10765,10765,42207,42207,42207,8652,8619,8619,8619,42207,8586,8554,42207,8521,42207,42207,42207,42207,8489,8489,8456,42207,6408,8456,6376,6376,42207,42207,6376,8424,6344,8391,6343,6343,42207,8391,8391,6343,8391,42207,42207,8391,8391,8392,8392,42207,8392,8392,42207,8392,42207,42207,42207,42207,8424,42207,42207,42207,8425,8425,8425,8425,42207,10506,10506,10506,42207,10506,10506,42207,10539,42207,10539,10539,42207,12620,12620,12620,42207,12621,12621,12621,12653,42207,14702,14702,14734,14734,14735,14735,14735,14767,16816,16816,16816,16816,16849,16849,16849,16849,16882,18930,18930,18931,18963,18963,18963,21012,21012,21044,21045,21045,21045,21046}, {17950,17951,17950,17951,17950,19998,17918,17886,17853,17821,17820,17788,17756,17723,17723,17690,17658,17626,17593,17593,17560,15480,15447,15415,15382,15350,15317,15285,13236,13204,13171,13139,13106,13074,13074,13041,13009,13008,10928,10895,10895,10863,10862,10830,10830,10797,10765,10765,10732,8684,8652,8652,8619,8619,8619,8587,8586,8554,8554,8554,8521,8521,8521,8489,8489,8489,8456,8456,8456,8456,6408,8424,6376,6376,6376,6376,6376,8424,8423,6343,8391,6343,8391,8391,8391,8391,8391,8392,8391,8391,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8424,8424,8425,8425,8425,8425,8425,8425,8457,10506,10506,10506,10506,10506,10506,10539,10539,10539,10539,10539,12588,12620,12620,12620,12620,12621,12621,12653,12653,12653,14702,14702,14734,14734,14735,14735,14735,14767,16816,16816,16816,16817,16849,16849,16849,16850,16850,18930,18930,18931,18963,18963,18963,18964,21012,21044,21045,21045,21077,21078}, {17950,17950,17950,17950,17919,17950,17950,17886,17885,17853,17821,17788,17756,17755,17723,17691,17658,17658,17625,17593,17561,15480,15447,15447,15382,15350,15317,15317,13236,13204,13171,13139,13106,13106,13074,13041,13009,10960,10928,10927,10895,10863,10862,10830,10830,10797,10797,8717,8716,8684,8652,8652,8619,8619,8587,8587,8586,8554,8554,8554,8521,8521,8521,8521,8489,8489,8488,8456,8456,8456,8456,8424,8424,8424,8424,8424,6376,6376,8423,6343,8391,6343,6343,6343,8391,8391,8391,8391,8391,8391,8392,8392,8392,8392,8392,8392,8392,8392,8424,8392,8392,8424,8425,8425,8425,8425,8425,10473,8457,10506,10506,10506,10506,10506,10506,10539,10539,10539,10539,10539,12588,12620,12620,12620,12621,12621,12621,12653,12653,12653,14702,14702,14702,14734,14735,14735,14735,14767,16816,16816,16816,16849,16849,16849,16849,16850,18930,18930,18930,18931,18931,18963,18964,21012,21012,21045,21045,21045,21045,21078}, {17950,17950,17950,17950,17950,17951,17950,17918,17886,17853,17821,17820,17788,17756,17723,17691,17690,17658,17626,17625,15512,15512,15480,15415,15414,15382,15349,13269,15284,13204,13171,13171,13139,13106,13074,13073,13041,10961,10928,10928,10895,10895,10862,10830,10830,10797,10765,10765,10765,8684,8684,8652,8651,8619,8619,8587,8586,8586,8554,8554,8553,8521,8521,8521,8489,8489,8488,8488,8456,8456,6408,8456,8424,6376,6376,6376,8424,6376,6375,8391,6343,6344,6343,8391,8391,6343,8391,8392,8392,8392,8391,8392,8392,8392,8392,8392,8392,8392,8392,8424,8424,8425,8425,8425,8425,8425,8425,10473,10505,10506,10506,10506,10506,10506,10539,10539,10539,10539,10539,10539,12588,12620,12620,12620,12620,12621,12653,12653,12653,14702,14702,14702,14734,14735,14735,14735,14735,14768,16816,16816,16848,16849,16849,16849,16849,16850,18930,18930,18930,18931,18963,18963,18964,18964,21044,21045,21045,21077,21078,21078}, {17950,17919,17951,17950,17950,17950,17918,17918,17918,17886,17853,17821,17788,17756,17755,17723,17690,17658,17658,17626,17593,15512,15479,15447,15415,15382,15350,15317,13237,13204,13204,13171,13138,13106,13074,13073,13041,13008,10928,10928,10895,10895,10862,10830,10830,10798,10797,10765,8717,8684,8684,8652,8651,8619,8619,8619,8586,8586,8554,8554,8554,8521,8521,8521,8489,8489,8489,8488,8456,8456,8456,8456,8424,6376,8424,6376,6376,6376,6376,8424,6375,8391,6343,6343,8391,8391,8391,8391,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8424,8424,8424,8425,8425,8425,8425,8425,10473,10473,10506,10506,10506,10506,10506,10506,10539,10507,10539,10539,10539,10539,12588,12620,12620,12620,12621,12621,12653,12653,12653,12654,14702,14702,14734,14735,14735,14735,14767,14768,16816,16816,16816,16817,16849,16849,16849,16850,18930,18930,18931,18931,18963,18963,18964,21044,21044,21045,21045,21045,21078,21078}, {17950,17950,17950,17950,17950,17951,17918,17951,17918,17886,17853,17821,17820,17788,17756,17723,17723,17690,17658,17626,17593,15512,15480,15447,15415,15382,15350,15317,15285,13236,13204,13171,13139,13106,13106,13073,13041,10993,10960,10928,10927,10895,10863,10862,10830,10829,10797,10765,8717,8684,8684,8652,8651,8619,8619,8587,8587,8586,8554,8554,8554,8521,8521,8521,8521,8489,8489,8488,8456,6408,8456,6408,6408,6408,6376,6376,6376,6376,6376,8392,6375,6376,8423,6343,8391,8391,8392,8392,8392,8391,8392,8392,8392,8392,8392,8392,8392,8392,8424,8424,8424,8425,8425,8425,8425,8425,8425,8425,10506,10506,10506,10506,10506,10538,10539,10539,10539,10539,12587,10540,12620,12620,12620,12620,12621,12621,12653,12653,12653,14702,14702,14702,14734,14735,14735,14735,14767,14768,16816,16816,16848,16849,16849,16849,16881,16882,18930,18930,18930,18931,18963,18964,18964,21012,21044,21045,21045,21045,21078,21078}, {17951,17950,19998,17951,17950,19966,17950,17950,19966,17886,17886,17853,17821,17788,17756,17755,17723,17690,17690,17626,15545,15512,15512,15479,15415,15414,15382,15349,13269,13236,13204,13171,13171,13138,13106,13074,10993,13009,10960,10928,10928,10895,10895,10862,10862,10829,10797,10797,8717,8716,8684,8652,8652,8651,8619,8619,8587,8586,8586,8554,8554,8553,8521,8521,8521,8489,8489,8489,8488,8456,8456,6408,8456,8424,8424,6376,8424,6376,6376,8424,6376,6343,8424,6343,6344,8391,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8424,8424,8424,8425,8425,8425,8425,8425,8425,10505,10506,10506,10506,10506,10506,10506,10539,10539,10539,10539,10539,12588,12620,12620,12620,12620,12621,12621,12653,12653,12654,14702,14702,14734,14734,14735,14735,14767,16816,16816,16816,16816,16849,16849,16849,16849,16850,16882,18930,18930,18931,18963,18963,18963,18964,21044,21044,21045,21045,21077,21078,21078}, {17950,17950,17951,17918,17950,17950,17950,17918,17950,17918,17886,17853,17821,17820,17788,17755,17723,17723,17690,17658,17625,15545,15480,15479,15447,15414,15382,15349,15317,13236,13204,13171,13171,13138,13106,13073,13073,13041,10960,10928,10928,10895,10895,10862,10830,10830,10797,10797,8717,8716,8684,8684,8652,8651,8619,8619,8587,8586,8586,8554,8554,8553,8521,8521,8521,8489,8489,8489,8488,8456,8456,6408,8456,6408,6376,6376,8424,6376,6376,8424,8424,6376,8392,8392,8391,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8392,8424,8424,8424,8424,8424,8425,8425,8425,8425,8425,8425,10505,10506,10506,10506,10506,10506,10506,10507,10539,10539,10539,10539,12588,12620,12620,12620,12620,12621,12653,12653,12653,14701,14702,14734,14734,14735,14735,14735,14735,16816,16816,16816,16816,16817,16849,16849,16849,16850,18930,18930,18931,18931,18963,18963,18964,21012,21044,21045,21045,21045,21077,21078,21078}, {17951,17950,17918,17950,19966,17950,17951,17950,17950,17950,17886,17885,17853,17821,17788,17756,17755,17723,17690,17658,17625,15545,15512,15480,15447,15415,15382,15350,42207,42207,42207,13203,13171,42207,42207,42207,13073,13041,42207,42207,42207,42207,10895,10862,42207,42207,42207,10797,10765,42207,42207,42207,8652,8651,8651,42207,8586,8586,42207,8554,42207,42207,42207,42207,8521,42207,8489,8489,8488,42207,8456,8456,42207,8456,6408,8456,8424,42207,42207,42207,42207,42207,8424,8391,42207,42207,8392,8392,8392,8392,42207,8392,8392,8392,42207,8424,8392,42207,42207,8424,8424,42207,42207,42207,8425,42207,8425,10506,42207,10506,10506,10506,42207,42207,42207,10539,10539,10539,42207,42207,12620,12620,12620,42207,42207,12653,12653,42207,42207,42207,42207,14734,14735,14735,14735,14735,14768,16816,16816,16848,16849,16849,16849,16849,16882,16882,18930,18930,18963,18963,18963,18964,21012,21044,21045,21045,21045,21078,21078,21078}, {17950,17950,17950,17950,17951,17918,17950,17951,17950,17918,17918,17886,17853,17821,17788,17788,17756,17723,17723,17690,15578,15545,15512,15512,15447,15415,15414,15350,42207,13269,13236,42207,13171,42207,13138,13106,42207,13041,42207,10960,10928,10927,10895,42207,10862,10830,10798,10797,42207,8717,8684,8684,8684,8651,8651,42207,8619,42207,8586,8586,42207,8554,8553,8521,8521,42207,8521,8489,8489,42207,6440,42207,42207,6408,8456,6408,6376,6376,6376,42207,8424,8424,8424,42207,6376,8392,42207,8424,8392,8392,42207,42207,8392,42207,42207,8424,42207,8424,8424,42207,8425,8425,42207,8425,8425,42207,42207,10506,42207,10506,10506,10506,42207,10507,10539,42207,10539,42207,12587,12620,42207,12620,42207,12621,12621,12621,12653,42207,14702,14702,14734,14734,14735,14735,14767,14767,16816,16816,16816,16848,16849,16849,16849,16849,16882,18930,18930,18931,18931,18963,18963,18964,21012,21044,21045,21045,21077,21078,21078,23126}, {17950,17950,19999,17918,17950,17950,17950,19966,17951,17950,17918,17886,17885,17853,17821,17788,17756,17755,17723,17690,17658,15577,15544,15512,15479,15415,15414,15382,42207,42207,42207,13204,13171,42207,42207,42207,13073,10993,42207,42207,42207,10928,10895,10895,42207,42207,10830,10797,10797,42207,42207,8684,8684,8652,8651,42207,42207,8587,8586,8586,42207,42207,42207,8553,8521,8521,42207,42207,42207,8488,8488,8456,42207,8456,6408,8424,6376,6376,8424,42207,6376,6376,6376,42207,8424,8424,42207,8392,8392,8392,42207,8392,42207,8392,42207,8424,42207,42207,42207,42207,8425,8425,42207,8425,8425,42207,10473,42207,42207,10506,10506,10506,42207,42207,42207,10539,10539,42207,42207,42207,42207,12620,42207,12621,42207,42207,12653,42207,42207,42207,14734,14734,14735,14735,14735,14767,16816,16816,16816,16816,16849,16849,16849,16849,16882,18930,18930,18931,18963,18963,18964,18964,21044,21044,21045,21045,21045,21078,21078,21078}, {17950,17919,17950,17950,17950,17950,17950,17950,17950,17950,17950,17918,17886,17853,17853,17820,17788,17755,17723,17690,17658,15577,15545,15512,15479,15447,15414,15382,42207,13269,13236,13204,13203,42207,13138,42207,13073,13073,42207,10960,10928,10927,10927,10895,10862,10862,42207,10797,8749,8717,8717,42207,8684,8652,8651,42207,8619,42207,8586,8586,42207,8554,8553,8521,8521,8521,8521,42207,8489,8488,8488,8456,42207,8456,8456,6408,6376,6376,6376,42207,6376,8424,8424,42207,8424,8424,42207,8424,8424,8392,42207,8424,8392,8424,42207,8392,42207,8392,8424,42207,8425,8425,42207,8425,8425,42207,10505,10506,42207,10506,10506,10506,42207,10539,10539,10539,10539,42207,12588,12620,42207,12620,42207,12621,12653,42207,12653,42207,14702,14702,14734,14734,14735,14735,14735,14767,16816,16816,16816,16849,16849,16849,16849,16850,16882,18930,18930,18931,18963,18963,18964,21012,21044,21045,21045,21045,21077,21078,23126,21078}, {17950,17950,17950,17950,19998,17950,19998,17950,17950,17950,19966,17918,17918,17885,17853,17821,17788,17756,17723,17722,17658,15577,15545,15512,15480,15447,15414,15382,42207,13269,13268,13236,13203,42207,13138,13106,42207,11025,42207,42207,42207,42207,10927,42207,42207,42207,10830,10829,42207,42207,42207,8716,8684,8684,8651,42207,8619,8618,42207,8586,42207,42207,42207,42207,8521,8521,8521,42207,8489,8488,8488,42207,42207,42207,8456,8456,8456,8424,8424,42207,8424,8424,8424,8424,42207,42207,8424,8424,8392,8392,42207,8392,8392,8424,42207,8424,42207,8424,8424,42207,8425,42207,42207,42207,8425,42207,10473,10506,42207,10506,10506,10506,42207,10539,10539,10539,10539,42207,12588,12620,42207,12620,12621,42207,42207,12653,12653,42207,42207,42207,42207,14734,14735,14735,14767,14768,16816,16816,16816,16849,16849,16849,16849,16882,18930,18930,18931,18963,18963,18963,21012,21012,21044,21045,21045,21045,21078,21078,21078,21078}, {17950,17918,19998,17950,17951,17950,17950,19998,19999,17951,17950,17950,17918,17886,17853,17821,17788,17788,17755,17723,17690,15578,15545,15512,15480,15447,15446,15414,15350,15349,13269,13236,13204,13171,13171,13138,13106,11025,11025,10993,10960,10928,10927,10895,10894,10862,10830,10829,8749,8749,8717,8716,8684,8684,8651,8651,8619,8619,8618,8586,8586,8554,8554,8553,8521,8521,8521,8489,8489,8489,6440,8488,8456,6408,8456,6408,8456,6376,6376,8424,6376,8424,8424,8424,8424,8424,8424,8424,8392,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8425,8425,8425,8425,8425,8425,8425,10505,10506,10506,10506,10506,10506,10507,10539,10539,10539,10539,12588,12588,12620,12620,12620,12621,12653,12621,12653,12653,14702,14702,14702,14734,14735,14735,14735,14767,16816,16816,16816,16848,16849,16849,16849,16849,16882,18930,18930,18931,18931,18963,18964,18964,21012,21044,21045,21045,21077,21078,21078,21078,21078}, {19999,19998,17950,17950,17918,17950,17950,17950,17950,17950,17918,17919,17918,17886,17885,17853,17820,17788,17755,17723,17690,17658,15577,15545,15512,15479,15447,15414,15382,13301,13269,13236,13236,13203,13171,13138,13106,13073,11025,10992,10960,10960,10927,10895,10895,10862,10862,10830,10797,10797,8717,8716,8684,8684,8683,8651,8651,8619,8587,8586,8586,8554,8554,8553,8553,8521,8521,8521,8489,8489,8488,8488,8488,8456,8456,8456,8456,8424,8456,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8392,8424,8424,8424,8424,8424,8424,8424,8424,8425,8425,8425,8425,8425,8457,8457,10506,10506,10506,10506,10506,10506,10507,10539,10539,10539,10539,12587,12620,12620,12620,12620,12621,12621,12653,12653,12653,14702,14734,14734,14734,14735,14735,14735,14767,16816,16816,16816,16816,16849,16849,16849,16881,18930,18930,18930,18931,18963,18963,18963,21012,21044,21044,21045,21045,21077,21078,21078,21078,21078}, {17951,17950,17950,17950,17950,17951,17918,17950,17950,17950,19966,17951,17950,17918,17886,17853,17821,17788,17755,17723,17690,17658,15577,15545,15512,15479,15447,15414,15382,13301,13301,13268,13236,13203,13171,13138,13138,13106,11025,10993,10960,10960,10927,10927,10895,10862,10862,10830,10829,8749,8749,8716,8716,8684,8684,8651,8651,8619,8619,8618,8586,8586,8554,8554,8553,8521,8521,8521,8521,8489,8489,8488,8456,8456,8456,6408,8456,8456,6376,6376,8424,6376,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8425,8425,8425,8425,8425,8425,8425,8457,10506,10506,10506,10506,10506,10506,10539,10539,10539,10539,10539,12588,12620,12620,12620,12620,12621,12653,12653,12653,14701,14702,14702,14734,14734,14735,14735,14735,14768,16816,16816,16816,16816,16849,16849,16849,16850,16882,18930,18930,18963,18963,18963,18964,21012,21012,21044,21045,21045,21077,21078,21078,23126,21078}, {17950,17918,17950,17950,17950,17950,17918,19998,17951,17950,17950,17950,17950,17918,17918,17885,17853,17820,17756,17723,17722,17658,15577,15544,15512,15512,15447,15414,15414,13302,13301,13268,13236,13203,13171,13138,13138,13105,11025,10993,10992,10960,10928,10927,10895,10894,10862,10862,10829,8749,8749,8717,8716,8684,8684,8651,8651,8619,8619,8586,8586,8554,8586,8554,8553,8521,8521,8521,8521,8521,8489,8488,8488,8456,8456,8456,8456,8456,6408,8456,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8425,8425,8425,8425,8425,8457,8457,10506,10506,10506,10506,10506,10538,10539,10539,10539,10539,10539,12588,12620,12620,12620,12620,12621,12621,12653,12653,14702,14702,14702,14734,14734,14735,14735,14767,14767,16816,16816,16816,16849,16849,16849,16849,16850,18930,18930,18930,18931,18963,18963,18964,21012,21044,21045,21045,21045,21046,21078,21078,21078,21078}, {17918,17950,19999,17950,17950,17950,17950,17950,17918,19966,17950,17919,17950,17918,17918,17886,17853,17820,17788,17755,17723,17690,15610,15577,15544,15512,15479,15446,15414,13333,13301,13269,13236,13204,13171,13139,13138,13106,11025,11025,10992,10960,10960,10927,10927,10894,10862,10862,8781,10797,8749,8717,8716,8716,8684,8684,8651,8619,8619,8618,8586,8586,8586,8554,8554,8553,8521,8521,8521,8489,8489,8488,8488,8456,8456,6408,8456,8456,8456,8456,8424,8424,6376,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8425,8425,8425,8425,8425,8457,8425,10506,10506,10506,10506,10506,10506,10539,10539,10539,10539,10539,10540,12620,12620,12620,12620,12621,12621,12653,12653,12653,14702,14702,14702,14734,14735,14735,14735,14735,16816,16816,16816,16816,16849,16849,16849,16849,16882,18930,18930,18931,18963,18963,18963,18964,21012,21044,21045,21045,21045,21078,21078,21078,21078,21078}, {17950,17951,17950,17950,17950,19999,17950,17950,17950,17950,17950,17950,19999,19998,17918,17886,17853,17821,17788,17755,17722,15642,15610,15577,15544,15512,15479,15447,15414,13334,13301,13269,13236,13236,13203,13171,13138,13106,13105,11025,10993,10992,10960,10927,10927,10895,10862,10862,10830,10829,8749,8717,8716,8716,8684,8684,8651,8651,8619,8619,8586,8586,8586,8554,8554,8554,8553,8521,8521,8521,8489,8489,8489,8488,8456,8456,8456,8456,8456,8456,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8425,8425,8425,8425,8425,8425,8425,8457,10506,10506,10506,10506,10506,10506,10507,10539,10539,10539,10539,10539,12620,12620,12620,12620,12621,12653,12653,12653,12653,14702,14702,14734,14734,14735,14735,14735,14767,16816,16816,16816,16848,16849,16849,16849,16849,16882,18930,18930,18931,18931,18963,18963,18964,21044,21044,21045,21045,21077,21078,23126,21078,21078,21078}, {17950,17918,19998,17951,17950,17950,17950,17951,19966,17950,17919,17950,17950,17950,17950,17918,17885,17853,17820,17787,17755,17690,15610,15577,15545,15512,15479,15447,15446,15382,13301,13269,13268,13236,13203,13171,13170,13138,13105,11025,10993,10992,10960,10927,10927,10895,10894,10862,10829,10829,8749,8749,8717,8716,8684,8684,8651,8651,8619,8619,8618,8586,8586,8554,8554,8553,8553,8521,8521,8521,8521,8489,8489,8488,8488,8456,6408,8456,8456,6408,8456,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8425,8425,8425,8457,8457,8457,10505,10506,10506,10506,10506,10506,10506,10539,10539,10539,10539,12587,12588,12620,12620,12620,12620,12621,12621,12653,12653,14701,14702,14702,14734,14734,14735,14735,14735,14767,16816,16816,16816,16848,16849,16849,16849,16881,16882,18930,18930,18931,18963,18963,18964,21012,21044,21045,21045,21045,21045,21078,21078,23126,21078,21078}, {17951,17918,17950,17950,17951,17918,17919,17950,17950,17950,19999,17950,17950,19998,17919,17950,17886,17853,17820,17788,17755,17723,15610,15609,15545,15544,15512,15447,15446,13366,13301,13301,13269,13236,13203,13203,13170,13138,13106,13073,10993,10992,10960,10960,10927,10895,10894,10862,10862,10829,8749,8749,8717,8716,8684,8684,8683,8651,8651,8619,8618,8586,8586,8586,8554,8554,8553,8521,8521,8521,8489,8489,8489,8488,8488,8456,8456,8456,8456,8456,8456,8456,8456,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8425,8425,8425,8425,8425,8425,8425,8457,10505,10506,10506,10506,10506,10506,10507,10539,10539,10539,10539,10539,12588,12588,12620,12620,12620,12621,12653,12653,12653,12654,14702,14702,14734,14735,14735,14735,14767,14768,16816,16816,16816,16849,16849,16849,16849,16850,18930,18930,18931,18931,18963,18963,18964,21012,21012,21045,21045,21077,21078,21078,21078,21078,21078,21078}, {17918,17950,17951,17950,17950,17950,17950,17950,17950,17950,17918,17950,17951,19998,17950,17950,17886,17853,17821,17788,17755,17723,17690,15609,15577,15544,15512,15479,15447,15414,15382,13301,13268,13236,13236,13203,13171,13138,13106,11057,11025,10993,10960,10960,10927,10895,10894,10862,8814,10829,8781,8749,8749,8716,8684,8684,8652,8651,8651,8619,8619,8618,8586,8586,8554,8554,8553,8553,8521,8521,8521,8489,8489,8489,8488,8488,6440,8456,8456,8456,6408,8456,8456,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8425,8425,8425,8425,8457,8425,8457,8457,10505,10506,10506,10506,10506,10506,10506,10539,10539,10539,10539,12587,12620,12620,12620,12620,12621,12621,12653,12653,12653,14701,14734,14734,14734,14735,14735,14735,14767,16816,16816,16816,16816,16849,16849,16849,16849,18930,18930,18930,18931,18931,18963,18963,18964,21012,21044,21045,21045,21045,21078,21078,21078,21078,21078,23126}, {17950,17950,17950,17918,17950,17950,17951,17950,17951,17951,19998,19998,17950,17950,17950,17918,17918,17885,17821,17788,17755,17723,17690,17658,15577,15544,15512,15479,15447,15414,13334,13301,13301,13268,13236,13203,13171,13138,13138,13105,11025,10993,10992,10960,10927,10927,10895,10862,10862,10830,10829,8749,8749,8716,8716,8684,8684,8651,8651,8619,8619,8619,8586,8586,8586,8554,8553,8521,8521,8521,8521,8521,8489,8489,8488,8488,8456,8456,8456,8456,8456,8456,8456,8424,8456,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8425,8425,8425,8425,8425,8457,8457,8457,10505,10506,10506,10506,10506,10506,10506,10506,10539,10539,10539,10539,12588,12620,12620,12620,12620,12621,12621,12653,12653,14701,14702,14702,14734,14734,14735,14735,14735,14767,16816,16816,16816,16849,16849,16849,16849,16849,16882,18930,18930,18931,18963,18963,18963,18964,21012,21044,21045,21045,21077,21078,21078,23126,21078,21078,21078}, {17950,19998,17918,17950,17918,17950,17950,17950,19998,17918,17950,17918,17950,17950,17951,17918,17918,17885,17853,17820,17788,17755,17690,15642,15577,15545,15512,15511,15447,15446,13334,13333,13301,13268,13236,13203,13171,13138,13138,11057,11025,10993,10992,10960,10927,10927,10895,10894,10862,8814,10829,8781,8749,8749,8716,8684,8684,8652,8651,8651,8619,8618,8586,8586,8586,8554,8554,8553,8521,8521,8521,8521,8489,8489,8489,8488,8488,8488,8456,8456,8456,8456,8456,8456,8456,8456,8424,8424,8424,8424,8424,8424,8424,8424,8424,8425,8425,8425,8425,8457,8425,8457,8457,8457,10506,10506,10506,10506,10506,10538,10539,10539,10539,10539,10539,12588,12620,12620,12620,12620,12621,12621,12653,12653,12653,14702,14702,14734,14734,14735,14735,14767,14767,16816,16816,16816,16849,16849,16849,16849,16850,18930,18930,18930,18931,18963,18963,18964,18964,21044,21045,21045,21045,21078,21078,21078,21078,21078,21078,21078}, {17950,17951,17950,17950,17950,17950,17918,17950,17950,17950,19998,17950,17951,19998,17950,17918,17918,17918,17853,17820,17788,17755,17722,17690,15609,15577,15544,15512,15479,15446,13366,13333,13301,13268,13236,13203,13171,13171,13138,11057,11025,11025,10992,10960,10960,10927,10895,10894,10862,10862,8781,8781,8749,8717,8716,8684,8684,8684,8651,8651,8619,8619,8618,8586,8586,8554,8554,8553,8521,8521,8521,8521,8489,8489,8489,8488,8488,8488,8456,8456,8456,8456,8456,8456,8456,8424,8424,8424,8424,8424,8424,8424,8424,8424,8424,8425,8425,8425,8457,8457,8457,8457,8457,8457,10506,10506,10506,10506,10506,10538,10539,10539,10539,10539,10539,12588,12620,12620,12620,12621,12621,12653,12653,12653,14702,14702,14734,14734,14734,14735,14735,14767,16816,16816,16816,16816,16817,16849,16849,16849,16850,18930,18930,18930,18931,18963,18963,18964,21012,21044,21045,21045,21045,21078,23126,21078,21078,21078,21078,21078}, {17950,17950,17950,17918,17950,17950,17951,19998,17950,17950,17950,17950,19999,17918,17950,17918,17918,17886,17885,17821,17788,17755,17723,15642,17658,15577,15544,15512,15479,15447,13366,13334,13333,13268,13268,13236,13203,13171,13138,13138,11057,11025,10993,10992,10960,10927,10927,10895,10894,10862,10830,8781,8749,8749,8716,8716,8684,8684,8651,8651,8651,8619,8619,8586,8586,8586,8554,8554,8553,8521,8521,8521,8521,8489,8489,8489,8489,8456,8456,8456,8456,8456,8456,8456,8456,8456,8456,8424,8424,8424,8424,8424,8424,8425,8425,8425,8457,8425,8457,8425,8457,8457,8457,10506,10506,10506,10506,10506,10506,10506,10539,10539,10539,10539,12587,12588,12620,12620,12620,12620,12621,12653,12653,12653,12654,14702,14734,14734,14734,14735,14735,14735,14768,16816,16816,16848,16849,16849,16849,16849,18930,18930,18930,18930,18931,18963,18963,18964,21012,21044,21045,21045,21045,21078,21078,21078,21078,21078,21078,21078}, {17919,17950,17918,17950,17918,17950,17918,19998,17951,19999,17950,17950,17950,17950,17918,17918,17918,17886,17885,17853,17788,17756,17755,15642,15610,15577,15544,15512,15479,15447,15414,13366,13333,13269,13268,13236,13203,13171,13138,13138,11057,11025,11025,10992,10960,10959,10927,10927,10894,10862,10830,10829,8749,8749,8748,8716,8684,8684,8684,8651,8651,8619,8619,8586,8586,8586,8554,8554,8553,8553,8521,8521,8521,8489,8489,8489,8488,8489,8488,8488,8456,8456,8456,8456,8456,8456,8456,8456,8456,8424,8424,8424,8424,8424,8425,8425,8425,8425,8425,8457,8457,8457,8457,10506,10506,10506,10506,10506,10506,10539,10539,10539,10539,10539,10539,12620,12620,12620,12620,12621,12621,12653,12653,12653,14702,14702,14734,14734,14735,14735,14735,14767,16816,16816,16816,16816,16849,16849,16849,16849,16882,18930,18930,18931,18931,18963,18964,21012,21012,21044,21045,21045,21077,21078,21078,21078,21078,21078,21078,21078}, {17950,17950,17950,17918,19998,17950,17950,17950,17950,17950,17918,17950,17919,17950,19966,17918,17886,17918,17885,17853,17820,17787,17755,17722,17690,15609,15545,15544,15511,15479,15446,15414,13333,13301,13268,13236,13203,13203,13170,13138,11057,11057,11025,10992,10960,10959,10927,10895,10894,10894,10862,8781,8781,8749,8717,8716,8716,8684,8683,8651,8651,8651,8619,8618,8586,8586,8554,8554,8553,8553,8521,8521,8521,8521,8489,8489,8489,8489,8489,8456,8456,8456,8456,8456,8456,8456,8456,8456,8456,8456,8456,8457,8456,8457,8425,8425,8425,8457,8457,8457,8457,8457,10505,10506,10506,10506,10506,10506,10506,10539,10539,10539,10539,10539,12587,12620,12620,12620,12620,12621,12621,12653,12653,12653,14702,14734,14702,14734,14735,14735,14735,14767,16816,16816,16816,16848,16849,16849,16849,16850,18930,18930,18930,18931,18931,18963,18963,18964,21044,21044,21045,21045,21077,21078,21078,21078,21078,23126,21078,21078}, {17918,19998,17951,17950,17950,17951,17950,17951,17950,17950,17950,17950,17950,17950,17918,17918,17918,17886,17885,17853,17820,17788,17755,17722,15642,15609,15577,15544,15512,15479,15447,15414,13333,13301,13268,13236,13235,13203,13171,13138,11058,11025,11025,10992,10960,10960,10927,10927,10895,10894,10862,10862,10829,8749,8749,8716,8716,8684,8684,8651,8651,8619,8619,8619,8586,8586,8586,8554,8554,8554,8521,8521,8521,8521,8521,8489,8489,8489,8489,8488,8456,8456,8456,8456,8456,8456,8456,8456,8456,8456,8456,8457,8457,8425,8457,8457,8457,8457,8457,8457,8457,8458,10506,10506,10506,10506,10506,10506,10538,10539,10539,10539,10539,10539,12588,12620,12620,12620,12620,12621,12653,12653,12653,14701,14702,14702,14734,14735,14735,14735,14767,14768,16816,16816,16816,16849,16849,16849,16849,16882,18930,18930,18931,18931,18963,18963,18964,21044,21044,21045,21045,21045,21078,23126,21078,21078,21078,21078,21078,21078}, {17950,17950,17950,17918,17918,19998,17950,17950,17950,19998,17950,17951,17950,17950,17918,17918,17918,17885,17885,17853,17853,17788,17755,17723,15642,15610,15577,15544,15512,15479,15447,13366,13334,13301,13301,13236,13236,13203,13171,13138,13138,11057,11025,11025,10992,10960,10927,10927,10895,10894,10862,10830,8781,8749,8749,8749,8716,8684,8684,8651,8651,8651,8619,8619,8586,8586,8586,8554,8554,8554,8553,8521,8521,8521,8521,8521,8489,8489,8489,8489,8457,8456,8456,8456,8456,8456,8456,8456,8456,8457,8457,8457,8457,8457,8457,8457,8457,8457,8457,8457,8457,10505,10506,10506,10506,10506,10506,10538,10539,10539,10539,10539,10539,10539,12588,12588,12620,12620,12620,12621,12621,12653,12653,14701,14702,14734,14734,14735,14735,14735,14735,14768,16816,16816,16816,16849,16849,16849,16849,16882,18930,18930,18931,18931,18963,18963,18964,21012,21044,21045,21045,21077,21078,21078,21078,23126,21078,21078,23126,21078}, {17918,17950,17950,17951,17950,17950,17951,17951,17950,17951,17950,19998,17918,17918,17918,17918,17886,17885,17885,17853,17853,17820,17787,17755,15674,15642,15609,15576,15512,15479,15447,15446,13334,13333,13301,13268,13236,13203,13171,13170,13138,11057,11057,11025,10992,10960,10959,10927,10927,10894,10894,10862,8781,8781,8749,8749,8716,8716,8684,8684,8651,8651,8619,8619,8618,8586,8586,8586,8554,8554,8553,8553,8521,8521,8521,8489,8489,8489,8489,8489,8489,8457,8489,8456,8456,8457,8456,8456,8456,8457,8457,8457,8457,8457,8457,8457,8457,8457,8457,8457,8457,8457,10506,10506,10506,10506,10506,10538,10506,10539,10539,10539,10539,10539,12620,12620,12620,12620,12621,12653,12653,12653,12653,12654,14702,14734,14734,14735,14735,14735,14767,16816,16816,16816,16848,16849,16849,16849,16849,18930,18930,18930,18931,18963,18963,18963,18964,21012,21044,21045,21045,21077,21078,21078,21078,21078,21078,21078,21078,23126}, {17950,17950,17950,19998,17950,17950,17918,17950,17950,17950,17918,17951,17950,17918,17918,17886,17886,17886,17853,17885,17853,17820,17788,17755,17722,15642,15609,15577,15544,15512,15479,15446,13366,13333,13301,13268,13236,13203,13203,13171,13138,11057,11025,11025,10992,10960,10960,10927,10927,10895,10862,10862,8781,8781,8749,8749,8716,8716,8684,8684,8683,8651,8651,8619,8619,8586,8586,8586,8554,8554,8553,8553,8521,8521,8521,8521,8521,8489,8489,8489,8489,8489,8457,8457,8457,8457,8457,8457,8457,8457,8457,8457,8457,8457,8457,8457,8457,8457,8457,8457,8457,8458,10506,10506,10506,10506,10506,10539,10539,10539,10539,10539,10539,10540,12588,12620,12620,12620,12621,12621,12653,12653,12653,14702,14702,14734,14734,14735,14735,14735,14767,16816,16816,16816,16816,16849,16849,16849,16849,18930,18930,18930,18931,18931,18963,18964,21012,21044,21045,21045,21045,21045,21078,21078,21078,21078,23126,21078,21078,21078}, {17950,17950,17950,17918,17950,17950,17950,17950,17950,17951,17951,17950,17950,19966,17918,17918,17886,17885,17885,17853,17853,17820,17788,17755,17722,17690,15609,15577,15544,15512,15479,15447,15414,13333,13301,13268,13268,13236,13203,13171,13138,13138,11057,11025,10992,10992,10960,10927,10927,10895,10894,10862,10830,8781,8749,8749,8716,8716,8684,8684,8683,8651,8651,8619,8619,8618,8586,8586,8586,8554,8554,8553,8521,8521,8521,8521,8521,8489,8489,8489,8489,8489,8489,8457,8457,8457,8457,8457,8457,8457,8457,8457,8457,8457,8457,8457,8457,8457,8457,8457,8458,10506,10506,10506,10506,10506,10538,10538,10539,10539,10539,10539,10539,12588,12620,12620,12620,12620,12621,12621,12653,12653,12653,14702,14702,14734,14734,14735,14735,14767,16815,16816,16816,16816,16849,16849,16849,16849,16850,18930,18930,18930,18931,18963,18963,18964,21044,21044,21045,21045,21045,21078,21078,23126,21078,21078,23126,21078,21078,23126}, {17950,17951,17950,17951,17950,19998,17950,17950,17950,17951,17950,17918,17950,17918,17918,17918,17885,17885,17853,17853,17853,17852,17820,17787,17755,17722,15610,15577,15544,15512,15479,15479,13366,13366,13333,13301,13268,13236,13203,13171,13170,11090,11057,11025,11025,10992,10960,10959,10927,10895,10894,10862,10862,8781,8781,8749,8749,8716,8716,8684,8683,8651,8651,8651,8619,8619,8586,8586,8586,8554,8554,8554,8553,8521,8521,8521,8521,8489,8489,8489,8489,8489,8489,8489,8457,8457,8457,8457,8457,8457,8457,8457,8457,8457,8457,8457,8457,8457,8457,8458,8458,10506,10506,10506,10506,10538,10538,10539,10539,10539,10539,10539,12619,12620,12620,12620,12620,12620,12621,12653,12653,12653,12654,14702,14734,14734,14734,14735,14735,14735,14768,16816,16816,16816,16849,16849,16849,16849,16882,18930,18930,18931,18963,18963,18963,18964,21012,21044,21045,21045,21077,21078,21078,21078,21078,21078,21078,23126,21078,21078}, {17950,17950,17950,17950,17919,17950,17950,17950,17950,17950,17950,17950,17918,17918,17918,17918,17885,17885,17853,17853,17853,17853,17820,17788,17755,17722,15610,15609,15545,15512,15511,15479,15446,13366,13333,13301,13268,13236,13235,13171,13170,13138,13105,11025,11025,10992,10960,10960,10927,10927,10894,10894,10862,8782,8781,8749,8749,8716,8716,8716,8684,8651,8651,8651,8619,8618,8618,8586,8586,8554,8554,8554,8553,8521,8521,8521,8521,8521,8489,8489,8489,8489,8489,8489,8457,8457,8457,8457,8457,8457,8457,8457,8457,8457,8457,8457,8457,8457,8457,8457,10506,10506,10506,10506,10506,10538,10538,10539,10539,10539,10539,10539,10540,12620,12620,12620,12620,12620,12621,12653,12653,14701,14702,14702,14702,14734,14735,14735,14735,14735,16816,16816,16816,16816,16849,16849,16849,16849,18930,18930,18930,18931,18963,18963,18964,18964,21044,21044,21045,21045,21045,21078,21078,23126,21078,21078,21078,21078,21078,21078}, {17950,17950,17950,17950,17950,17951,17950,17951,17950,17950,17951,17950,17950,17918,17918,17886,17886,17885,17853,17853,17853,17820,17820,17788,17755,15674,15642,15609,15577,15544,15512,15479,15446,15414,13333,13301,13268,13268,13235,13203,13171,11090,11058,11057,11025,10992,10992,10960,10927,10927,10895,10894,10862,8813,8781,8749,8749,8717,8716,8684,8684,8683,8651,8651,8619,8619,8618,8586,8586,8586,8554,8554,8554,8553,8521,8521,8521,8521,8489,8489,8489,8489,8489,8489,8489,8489,8457,8457,8457,8457,8457,8457,8457,8457,8457,8457,8457,8457,8457,8458,8458,10506,10506,10506,10538,10538,10539,10539,10539,10539,10539,12587,10540,12620,12620,12620,12620,12621,12621,12653,12653,12653,14702,14702,14734,14734,14735,14735,14735,14767,16816,16816,16816,16849,16849,16849,16849,16882,16882,18930,18930,18931,18963,18963,18964,18964,21044,21045,21045,21045,21077,21078,21078,21078,23126,21078,23126,21078,21078,21078}, {17950,17919,17951,17950,17950,17950,17918,19998,17950,17951,19998,17951,17918,17918,17918,17886,17885,17885,17853,17853,17853,17820,17820,17820,17755,17755,15642,15609,15577,15544,15512,15479,15446,13366,13366,13301,13300,13268,13236,13203,13171,13170,13138,11057,11025,10993,10992,10960,10927,10927,10895,10894,10862,10862,8781,8781,8749,8749,8716,8716,8684,8684,8651,8651,8651,8619,8619,8586,8586,8586,8554,8554,8554,8554,8553,8521,8521,8521,8521,8521,8489,8489,8489,8489,8489,8489,8489,8489,8457,8457,8457,8457,8457,8457,8457,8457,8457,8457,8458,8458,10506,10506,10506,10506,10538,10538,10538,10539,10539,10539,10539,10539,10572,12588,12620,12620,12620,12621,12621,12653,12653,12654,14702,14702,14734,14734,14735,14735,14767,14768,16816,16816,16816,16849,16849,16849,16849,16882,18930,18930,18931,18931,18963,18963,18964,21012,21044,21045,21045,21045,21077,21078,21078,21078,21078,21078,21078,21078,21078,21078}, {17950,17950,17950,17950,17950,17951,17918,17951,17950,17950,17950,17950,17918,17918,17918,17886,17885,17885,17853,17853,17852,17820,17820,17788,17787,17755,15674,15642,15609,15576,15512,15479,15479,13366,13366,13333,13301,13268,13236,13203,13171,13170,11090,11057,11025,11025,10992,10960,10960,10927,10927,10894,10862,10862,10829,8781,8749,8749,8716,8716,8684,8684,8651,8651,8651,8619,8619,8618,8586,8586,8586,8586,8554,8554,8553,8521,8521,8521,8521,8489,8521,8489,8489,8489,8489,8489,8489,8457,8489,8457,8457,8457,8457,8457,8457,8457,8457,8457,8458,10506,10506,10506,10506,10538,10538,10538,10539,10539,10539,10539,10539,12587,12620,12620,12620,12620,12620,12621,12653,12653,12653,12653,14702,14734,14734,14734,14735,14735,14767,14768,16816,16816,16816,16849,16849,16849,16849,16882,18930,18930,18931,18931,18963,18963,18964,21044,21044,21045,21045,21045,21078,21078,21078,21078,21078,21078,21078,23126,21078,21078}, {17951,17950,19998,17951,17950,19966,17950,17950,19999,17918,17950,17950,17918,17886,17886,17885,17885,17853,17853,17853,17820,17820,17820,17820,17787,17755,15674,15642,15609,15577,15544,15511,15479,15446,15414,13333,13301,13268,13268,13235,13203,13170,13138,11090,11057,11025,10992,10992,10960,10927,10927,10895,10894,10862,8814,10829,8749,8749,8748,8716,8716,8684,8684,8651,8651,8619,8619,8619,8586,8586,8586,8586,8554,8554,8554,8553,8521,8521,8521,8521,8489,8489,8489,8489,8489,8489,8489,8489,8489,8489,8457,8457,8457,8457,8457,8457,8458,8458,10506,8490,10506,10506,10538,10538,10538,10538,10539,10539,10539,10539,10539,12620,12588,12620,12620,12620,12621,12621,12653,12653,12653,14702,14702,14734,14734,14735,14735,14735,14735,16816,16816,16816,16816,16849,16849,16849,16850,18898,18930,18930,18931,18931,18963,18963,18964,21012,21044,21045,21045,21077,21078,23126,21078,23126,21078,21078,21078,21078,21078,21078}, };
-const uint16_t p2Won[120][160] = { {64639,64639,64639,64607,64607,62558,62558,62526,62526,60477,60445,60477,60445,58396,58396,58364,58364,56315,56315,56283,56283,54234,54234,54202,54202,54202,52153,52153,52121,52121,52120,50072,50040,50040,50040,47991,47991,47959,47959,45910,45910,45878,45878,45878,43829,43797,43797,43797,43796,41716,41748,41716,41716,39667,39667,39635,39635,39635,37586,37554,37554,37554,37554,35505,35505,35473,35473,35472,35472,33392,33392,33392,33392,31343,31311,31311,29230,29230,29229,27149,27149,25069,25068,25036,25035,22987,22987,22955,22954,20906,20906,20906,20874,20873,20873,18825,18825,18825,18825,18825,18825,18825,18793,18825,18825,18825,18825,18825,18825,18825,18825,18825,18825,18825,18857,18857,18857,18858,20906,20906,20938,20938,20938,20939,20971,23019,23019,23051,23052,23052,25100,25132,25133,25133,25133,27213,27213,27246,27246,27246,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327}, {64639,64607,64639,64607,64607,62558,62526,62526,62526,60477,60477,60445,60444,58396,58396,58396,58364,56315,56315,56283,56283,54234,54234,54202,54202,54201,52153,52121,52121,52121,50072,50072,50040,50040,47991,47991,47991,47959,45910,45910,45910,45878,45878,45877,43797,43797,43797,43797,43796,41716,41716,41716,41716,39667,39635,39635,39635,39634,37586,37554,37554,37554,37553,35505,35473,35473,35473,35472,33424,33424,33392,33392,33391,31311,31311,31311,29230,29230,29229,27149,27149,27116,25068,25068,25036,22987,22987,22955,22954,20906,20906,20874,20906,20874,20873,18825,18825,18825,18825,18825,18825,18825,18793,18825,18825,18793,18825,18825,18824,18825,18825,18825,18825,18825,18825,18857,18857,18857,18858,20906,20906,20938,20938,20938,20971,20939,23019,23019,23019,23052,23052,25100,25132,25132,25133,27213,27213,27213,27246,27246,29294,29294,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327}, {64607,64639,64607,64607,62558,62558,62526,62526,60477,60477,60477,60445,58396,58396,58396,58364,56315,56315,56315,56283,54234,54234,54202,54234,54202,52153,52153,52121,52121,50072,50072,50072,50040,50040,47991,47959,47959,47959,45910,45910,45878,45878,45878,43829,43829,43797,43797,43797,41716,41716,41716,41716,39667,39667,39635,39635,39635,37586,37554,37554,37554,37553,35505,35505,35473,35473,35473,35472,33392,33392,33392,33391,31311,31311,31311,31311,29262,29230,29230,27149,27117,27149,25068,25068,25036,22987,22987,22987,22954,20906,20906,20906,20906,20873,18825,18825,18825,18825,18825,18825,18825,18825,18793,18824,18792,18793,18825,16744,18824,18825,18825,18825,18825,18825,18825,18825,18825,18857,18857,20906,20906,20938,20938,20938,20938,20938,20971,23019,23019,23051,23052,23052,25100,25132,25133,25133,25133,27213,27213,27214,27246,29294,29295,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327}, {64639,64639,64639,64607,62558,62558,62526,62525,60477,60477,60445,60445,58396,58396,58364,58364,56315,56315,56283,56283,54234,54234,54202,54202,52153,52153,52153,52121,52121,50072,50072,50040,50040,47992,47991,47959,47959,47959,45910,45910,45878,45878,45877,43829,43797,43797,43797,41716,41716,41716,41716,41716,39635,39635,39635,39635,39634,37586,37554,37554,37554,35505,35505,35473,35473,35473,35472,33424,33392,33392,33392,33391,31343,31311,31311,31311,31310,29230,29230,27149,27149,27149,25068,25068,25035,22987,22987,22987,22955,22954,20906,20906,20874,20873,20873,18825,18825,18825,18825,18825,18793,18793,18792,16744,18792,18824,16744,16776,18792,18824,16776,18793,18825,18825,18825,18825,18825,18825,18857,18857,18857,20906,20938,20938,20938,20938,20971,20971,23019,23051,23051,23052,23052,25100,25132,25132,25133,27213,27213,27213,27246,27246,29294,29294,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327}, {64639,64607,64607,62559,62558,62558,62526,60477,60477,60477,60445,58396,58396,58396,58364,56315,56315,56315,56283,56282,54234,54234,54202,54202,52153,52121,52121,52121,52121,50072,50072,50040,50039,47991,47991,47959,47959,45910,45910,45878,45878,45878,45877,43829,43797,43797,43797,41748,41716,41716,41716,41715,39667,39635,39635,39635,37586,37554,37554,37554,37554,35505,35505,35473,35473,35472,35472,33392,33392,33392,33391,31343,31311,31311,31311,31310,29230,29262,29230,27181,27149,27149,27116,25068,25068,25067,22987,22987,22955,22954,20906,20874,20906,20874,20873,18825,18825,18793,18825,18793,18793,18792,18824,16744,18792,16744,16744,16744,16744,16776,16776,16776,18824,18825,18825,18825,18825,18857,18825,18857,18857,18857,20906,20906,20938,20938,20938,20939,23019,23019,23019,23020,23052,23052,25132,25132,25133,25133,27213,27213,27213,27246,27246,29294,29326,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327}, {64639,64607,64607,62558,62558,62526,62526,60477,60477,60445,60445,58396,58396,58364,58364,56315,56315,56283,56283,54234,54234,54202,54202,52153,52153,52153,52121,52121,50072,50072,50040,50040,50040,47991,47991,47959,45911,45910,45878,45878,45878,45877,43829,43797,43797,43797,43796,41748,41716,41716,39667,39667,39635,39635,39635,37586,37554,37554,37554,37554,35505,35505,35473,35473,35473,35472,33424,33392,33392,33392,33391,31343,31311,31311,31311,31310,29230,29230,29230,29229,27149,27149,25068,25068,25068,25036,22987,22987,22955,22954,20906,20906,20874,20873,18825,18825,18825,18825,18825,18793,16745,18792,18792,16744,16744,16744,16744,16744,16744,16744,16744,16776,16777,18824,16776,18825,18825,18825,18825,18857,18857,18857,18857,20906,20938,20938,20938,20938,20971,23019,23019,23019,23052,23052,25100,25132,25132,25133,25133,27213,27213,27213,27246,27246,29294,29295,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327}, {64607,64607,64607,62558,62558,62526,60477,60477,60445,60445,58396,58396,58396,58364,56315,56315,56283,56283,56283,54234,54234,54202,54202,52153,52153,52121,52121,52121,50072,50072,50072,50039,47991,47991,47959,47959,47958,45910,45878,45878,45878,45877,43797,43797,43797,43796,41716,41716,41716,41716,41715,39635,39635,39635,39635,37586,37554,37554,37554,37554,35505,35505,35505,35473,35473,33424,33424,33392,33392,33391,31343,31311,31311,31311,31311,29262,29262,29230,29230,29229,27149,27149,27149,25068,25068,25035,22987,22987,22955,22954,20906,20906,20874,20873,20873,20873,18825,18825,18825,18825,18824,18792,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16776,16776,18792,18824,18825,18825,18825,18825,18857,18857,18857,20906,20938,20938,20938,20938,20939,23019,23019,23051,23051,23052,25100,25100,25132,25133,25133,27213,27213,27214,27246,27246,29294,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327}, {64639,64607,62558,62526,62526,62526,60477,60477,60477,60445,58396,58396,58364,58364,56315,56315,56315,56283,54234,54234,54234,54202,54202,52153,52121,52121,52121,50072,50040,50040,50040,47991,47991,47991,47959,47958,45910,45910,45878,45878,45878,43829,43797,43797,43797,41748,41716,41716,41716,41715,39667,39635,39635,39635,39634,37586,37554,37554,37554,37553,35473,35473,35473,35473,35472,33424,33392,33392,33392,33391,31343,31311,31311,31311,31310,29262,29230,29230,29230,29229,27181,27149,27149,27116,25068,25036,25035,22987,22987,22954,20906,20906,20874,20874,20873,18825,18825,18825,18793,18793,18792,18792,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16776,16776,18824,18824,18825,18825,18825,18857,18857,18857,18857,20906,20938,20938,20938,20938,20971,23019,23019,23019,23052,23052,25132,25132,25132,25133,25133,27213,27213,27214,27246,27246,29294,29295,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327}, {64607,64606,62558,62558,62526,60478,60477,60477,60445,58396,58396,58364,58364,58363,56315,56315,56283,54235,54234,54234,54202,54202,52153,52153,52121,52121,52120,50072,50040,50040,50040,47991,47991,47959,47959,47958,45910,45878,45878,45878,45877,43797,43797,43797,43796,41748,41716,41716,41716,39667,39635,39635,39635,39635,37586,37554,37554,37554,37553,35505,35473,35473,35473,35473,35472,33392,33392,33392,33392,31343,31343,31311,31311,31310,29262,29230,29230,29230,29230,29229,27149,27149,27149,27116,25068,25068,25035,22987,22955,22955,20906,20906,20874,20873,18825,18825,18825,18825,18793,18825,18792,16744,18792,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16776,16776,16776,18825,18825,18825,18857,18857,18857,18857,18858,20938,20938,20938,20938,20971,23019,23019,23051,23051,23052,25100,25132,25132,25133,25165,27213,27213,27214,27246,27246,29294,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327}, {64607,62558,62558,62558,62526,60477,60445,60445,60445,58396,58396,58364,58364,56315,56315,56315,56283,54234,54234,54202,54202,54202,52153,52121,52121,52121,52120,50072,50040,50040,50039,47991,47991,47959,47959,45910,45878,45878,45878,45877,43797,43797,43797,43797,43796,41748,41716,41716,41716,39667,39635,39635,39635,39634,37554,37554,37554,37554,37553,35505,35473,35473,35473,35472,33424,33392,33392,33392,33391,31343,31311,31311,31311,31310,31278,29230,29230,29230,29229,27181,27149,27149,27149,27116,25068,25036,25035,22987,22987,22986,20906,20906,20906,20906,20873,18825,18825,18825,18825,18792,18792,18792,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16776,18825,18824,18825,18825,18825,18857,18857,18857,20906,20938,20938,20938,20970,20971,23019,23019,23019,23052,25100,25100,25132,25133,25133,25165,27213,27213,27246,27246,29294,29294,29295,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327}, {64606,62558,62558,62526,60477,60477,60477,60445,60445,58396,58396,58396,58364,56315,56315,56283,56283,54234,54234,54202,54202,54201,52153,52121,52121,50072,50072,50072,50040,50040,47991,47991,47991,47959,47959,45910,45878,45878,45878,45877,43829,43797,43797,43796,43796,41716,41716,41716,41715,39635,39635,39635,39635,39634,37554,37554,37554,37553,35505,35505,35473,35473,35473,35472,33424,33392,33392,33392,31343,31343,31311,31311,31311,29262,29230,29230,29230,29230,27181,27149,27149,27149,27149,27149,25068,25068,25036,22987,22987,22954,20906,20906,20906,20874,20873,18825,18825,18825,18825,18792,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16776,16776,16776,18824,16776,18825,18857,18857,18857,18857,18857,20938,20938,20938,20938,20970,20971,23019,23051,23051,23052,23052,25132,25132,25133,25133,25133,27213,27213,27246,27246,29294,29294,29327,29327,29327,29327,29327,29327,29327,29327,29327,29327}, {62559,62558,62526,62526,60477,60477,60445,60445,58396,58396,58396,58364,56315,56315,56283,56283,56283,54234,54202,54202,54202,52153,52153,52121,52121,52120,50072,50040,50040,50039,47991,47991,47959,47959,45910,45910,45878,45878,45878,43829,43797,43797,43797,41748,41716,41716,41716,41716,41683,39635,39635,39635,39634,37554,37554,37554,37554,37553,35505,35473,35473,35473,35472,33424,33392,33392,33392,33391,31311,31311,31311,31311,31310,31278,29262,29230,29230,29229,29229,27149,27149,27149,27149,27148,25068,25068,25068,22987,22987,22987,22954,20906,20906,20905,20873,18825,18825,18793,18793,18792,18792,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16776,16776,16776,18824,18825,18825,18825,18857,18857,18857,18858,20906,20938,20938,20938,20970,20971,23019,23019,23051,23052,23052,25100,25132,25132,25165,27213,27213,27213,27246,27246,27246,29326,29327,29327,29327,29327,29327,29327,29327,29327,29327}, {62558,62558,62526,62526,60477,60477,60445,60444,58396,58396,58364,58364,56315,56315,56283,56283,54234,54234,54202,54202,52153,52153,52121,52121,52121,50072,50072,50040,50040,50039,47959,47959,47959,47958,45910,45878,45878,45878,43829,43829,43797,43797,43797,41748,41716,41716,41716,39667,39635,39635,39635,39635,37586,37554,37554,37554,37554,35505,35505,35473,35473,35473,33424,33392,33392,33392,33392,31311,31343,31311,31311,31310,29262,29262,29230,29230,29230,29229,27181,27149,27149,27149,27116,25068,25068,25068,25068,25035,22987,22987,22954,20906,20906,20906,20873,18825,18825,18825,18793,18792,18792,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16776,16776,16776,16776,18825,18825,18857,18857,18857,18857,18857,20938,20938,20938,20938,20970,23019,23019,23051,23051,23052,25100,25132,25132,25133,25133,27213,27213,27213,27246,27246,29294,29294,29327,29327,29327,29327,29327,29327,29327,29327}, {62558,62558,62526,60477,60477,60445,60445,58397,58396,58364,58364,56315,56315,56315,56283,54234,54234,54202,54202,54202,54201,52153,52153,52121,50072,50072,50072,50040,50040,47959,47991,47959,47959,47958,45910,45878,45878,45878,43829,43797,43797,43797,41749,41748,41716,41716,41716,39667,39635,39635,39635,39635,37586,37554,37554,37554,35505,35505,35505,35473,35473,35472,33424,33392,33392,33392,33392,31311,31343,31311,31311,31311,29262,29230,29230,29230,29229,29229,27149,27149,27149,27149,27148,27148,25068,25068,25068,22987,22987,22987,22986,20906,20906,20874,20873,18825,18825,18825,18825,18792,18792,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16776,16744,16776,18824,18825,18825,18857,18857,18857,18857,18890,20938,20938,20938,20938,20971,23019,23019,23051,23051,23052,25100,25132,25132,25133,27213,27213,27213,27214,27246,27246,27246,29294,29327,29327,29327,29327,29327,29327,29327}, {62558,62526,62526,60477,60445,60445,60444,58396,58396,58364,58364,56315,56315,56283,56283,54234,54234,54234,54202,52154,52153,52121,52121,52121,50072,50040,50040,50040,47991,47991,47991,47959,47959,45910,45878,45878,45878,45877,43829,43797,43797,43796,41748,41748,41716,41716,41715,39635,39635,39635,39635,37554,37586,37554,37554,37554,35505,35473,35473,35473,35472,35472,33424,33392,33392,33392,31343,31311,31311,31311,31310,31310,29262,29230,29230,29230,29229,27181,27149,27149,27149,27148,27148,25068,25068,25068,25068,25067,22987,22987,22955,20906,20906,20906,20905,18825,18825,18825,18793,18792,18792,18792,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16776,16776,18824,18825,18857,18825,18857,18857,18857,18857,20938,20938,20938,20938,23019,23019,23019,23051,23052,23052,25100,25132,25133,25133,25165,27213,27213,27213,27246,27246,27246,29295,29327,29327,29327,29327,29327,29327}, {62526,62526,62526,60477,60445,60445,58396,58396,58396,58364,56315,56315,56283,56283,54234,54234,54234,54202,54202,54201,52153,52121,52121,52120,50072,50040,50040,50040,47991,47959,47959,47959,45910,45910,45878,45878,45878,43829,43797,43797,43797,41749,41748,41716,41716,41716,39667,39635,39635,39635,39635,37554,37554,37554,37554,37553,35505,35505,35473,35473,35472,33424,33392,33392,33392,33391,31343,31343,31311,31311,31310,29262,29262,29230,29230,29229,29197,27149,27149,27149,27149,27148,27148,25068,25068,25068,25068,25067,22987,22987,22987,22954,20906,20906,20873,20873,18825,18825,18825,18824,18792,16744,16744,16744,16744,16744,16744,16744,16711,16744,16743,16743,16743,16711,16744,16743,16744,16744,16744,16776,16744,16744,16776,16776,16776,16776,18824,18857,18857,18857,18857,18889,18890,20938,20938,20938,20970,20971,23019,23019,23051,23052,23052,25132,25132,25132,25165,27213,27213,27213,27214,27246,27246,29294,29326,29327,29327,29327,29327,29327}, {62526,62526,60477,60477,60445,60445,58396,58396,58364,58364,56315,56315,56315,56283,56282,54234,54202,54202,54202,52153,52153,52121,52121,50072,50072,50040,50040,47991,47991,47959,47959,47958,45910,45878,45878,45878,45877,43797,43797,43797,43796,41748,41716,41716,41716,41715,39667,39635,39635,39635,39602,37554,37554,37554,37554,35505,35505,35473,35473,35473,35472,33392,33392,33392,33391,31343,31343,31311,31311,31311,31310,29230,29230,29230,29230,29229,27181,27149,27149,27149,27149,27148,25068,25068,25068,25068,25067,25035,22987,22987,22986,22986,20906,20906,20905,20905,18825,18825,18825,18824,18792,16744,16744,16744,16744,16744,16744,16744,16743,16711,16744,16711,16743,16744,16711,16743,16744,16744,16744,16744,16744,16776,16744,16776,16776,16776,16776,18857,18857,18857,18857,18857,18889,20938,20938,20938,20938,20970,23019,23019,23051,23051,23052,23052,25100,25132,25133,25133,25165,27213,27213,27214,27246,27246,29294,29326,29327,29327,29327,29327}, {62526,60477,60477,60445,60445,60445,58396,58396,58364,58364,56315,56315,56283,56283,54234,54234,54202,54202,52153,52153,52121,52121,52120,50072,50040,50040,47992,47991,47991,47959,47959,47958,45910,45878,45878,45878,43829,43829,43797,43797,43796,41748,41716,41716,41716,41715,39635,39635,39635,39635,37586,37554,37554,37554,37553,35505,35473,35473,35473,35472,35472,33392,33392,33392,33391,31343,31311,31311,31311,31311,29262,29230,29230,29230,29230,29229,27149,27149,27149,27149,27149,27116,25068,25068,25068,25068,25067,25035,22987,22987,22987,22986,20906,20906,20905,20873,18825,18825,18825,18792,18792,18824,16744,16744,16744,16744,16744,16744,16711,16712,16743,16743,16743,16711,16743,16743,16711,16743,16744,16744,16744,16744,16744,16776,16776,16776,16776,18824,18825,18857,18857,18857,18857,20938,20938,20938,20938,20970,20971,23019,23019,23051,23051,23052,25100,25132,25132,25133,25133,27213,27213,27213,27214,27246,27246,29294,29294,29327,29327,29327}, {62526,60477,60477,60477,60445,58396,58396,58364,58364,56316,56315,56283,56283,54234,54234,54202,54202,54202,52153,52153,52121,52121,50072,50072,50040,50040,47992,47991,47991,47959,47958,45910,45878,45878,45878,45878,43829,43797,43797,43797,43796,41716,41716,41716,41716,39635,39635,39635,39635,37586,37554,37554,37554,37553,35505,35505,35473,35473,35473,35472,33424,33392,33392,33392,31343,31311,31311,31311,31311,31310,29230,29230,29230,29230,29229,27149,27149,27149,27149,27148,27148,25068,25068,25068,25068,25067,25067,22987,22987,22987,22987,22986,20938,20906,20906,20905,18825,18825,18825,18824,18792,18792,16744,16744,16744,16744,16744,16711,16743,16711,16743,16711,16743,16743,16711,16743,16711,16743,16743,16744,16743,16744,16744,16776,16776,16776,16776,18824,18824,18825,18857,18857,18857,18857,20938,20938,20938,20938,20970,20971,23019,23019,23051,23051,25100,25100,25132,25132,25133,27213,27213,27213,27213,27246,27246,27246,29294,29326,29327,29327}, {60477,60477,60477,60445,60445,58396,58396,58364,58364,56315,56315,56283,56283,54234,54234,54234,54202,52153,52153,52153,52121,52121,50072,50072,50040,50039,47991,47991,47959,47959,45910,45910,45878,45878,45878,43829,43797,43797,43797,43797,41748,41716,41716,41716,39667,39667,39635,39635,39635,37586,37554,37554,37554,37553,35473,35505,35473,35473,35473,33424,33392,33392,33392,33391,31343,31311,31311,31311,31311,29230,29262,29230,29230,29229,29229,27149,27149,27149,27149,27149,27148,25068,25068,25068,25068,25067,25035,23019,22987,22987,22987,22987,20906,20906,20906,20905,20905,18825,18825,18824,18792,16744,16744,16744,16744,16744,16744,16743,16743,16711,16711,16743,16711,16743,16711,16743,16711,16743,16711,16743,16743,16743,16744,16776,16744,16776,16776,16776,16776,18824,18857,18857,18857,18857,18889,20938,20938,20938,20938,20970,20971,23019,23051,23051,23052,23052,25132,25132,25133,25133,25133,27213,27213,27213,27214,27246,27246,29294,29294,29327}, {62526,60477,60445,60445,58396,58396,58396,58364,58363,56315,56283,56283,56282,54234,54202,54202,54202,52153,52153,52121,52121,50072,50072,50040,50040,47992,47991,47959,47959,47959,45910,45878,45878,45878,45877,43829,43797,43797,43797,41749,41748,41716,41716,41715,39667,39635,39635,39635,39634,37554,37554,37554,37554,35505,35505,35473,35473,35473,35472,33392,33392,33392,33392,33391,31343,31311,31311,31311,31310,29262,29230,29230,29230,29229,27149,27149,27149,27149,27149,27116,27116,25068,25068,25068,25067,25067,25035,22987,22987,22987,22986,22986,22986,20906,20906,20905,20873,18825,18825,18825,18824,18824,16744,16744,16744,16744,16744,16743,16743,16711,16711,16711,16743,16711,16711,16743,16711,16743,16743,16743,16743,16743,16743,16744,16776,16776,16776,16776,18824,18824,18824,18857,18857,18857,18857,18890,20938,20938,20938,20970,20970,23019,23019,23019,23051,23052,23052,25132,25132,25132,25133,27213,27213,27213,27213,27246,27246,29294,29294,29327}, {60477,60445,60445,58396,58396,58396,58364,58364,56315,56315,56283,56283,54234,54234,54234,54202,52153,52153,52121,52121,52121,50072,50040,50040,50040,47991,47991,47959,47959,45910,45910,45878,45878,45878,43830,43797,43797,43797,43796,41748,41716,41716,41716,41716,39635,39635,39635,39635,37554,37554,37554,37554,37553,35505,35473,35473,35473,35473,33424,33392,33392,33392,33391,33391,31311,31311,31311,31310,29230,29262,29230,29230,29229,27181,27149,27149,27149,27149,27149,27148,25068,25068,25068,25068,25068,25035,22987,22987,22987,22987,22986,22986,22954,20906,20906,20905,20905,18825,18825,18824,18824,18824,16744,16744,16744,16744,16743,16744,16711,16743,16743,16711,16711,16711,14663,16711,16743,16743,16743,16743,16743,16744,16743,16744,16744,16776,16776,16776,16776,16776,16808,18856,18857,18857,18857,18857,20937,20938,20938,20938,20970,23019,23019,23019,23051,23051,23052,25100,25132,25132,25132,25165,27181,27213,27213,27213,27246,27246,27246,29294}, {60477,60445,60445,60444,58396,58396,58364,56316,56315,56315,56283,54234,54234,54234,54202,54202,52153,52153,52121,52121,52120,50072,50040,50040,50040,47991,47959,47959,47959,47958,45878,45878,45878,45877,43829,43797,43797,43797,43796,41748,41716,41716,41715,39635,39635,39635,39635,39602,37586,37554,37554,37554,37553,35505,35473,35473,35473,35472,33392,33392,33392,33392,33391,31343,31311,31311,31311,31310,29262,29230,29230,29230,29229,27181,27149,27149,27149,27149,27148,27116,25100,25068,25068,25068,25067,22987,22987,22987,22987,22986,22986,22986,22954,20906,20906,20905,20905,18825,18825,18825,18824,18824,18792,16744,16744,16744,16743,16743,16743,16743,16743,16711,16743,16711,16743,14663,16743,14695,16743,16743,16743,16743,16743,16743,16744,16744,16776,16776,16776,16776,18824,18856,18857,18857,18857,18889,18857,20938,20938,20938,20970,20970,20971,23019,23051,23051,23051,23052,25132,25132,25132,25133,25165,25165,27213,27213,27214,27246,27246,29294}, {60477,60445,60445,58396,58396,58364,58364,56315,56315,56283,56283,54234,54234,54202,54202,54202,52153,52121,52121,52121,50072,50072,50040,50040,47991,47991,47959,47959,45911,45910,45878,45878,45878,45877,43829,43797,43797,43797,41748,41748,41716,41716,41716,39667,39635,39635,39635,39634,37554,37554,37554,37554,35505,35505,35473,35473,35473,35472,33424,33392,33392,33392,31343,31311,31311,31311,31310,29262,29230,29230,29230,29230,29229,27149,27149,27149,27149,27148,27148,27148,25068,25068,25068,25068,25067,23019,22987,22987,22987,22986,22986,22986,20906,20906,20906,20906,20905,20873,18825,18825,18824,18792,16776,16744,16744,16744,16744,16743,16743,16711,16743,16743,16711,14663,16743,14695,14695,16743,14695,16743,16743,16743,16743,16743,16743,16744,16776,16776,16776,16776,18824,18856,18856,18857,18857,18857,18857,20905,20938,20938,20970,20938,20970,23019,23019,23051,23051,23052,23052,25132,25132,25132,25133,27213,25165,27213,27213,27214,27246,27246}, {60477,60445,58397,58396,58396,58364,56315,56315,56315,56283,54234,54234,54202,54202,54202,52153,52153,52121,52121,52121,50072,50040,50040,50040,47991,47959,47959,47959,45910,45910,45878,45878,45878,43829,43797,43797,43797,43796,41716,41716,41716,41715,39635,39635,39635,39635,39635,37554,37554,37554,37554,37554,35473,35473,35473,35473,35472,33392,33392,33392,33392,33391,31343,31311,31311,31311,31311,29230,29230,29230,29230,29229,29229,27149,27149,27149,27149,27148,27148,25068,25068,25068,25068,25068,25035,22987,22987,22987,22987,22986,22954,22986,20938,20906,20906,20906,20905,18857,18857,18825,18824,18824,16776,16744,16744,16744,16743,16743,16743,16743,16743,16743,14695,16711,14663,16743,14663,14695,16743,14695,16743,16743,16743,16743,16775,16743,16776,16776,16776,16776,16776,16776,18856,18856,18857,18857,18857,18889,18889,20938,20938,20970,20970,20970,23019,23019,23019,23052,23051,23052,25100,25132,25132,25133,27181,27213,27213,27213,27214,27246}, {60445,60445,58396,58396,58364,58364,56315,56315,56283,56283,54234,54234,54202,54202,54202,52153,52153,52121,52121,50072,50072,50040,50040,50039,47991,47991,47959,47959,45910,45878,45878,45878,45878,43829,43797,43797,43797,43796,41716,41716,41716,41715,39635,39635,39635,39635,37586,37554,37554,37554,37554,35505,35505,35473,35473,35473,33392,33424,33392,33392,33392,33391,31311,31311,31311,31311,31278,29262,29230,29230,29230,29229,27149,27181,27149,27149,27149,27148,25100,25068,25068,25068,25067,25067,25067,22987,22987,22987,22986,22986,22986,20906,20906,20906,20906,20905,20905,20905,18825,18857,18824,18824,18824,16744,16744,16776,16744,16743,16743,16743,16743,16743,16743,14695,14695,14695,14695,16743,16743,16743,14695,16743,14695,16743,16743,16743,16743,16775,16776,16776,16776,16776,18824,18856,18857,18857,18857,18889,18889,20937,20938,20938,20970,20970,23019,23051,23051,23051,23051,23052,25132,25132,25132,25132,25133,25133,27213,27213,27213,27213}, {60445,58396,58396,58396,58364,58363,56315,56315,56283,54235,54234,54234,54202,54202,52153,52153,52153,52121,52120,50072,50040,50040,50039,47991,47959,47959,47959,45910,45910,45878,45878,45878,43829,43797,43797,43797,43797,41716,41716,41716,41716,39635,39635,39635,39635,39634,37554,37554,37554,37554,37553,35505,35473,35473,35473,35473,33424,33392,33392,33392,33391,31311,31343,31311,31311,31310,29262,29230,29230,29230,29229,29229,27149,27149,27149,27149,27149,27116,25068,25068,25068,25068,25067,25067,22987,22987,22987,22987,22986,22986,22986,20906,20906,20906,20906,20905,20905,20905,18857,18857,18825,18824,18824,18824,16776,16744,16744,16743,16743,16743,16743,16743,16743,16743,16743,16743,14663,14695,14695,14695,14695,14695,16743,16743,16743,16743,16775,16776,16776,16776,16776,16776,16808,18856,18856,18857,18857,18857,18889,20937,20938,20938,20938,20970,20970,23019,23019,23051,23051,23051,23052,25132,25132,25132,25133,25133,25165,27213,27213,27213}, {60445,58396,58396,58364,58364,56315,56315,56283,56283,54234,54234,54202,54202,54202,52153,52121,52121,52121,50072,50040,50040,50040,47991,47991,47959,47959,47958,45910,45878,45878,45878,45878,43829,43797,43797,43797,41748,41716,41716,41716,41716,39667,39635,39635,39635,37586,37554,37554,37554,37554,35505,35473,35473,35473,35473,35472,33392,33392,33392,33391,31343,31311,31311,31311,31311,31310,29230,29230,29230,29230,29229,29197,27149,27149,27149,27149,27148,25100,25068,25068,25068,25068,25067,22987,22987,22987,22987,22987,22986,22986,20906,20938,20906,20906,20905,20905,20905,20905,20905,18825,18825,18824,18824,18824,16776,16744,16744,16743,16743,16743,16743,16743,16743,14663,14695,14663,14695,14695,14695,16743,16743,14695,16743,16743,16743,16743,16743,16775,16776,16776,16776,16776,16776,16776,18856,18856,18857,18889,18857,20937,20937,20938,20970,20970,20970,20970,23019,23019,23051,23051,23051,23052,25100,25132,25132,25132,25133,25133,27213,27213}, {58397,58396,58396,58364,58364,56315,56315,56283,56283,54234,54234,54202,54202,52154,52153,52121,52121,52120,50072,50072,50040,50040,47991,47991,47959,47959,47958,45910,45878,45878,45878,45877,43797,43797,43797,43796,41716,41716,41716,41716,39667,39667,39635,39635,39603,37554,37554,37554,37554,37553,35505,35473,35473,35473,35473,33424,33392,33392,33392,33392,31311,31311,31311,31311,31311,29230,29262,29230,29230,29230,27181,27149,27149,27149,27149,27149,27116,25068,25068,25068,25068,25067,25067,25035,22987,22987,22987,22987,22986,22986,22986,20906,20906,20906,20905,20905,20905,20905,18857,18825,18857,18825,18824,18824,16776,16776,16744,16743,16743,16743,16743,16743,16743,16743,16743,16743,16743,14695,14695,14695,16743,14695,16743,16743,16743,16775,16743,16743,16775,16776,16776,16776,16776,18856,18856,18856,18857,18889,18889,18889,20937,20937,20970,20938,20970,20970,23019,23019,23051,23051,23051,23052,25132,25132,25132,25132,25132,25165,27213,27213}, {58396,58396,58396,58364,58363,56315,56315,56283,54234,54234,54202,54202,54202,54201,52153,52121,52121,52120,50072,50040,50040,47992,47991,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,16775,16776,16776,16776,16776,16808,18856,18856,18856,18857,18857,18889,18889,20937,20937,20970,20970,20970,20970,23019,23019,23051,23051,23051,23052,23052,25132,25132,25132,25133,25165,27213}, {58396,58364,58364,58364,56315,56315,56283,56283,54234,54234,54234,54202,52153,52153,52121,52121,52121,50072,50072,50040,50040,47991,47959,58430,47959,47958,45910,45910,45878,45878,45877,43797,43797,43797,43797,41716,41748,41716,41716,41715,39635,39635,39635,39635,37586,37554,37554,37554,35506,35505,35473,35473,35473,35473,33392,33392,33392,33392,33391,33391,31311,31311,31311,31311,29230,29230,29230,29230,29230,29197,27149,27149,27149,27149,27149,27148,25068,25068,25068,25068,25068,25067,25067,22987,22987,22987,22986,22986,22986,20938,20906,20906,20906,20905,20905,20905,20905,18857,18857,18857,18857,18824,18824,18824,18824,16776,16776,16776,16743,16743,16743,16743,16743,16743,16743,14695,16743,14695,14695,16743,14695,16743,14695,16743,16743,16743,16743,58430,16775,16775,16775,16776,16808,16776,18856,18856,18856,18857,18889,18889,18889,18889,20937,20938,20938,20970,20970,20970,23019,23051,23051,23051,23051,23052,23052,25132,25132,25132,25133,25133}, {58396,58396,58364,56315,56315,56315,56283,54234,54234,54234,54202,54202,52153,52153,52153,52121,50072,50072,50040,50040,50040,47991,47991,58430,47959,45910,45878,45878,45878,45878,43797,43797,43797,43797,41748,41716,41716,41716,41716,39667,39667,39635,39635,39635,37554,37554,37554,37554,37553,35505,35473,35473,35473,35472,33424,33424,33392,33392,33392,31311,31311,31311,31311,29262,29262,29230,29230,29230,29230,29229,27149,27149,27149,27149,27148,27116,25068,25068,25068,25068,25067,25067,22987,22987,22987,22987,22986,22986,22986,20938,20906,20906,20906,20905,20905,20905,20905,20905,18857,18825,18825,18824,18824,18824,18824,18824,16776,16744,16775,16743,16775,16743,16743,16743,16743,16743,14695,14695,14695,14695,16743,16743,16743,16743,16743,16743,16743,58430,16775,16776,16775,16776,16776,16808,16808,16808,18856,18856,18856,18889,18889,20937,20937,20937,20938,20970,20970,20970,20970,23051,23051,23051,23051,23051,23052,25132,25132,25132,25132,25133}, {58396,58364,58364,56315,56315,56283,56283,54234,54234,54234,54202,52154,52153,52121,52121,52121,50072,50040,50040,50040,47991,47959,47991,58430,47958,45910,45910,45878,45878,45877,43829,43797,43797,43797,41748,41716,41716,41716,39667,39635,39635,39635,39635,37586,37586,37554,37554,37554,35505,35473,35473,35473,35473,33392,33424,33392,33392,33392,31343,31311,31311,31311,31311,29262,29230,29230,29230,29230,29229,27149,27149,27149,27149,27149,27116,25100,25068,25068,25068,25068,25067,23019,23019,22987,22987,22987,22987,22986,22986,20906,20906,20906,20905,20905,20905,20905,20905,18857,18857,18825,18856,18856,18824,18824,18824,18824,16776,16776,16776,16743,16743,16743,16743,14695,16743,16743,16743,14695,16743,14695,14695,14695,16743,16743,16743,16775,16775,58430,16775,16775,16775,16776,16776,16808,16808,18856,18856,18856,18856,18889,18889,18889,18889,20937,20969,20938,20970,20970,20970,20970,23051,23019,23051,23051,23051,23052,25132,25132,25132,25132}, {58364,58364,56315,56315,56315,56283,54234,54234,54234,54202,54202,52153,52153,52121,52121,52120,50072,50040,50040,50040,47991,47959,47959,58430,45910,45910,45878,45878,45878,43797,43797,43797,43797,43796,41748,41716,41716,41715,39635,39635,39635,39635,39635,37554,37554,37554,37554,37553,35505,35473,35473,35473,35472,33424,33392,33392,33392,33391,31311,31311,31311,31311,31310,29262,29230,29230,29230,29230,29229,27181,27149,27149,27149,27148,27148,25068,25068,25068,25068,25067,25067,23019,22987,22987,22987,22986,22986,22986,20938,20938,20906,20906,20906,20905,20905,20905,18857,18857,18857,18857,18856,18856,18824,18824,18824,18824,18824,16776,16775,16775,16743,16775,16743,16743,16743,16743,16775,16743,16743,14695,16743,16743,16743,16743,16775,16743,16775,58430,16775,16775,16775,16775,16776,16808,16776,18856,18856,18856,18856,18888,18857,18889,18889,20937,20937,20937,20970,20970,20970,20970,23019,23019,23051,23051,23051,23051,25132,25100,25132,25132}, {58364,58364,56315,56315,56283,56283,54234,54234,54202,54202,54202,52153,52153,52121,52121,52120,50040,50040,50040,50039,47991,47991,47959,58430,45910,45910,45878,45878,45878,43829,43797,43797,43797,43796,41716,41716,58430,58430,58430,58430,58430,58430,37586,37554,37554,37554,58430,58430,35473,35473,35473,35473,35472,33424,33392,33392,33392,33391,58430,58430,58430,58430,29262,29262,29230,29230,58430,58430,27149,27149,27149,27149,27149,27148,58430,58430,25068,25068,58430,58430,58430,58430,58430,58430,58430,58430,22986,22986,58430,58430,58430,58430,58430,58430,20905,20905,18857,18857,18857,18825,18856,18856,18824,18856,58430,58430,58430,58430,16776,16775,16775,16775,16743,16743,16743,16743,16743,16743,16743,16775,16743,16743,14695,16743,16775,16743,16775,58430,16775,16775,16775,16775,16808,16808,16808,18856,16808,18856,18888,18856,18889,18889,18889,20937,18889,20937,20970,20970,20970,20970,23018,23051,23051,23051,23051,23051,23052,23052,25132,25132}, {58364,58364,56315,56315,56283,56283,54234,54234,54202,54202,52153,52153,52121,52121,52120,50040,50040,50040,50040,47991,47959,47959,47959,58430,45878,45878,45878,45878,45877,43797,43797,43797,43796,41748,41716,41716,58430,58430,58430,58430,58430,58430,37554,37554,37554,37554,58430,58430,35473,35473,35473,35473,33392,33392,33392,33392,33391,31343,58430,58430,58430,58430,31310,29230,29230,29230,58430,58430,27149,27149,27149,27149,27149,27148,58430,58430,25068,25068,58430,58430,58430,58430,58430,58430,58430,58430,22986,22986,58430,58430,58430,58430,58430,58430,20905,18857,18857,18857,18857,18857,18856,18824,18824,18824,58430,58430,58430,58430,16776,16776,16775,16775,16743,16775,16743,16743,16743,16743,14695,16775,14695,16743,16775,16775,16775,16775,16775,58430,16775,16775,16775,16775,16775,16776,16808,16808,18856,18856,18856,18856,18889,18889,18889,18889,18889,20937,20937,20970,20970,20970,20970,23050,23019,23051,23051,23051,23051,23052,25132,25132}, {58364,56315,56315,56283,56283,54234,54234,54202,54202,54201,52153,52153,52121,52121,50072,50072,50040,50040,50040,47991,47991,47959,47959,58430,45910,45878,45878,45877,43829,43797,43797,43797,41748,41716,41716,41716,58430,58430,39667,39635,39635,37586,58430,58430,37554,37553,58430,58430,35473,35473,35473,35472,33424,33392,33392,33392,58430,58430,31311,31311,31311,31310,58430,58430,29230,29229,58430,58430,27149,27149,27149,27149,27116,27148,58430,58430,25068,25068,58430,58430,25067,22987,22987,22987,22987,22986,22986,22986,58430,58430,20906,20905,20905,20905,58430,58430,18857,18857,18857,18857,18856,18856,58430,58430,18824,18824,18824,18824,58430,58430,16776,16775,16775,16775,16775,16775,16775,16775,16775,16743,16775,16743,16775,16743,16775,16775,16775,58430,16775,16775,16775,16775,16807,16808,16808,16808,18856,18856,18856,18856,18856,18888,18889,18889,18889,20937,20937,20969,20970,20970,20970,23018,23051,23051,23051,23051,23051,23051,25132,25132}, {58364,56315,56315,56283,54235,54234,54234,54202,54202,52153,52153,52121,52121,52120,50072,50072,50040,50040,47991,47991,47959,47959,47958,58430,45878,45878,45878,43829,43797,43797,43797,43797,41748,41716,41716,41716,58430,58430,39635,39635,39635,37586,58430,58430,37554,37553,58430,58430,35473,35473,35472,33424,33392,33392,33392,33391,58430,58430,31311,31311,31311,29230,58430,58430,29230,29230,58430,58430,27149,27149,27149,27149,27148,25100,58430,58430,25068,25068,58430,58430,22987,22987,22987,22987,22986,22986,22986,20938,58430,58430,20906,20905,20905,20905,58430,58430,18857,18857,18857,18856,18824,18824,58430,58430,18824,18824,18824,18824,58430,58430,16776,16775,16775,16775,16775,16775,16775,16775,16743,16775,16775,16775,16775,16775,16775,16775,16775,58430,16775,16775,16775,16807,16807,16775,16808,16808,16808,16808,18856,18856,18856,18888,18889,18889,18889,20937,18889,20969,20969,20970,20970,20970,23018,23051,23051,23051,23051,23051,23051,25132}, {56315,56315,56315,56283,56282,54234,54234,54202,54201,52153,52121,52121,52121,52120,50072,50040,50040,50039,47991,47959,47959,47959,45910,58430,45878,45878,43829,43829,43797,43797,43797,43796,41716,41716,41716,41716,58430,58430,58430,58430,58430,58430,37554,37554,37554,37553,58430,58430,35473,35473,35472,33392,33392,33392,33392,31343,58430,58430,58430,58430,58430,58430,58430,58430,29230,29229,29229,27149,58430,58430,58430,58430,58430,58430,25068,25068,25068,25067,58430,58430,58430,58430,58430,58430,22986,22986,22986,20938,58430,58430,58430,58430,58430,58430,20905,20905,18857,18857,18857,18856,18856,18824,18824,18856,18824,18824,58430,58430,16808,18824,16776,16775,16775,16775,16775,16775,16775,16775,16775,16775,16775,16775,16775,16775,16775,16775,16775,58430,16775,16775,16807,16807,16807,16807,16807,16808,16808,18856,18856,18856,18888,18888,18888,18889,18889,18889,20969,20937,20969,20970,20970,20970,20970,23018,23050,23051,23051,23051,23083,25099}, {56315,56315,56283,56283,54234,54234,54234,54202,54202,52153,52153,52121,52121,50072,50040,50040,50040,47991,47991,47959,47959,47958,45910,58430,45878,45878,45877,43829,43797,43797,43797,41748,41748,41716,41716,41683,58430,58430,58430,58430,58430,58430,37554,37554,37554,35505,58430,58430,35473,35473,35472,33392,33392,33392,33392,33391,58430,58430,58430,58430,58430,58430,58430,58430,29230,29229,27149,27149,58430,58430,58430,58430,58430,58430,25068,25068,25068,25067,58430,58430,58430,58430,58430,58430,22986,22986,22986,20938,58430,58430,58430,58430,58430,58430,20905,18857,18857,18857,18856,18824,18856,18856,18856,18824,18856,18856,58430,58430,18824,18856,16776,16775,16807,16775,16775,16775,16775,16775,16775,16775,16775,16775,16775,16775,16775,16775,16775,58430,16807,16807,16807,16775,16807,16807,16808,16808,16808,16808,18856,18888,18888,18888,18888,18888,18889,18889,20937,20969,20969,20969,20970,20970,20970,21002,23050,23051,23051,23051,23051,23051}, {56315,56283,56283,56283,54234,54234,54202,54202,54201,52121,52121,52121,50072,50072,50040,50040,50040,47991,47959,47959,47959,45910,45910,58430,45878,45878,43797,43829,43797,43797,43796,41716,41716,41716,41716,39667,58430,58430,39635,37586,37554,37554,37554,37554,35505,35505,58430,58430,35473,35472,33424,33392,33392,33392,33391,31343,58430,58430,31311,31310,29230,29230,58430,58430,29230,29229,27149,27149,27149,27149,58430,58430,25068,25068,25068,25068,25067,25067,58430,58430,22987,22987,22987,22986,22986,22986,20938,20938,58430,58430,20905,20905,58430,58430,18857,18857,18857,18856,18856,18856,18824,18856,18856,18824,58430,58430,16808,18824,18824,18856,18856,16808,16808,16775,16775,16775,16775,16775,16775,16775,16775,16775,16775,16775,16775,16775,16775,58430,16807,16775,16807,16807,16807,16807,16807,16807,16808,16808,18856,18856,18888,18888,18888,18888,18889,18889,18889,18889,20969,20969,20969,20970,20970,20970,23018,23050,23051,23051,23051,23051}, {56315,56283,56283,54234,54234,54202,54202,54201,52153,52153,52121,52121,50072,50072,50040,50040,50039,47991,47959,47959,47958,45910,45878,58430,45878,45878,43829,43797,43797,43797,41748,41716,41716,41716,41715,39667,58430,58430,39635,39602,37554,37554,37554,37553,35505,35505,58430,58430,35473,35472,33392,33392,33392,33392,33359,31311,58430,58430,31311,31310,29230,29230,58430,58430,29229,27149,27149,27149,27149,27149,58430,58430,25068,25068,25068,25068,25068,25067,58430,58430,22987,22987,22986,22986,22986,22986,20906,20906,58430,58430,20905,20905,58430,58430,20905,18857,18857,18857,18856,18856,18824,18856,18824,18824,58430,58430,18856,18824,16808,18856,16808,18856,18856,16807,16807,16807,16775,16775,16775,16775,16775,16775,16775,16775,16775,16807,16807,58430,16807,16807,16807,16807,16807,16807,16807,16807,16808,18856,18856,18856,18888,18888,18888,18888,18888,18889,18889,20937,20937,20969,20969,20970,20970,20970,23050,23050,23051,23051,23051,23051}, {56315,56283,56283,54234,54234,54202,54202,54201,52153,52121,52121,52120,50072,50040,50040,50039,47991,47991,47959,47959,45910,45910,45878,58430,45878,43829,43797,43797,43797,43797,41748,41716,41716,41716,41715,39635,58430,58430,39635,37586,37554,37554,37554,37553,35505,35473,58430,58430,58430,58430,58430,58430,58430,58430,31343,31311,58430,58430,31310,29262,29230,29230,58430,58430,29229,27149,27149,27149,27149,27149,58430,58430,25068,25068,25068,25067,25067,25035,58430,58430,58430,58430,58430,58430,58430,58430,20938,20906,58430,58430,20905,20905,20905,20905,58430,58430,18857,18856,18856,18824,18856,18856,58430,58430,58430,58430,58430,58430,58430,58430,16808,16808,18856,16808,16807,16807,16807,16807,16775,16807,16807,16807,16807,16807,16807,16775,16807,58430,16807,16807,16807,16807,16807,16807,16807,16807,16808,16808,16808,18888,18888,18856,18888,18888,18888,18888,18889,20969,20969,20969,20969,20969,20970,20970,20970,23050,23050,23051,23051,23051}, {56283,56283,54234,54234,54202,54202,54202,52153,52121,52121,52121,50072,50072,50040,50040,50039,47991,47991,47959,47959,45910,45878,45878,58430,45878,43829,43797,43797,43797,41748,41716,41716,41716,41716,39635,39635,58430,58430,37554,37586,37554,37554,37554,35505,35473,35473,58430,58430,58430,58430,58430,58430,58430,58430,31343,31311,58430,58430,31311,29230,29230,29230,58430,58430,27149,27149,27149,27149,27149,27149,58430,58430,25068,25068,25068,25068,25067,23019,58430,58430,58430,58430,58430,58430,58430,58430,20938,20938,58430,58430,20905,20905,20905,20905,58430,58430,18857,18857,18856,18856,18856,18856,58430,58430,58430,58430,58430,58430,58430,58430,18856,18856,18856,16807,18856,18855,16807,16807,16807,16807,16807,16807,16807,16807,16807,16807,16807,58430,16807,16807,16807,16807,16807,16807,16807,18855,16808,16808,18888,18888,18888,18888,18888,18888,18888,18888,18889,20969,18889,20969,20969,20969,20970,20970,20970,20970,23050,23050,23051,23051}, {56283,56283,54234,54234,54234,54202,52153,52153,52121,52121,52121,50072,50040,50040,50040,47991,47959,47991,47959,45910,45910,45878,45878,58430,45877,43797,43797,43797,43797,43796,41716,41716,41716,41715,39635,39635,39635,39635,37586,37554,37554,37554,37553,35505,35473,35473,35473,35473,33392,33424,33392,33392,33391,33359,31311,31311,31311,31311,29262,29230,29230,29230,29230,29229,27149,27149,27149,27149,27149,27148,25068,25068,25068,25068,25068,25067,25035,23019,22987,22987,22987,22987,22986,22986,20938,20906,20938,20906,20906,20905,20905,20905,20905,20905,18857,18857,18857,18856,18856,18856,18856,18856,18856,18856,18856,18856,18856,18856,18856,18856,18856,16808,16808,18856,18855,16807,16807,16807,16807,16807,16807,16807,16807,16807,16807,16807,16807,58430,16807,16807,16807,16807,16839,16807,16807,16807,16840,16839,18856,18856,18888,18888,18888,18888,18888,18920,18888,18889,18921,20969,20969,20969,20970,20970,20970,21002,23050,23050,23051,23051}, {56283,56282,54234,54234,54202,54202,52153,52153,52121,52121,50072,50072,50040,50040,47992,47991,47991,47959,47959,45910,45910,45878,45878,58430,43829,43797,43797,43797,43797,41716,41716,41716,41716,41715,39635,39635,39635,37587,37554,37554,37554,37554,35505,35505,35473,35473,35473,35472,33424,33392,33392,33392,33391,31311,31311,31311,31311,31310,29262,29230,29230,29230,29230,29229,27149,27149,27149,27149,27149,27148,25068,25068,25068,25068,25068,25067,25035,22987,22987,22987,22987,22986,22986,22986,22986,20938,20938,20906,20905,20905,20905,20905,20905,18857,18857,18857,18856,18856,18856,18856,18856,18856,18856,18856,18856,18856,18856,18856,18856,18856,18856,18855,18855,18856,18856,18888,18888,18855,16839,16807,16807,16807,16807,16807,16839,16807,16807,58430,16807,16807,16807,16807,16839,16807,16807,16839,16807,16807,18888,18888,18888,18888,18888,18888,18888,18888,18889,18921,20969,20969,20969,20969,20969,20969,21002,21002,23050,23050,23051,23051}, {56283,54234,54234,54202,54202,54202,52153,52121,52121,52120,50072,50072,50040,50040,47991,47991,47959,47959,47959,45910,45910,45878,45878,58430,43797,43797,43797,43797,41748,41748,41716,41716,41716,39635,39635,39635,39635,39634,37554,37554,37554,37553,35505,35505,35473,35473,35473,35472,33392,33392,33392,33392,31343,31311,31311,31311,58430,58430,29230,29230,29230,29230,29229,27149,58430,58430,27149,27149,27116,27148,58430,58430,58430,58430,25068,25067,22987,22987,58430,58430,22987,22986,22986,20938,58430,58430,20906,20906,20905,20905,58430,58430,20905,20905,20905,18857,18857,18856,18856,18856,18856,18856,18856,18856,18856,18856,18856,18856,18856,18856,18856,18856,18856,16807,18888,18856,18887,18887,18887,18887,16807,18887,18887,16807,16807,16839,18887,58430,16807,16807,16839,16807,16807,16839,16839,16807,18888,18887,18888,18888,18888,18888,18888,18888,18888,18888,18920,18889,18921,18921,20969,20969,20969,20970,20970,20970,20970,23050,23050,23050}, {54235,54234,54234,54234,54202,52153,52153,52121,52121,50072,50072,50040,50040,50040,47991,47991,47959,47959,45910,45910,45878,45878,45878,58430,43797,43797,43797,41749,41716,41716,41716,41716,39635,39667,39635,39635,37587,37586,37554,37554,37554,35506,35505,35473,35473,35473,35472,33424,33392,33392,33392,33391,31343,31311,31311,31311,58430,58430,29230,29230,29230,29230,29229,27181,58430,58430,27149,27149,27148,25068,58430,58430,58430,58430,25067,25035,22987,22987,58430,58430,22986,22986,22986,22986,58430,58430,20938,20938,20905,20905,58430,58430,20905,18857,18857,18857,18857,18856,18856,18856,18856,18856,18856,18856,18856,18856,18856,18856,18856,18856,18856,18856,18856,18856,18888,18887,18888,18888,18888,18888,18887,18887,18887,18887,18887,16839,16839,58430,16807,16839,16839,16839,16839,16839,16839,18887,18888,16839,18887,18888,18888,18888,18888,18888,18888,18888,18920,18888,20969,20969,20969,20969,20969,20969,21002,21002,21002,21002,23050,23050}, {54234,54234,54234,54202,54202,52153,52121,52121,52120,50072,50040,50040,50040,47991,47991,47959,47959,47959,45910,45910,45878,45878,45878,58430,43797,43797,43797,43796,41748,41716,41716,41716,39667,39635,39635,39635,39634,37554,37554,37554,37553,35505,35473,35473,35473,35473,35473,33392,33392,33392,33392,33391,31311,31311,31311,31311,58430,58430,29230,29230,29230,29230,27181,27181,58430,58430,27149,27149,58430,58430,25068,25068,25068,25068,58430,58430,23019,22987,58430,58430,58430,58430,22986,20938,58430,58430,20906,20905,20905,20905,58430,58430,20905,20905,18857,18857,18856,18856,18856,18856,18856,18856,18856,18856,18856,18856,18856,18856,16808,18856,18856,18856,18855,18888,18856,18887,18888,18888,18888,18888,18888,18887,18887,18887,18887,18887,16839,58430,16839,16839,16839,18887,16839,16839,18887,18887,18887,18887,18887,18888,18888,18888,18920,18888,18888,18920,18888,18920,18921,20969,20969,20969,20969,21001,20969,21002,21002,23050,23050,23050}, {54234,54234,54202,54202,52153,52153,52121,52121,52120,50072,50072,50040,50040,47991,47991,47959,47959,47958,45910,45878,45878,45878,45877,58430,43797,43797,41749,41748,41716,41716,41716,41715,39667,39635,39635,39635,37586,37586,37554,37554,37554,35505,35473,35473,35473,35473,33424,33392,33392,33392,33392,31343,31311,31311,31311,31311,58430,58430,29230,29230,29230,29229,27149,27149,58430,58430,27149,27116,58430,58430,25068,25068,25068,25068,58430,58430,22987,22987,58430,58430,58430,58430,22986,20938,58430,58430,20906,20906,20905,20905,58430,58430,20905,18857,18857,18857,18856,18856,18856,18856,18856,18856,18856,18856,18856,18856,18856,18888,18856,18856,18856,18856,18856,18888,18887,18888,18887,18888,18888,18888,18920,18920,18887,18887,18887,18887,18887,58430,18887,18887,18887,16839,16839,18887,18887,18887,18887,18887,18888,18888,18888,18888,18888,18920,18920,18920,18920,18920,18921,20969,20969,20969,20969,20969,20969,21001,21002,21002,21002,23050}, {54234,54202,54202,54202,52153,52121,52121,52121,50072,50072,50040,50040,47992,47991,47991,47959,47959,45910,45878,45878,45878,45878,43829,58430,43797,43797,41749,41748,41716,41716,41715,39667,39635,39635,39635,39635,37586,37554,37554,37554,37553,35505,35505,35473,35473,35473,33424,33392,33392,33392,33392,31343,31311,31311,31311,31311,58430,58430,29230,29230,58430,58430,27149,27149,58430,58430,27149,27149,58430,58430,25068,25068,25068,25068,58430,58430,22987,22987,58430,58430,22986,22986,58430,58430,58430,58430,20937,20905,20905,20905,58430,58430,20905,20905,18857,18857,18856,18856,18856,18856,18856,18856,18856,18856,18856,18856,18856,18856,18856,18856,18856,18855,18887,18888,18888,18888,18888,18887,18887,18920,18920,18920,18920,18888,18887,18887,18887,58430,18887,18887,18887,18887,18887,18887,18887,18887,18887,18920,18920,18888,18920,18888,18920,18888,18920,18920,18920,20968,18921,20969,20969,20969,20969,21001,21001,21001,21002,21002,23050,23050}, {54234,54202,54202,54201,52153,52121,52121,52121,50072,50040,50040,50040,47991,47991,47959,47959,47959,45910,45878,45878,45878,45878,43797,58430,43797,43796,41716,41748,41716,41716,41715,39667,39635,39635,39635,37586,37554,37554,37554,37554,35505,35473,35473,35473,35473,33424,33424,33392,33392,33392,33391,31343,31311,31311,31311,31310,58430,58430,29230,29230,58430,58430,27149,27149,58430,58430,27148,27148,58430,58430,25068,25068,25067,25067,58430,58430,22987,22987,58430,58430,22986,22986,58430,58430,58430,58430,20906,20905,20905,20905,58430,58430,18857,20905,18857,18857,18856,18856,18856,18856,18856,18856,18856,18856,18856,18856,18856,18856,18888,18856,18888,18888,18888,18888,18888,18887,18888,18920,18888,18920,18920,18920,18920,18920,18920,18920,18919,58430,18919,18887,18919,18887,18887,18887,18919,18887,18887,18887,18888,18888,18920,18920,18920,18920,18920,18920,18920,18920,18920,20969,20969,21001,20969,20969,20969,21002,20970,23050,23050,21002}, {54234,54202,54202,52153,52153,52121,52121,50073,50072,50072,50040,50039,47991,47991,47959,47959,45910,45910,45878,45878,45878,43829,43829,58430,43797,41749,41748,41716,41716,41716,39667,39635,39635,39635,39634,37586,37554,37554,37554,37554,35505,35505,35473,35473,35473,33424,33392,33392,33392,33392,31343,31311,31311,31311,31311,31310,58430,58430,58430,58430,29229,27181,58430,58430,58430,58430,27148,27148,58430,58430,25068,25068,25067,23019,58430,58430,22987,22987,58430,58430,22986,20938,20938,20938,58430,58430,20906,20905,20905,20905,20905,20905,20905,20905,18857,18857,18857,18856,18856,18856,18856,18856,18856,18856,18856,18856,18856,18856,18888,18888,18888,18888,18888,18888,18888,18888,18888,18888,18920,18920,18920,18920,18920,18920,18920,18920,18920,58430,18919,18919,18919,18919,18919,18919,18919,18920,18919,18919,18920,18920,18920,18920,18920,18920,18920,18920,18920,20968,18920,18920,21001,20969,21001,21001,21001,21001,23050,21002,21002,23050}, {54202,54202,52154,52153,52121,52121,52121,50072,50072,50040,50040,50040,47991,47959,47959,47959,45910,45878,45878,45878,45878,43829,43797,58430,43797,41749,41748,41716,41716,39667,39667,39635,39635,39635,37587,37554,37554,37554,37554,37553,35505,35473,35473,35473,33425,33392,33424,33392,33392,33391,31311,31311,31311,31311,31310,29262,58430,58430,58430,58430,27181,27149,58430,58430,58430,58430,27149,25068,58430,58430,25068,25068,25067,23019,58430,58430,22987,22987,58430,58430,22986,22986,20938,20906,58430,58430,20905,20905,20905,20905,20905,20905,18857,18857,18857,18857,18856,18857,18856,18856,18856,18856,18856,18856,18856,18856,18888,18856,18888,18888,18888,18888,18888,18888,18888,18888,18888,18920,18920,18920,18920,18920,18920,18920,18920,18919,18920,58430,18919,18920,18920,18919,18919,18919,18919,18919,18919,18920,18919,18920,18920,18920,18920,18920,18920,18920,18920,20968,20968,20969,20968,21001,20969,21001,21001,21001,21001,21001,21002,23050}, {54202,54202,52153,52153,52121,52121,52120,50072,50040,50040,50039,47991,47991,47959,47959,47958,45910,45910,45878,45878,45877,43797,43797,58430,43797,41716,41716,41716,41716,41715,39635,39635,39635,39635,37586,37554,37554,37554,37554,35505,35473,35473,35473,35473,35472,33424,33392,33392,33392,31343,31343,31311,31311,31311,31310,29230,58430,58430,29230,29229,29197,27149,27149,27149,58430,58430,27148,25068,25068,25068,58430,58430,58430,58430,22987,22987,22987,22986,58430,58430,22986,20938,20938,20906,58430,58430,20905,20905,20905,20905,58430,58430,20905,20905,18857,18856,18856,18856,18856,18856,18888,18856,18856,18888,18856,18888,18888,18888,18888,18888,18888,18888,18888,18888,18888,18888,18920,18920,18920,18920,18920,18920,18920,18952,21000,18920,18920,58430,18952,18919,18919,18919,18920,18920,18920,18920,18919,18920,18919,18920,18920,18920,18920,18920,18952,18920,18952,18920,21000,21000,21001,20969,21001,21001,21001,21001,21002,21001,21002,23050}, {54202,54202,52153,52153,52121,52121,50072,50072,50040,50040,50040,47991,47991,47959,47959,45910,45878,45878,45878,45878,43829,43829,43797,58430,41748,41748,41716,41716,41716,39667,39635,39635,39635,39635,37586,37586,37554,37554,37553,35505,35473,35473,35473,35473,35472,33392,33392,33392,33392,31343,31343,31311,31311,31311,29262,29230,58430,58430,29230,29229,27149,27149,27149,27149,58430,58430,27116,25100,25068,25068,58430,58430,58430,58430,22987,22987,22987,22986,58430,58430,22986,20938,20938,20906,58430,58430,20905,20905,20905,20905,58430,58430,18857,18857,18857,18856,18857,18856,18888,18888,18856,18856,18888,18888,18888,18888,18888,18888,18888,18888,18888,18888,18888,18888,18920,18920,18920,18920,18920,18920,18920,18920,18952,18952,18952,21000,18952,58430,18952,18920,18952,18952,18919,18919,18919,18920,18920,18920,18952,18920,18952,18920,18920,18920,18952,18952,21000,21000,21000,21000,21001,21001,21001,21001,21001,21001,21001,21002,21002,21002}, {54202,52153,52153,52121,52121,52121,50072,50040,50040,50040,47991,47991,47959,47959,45910,45910,45878,45878,45878,45878,43797,43797,43797,58430,41748,41716,41716,41716,41716,39667,39635,39635,39635,37586,37586,37554,37554,37554,35505,35473,35473,35473,35473,35472,33392,33392,33392,33392,33391,31311,31311,31311,31311,31310,29230,29230,29230,29230,29230,29229,27181,27149,27149,27149,27149,25068,25068,25068,25068,25068,25068,25067,25067,22987,22987,22987,22987,22986,22986,22986,20938,20938,20906,20938,20905,20905,20905,20905,20905,20905,20905,18857,20905,18857,18857,18856,18888,18856,18888,18856,18888,18888,18888,18888,18888,18888,18888,18888,18888,18888,18888,18888,18888,18888,18888,18920,18920,18920,18920,18920,18920,18920,18920,18952,18952,21000,21000,58430,21000,18952,18952,18952,18952,18952,18952,18920,18952,18952,18952,18952,18952,18952,18952,21000,18920,21000,20968,21000,21000,21000,21001,21001,21001,21001,21001,21001,21033,21001,23050,23050}, {54202,52153,52121,52121,52121,52120,50072,50040,50040,50040,47991,47991,47959,47959,45910,45910,45878,45878,45878,43829,43829,43797,43797,58430,41716,41748,41716,41716,39667,39635,39635,39635,39635,37586,37554,37554,37554,37553,35505,35473,35473,35473,35473,33424,33392,33392,33392,33392,33391,31343,31311,31311,31311,31310,29262,29230,29230,29230,29229,27149,27149,27149,27149,27149,27149,27148,25068,25068,25068,25068,25068,25067,23019,23019,22987,22987,22987,22987,22986,22986,20938,20938,20938,20938,20905,20905,20905,20905,20905,20905,18857,18857,18857,18857,18857,18856,18857,18888,18856,18888,18856,18888,18888,18888,18888,18888,18888,18888,18888,18888,18888,18920,18920,18920,18920,18920,18920,18920,18920,18920,18920,18952,18952,18952,18952,21000,21000,58430,21000,21000,21000,21000,18952,21000,18952,18952,18952,21000,18952,18952,21000,18952,18952,21000,21000,21000,21000,21000,21000,21001,21001,21001,21001,21001,21001,21001,21001,21001,23082,23049}, {54201,52153,52153,52121,52121,50072,50072,50040,50040,47991,47991,47991,47959,47958,45910,45878,45910,45878,45878,43829,43797,43797,43797,58430,41716,41716,41716,41716,39667,39635,39635,39635,39634,37554,37554,37554,37554,37553,35505,35505,35473,35473,35473,33424,33392,33392,33392,33391,31343,31311,31311,31311,31311,31310,29230,29230,29230,29230,29229,27149,27149,27149,27149,27149,27116,25068,25100,25068,25068,25068,25067,25067,22987,22987,22987,22987,22987,22986,22986,20938,20938,20906,20938,20906,20905,20905,20905,20905,20905,20905,20905,18857,18857,18857,18888,18856,18856,18856,18888,18888,18888,18888,18888,18888,18888,18888,18888,18888,18888,18888,18888,18888,18920,18920,18920,18920,18920,18920,18920,18920,18952,18952,21000,18952,21000,21000,21000,58430,21000,21000,21032,21000,21000,21000,18952,21032,18952,18952,21000,21000,21000,21000,21000,21000,21032,21000,21000,21000,21000,21000,21000,21033,21001,21001,21033,21001,21033,23082,23081,23082}, {52153,52153,52121,52121,50072,50072,50072,50040,50040,47991,47959,47959,47959,45910,45910,45878,45878,45878,43829,43797,43797,43797,43797,58430,41716,41716,41716,41715,39667,39635,39635,39635,37586,37554,37554,37554,35506,35505,35505,35473,35473,35473,33424,33392,33392,33392,33392,33391,31343,31311,31311,31311,31310,29262,29230,29230,29230,29230,27181,27181,27149,27149,27149,27149,27148,27116,25068,25068,25068,25067,25067,25067,22987,22987,22987,22987,22986,22986,22986,20938,20938,20906,20938,20905,20906,20937,20905,20905,20905,20905,20905,18857,18857,18857,18856,18888,18856,18888,18888,18888,18888,18888,18888,18888,18888,18888,18888,18888,18888,18888,18920,18920,18920,18920,18920,18920,18920,18920,18920,18920,18920,18952,18952,21000,21000,21000,21000,58430,21032,21032,21032,21032,21032,21000,21000,21032,21000,21032,21000,21032,21032,21000,21000,21000,21000,21000,21032,21000,21032,21032,21000,21033,21033,21001,21033,21033,21033,23081,21001,23082}, {52153,52121,52153,52121,50072,50072,50040,50040,47991,47991,47991,47959,47959,45910,45910,45878,45878,45878,43829,43797,43797,43797,43796,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,58430,21032,21032,21032,21032,21032,21032,21032,21032,21032,21032,21032,21032,21000,21032,21032,21032,21032,21032,21032,21032,21032,21032,21033,21033,21033,21033,23081,23081,23081,23081,23081,23081}, {52153,52153,52121,52120,50072,50072,50040,50040,47991,47991,47959,47959,47958,45910,45878,45878,45878,45877,43829,43797,43797,43797,43796,41748,41716,41716,41716,39667,39635,39635,39635,39635,37586,37554,37554,37554,37553,35505,35473,35473,35473,35472,33392,33392,33392,33392,33391,31343,31311,31311,31311,31311,29230,29230,29230,29230,29230,27149,27181,27149,27149,27149,27149,27148,27148,25068,25068,25068,25068,25067,25067,23019,22987,22987,22987,22987,22986,22986,20938,20938,20906,20938,20906,20938,20905,20905,20905,20905,20905,18857,20905,18857,18857,18857,18888,18856,18888,18888,18888,18888,18888,18888,18888,18888,18888,18888,18888,18920,18920,18920,18920,18920,18920,18920,18920,18920,18920,18952,18952,18952,18952,18952,21000,21000,21000,21000,21032,21032,21032,21032,21032,21032,21032,21032,21032,21064,21032,21032,21032,21032,21032,21032,21032,21032,21032,21032,21032,21032,21032,21032,21032,21033,21033,21033,23081,21033,23081,23081,23113,23082}, {52153,52121,52121,50072,50072,50040,50040,50040,47991,47959,47991,47959,45910,45878,45878,45878,45878,43829,43829,43797,43797,43797,41748,41716,41716,41716,39667,39667,39635,39635,39635,37586,37554,37554,37554,37554,35506,35505,35473,35473,35473,33424,33424,33392,33392,33392,31343,31343,31311,31311,31311,31310,29262,29230,29230,29230,29229,27181,27149,27149,27149,27149,27149,27148,25068,25068,25068,25068,25068,25067,25067,22987,22987,22987,22987,22987,22986,22986,20938,20938,20938,20938,20938,20905,20937,20905,20905,20905,20905,20905,18857,18857,18857,18857,18888,18856,18888,18856,18888,18888,18888,18888,18888,18888,18888,18888,18920,18920,18920,18920,18920,18920,18920,18920,18920,18920,18952,18952,18952,21000,18952,21000,21000,21000,21000,21032,21032,21032,21032,21032,21032,21032,21064,21032,21064,21032,21064,21032,21064,21064,21032,21032,21032,21032,21032,21032,21032,21032,21032,21033,21033,21033,21033,21033,21033,23081,23081,23113,23081,23082}, {52153,52121,52120,50072,50040,50040,50040,47991,47991,47991,47959,47959,45910,45910,45910,45878,45878,43829,43797,43797,43797,43796,41748,41748,41716,41716,39635,39635,39635,39635,37587,37554,37586,37554,37554,37554,35505,35505,35473,35473,35473,33424,33392,33392,33392,33392,33391,31311,31311,31311,31311,31310,29230,29230,29230,29230,29230,27181,27149,27149,27149,27149,27149,25068,25100,25068,25068,25068,25068,25067,22987,23019,22987,22987,22987,22987,22986,22986,22986,20938,20906,20938,20906,20906,20905,20905,20905,20937,20905,20937,18857,18857,18857,18857,18856,18888,18888,18888,18888,18888,18888,18888,18888,18920,18920,18920,18920,18920,18920,20968,18920,18920,18920,20968,18920,18952,18952,21000,18952,18952,21000,21000,21000,21000,21032,21032,21032,21032,21032,21064,21064,21064,21064,23112,21064,21064,21064,21064,21064,21064,21064,21064,21064,21064,21064,21064,21064,21064,21033,23113,21065,23113,23113,23113,23081,23113,23113,23113,23081,23081}, {52121,52121,50073,50072,50072,50040,47992,47991,47991,47959,47959,45911,45910,45878,45878,45878,43829,43797,43829,43797,43797,41716,41748,41716,41716,39668,39667,39635,39635,39635,39635,37586,37554,37554,37554,35505,35505,35473,35473,35473,35473,33424,33392,33392,33392,33391,31311,31311,31311,31311,31310,29262,29230,29230,29230,29230,29229,27149,27149,27149,27149,27149,27149,27148,25068,25068,25068,25068,25067,25067,22987,22987,22987,22987,22987,22987,22986,22986,20938,20938,20938,20938,20937,20905,20905,20905,20905,20905,20905,18857,20905,18857,18889,18888,18888,18888,18888,18888,18888,18888,18888,18888,18888,20936,18920,18920,18920,18920,18920,18920,18920,18920,20968,18920,18952,18952,21000,21000,21000,21000,21000,21000,21032,21032,21032,21032,21032,21032,21032,21032,21064,21064,23112,23112,23112,23112,23112,23144,23112,21064,23112,21064,21065,21064,23112,21064,21064,21065,23113,21065,23113,23113,23113,23113,23113,23113,23113,23113,23114,23114}, {52121,52121,50072,50072,50072,50040,47991,47991,47991,47959,47959,45910,45910,45878,45878,45878,43829,43797,43797,43797,43797,41748,41716,41716,41716,39667,39635,39635,39635,39635,37586,37554,37554,37554,37553,35505,35505,35505,35473,35473,33424,33424,33392,33392,33392,31343,31343,31343,31311,31311,31310,29230,29262,29230,29230,29229,27181,27149,27149,27149,27149,27149,27148,25100,25068,25068,25068,25068,25067,25067,22987,22987,22987,22987,22987,22986,22986,22986,20938,20938,20938,20906,20906,20905,20905,20905,20905,20905,20905,20905,20905,18857,18889,18857,18888,18888,18888,18888,18888,18888,18888,18888,18888,20936,18920,18920,20968,20968,18920,18920,18920,21000,21000,18952,21000,21000,21000,21000,21000,21000,21000,21032,21000,21000,21032,21032,21032,21032,21032,21064,21064,21064,21064,23112,23112,23145,23144,23112,23112,23112,23112,21064,23112,23112,23113,23112,23113,23112,23145,23113,23113,23113,23113,23113,23113,23113,23113,23113,23114,23113}, {52121,52121,50072,50040,50040,50040,47991,47991,47959,47959,47959,45910,45910,45878,45878,45878,43797,43797,43797,43797,41748,41748,41716,41716,41716,39667,39635,39635,39635,39634,37586,37554,37554,37554,37554,35505,35505,35473,35473,35473,33424,33392,33392,33392,33392,33391,31311,31311,31311,31311,29262,29262,29230,29230,29230,29230,27181,27149,27149,27149,27149,27148,27148,25068,25068,25068,25068,25068,25067,23019,22987,23019,22987,22987,22987,22986,22986,22986,20938,20938,20906,20906,20938,20905,20905,20905,20905,20937,20905,20905,18857,18857,18889,18888,18888,18888,18888,18888,18888,18888,18888,18888,18920,20968,18920,20968,20968,18920,20968,20968,18952,21000,18920,21000,18952,21000,21000,21000,21000,21032,21000,21032,21032,21032,21032,21032,21032,21064,21064,21064,21064,21064,23112,23145,23144,23144,23144,23145,23145,23145,23145,23144,23145,23144,23112,23145,23145,23145,23145,23145,23145,23145,23113,23145,23113,23113,23113,23113,23113,23146}, {52121,50073,50072,50040,50040,50040,47991,47991,47959,47959,45910,45910,45878,45878,45878,43829,43797,43797,43797,43797,41748,41716,41716,41716,39667,39667,39635,39635,39635,37586,37586,37554,37554,37554,35505,35505,35473,35473,35473,35472,33424,33424,33392,33392,33392,31343,31311,31311,31311,31311,29262,29230,29230,29230,29230,29229,27149,27149,27149,27149,27149,27148,27148,25068,25068,25068,25068,25067,25067,25035,22987,22987,22987,22987,22986,22986,22986,22986,20938,20906,20906,20938,20905,20905,20905,20905,20905,20937,18857,20937,18889,18889,18857,18888,18888,18888,18888,18888,18888,18888,18888,18888,18920,18920,20968,20968,20968,20968,20968,20968,21000,21000,21000,21000,21000,21000,21000,21000,21000,21032,21000,21032,21032,21032,21032,21032,21064,21064,21064,21064,21064,23112,23112,23144,23144,23144,23145,23177,23144,23145,23145,23145,23145,23145,23145,23145,23145,23145,23145,23145,23145,23145,23113,23145,23145,23145,23113,23145,25194,23114}, {52121,50072,50072,50040,50040,47991,47991,47959,47959,47958,45910,45910,45878,45878,45878,43829,43797,43797,43797,43796,41748,41748,41716,41716,39668,39635,39635,39635,39635,37586,37554,37554,37554,35505,35505,35505,35473,35473,35473,33424,33392,33392,33392,33392,31343,31343,31311,31311,31311,31310,29262,29230,29230,29230,29230,29229,27149,27149,27149,27149,27149,27148,25100,25068,25068,25068,25068,25068,25067,23019,23019,22987,22987,22986,22987,22986,20938,20938,20938,20938,20938,20938,20906,20937,20937,20937,20905,20905,20905,20905,20905,18857,18889,18888,18889,18888,18888,18888,18888,18888,20936,18920,20968,20968,20968,20968,20968,20968,21000,21000,21000,21000,21000,21000,21000,21000,21032,21032,21032,21000,21032,21032,21032,21032,21064,21064,21064,21064,21064,21064,23112,23112,23144,23144,23144,23145,23145,23177,23177,23177,23145,23177,23177,23145,23145,23145,23145,23177,25193,23145,23145,23145,23145,23145,23145,23145,25194,25194,25194,25194}, {50073,50072,50072,50040,47992,47991,47991,47959,47959,45910,45910,45910,45878,45878,45878,43829,43797,43797,43797,41748,41748,41716,41716,41715,39667,39667,39635,39635,37586,37586,37554,37554,37554,37554,35505,35473,35473,35473,35473,33424,33424,33392,33392,33392,31343,31311,31311,31311,31311,31310,29230,29230,29230,29230,29230,27181,27149,27149,27149,27149,27149,25100,25068,25068,25068,25068,25067,25067,23019,22987,22987,22987,22987,22987,22987,22986,22986,22986,20938,20938,20938,20906,20937,20905,20937,20905,20905,20937,20905,18889,18889,18889,18889,18888,18888,18888,18889,18888,18888,18888,18888,18888,20968,20968,20968,20968,20968,21000,21000,21000,21000,21000,21000,21000,21000,21000,21032,21032,21032,21032,21032,21032,21032,21032,21032,21032,21064,21064,21064,23112,23144,23144,23144,23144,23145,23177,23177,23177,23177,25225,23177,25225,23177,23177,25225,23177,23177,23177,23177,23177,25225,23177,23177,23145,25193,23145,23145,23145,23145,25194}, {50072,50072,50072,50040,50039,47991,47991,47959,47959,47958,45878,45878,45878,45878,43829,43829,43797,43797,43797,41716,41716,41716,41716,39667,39635,39635,39635,39635,37586,37586,37586,37554,37554,35505,35505,35505,35473,35473,35472,33424,33392,33392,33392,33392,31343,31311,31311,31311,31310,29262,29262,29230,29230,29230,29229,27181,27149,27149,27149,27149,27149,27148,25100,25068,25068,25068,25068,25067,25067,22987,22987,22987,22987,22986,22986,22986,20938,20938,20938,20938,20906,20938,20937,20905,20937,20905,20905,18857,20905,20905,18889,20937,18889,18888,18889,18888,18888,18888,18888,20936,20968,20968,20968,20968,20968,20968,20968,21000,21000,21000,21000,21000,21000,21000,21000,21000,21032,21032,21032,21032,21032,21032,21032,21032,21064,21064,21064,23112,21064,23112,23144,23144,23144,23144,23144,23177,23177,25225,23177,25225,25257,25225,25225,25225,23177,25225,25257,25225,25225,23177,25225,23177,25225,25225,23177,25226,25226,25225,25226,25226}, {50072,50072,50040,50040,47991,47991,47991,47959,47959,45910,45910,45910,45878,45878,43829,43797,43797,43797,43797,41716,41748,41716,41716,58430,58430,58430,39635,39635,58430,58430,58430,37554,37554,58430,58430,58430,58430,35473,33425,58430,58430,58430,33392,33391,58430,58430,58430,31311,31310,29262,58430,29230,29230,58430,29229,58430,58430,58430,58430,27149,58430,25100,25068,25068,58430,25068,25067,58430,58430,22987,23019,22987,22987,58430,58430,58430,58430,58430,20938,20938,58430,58430,20937,20937,20937,20905,58430,58430,58430,18889,20937,58430,58430,58430,58430,18888,18888,58430,58430,58430,18920,58430,58430,58430,58430,58430,21000,21000,58430,58430,21000,21000,58430,58430,58430,21032,21032,58430,58430,58430,58430,58430,21032,21064,21064,21064,58430,21064,23144,23144,23144,23144,23144,23177,23177,23177,23177,23177,25225,25257,25257,25257,25257,25257,25257,25225,25257,25225,25257,25225,25225,25257,25225,25257,25226,25226,25226,25226,25226,25226}, {50072,50040,50040,50040,47991,47991,47991,47959,47958,45910,45878,45878,45878,45877,43829,43797,43797,43797,41748,41748,41716,41716,41715,58430,39635,39635,58430,37586,58430,37554,37554,58430,37554,58430,35473,35473,35473,35473,58430,33424,33392,33392,33392,58430,31311,31311,31311,31311,31311,29262,58430,29230,58430,29230,27181,58430,27149,27149,27149,27149,58430,25100,25068,25068,58430,25068,58430,25067,23019,58430,22987,22987,22987,22986,22986,58430,20938,20938,20938,58430,20938,20937,58430,20937,20937,20937,58430,20937,18889,58430,18857,58430,18889,18888,18888,18888,58430,18888,18888,20968,20968,20968,20968,58430,20968,20968,21000,58430,21000,21000,58430,21000,58430,21000,21032,58430,21032,21032,21032,58430,21032,21032,21032,21064,21064,21064,58430,23112,23144,23144,23144,23145,23145,23177,23177,23177,25225,25225,25225,25257,25257,25257,25257,25257,25257,25257,25257,25257,25257,25258,25257,25257,25257,25258,25225,25226,25226,25226,25226,25226}, {50072,50040,50040,47991,47991,47991,47959,47959,45910,45910,45878,45878,45878,43829,43829,43797,43797,43797,41748,41716,41716,41716,41715,58430,58430,58430,39635,37586,58430,58430,58430,37554,35505,58430,58430,58430,35473,35473,33424,58430,58430,33392,33392,31343,58430,58430,31311,31311,31310,29262,58430,58430,29230,29229,27149,58430,58430,58430,27149,27149,27148,58430,58430,58430,25068,25068,58430,23019,22987,58430,22987,22987,22987,22986,22986,58430,20938,20938,20938,58430,20938,20937,58430,20905,20905,20905,58430,58430,58430,20937,20937,58430,58430,58430,18888,18888,18888,58430,58430,18920,20968,20968,20968,58430,20968,21000,21000,58430,58430,58430,58430,21000,58430,58430,58430,21032,21032,21032,21032,58430,21032,21064,21064,21064,23112,23144,58430,23112,23144,23144,23176,23144,23144,23177,23177,23177,25225,25257,25257,25257,25257,25257,25289,25289,25258,25290,25257,25258,25257,25258,25258,25258,25258,25258,25258,25258,25258,25258,25258,25226}, {50072,50040,50040,47991,47991,47991,47959,47958,45910,45910,45878,45878,45878,43829,43829,43797,43797,41748,41748,41716,41716,41716,39667,58430,39635,39635,39635,37587,58430,37554,58430,37554,35505,58430,35505,35473,35473,33424,33424,33424,33392,58430,31343,31343,31311,31311,58430,31310,29262,29262,58430,29230,58430,29229,27181,58430,27149,27149,27149,27149,25100,25068,58430,25068,25068,25068,58430,25067,23019,58430,22987,22987,22987,22986,22986,58430,22986,20938,20938,58430,20938,20937,58430,20937,20937,20937,58430,20937,58430,18889,18889,58430,18889,18889,18889,18888,20936,18888,20968,58430,18920,20968,20968,58430,20968,21000,21000,58430,21000,21000,58430,21000,58430,21032,58430,21032,21032,21032,21032,58430,21064,21064,21064,23112,21064,23112,23144,23144,23144,23144,23145,23177,23177,23177,23177,25257,25257,25257,25257,25257,25257,25257,25290,25290,27338,25258,25290,27338,27338,27338,25258,25258,27338,25258,25258,27306,25258,25258,25258,25258}, {50040,50040,47991,47991,47959,47959,47959,47958,45910,45878,45878,45878,43829,43829,43797,43797,43797,41748,41748,41716,41716,39668,39667,58430,39635,39635,39635,37554,58430,37554,37554,58430,35505,58430,58430,58430,58430,33424,58430,58430,58430,33392,33391,58430,58430,58430,31311,31310,29262,29262,58430,29230,29230,58430,27181,58430,58430,58430,58430,27148,27148,25068,58430,25068,25068,25068,25067,58430,58430,22987,22987,22987,22987,22986,22986,58430,20938,20938,20938,20938,58430,58430,20937,20937,20937,20937,58430,20937,20937,58430,20937,58430,58430,58430,58430,20936,58430,58430,58430,20968,20968,20968,20968,58430,20968,21000,21000,58430,21000,21000,58430,21032,58430,21032,21032,58430,21032,21032,21064,58430,21064,21064,23112,23112,23112,23144,58430,23144,23145,23144,23144,23177,23177,23177,23177,25257,25257,25257,25257,25257,25257,25290,27338,27338,27338,27370,27338,27370,27338,27338,27338,27338,25258,27338,27338,27306,27306,27306,27306,27306}, {50040,50040,47991,47991,47991,47959,47958,45910,45910,45910,45878,45878,43829,43829,43797,43797,41749,41748,41716,41716,41716,41715,39667,39635,39635,39635,37586,37586,37554,37554,37554,35505,35505,35505,35473,35473,35473,33424,33392,33392,33392,33391,31343,31311,31311,31311,31311,29262,29230,29262,29230,29230,29229,27181,27149,27149,27149,27149,27149,27148,25100,25100,25068,25068,25068,25067,25067,22987,23019,22987,22987,22986,22987,22986,22986,22986,20938,20938,20938,20938,20938,20937,20937,20905,20937,20905,20937,20937,20937,20937,18889,20937,18889,20937,18888,18888,20936,20968,18920,18920,20968,20968,20968,20968,20968,21000,21000,21000,21000,21000,21032,21032,21032,21032,21032,21032,21032,21032,21064,23112,23112,23112,23112,23112,23144,23144,23144,23144,23176,23176,23177,23177,25225,25225,25225,25257,25257,25257,25257,25257,25257,25289,27338,27338,27338,27370,27370,27338,27370,27338,27338,27370,27338,27338,27338,27338,27338,27338,27306,27338}, {50040,50039,47991,47991,47991,47959,47958,45910,45910,45878,45878,43829,43829,43797,43797,43797,41748,41748,41716,41716,41716,39667,39667,39635,39635,39634,37586,37554,37554,37554,35506,35505,35505,35505,35473,35473,33424,33424,33392,33392,33392,33391,31343,31343,31311,31311,31311,29262,29262,29230,29230,29230,29229,27181,27181,27149,27149,27149,27148,27148,25100,25068,25068,25068,25068,25067,25067,23019,23019,22987,22987,22987,22986,22986,22986,20938,20938,20938,20938,20938,20938,20937,20937,20937,20937,20937,20937,20937,20937,20937,20937,20937,20937,18888,18889,20937,20936,20968,20968,20968,18920,20968,20968,20968,20968,21000,21000,21000,21000,21000,21032,21032,21032,21032,21032,21064,23112,23112,21064,21064,23112,23112,23144,23144,23144,23144,23145,23145,23176,23177,23177,23177,25225,25225,25257,25257,25257,25257,25289,25289,27337,27338,27338,27338,27370,27370,27402,27402,27370,27370,27370,27370,27370,27338,27370,27370,27338,27338,27339,27338}, {50040,47991,47991,47959,47959,47959,45910,45910,45910,45878,45878,43830,43829,43797,43797,43797,41749,41748,41716,41716,39667,39635,39635,39635,39635,39635,37586,37554,37554,37554,37553,35505,35505,35473,35473,35473,33424,33424,33392,33392,33392,33391,31343,31343,31311,31311,31310,31310,29230,29230,29230,29230,27181,27149,27149,27149,27149,27149,27149,27148,25100,25068,25068,25068,25068,25067,25067,23019,22987,22987,22987,22986,22986,22986,22986,20938,20938,20938,20938,20938,20938,20937,20937,20937,20937,20937,20937,20937,20937,20937,20937,20937,20937,20937,20936,18888,20936,20936,20968,18920,20968,20968,20968,20968,21000,21000,21000,21000,21000,21032,21032,21032,21032,21032,21064,21032,21064,21064,23112,23112,23112,23145,23145,23144,23144,23145,23177,23144,23177,23177,23177,23177,25225,25257,25257,25257,25257,25257,25289,25289,27338,27370,27370,27370,27370,27370,27402,27403,27402,27370,27370,27370,27370,27371,29419,27370,27370,27371,27371,27338}, {50040,47991,47991,47991,47959,47958,45910,45910,45910,45878,45878,43829,43797,43797,43797,43796,41748,41716,41716,41716,41715,39667,39635,39635,39635,37586,37586,37554,37554,37554,35505,35505,35473,35473,35473,35473,33424,33424,33392,33392,33392,31343,31343,31311,31311,31311,29262,29262,29230,29230,29230,29229,29229,27181,27149,27181,27149,27149,27148,25100,25068,25068,25068,25068,25068,25067,25067,23019,23019,23019,22987,22987,22986,22986,22986,22986,20938,20938,20938,20938,20937,20937,20937,20937,20937,20937,20937,20937,20937,20937,20937,18889,20937,18888,20936,20968,18888,20968,20968,20968,20968,20968,20968,20968,21000,21000,21000,21000,21000,21000,21032,21032,21032,21032,23112,23112,23112,23112,23112,23144,23144,23145,23144,23145,23145,23144,23145,23177,23177,23177,25225,25257,25257,25257,25257,25257,25289,25257,27337,27338,27338,27370,27370,27370,27370,27370,27402,29450,29483,29451,29451,29451,27403,29451,29451,29451,29419,27371,27371,27371}, {50039,47991,47991,47959,47959,45910,45910,45910,45878,45878,45877,43829,43829,43797,43797,41748,41748,41748,41716,41716,39667,39667,39635,39635,39635,37586,37554,37554,37554,37554,35505,35505,35473,35473,35473,35472,33424,33392,33392,33392,33391,31343,31311,31311,31311,31311,31310,29230,29230,29230,29230,29229,27181,27181,27149,27149,27149,27149,27148,25100,25100,25068,25068,25068,25067,25067,23019,23019,23019,22987,22987,22987,22986,22986,22986,20938,20938,20938,20938,20938,20937,20938,20937,20937,20937,20937,20937,20937,20937,20937,20937,20937,20937,20937,20936,20968,20936,20968,20968,20968,20968,20968,20968,20968,21000,21000,21000,21000,21032,21032,21032,21032,21032,23113,23112,23112,23113,23112,23112,23112,23145,23145,23144,23177,23177,23145,23177,23177,23177,25225,25257,25257,25257,25257,25257,25257,25257,25289,27337,27338,27370,27370,27370,27370,27370,27402,29450,29450,29451,29483,29483,29451,29451,29451,29451,29451,29451,29451,29419,29451}, {47991,47991,47991,47959,45911,45910,45910,45910,45878,45878,43829,43829,43797,43797,43796,41748,41748,41716,41716,41716,39667,39635,39635,39635,39634,37586,37554,37554,37554,35506,35505,35473,35473,35473,35473,33424,33424,33424,33392,33392,33391,31343,31311,31311,31311,31311,29262,29262,29230,29230,29230,29229,27181,27181,27149,27149,27149,27149,25100,25100,25068,25068,25068,25068,25067,25067,23019,23019,23019,23019,22987,22987,22986,22986,22986,20938,20938,20938,20938,20938,20938,20937,20937,20937,20937,20937,20937,20937,20937,20937,20937,20937,20937,20937,20936,20937,20968,20968,20968,20968,20968,21000,20968,21000,21000,21000,21000,21000,21000,21032,21032,21032,21032,23112,23113,23113,23113,23112,23145,23145,23145,23145,23145,23177,23177,23177,23177,25225,25225,25257,25257,25257,25257,25289,25257,25289,25289,27338,27338,27370,27370,27370,27370,27370,27402,29450,27402,29483,29483,29483,29483,29483,29483,29483,29451,29483,29451,29451,29451,29451}, {47991,47991,47959,47959,47958,45910,45910,45878,45878,45878,43829,43797,43829,43797,43797,41748,41748,41716,41716,41715,39667,39635,39635,39635,37586,37586,37554,37554,37554,37553,35505,35505,35473,35473,35473,33424,33424,33392,33392,33392,33391,31343,31311,31311,31311,31311,29262,29230,29230,29230,29230,29229,27181,27181,27149,27149,27149,27148,27148,25100,25068,25068,25068,25068,25067,25067,23019,23019,23019,22987,22987,22986,22986,22986,20938,20938,20938,20938,20938,20937,20937,20937,20937,20937,20937,20937,20937,20937,20937,20937,20937,20937,20937,20937,20936,20969,18888,20969,20968,20968,20968,20968,20968,21000,21000,21000,21000,21000,21032,21032,21032,21032,23112,23113,23113,23113,23113,23145,23145,23145,23145,23177,23177,23177,23177,23177,25225,25257,25225,25257,25257,25257,25257,25257,25289,25289,27337,27338,27370,27370,27370,27370,27402,27402,29450,29451,29451,29483,29483,29483,29483,31563,31531,31563,29483,29483,29483,29451,29451,29451}, {47991,47991,47991,47959,45910,45910,45910,45878,45878,45877,43829,43797,43797,43797,41748,41748,41716,41716,41715,39667,39635,39635,39635,58430,58430,58430,37554,37554,58430,58430,58430,35505,35473,58430,58430,58430,58430,33392,33392,58430,58430,58430,31311,31311,58430,58430,58430,29262,29230,29230,58430,27181,27181,58430,27149,58430,58430,58430,58430,25100,58430,25068,25068,25067,58430,23019,23019,58430,22987,22987,23019,22986,58430,58430,58430,58430,58430,20938,20938,58430,58430,20937,20937,20937,20937,58430,20937,20937,20937,58430,20937,20969,58430,58430,20936,20936,58430,58430,58430,20968,58430,20968,21000,58430,21000,21000,21000,58430,58430,58430,21032,21032,21032,58430,58430,23145,23145,23145,58430,58430,23145,23145,58430,58430,58430,58430,25225,25257,25257,25257,25257,25257,25257,25289,25289,25289,27338,27338,27370,27370,27370,27370,27402,29450,29450,29482,29482,29483,29483,31563,31563,31563,31563,31563,31563,31564,29483,31531,29483,29483}, {47991,47991,47959,47959,45910,45910,45910,45878,45878,43829,43829,43797,43797,43797,41748,41716,41716,41716,41716,39667,39635,39635,39635,58430,37586,37586,58430,37554,58430,35505,35505,58430,35473,58430,35472,33424,33424,33392,58430,33392,31343,31343,31311,58430,31311,29262,29262,29230,29230,29230,58430,29229,58430,27149,27149,58430,27149,27149,27148,25100,58430,25068,25068,25068,58430,23019,58430,58430,23019,23019,22986,22987,22986,22986,58430,20938,20938,20938,58430,20938,20937,58430,20937,20937,20937,58430,58430,20937,58430,58430,20937,58430,20969,20969,58430,20968,20969,58430,20968,20968,58430,58430,21000,58430,21000,21000,21000,58430,21032,21032,58430,21032,58430,23113,23113,58430,23145,58430,23145,23145,23145,23177,58430,23177,25225,25257,25257,25257,25257,25257,25257,25289,25289,27337,25289,27338,27370,27370,27370,27370,27402,27402,27402,29450,29483,29483,29483,29483,29483,31563,31563,31563,31596,31596,31595,31564,31564,31563,29515,31531}, {47991,47959,47959,45910,45910,45910,45878,45878,45877,43829,43829,43797,43797,43797,41748,41748,41716,41716,39667,39635,39635,39635,39635,58430,58430,58430,37554,37554,58430,58430,58430,35473,35473,58430,58430,58430,33392,33392,33392,58430,58430,31343,31311,31311,58430,58430,29262,29230,29230,29230,58430,58430,27181,27149,27149,58430,58430,58430,25100,25068,25068,58430,58430,58430,25067,23019,23019,58430,22987,23019,22986,22986,22986,20938,58430,20938,20938,20938,58430,20938,20937,58430,20937,20937,20937,58430,20937,58430,20937,58430,20937,58430,58430,58430,58430,20969,20968,58430,20968,20968,58430,20968,58430,58430,21000,21000,21000,58430,58430,58430,21033,21032,58430,58430,58430,58430,23145,58430,23145,58430,58430,25225,58430,58430,58430,25257,25257,25257,25257,25257,25257,25257,25257,27337,27338,27338,27370,27370,27370,27402,27402,29450,29450,29450,29482,29483,29483,29515,29515,31563,31563,31595,31596,31596,31596,31596,31564,31563,31564,31564}, {47991,47959,47959,47958,45910,45910,45878,45878,43829,43829,43829,43797,43797,43796,41748,41716,41716,41716,39667,39667,39635,39635,39635,58430,37586,37554,37554,37554,58430,35505,58430,35473,35473,58430,33424,33424,33392,33392,33392,31343,31343,58430,31311,31311,31310,29262,58430,29230,29230,29230,58430,27181,58430,27149,27149,58430,27149,27148,25100,25100,25068,25068,58430,25067,25067,23019,23019,58430,23019,23019,22986,22987,22986,22986,58430,20938,20938,20938,58430,20938,20937,58430,20937,20937,20937,58430,20937,20937,20937,58430,20937,58430,20937,20937,58430,20968,20968,58430,20968,20968,58430,21001,21000,58430,21000,21000,21000,58430,21032,21032,21033,23081,58430,23113,23113,58430,23145,58430,25225,23177,58430,23177,58430,25225,25257,25257,25257,25257,25257,25257,25289,25289,27338,27370,27370,27370,27370,27370,27370,27402,27402,29482,29482,29483,29483,29483,29515,29515,31563,31563,31595,31564,31596,31596,31596,31596,33644,31596,31564,31564}, {47991,47959,47959,45910,45910,45878,45878,45878,43830,43797,43829,43797,43797,41748,41748,41748,41716,39667,39667,39667,39635,39635,39635,58430,37586,37554,37554,37554,58430,35505,35473,58430,35473,58430,58430,58430,58430,33392,58430,58430,58430,31311,31311,58430,58430,58430,29262,29262,29230,29229,58430,27181,27181,58430,27149,58430,58430,58430,58430,25100,25068,25068,58430,25067,25067,23019,58430,58430,58430,22987,23019,22986,22986,22986,58430,20938,20938,20938,20938,58430,58430,20937,20937,20937,20937,58430,20937,20937,20937,58430,20937,58430,20937,20969,58430,20968,58430,58430,58430,20968,58430,20968,21000,58430,21001,21000,21032,58430,21032,21032,21032,23113,58430,23113,23145,58430,23145,23177,58430,58430,23177,25257,58430,58430,58430,58430,25257,25257,25289,25289,27337,27338,25289,27338,27370,27370,27370,27370,27402,27402,29482,29450,29482,29483,29483,29483,31563,31563,31563,31595,31596,31596,31596,33676,33676,33676,33676,33676,31596,31596}, {47991,47959,45911,45910,45910,45878,45878,45877,43829,43829,43797,43797,43797,41748,41748,41716,41716,39668,39667,39667,39635,39635,37586,37586,37554,37554,37554,37553,35505,35505,35505,35473,35473,33424,33424,33392,33392,33392,33391,31343,31343,31311,31311,31311,31310,29262,29262,29230,29230,29230,27181,27181,27149,27149,27149,27149,27148,27148,25100,25100,25068,25068,25068,25067,25067,23019,23019,22987,22987,22987,22986,22986,22986,22986,20938,20938,20938,20938,20938,20937,20937,20937,20937,20937,20937,20937,20937,20937,20937,20937,20937,20969,20969,20968,20969,20969,20968,20969,20968,20968,20968,21000,21000,21000,21000,21000,21000,21032,21032,21032,21065,23113,23112,23113,23113,23145,23145,23177,23177,25225,25225,25257,25257,25257,25257,25257,25257,25257,27337,25289,27338,27338,27370,27370,27370,27370,27402,27402,27402,27402,29482,29482,29483,29483,29483,31563,31563,31595,31563,31595,31596,31596,33676,33676,33676,33676,33676,33676,33676,33644}, {47959,47959,45910,45910,45878,45878,45878,43829,43829,43829,43797,43797,43796,41748,41748,41716,41716,39667,39667,39635,39635,39635,39634,37586,37554,37554,37554,35505,35505,35505,35473,35473,35473,33424,33392,33424,33392,33392,31343,31343,31343,31343,31311,31311,31310,29262,29230,29230,29230,27181,27181,27181,27181,27149,27149,27149,27148,25100,25100,25068,25068,25068,25068,25067,25067,23019,23019,23019,22987,23019,22987,22986,22986,22986,20938,20938,20938,20938,20938,20938,20937,20937,20937,20937,20937,20937,20937,20937,20937,20969,20937,20937,20937,20969,20969,20968,20969,20969,20968,20968,20968,21000,21000,21000,21000,21032,21033,21033,21033,21033,21065,23113,23113,23113,23145,23145,23145,23177,25225,25225,25225,25257,25257,25257,25257,25257,25257,25289,27338,27337,27337,27370,27370,27370,27370,27370,27402,27434,29450,29482,29482,29483,29483,29515,29515,31563,31595,31595,31595,31596,33676,33676,33676,33676,33676,33676,33676,33708,33676,33676}, {47959,47959,45910,45910,45910,45878,45878,45878,43829,43797,43797,43797,41748,41748,41716,41716,41716,39667,39667,39635,39635,39635,37586,37586,37554,37554,37554,35505,35505,35505,35505,35473,35472,33424,33424,33424,33392,33392,31343,31343,31343,31311,31311,31310,29262,29262,29230,29230,29230,29230,27181,27181,27149,27149,27149,27149,27148,25100,25100,25068,25068,25068,25067,25067,25067,23019,23019,23019,23019,22987,23018,22986,22986,22986,22986,20938,20938,20938,20938,20937,20937,20937,20937,20937,20937,20937,20937,20937,20937,20937,20969,20937,20969,20969,20969,20969,20969,20968,20969,20968,21001,21000,21000,21001,21000,21000,21000,21033,21033,21033,21033,23112,23113,23113,23145,23145,23145,23177,25225,25257,25257,25257,25257,25257,25257,27338,25289,27338,27338,27338,27370,27370,27370,27370,27402,27402,27402,27402,29482,29482,29483,29483,29483,29515,31595,31563,31595,31595,31596,31596,33676,33676,33676,33676,33708,33676,33708,33709,33709,33676}, {47959,47958,45910,45910,45878,45878,45878,43829,43829,43797,43797,43797,41748,41748,41716,41716,39667,39667,39667,39635,39635,37587,37586,37554,37554,37554,37553,35505,35505,35473,35473,35473,35472,33424,33424,33392,33392,33391,31343,31343,31311,31311,31311,31310,29262,29262,29262,29230,29230,27181,27181,27149,27149,27181,27149,27149,27148,25100,25100,25100,25068,25068,25067,25067,25067,23019,23019,23019,22987,22987,22986,22986,22986,22986,20938,20938,20938,20938,20938,20938,20937,20937,20937,20937,20937,20969,20937,20937,20937,20937,20937,20969,20969,20969,20969,20969,20968,20968,20969,20968,21000,20968,21000,21000,21001,21033,21000,21033,21032,21033,23113,23113,23113,23113,23145,23145,23145,23177,23177,25225,25257,25257,25257,25257,25289,25290,25290,27338,27370,27370,27370,27370,27370,27370,27402,29450,29450,29482,29482,29482,29482,29483,31563,31563,31595,31563,31595,31595,31596,33676,31628,33676,33676,33708,33708,33708,33708,33709,33708,33709}, {47959,45910,45910,45910,45878,45878,43830,43829,43829,43829,43797,41748,41748,41716,41748,41716,39667,39667,39667,39635,39635,39634,37586,37586,37554,37554,37554,35505,35505,35505,35473,35473,33424,33424,33424,33392,33392,33392,31343,31343,31311,31343,31311,29262,29262,29262,29262,29230,29230,27181,27181,27181,27149,27149,27149,27149,27148,25100,25100,25068,25068,25068,25067,25067,23019,23019,23019,23019,23019,23019,22986,22986,22986,22986,20938,20938,20938,20938,20938,20937,20937,20937,20937,20937,20937,20937,20937,20937,20937,20969,20969,20969,20969,20969,20969,20969,20969,20969,20968,20969,21000,21001,21000,21000,21001,21032,21033,21032,21033,21033,23113,23113,23113,23145,23145,23145,23177,25225,25225,25257,25257,25257,25258,25258,25289,27338,27338,27338,27370,27370,27370,27402,27402,27402,27402,27402,29450,29482,29482,29483,29483,29515,31595,31563,31595,31595,31595,31627,33676,33676,33676,33708,33708,33708,33708,33709,33708,35789,33708,33676}, {47959,45910,45910,45878,45878,45877,43829,43829,43797,43797,43797,41749,41748,41748,41716,41716,39667,39667,39635,39635,39635,37586,37586,37554,37554,35505,35505,35505,35505,35473,35505,35473,33424,33424,33424,33392,33392,31343,31343,31343,31311,31311,31311,31310,29262,29262,29230,29230,29230,29229,27181,27181,27149,27149,27149,27148,27148,25100,25100,25100,25068,25068,25067,25067,25067,23019,23019,23019,23019,22986,23018,23018,22986,22986,22986,20938,20938,20938,20938,20938,20938,20937,20937,20937,20937,20937,20937,20937,20937,20937,20969,20969,20969,20969,20969,20969,20969,20969,20969,21000,21001,21000,21001,21001,21000,21032,21033,21033,21033,23113,23113,23113,23113,23145,23145,23145,23145,23177,25225,25257,25257,25257,27338,27338,27338,27338,27370,27370,27370,27370,27370,27402,29450,27402,29450,29482,29482,29483,29483,29515,29515,31563,31563,31595,31595,31595,31628,33676,31628,33676,33708,33708,33708,33708,33708,33708,35757,33708,33741,33709}, {45910,45910,45910,45878,45910,45878,43829,43829,43797,43797,43796,41748,41748,41716,41716,41716,39667,39667,39635,39635,39635,37586,37554,37554,37554,37554,35505,35505,35505,35505,35473,35473,33424,33424,33392,33392,33392,31343,31343,31311,31311,31311,31310,29262,29262,29230,29230,29230,29230,27181,27181,27149,27181,27149,27149,27149,25100,25100,25100,25100,25068,25068,25067,25067,23019,23019,23019,23019,23019,23019,23018,22986,22986,20938,22986,20938,20938,20938,20938,20938,20938,20937,20937,20937,20937,20937,20937,20937,20937,20969,20937,20969,20969,20969,20969,20969,20968,20969,20969,21001,21001,21001,21001,21001,21001,21033,21033,21033,21033,21065,23113,23113,23113,23145,23145,23145,25225,25225,25225,25257,25257,25258,25290,27338,27338,27370,27370,27370,27370,27370,27370,27402,27402,29450,29482,29482,29483,29483,29515,29515,29515,31563,31595,31595,31595,31628,33676,33676,33708,33708,33708,33708,33708,33708,33708,35788,35789,35757,35757,33709}, {45910,45910,45910,45878,45878,45877,43829,43829,43829,43797,43796,41748,41748,41716,41716,39667,39667,39667,39635,39635,37587,37586,37586,37586,37554,37554,35505,35505,35505,35473,35473,33424,33424,33424,33392,33392,33392,31343,31343,31343,31343,31311,31310,29262,29262,29230,29230,29230,29229,27181,27181,27181,27149,27149,27149,27148,25100,25100,25068,25068,25068,25068,25067,23019,25067,23019,23019,23019,22987,23018,22986,23018,23018,22986,22986,20938,20938,20938,20970,20937,20937,20937,20937,20937,20937,20969,20937,20969,20969,20969,20937,20969,20969,20969,20969,20969,20969,21001,21000,21001,21001,21000,21001,21000,21033,21033,21033,21033,21033,23113,23113,23113,23113,23145,23145,23145,23177,25225,25225,25257,25258,25258,27338,27338,27370,27370,27370,27370,27402,27402,27402,29450,29450,29482,29482,29482,29515,29515,29515,31563,31563,31595,31595,31595,31595,33676,33676,33708,33676,33708,33708,33740,35756,35788,35789,35789,35789,35757,33708,33708}, {45910,45910,45910,45878,45878,43830,43829,43829,43797,43797,41748,41748,41748,41716,41716,39667,39667,39635,39667,39635,37586,37586,37586,37554,37554,35505,35505,35505,35505,35505,35473,33424,33424,33424,33392,33392,33392,31343,31343,31311,31311,31311,31310,29262,29262,29230,29230,29230,29229,27181,27181,27149,27149,27149,27149,27148,25100,25100,25100,25100,25068,25067,25067,25067,23019,23019,23019,23019,23019,23019,23018,22986,22986,22986,22986,20970,20970,20938,20938,20938,20937,20937,20937,20937,20937,20937,20969,20937,20937,20937,20969,20969,20969,20969,20969,20969,20969,20969,21001,21001,21001,21001,21001,21001,21033,21033,21033,21033,23113,23113,23113,23113,23145,23145,23145,23145,25225,25225,25257,25257,25257,25258,27338,27338,27370,27370,27402,27402,27402,27402,27402,29450,29482,29483,29483,29515,29515,29547,31563,31595,31595,31595,31596,31595,33676,31628,33708,33708,33708,33708,33740,33740,33708,35789,35789,35789,35789,35789,35789,33709}, {45910,45910,45910,45878,45878,43829,43829,43797,43797,41748,41748,41748,41716,41716,39667,39667,39667,39635,39635,39635,37586,37586,37554,37554,37554,35505,35505,35505,35505,35473,35473,33424,33424,33392,33392,33392,33391,31343,31311,31311,31311,31311,31310,29262,29262,29230,29230,29230,29229,27181,27181,27149,27181,27149,27149,27148,25100,25100,25100,25068,25100,25068,25067,25067,23019,23019,23019,23019,23019,23018,22986,22986,23018,20938,22986,20938,20938,20938,20938,20938,20938,20937,20937,20937,20969,20937,20937,20937,20969,20969,20969,20937,20969,20969,20969,20969,20969,20969,21001,21001,21001,21000,21001,21033,21033,21033,23081,23081,23081,23113,23113,23145,23145,23145,23145,23145,25225,25225,25257,25257,25258,27338,27338,27338,27370,27370,27370,27402,27402,29450,29482,29482,29483,29483,29483,31563,29515,29515,31595,31595,31595,31595,31627,33676,33676,33708,33708,33708,33740,33740,35788,35788,35788,35789,35789,35789,35789,35789,35789,35756}, {45910,45910,45878,45878,43829,43829,43829,43829,43797,43797,41748,41716,41748,41716,39668,39667,39635,39635,39635,39635,37586,37586,37554,37554,37554,35505,35505,35505,35505,35473,35473,33424,33424,33424,33392,33392,31343,31343,31343,31343,31311,31311,29262,29262,29262,29230,29230,29230,27181,27181,27181,27181,27149,27149,27149,27148,25100,25100,25100,25068,25068,25067,25067,23019,23019,23019,23019,23019,23019,23019,23018,23018,22986,22986,23018,20938,20970,20938,20938,20970,20937,20937,20937,20937,20937,20969,20969,20969,20969,20969,20969,20969,20969,20969,20969,20969,20969,21001,21001,21001,21001,21001,21001,21033,21001,21033,21033,21033,23113,23113,23113,23145,23113,23145,23145,23177,25225,25225,25257,25258,25258,25290,27338,27370,27370,27370,27402,29450,29450,29482,29482,29483,29483,29515,29515,29515,31563,31595,31595,31595,31595,31627,33676,33676,33676,33708,33708,33708,33740,35788,35789,35821,35789,35821,35789,35789,35789,35789,35789,35789}, {45910,45910,45910,45878,43829,43829,43829,43797,43797,41749,41748,41748,41716,41716,39667,39667,39667,39635,39635,39635,37586,37586,37554,37554,35505,35505,35505,35505,35473,35473,35472,33424,33424,33424,33392,33391,31343,31343,31343,31311,31311,31311,29262,29262,29262,29230,29230,29230,27181,27181,27181,27149,27149,27149,27148,27148,25100,25100,25100,25100,25068,25067,25067,23019,23019,23019,23019,23019,23019,22987,23018,23018,23018,23018,20938,20970,23018,20938,20938,20938,20937,20937,20937,20937,20937,20969,20969,20969,20937,20969,20969,20969,20969,20969,20969,20969,20969,21001,21001,21001,21001,21001,21001,21033,21033,21033,21033,23113,23113,23113,23113,23113,23145,23145,23145,25225,25225,25225,25257,25258,25258,27338,27338,27370,27370,27370,29450,27402,29450,29483,29483,29483,29483,29515,31563,31563,31595,31595,31595,31627,31628,33676,33676,33676,33708,33708,33708,33740,33740,35788,35788,35821,35789,35789,35821,35821,35789,35789,35789,35789}, {45910,45878,45878,45878,43829,43829,43829,43797,43797,41748,41748,41748,41716,41715,39667,39667,39667,39635,39635,39634,37586,37586,37554,37554,35506,35505,35505,35505,35505,35473,33425,33424,33424,33392,33392,33392,31343,31343,31343,31311,31311,31310,29262,29262,29262,29262,29230,27181,27181,27181,27181,27181,27181,27149,27148,27148,25100,25100,25100,25068,25100,25068,25067,23019,23019,23019,23019,23019,23019,23018,23018,23018,22986,23018,22986,20970,20938,20970,20970,20970,20937,20937,20969,20969,20969,20969,20937,20969,20969,20969,20969,20969,20969,20969,20969,20969,21001,20969,21001,21001,21001,21033,21033,21001,21033,21033,23081,21065,23113,23113,23145,23145,23145,23145,23177,25225,25225,25257,25257,25258,25290,27338,27338,27370,27370,27402,29451,29451,29483,29482,29483,29483,31563,31563,31595,31563,31595,31595,31628,31627,31628,33676,33708,33708,33708,33740,33740,35788,35821,35821,35789,35821,35821,35821,35821,35821,35821,35789,35789,35789}, {45910,45878,45878,45878,43829,43829,43797,43797,41748,41748,41748,41748,41716,41716,39667,39667,39667,39635,37586,37586,37586,37554,37554,37554,35505,35505,35505,35505,35473,35473,33424,33424,33424,33392,33392,33392,31343,31343,31343,31311,31311,29262,29262,29262,29230,29230,29230,27181,27181,27181,27181,27149,27149,27149,27148,25100,25100,25100,25100,25100,25068,25067,23019,25067,23019,23019,23019,23019,23019,23019,23018,23018,23018,23018,23018,23018,20938,20938,20938,20970,20938,20938,20937,20969,20969,20969,20937,20969,20969,20969,20969,20969,20969,20969,20969,20969,21001,21001,21001,21001,21001,21001,21033,21033,21033,21033,23081,23113,23113,23113,23113,23145,23145,23145,23145,25225,25225,25258,25258,25258,27338,27338,27338,27370,27370,27402,27402,29483,29483,29483,29483,29515,29515,31563,31595,31595,31595,31595,31628,33676,33676,33708,33708,33740,33740,33740,33740,35789,35820,35821,35821,35821,35821,35821,35821,35821,35789,35789,35789,35789}, {45910,45878,45878,45878,43829,43829,43797,43797,41748,41748,41716,41716,41716,41715,39667,39667,39635,39635,39635,37586,37586,37554,37554,35505,35505,35505,35505,35505,35473,35472,33424,33424,33424,33392,33392,33391,31343,31343,31311,31311,31310,31310,29262,29262,29262,29230,29230,29229,27181,27181,27181,27149,27149,27149,27148,25100,25100,25100,25100,25100,25068,25067,25099,25067,23019,23019,23019,23019,23019,23018,23018,23018,23018,23018,20938,20938,20970,20970,20938,20938,20937,20969,20969,20937,20969,20969,20969,20969,20969,20969,20969,20969,20969,20969,21001,20969,21001,21001,21001,21001,21001,21001,21033,21033,21033,23081,23081,23113,23113,23113,23113,23145,23145,23177,25225,25225,25225,25257,25258,25258,27338,27338,27338,27370,27370,29450,29483,29483,29483,29515,29515,31563,31563,31563,31595,31595,31595,33676,33676,33708,33708,33708,33708,33740,33740,35788,35821,35789,35821,35821,35821,35821,35821,35821,35821,35821,35821,35821,35821,35789}, {45910,45910,43830,43829,43829,43829,43829,43797,41749,41748,41748,41748,41716,39667,39667,39667,39667,39635,39634,37586,37586,37554,37554,37554,35505,35505,35505,35505,35473,35473,33424,33424,33424,33424,33392,31343,31343,31343,31343,31311,31311,29262,29262,29262,29230,29230,29230,29229,27181,27181,27181,27149,27149,27149,27148,27148,25100,25100,25100,25100,25068,25068,25067,23019,23019,23019,23019,23019,23019,23019,23018,23018,23018,23018,23018,23018,20970,20970,20938,20970,20970,20937,20969,20969,20969,20969,20969,20969,20969,20969,20969,20969,20969,20969,20969,21001,21001,21001,21001,21001,21001,21033,21033,21033,21033,21033,23113,23113,23113,23113,23145,23145,23145,23177,25225,25225,25257,25258,25258,27338,27338,27338,27370,27370,27370,29451,29451,29483,29515,31563,31563,31563,31595,31595,31596,31628,31628,33676,33676,33708,33708,33708,33708,35788,35788,35789,35821,35821,35821,35821,35821,37901,35821,35853,35821,35821,35821,35821,35789,35789}, {45910,45878,45877,43829,43829,43829,43829,41748,41748,41748,41748,41716,39668,39667,39667,39667,39635,39635,37587,37586,37586,37586,37554,35505,35505,35505,35505,35505,35473,33424,33424,33424,33424,33392,33392,31343,31343,31343,31343,31311,31311,29262,29262,29262,29230,29262,29230,27181,27181,27181,27181,27181,27149,27149,27148,25100,25100,25100,25068,25100,25068,25067,25067,25067,23019,23019,23019,23019,23019,23019,23018,23018,23018,23018,23018,20970,20970,20970,20970,20970,20970,20969,20969,20969,20969,20969,20969,20969,20969,20969,20969,20969,20969,20969,20969,21001,21001,21001,21001,21001,21001,21033,21033,21033,23081,23081,23113,23113,23113,23145,23145,23145,23145,23177,25225,25225,25258,25258,25258,25290,25290,27338,27338,27370,27402,29451,29451,29483,29515,31563,31563,31595,31595,31596,31628,31627,33676,33676,33676,33708,33740,33740,35788,35788,35821,35821,35821,35821,35821,35853,35821,35853,35853,37901,35821,35821,35821,35821,35789,35789}, {45910,45878,45877,43829,43829,43797,43797,41748,41748,41748,41748,41716,39668,39667,39667,39667,39635,39635,37586,37586,37554,37554,37554,37554,35505,35505,35505,35473,35473,33424,33424,33424,33424,33392,33392,31343,31343,31343,31311,31311,31311,29262,29262,29262,29262,29230,27181,27181,27181,27181,27181,27149,27149,27149,27148,27148,25100,25100,25100,25100,25100,25099,25067,23019,23019,23019,23019,23019,23019,23019,23018,23018,23018,23018,23018,20970,20970,20970,20970,20970,20938,20969,20969,20969,20969,20969,20969,20969,20969,20969,20969,20969,20969,21001,21001,21001,21001,21001,21001,21001,21001,21033,21033,23081,21033,23113,23113,23113,23113,23145,23145,23145,23145,25225,25225,25225,25258,25258,25258,27306,27338,27338,27370,27370,29450,29451,29483,29483,29515,31563,31595,31595,31595,31628,31627,33676,33676,33708,33708,33708,33740,33740,35788,35821,35821,35821,35821,35853,35821,35853,37901,37901,37901,37901,35821,35821,35821,35821,35821,35789}, {45910,45878,43829,43829,43829,43829,43797,43796,41748,41748,41716,41716,41716,39667,39667,39635,39635,37586,37586,37586,37586,37586,37554,35505,35505,35505,35505,35505,35473,33424,33424,33424,33424,33392,33392,31343,31343,31343,31343,31343,29262,29262,29262,29262,29230,29230,29230,27181,27181,27181,27181,27181,27149,27148,27148,25100,25100,25100,25100,25100,25068,25068,25067,25067,23019,23019,23019,23019,23019,23019,23019,23018,23018,23018,20970,20970,23018,20970,20970,20938,20970,20969,20969,20969,20969,20969,20969,20969,20969,20969,20969,20969,20969,20969,21001,21001,21001,21001,21001,21001,21033,21033,21033,23081,23081,23113,23113,23113,23113,23113,23145,23145,25225,23177,25225,25258,25258,25258,25258,25290,27338,27370,27370,27403,27402,29451,29483,29483,31563,31563,31595,31596,31628,31628,33708,33708,33708,33708,33708,35788,35788,35789,35821,35821,35821,35821,35853,35853,37901,37901,37901,37901,37901,37901,35853,35853,35821,35821,35821,35789}, {45878,45878,43829,43829,43797,43797,43797,41748,41748,41748,41748,41716,39667,39667,39667,39667,39635,37586,37586,37586,37554,37554,37554,35505,35505,35505,35505,35473,35473,33424,33424,33424,33392,33392,31343,31343,31343,31343,31311,31311,29262,29262,29262,29262,29262,29230,29229,27181,27181,27181,27181,27181,27149,27149,27148,25100,25100,25100,25100,25100,25068,25067,25067,25067,23019,23019,23019,23019,23019,23019,23018,23018,23018,23018,23018,20970,20970,20970,20970,20970,20970,20969,20969,20969,20969,20969,20969,20969,20969,20969,20969,20969,20969,21001,21001,21001,21001,21001,21001,21033,21001,21033,21033,23081,21033,23081,23113,23113,23113,23145,23145,23145,25193,25225,25225,25258,25258,25258,25258,27338,27338,27370,27370,27370,29451,29451,29483,29483,31563,31563,31595,31628,33676,33676,33676,33708,33708,33708,35788,35788,35788,35821,35821,35821,35821,35853,35853,37901,37901,37901,37933,37933,37901,37901,37901,35821,35821,35821,35821,35821}, {45878,43829,43829,43829,43829,43797,41748,41748,41748,41748,41716,41715,39667,39667,39667,39635,39635,37586,37586,37586,37554,37554,37554,35505,35505,35505,35505,35473,33424,33424,33424,33424,33424,33424,31343,31343,31343,31343,31311,31310,29262,29262,29262,29262,29230,29230,29229,27181,27181,27181,27149,27149,27149,27148,27148,25100,25100,25100,25100,25100,25100,25100,25067,25067,23019,23019,23019,23019,23019,23019,23018,23018,23018,23018,23018,23018,20970,20970,20970,20970,20970,20970,20969,20969,20969,20969,20969,20969,20969,20969,20969,20969,20969,21001,21001,21001,21001,21001,21001,21001,21033,21033,21033,23081,23081,23113,23113,23113,23113,23145,23145,23145,23145,25225,25225,25226,25258,25258,27306,27338,27370,27370,27370,27403,29451,29483,29483,29483,31563,31595,31595,31628,33676,33708,33708,33708,33740,33740,35788,35789,35821,35821,35853,35853,35853,37901,37901,37901,37901,37901,37933,37933,37933,37901,37901,35853,35853,35853,35821,35821}, {45878,45877,43829,43829,43829,43797,41748,41748,41748,41716,41716,39667,39667,39667,39667,39635,39635,37586,37586,37586,37586,37554,35505,35505,35505,35505,35505,35473,33425,33424,33424,33424,33392,33424,31343,31343,31343,31343,31311,31311,29262,29262,29262,29262,29230,29230,27181,27181,27181,27181,27181,27181,27149,27149,27148,25100,25100,25100,25100,25100,25100,25067,25099,23019,23019,23019,23019,23019,23019,23019,23018,23018,23018,23018,23018,20970,20970,20970,20970,20970,20970,20969,20969,20969,20969,20969,20969,20969,20969,20969,20969,20969,21001,20969,21001,21001,21001,21001,21001,21033,21033,21033,23081,23081,23081,23113,23113,23113,23113,23145,23145,25193,23177,25225,25226,25258,25258,25258,25290,27338,27370,27370,27370,27403,29451,29451,29483,29515,31563,31595,31596,31628,33708,33708,33708,33740,33740,33740,35821,35821,35821,35853,35853,37901,35853,37901,37933,37933,37933,37933,37933,37933,37933,37901,37901,37901,35853,35821,35821,35821}, {45878,43829,43829,43829,43797,43797,41748,41748,41748,41716,41716,39667,39667,39667,39667,39635,39635,37586,37586,37554,37586,35505,37553,35505,35505,35505,35505,35473,33424,33424,33424,33424,33392,33392,31343,31343,31343,31343,31343,31310,31310,29262,29262,29262,29262,29230,27181,27181,27181,27181,27181,27149,27181,27148,27148,25100,25100,25100,25100,25068,25099,25099,25067,23019,23019,23019,23019,23019,23019,23019,23018,23018,23018,23018,23018,23018,20970,20970,20970,20970,20970,20969,20969,20969,20969,20969,20969,20969,20969,20969,20969,20969,21001,21001,21001,21001,21001,21001,21001,21001,23049,23081,23081,23081,23113,23113,23113,23145,23145,23145,23145,25193,25226,25225,25226,25258,25258,25258,27338,27338,27338,27370,27371,29419,29451,29483,29515,29483,31563,31596,31628,31628,33676,33708,33740,33708,35789,35789,35821,35821,35821,35853,37901,37901,37901,37933,37933,37933,37933,37933,37934,37934,37901,37901,37901,37901,35853,35853,35853,35821}, {43830,43829,43829,43829,43797,43796,41748,41748,41748,41716,41716,39667,39667,39667,39667,39635,37586,37586,37586,37554,37554,37554,35505,35505,35505,35505,35505,35473,33424,33424,33424,33424,33392,33392,31343,31343,31343,31343,31343,29263,29262,29262,29262,29262,29230,29230,27181,27181,27181,27181,27181,27181,27181,27148,27148,25100,25100,25100,25100,25100,25068,25067,25067,25067,23019,23019,23019,23019,23019,23019,23018,23018,23018,23018,23018,23018,23018,20970,20970,20970,20970,20970,20970,20969,20969,20969,20969,21001,20969,20969,21001,21001,21001,21001,21001,21001,21001,21001,21033,21033,21033,23081,23081,23113,23113,23113,23113,23113,23145,23145,23145,25225,25225,25226,25258,25258,25258,25258,27338,27338,27370,27370,27403,27403,29451,29483,29483,31563,31563,31596,31628,33676,33708,33708,33741,35789,35821,35821,35821,35821,37901,37901,37901,37901,37933,37933,37933,37933,37966,37934,37934,37966,37933,37933,37933,37901,37901,35853,35821,35821}, {43829,43829,43829,43829,43797,41749,41748,41748,41748,41716,41715,39667,39667,39667,39667,39635,37586,37586,37586,37586,37554,37554,35505,35505,35505,35505,35473,35505,33424,33424,33424,33424,33392,33391,31343,31343,31343,31311,31311,31310,29262,29262,29262,29262,29262,29230,29229,27181,27181,27181,27181,27181,27149,27149,27148,25100,25100,25100,25100,25100,25100,25068,25099,23051,23019,23019,23019,23019,23019,23019,23018,23018,23018,23018,23018,23018,20970,20970,20970,20970,20970,20970,20969,20969,20969,20969,20969,20969,20969,20969,20969,21001,21001,21001,21001,21001,21001,21001,21033,23081,21033,23081,23081,23081,23113,23113,23113,23145,23145,23145,25225,25193,25225,25226,25226,25258,25258,27338,27338,27338,27370,27370,27371,29451,29483,29483,29515,31563,31563,31596,31628,33676,33708,33708,35789,35821,35821,35821,35821,35853,35853,37901,37933,37933,37933,37934,37934,37933,37966,40014,37934,37933,37934,37933,37901,37933,37901,37901,35853,35853}, {43829,43829,43829,43797,43797,41749,41748,41748,41748,41748,39668,39667,39667,39667,39667,39635,37586,37586,37586,37586,37554,37553,35505,35505,35505,35505,35473,35472,33424,33424,33424,33392,33424,31343,31343,31343,31343,31343,31311,29262,29262,29262,29262,29262,29230,29230,27181,27181,27181,27181,27181,27181,27149,27148,27148,25100,25100,25100,25100,25100,25099,25100,25067,25067,23019,23019,23019,23019,23019,23019,23018,23018,23018,23018,23018,23018,23018,23018,20970,20970,20970,20970,20969,20969,20969,20969,20969,20969,20969,21001,20969,21001,21001,21001,21001,21001,21001,21033,21033,21001,21033,23081,23081,23113,23113,23113,23113,23145,23145,25193,23145,25226,25226,25226,25258,25258,25258,27338,27338,27338,27370,27371,27371,29451,29483,29483,29515,31563,31595,31596,33676,33676,33708,33741,35789,35821,35821,35821,35853,37933,37901,37933,37933,37933,37934,37934,37966,37966,40014,40014,40014,37934,37933,37934,37901,37933,37901,37901,35853,37869}, {43829,43829,43829,43829,43797,43796,41748,41748,41748,41716,39667,39667,39667,39635,39635,37586,37586,37586,37586,37586,37554,37553,35505,35505,35505,35505,35505,35473,33424,33424,33424,33424,33392,33392,31343,31343,31343,31311,31311,31310,29262,29262,29262,29262,29262,29230,27181,27181,27181,27181,27181,27181,27149,27148,25100,25100,25100,25100,25100,25100,25100,25099,25099,25099,23019,23019,23019,23019,23019,23018,23019,23018,23018,23018,23018,23018,23018,20970,20970,20970,20970,20970,20970,20969,20970,20969,20969,20969,20969,21001,21001,21001,21001,21001,21001,21001,21001,21033,21033,21033,23081,23081,23113,23113,23113,23113,23113,23145,23145,23145,25194,25226,25226,25226,25258,25258,25258,27338,27338,27338,27370,27403,29451,29451,29483,29483,29515,31564,31596,31596,33676,33708,33708,35788,35789,35821,35853,37901,37901,37901,37933,37934,37934,37934,37966,37966,40014,40014,40014,40014,37966,37966,37934,37934,37934,37933,37901,37901,37901,37901}, {43829,43829,43829,43829,43797,41748,41748,41748,41748,41716,39667,39667,39667,39667,39667,37587,37586,37586,37586,37586,37554,35505,35505,35505,35505,35505,35473,35505,33424,33424,33424,33424,33423,31343,31343,31343,31343,31343,31343,29262,29262,29262,29262,29262,29262,29230,29229,27181,27181,27181,27181,27181,27149,27148,25100,25100,25100,25100,25100,25100,25068,25100,25099,23051,23019,23019,23051,23019,23019,23019,23018,23018,23018,23018,23018,23018,20970,20970,20970,20970,20970,20970,20969,20970,20969,20969,20969,20969,20969,21001,21001,21001,21001,21001,21001,21001,21033,21001,23081,23081,23081,23081,23113,23113,23113,23113,23113,23145,23145,23146,25226,25226,25226,25226,25258,25258,25258,27338,27338,27370,27370,27370,29451,29483,29451,29483,31563,31563,31595,31596,33676,33676,33708,35789,35821,35821,37901,37901,37901,37901,37934,37934,40014,40014,37966,40014,40014,40046,40014,40046,40014,40014,37934,37933,37933,37933,37901,37901,37901,35853}, {43829,43829,43829,43829,41748,41748,41748,41748,41748,39668,39667,39667,39667,39667,39635,39634,37586,37586,37586,37586,37553,35505,35505,35505,35505,35505,35504,33424,33424,33424,33424,33424,33392,31343,31343,31343,31343,31343,31310,31311,29262,29262,29262,29262,29262,29229,27181,27181,27181,27181,27181,27181,27149,27148,27148,25100,25100,25100,25100,25100,25100,25099,25099,25067,23019,23019,23019,23019,23019,23019,23018,23019,23018,23018,23018,23018,23018,20970,20970,20970,20970,20970,20970,20970,20969,20969,20969,20969,21001,21001,21001,21001,21001,21001,21001,21001,21033,23081,23081,23081,23081,23081,23113,23113,23113,23113,23145,23145,25193,25194,25226,25226,25226,25258,25258,27306,25258,27338,27338,27370,27371,27403,29451,29451,29483,29515,31563,31595,31596,31596,33676,33708,33708,35789,35789,35821,37901,37933,37934,37934,40014,39982,40014,40014,40014,40014,40014,40046,40014,40014,40014,40014,37966,37966,37933,37933,37933,37933,37901,37901}, {43829,43829,43829,43797,41748,41748,41748,41748,41748,39668,39667,39667,39667,39635,39667,37586,37586,37586,37586,37554,37554,35505,35505,35505,35505,35505,35505,33424,33424,33424,33424,33424,33423,31343,31343,31343,31343,31343,31310,31310,29262,29262,29262,29262,29262,29230,27213,27181,27181,27181,27181,27181,27149,27149,25100,25100,25100,25100,25100,25100,25100,25099,25099,25099,23051,23019,23019,23019,23019,23019,23018,23018,23018,23018,23018,23018,20970,23018,20970,20970,20970,20970,20970,20970,20970,20969,20969,21001,20969,21001,21001,21001,21001,21001,21001,21001,21033,23081,21033,23081,23081,23081,23081,23113,23113,23113,23145,23146,23146,25194,25226,25226,25226,25258,25258,27306,27338,27338,27338,27370,27371,29451,29451,29483,29483,29483,31563,31596,31596,31628,33676,33708,33709,35789,35789,35821,37901,37934,37934,39982,37966,40014,40014,40014,40014,40046,40046,40046,40046,40046,40014,40014,39982,40014,37966,37933,37933,37901,37901,37901}, {43829,43829,43829,43797,41748,41748,41748,41748,41716,39668,39667,39667,39667,39667,39635,37586,37586,37586,37586,37554,37553,35505,35505,35505,35505,35473,35473,33424,33424,33424,33424,33424,33423,31343,31343,31343,31343,31343,31310,29262,29262,29262,29262,29262,29262,29261,27181,27181,27181,27181,27181,27181,27180,27148,27148,25100,25100,25100,25100,25100,25100,25099,25099,25099,23051,23019,23019,23019,23019,23019,23018,23019,23018,23018,23018,23018,23018,23018,20970,23018,20970,20970,20970,20970,23017,20969,21001,20969,21001,21001,21001,21001,21001,21001,21001,23081,23081,21033,23081,23081,23081,23113,23113,23113,23113,23145,23145,23146,25194,25226,25226,25226,25258,25258,25258,25258,27338,27338,27370,27371,27403,29451,29451,29483,29483,31563,31563,31595,31596,31628,33676,33708,35789,35789,35821,35853,37901,37934,37934,40014,40014,40014,40014,40014,40046,40046,40046,40046,40046,40046,40046,40014,40014,37966,37934,37933,37934,37933,37901,37901}, {43829,43829,43829,43829,41748,41748,41748,41748,41716,41715,39667,39667,39667,39635,39635,37586,37586,37586,37586,37554,35505,35505,35505,35505,35505,35505,33456,33424,33424,33424,33424,33424,33392,31343,31343,31343,31343,31311,31343,29262,29262,29262,29262,29262,29262,29229,27181,27181,27181,27181,27181,27181,27181,27180,27148,25100,25100,25100,25100,25100,25100,25100,25099,23051,25067,23019,23051,23051,23019,23019,23018,23018,23018,23018,23018,23018,23018,23018,20970,23018,20970,20970,20970,20970,20970,21001,21001,21001,21001,23049,21001,21001,21001,21001,21001,21033,23081,23081,23081,23081,23081,23081,23113,23113,23113,23113,23146,23146,25194,25194,25226,25226,25258,25258,27306,27306,27338,27338,27370,27370,27371,29451,29451,29483,29483,31563,31564,31596,33644,33676,33708,33709,33709,35789,35821,35821,37901,37934,40014,40014,40046,40014,40046,40046,40046,40046,40078,40078,40046,40046,40046,40014,40014,40014,37966,37934,37933,37933,37933,37901}, };
-
-//pause page
-const uint16_t pausePage[120][160] = { {4261,4261,4261,4261,4261,4261,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4261,4261,4293,4293,4261,4261,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4261,4293,4293,4293,4293,4261,4261,4261,4261,4261,4293,4293,4293,4293,4261,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4261,4294,4293,4293,4293,4293,4293,4261,4293,4293,4293,4261,4262,4294,4261,4262,4293,4293,4261,4293,4293,4293,4261,4261,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4261,4293,4261,4293,4293,4261,4293,4293,4293,4261,4261,4261,4261,4261,4261,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293}, {4261,4261,4261,4261,4261,4261,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4261,4261,4261,4261,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4261,4293,4261,4261,4293,4261,4293,4261,4293,4261,4293,4262,4261,4262,4262,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4261,4293,4293,4293,4293,4261,4293,4261,4293,4293,4261,4261,4293,4261,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,2245,4261,4261,4261,4261,4261,4261,4261,4293,4261,4293,4293,4293,4293,4293,4293}, {4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4261,4293,4293,4293,4293,4261,4293,4293,4293,4293,4293,4293,4293,4293,4293,4261,4294,4293,4293,4294,4261,4293,4293,4293,4293,4261,4261,2181,4261,4262,4261,4293,4293,4293,4261,4261,4293,4293,4261,4261,4261,4261,4261,4261,4261,4261,4293,4293,4293,4293,4293,4293,4293,4293,4294,4293,4293,4293,4293,4261,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,6341,4293,4261,4293,4293,4293,4293,4293,4293}, {4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4261,4261,4293,4293,4293,4293,4293,4293,4293,4293,4261,4261,4261,4261,4261,4293,4293,4293,4293,4293,4294,2181,8520,16972,10633,2149,4293,4261,4261,4261,4293,4293,4293,4261,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4261,4326,2213,6439,12745,8519,2213,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4261,4261,4261,4261,4261,4261,6341,6341,6341,6341,4293,4293,4293,4293}, {4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4261,6374,6406,4326,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4261,4293,4293,4293,4293,4293,4293,4293,4293,4261,4293,4293,4293,4293,4293,4293,4294,4293,4293,4293,4293,4293,4293,4293,4293,4261,4293,4261,6374,6374,4293,4293,4293,4293,4293,4293,2180,8520,16972,10632,2148,4294,4293,4261,4293,4293,4293,4293,4293,4261,4261,4261,4261,4261,4261,4261,4261,4293,4293,4293,4293,4293,4293,4293,4293,4293,4261,4294,2181,6407,12745,8519,2213,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293}, {4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4261,6439,8519,6374,4261,4293,4293,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4293,4293,4293,4293,4293,4261,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4261,4293,4326,6406,4293,4293,4293,4293,4293,4293,4293,4293,4261,4293,4293,8519,8519,4293,4293,4261,4293,4293,4293,4293,4261,2181,4261,4261,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4261,4261,4261,4261,4261,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4261,4261,4261,4261,4261,4261,4261,4261,4261,4293,4261,4293,4261,4293,4261,4293,4261}, {4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4261,6406,6407,4326,4261,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4261,4261,4261,4261,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4261,4261,4293,4294,6374,4293,4293,4293,4293,4293,4293,4293,4293,4261,4293,4261,6406,6406,4261,4293,4293,4261,4293,4261,4293,4293,4261,4293,4293,4261,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4261,4293,4261,4293,4293,4261,4293,4261,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4261,4293,4261,4293,4293,4293,4293}, {4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4261,4261,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,6374,4294,4294,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4261,4293,4261,4261,4261,4261,4293,4261,4293,4293,4293,4293,4293,4293,4261,4293,4293,4293,4261,4293,4294,4326,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4261,4293,4261,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,6341,6341,6341,6341,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293}, {4293,4261,2180,4261,4261,4261,4261,4261,4261,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4294,4293,4261,4261,4293,4293,4293,6374,16971,12778,2148,4293,4293,4293,4293,4293,4293,4293,4293,4261,4261,4293,4293,4293,4261,4261,4261,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4261,4293,4293,4293,4261,4261,4293,4293,4293,4293,4293,4293,4261,4261,4294,4261,4261,4293,4293,4293,2148,8520,19084,12745,2148,4293,4293,4293,4293,4293,4261,4261,4261,4293,4293,4293,4293,4293,4261,4261,4293,4293,4293,4293,4293,4293,4293,4293,4293,4261,4261,4261,4293,4261,4261,4261,4261,4293,4293,4261,4261,4196,4228,4196,4228,4228,4228,4261,4228,2181,4229,4229,2181,4261,4261,4261,4261,4261,4261,4261,4261}, {4261,6407,10633,6406,4261,4294,4261,4293,4261,4261,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4261,4261,4293,4293,4293,4261,4261,4293,12745,10632,4261,4293,4261,4293,4293,4293,4261,4261,4293,4294,4325,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4261,4261,4261,4261,4293,4293,4261,4261,4293,4293,4293,4293,4261,4261,4293,4261,4293,4261,4261,4293,4261,4293,4261,4293,4294,2181,8487,14858,10632,2181,4293,4293,4293,4293,4293,4293,4293,4293,4293,4261,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4261,4293,4261,4293,4261,4294,4294,4261,4261,4261,10535,10567,12616,12583,10535,10535,10535,10535,8487,10535,8487,10567,10568,8455,8455,8455,8455,8487,8455,8454,6374}, {2180,10632,16972,8519,2148,4294,4261,4293,4261,4261,4261,4261,4261,4261,4261,4261,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4261,4261,4293,4293,4293,2180,2213,4261,4293,4293,4294,4261,4261,4293,4261,4293,6374,6374,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4294,4293,4293,4293,4293,4293,4261,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4261,4293,4294,4261,4293,4294,4261,2148,2148,4294,4293,4293,4293,4293,4261,4261,4261,4261,4293,4293,4293,4293,4261,4261,4261,4261,4293,4293,4293,4293,4293,4293,4293,4293,4261,4293,2181,4294,4261,4294,4262,4261,4261,4261,6309,12681,16841,16841,16809,14728,16809,14761,14761,14761,14761,14761,14761,14794,12648,12648,12648,12648,12648,12648,10536,8455}, {4261,6406,8487,6374,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4293,4293,4293,4293,4293,4293,4293,4293,6374,4326,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4261,4261,4293,4293,4293,4293,4261,4261,4293,4261,4326,4261,2181,4261,4293,4293,4294,4293,4261,4293,4293,4293,4293,4293,4261,4261,4293,4293,4261,4261,4261,4293,4261,4261,4293,4293,4293,4293,4261,4261,4293,4293,4261,4293,4293,4261,4293,4293,4261,4261,4293,4293,4261,4261,4261,4293,4261,4293,4293,4261,4293,4326,4326,4261,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4261,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4261,4261,6342,4294,4229,3,2181,4294,4261,4261,4229,14761,16841,14728,16777,14696,16776,14696,14696,14728,14696,12648,12648,12681,12648,12648,12648,12648,12648,12648,10536,8455}, {4261,4261,2148,4261,4294,4261,4293,4261,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,6374,4326,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4294,4294,4261,4293,4293,4293,4293,4294,4261,4293,4293,4261,4261,4261,4293,4293,4293,4293,4261,4293,4293,4293,4261,4261,4261,4261,4261,4261,4261,4293,4293,4293,4293,4261,4261,4261,4293,4261,4261,4261,4261,4261,4293,4293,4261,4261,4293,4293,4293,4293,4261,4261,4294,4294,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4261,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4261,4293,4294,4261,6374,12746,8487,2181,6341,6309,4229,14729,16809,14696,16744,16744,16744,16744,16776,16777,14729,12648,12616,12648,12648,12648,12616,12616,12648,12648,10535,8422}, {4261,4294,4294,4261,4261,4293,4293,4261,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4261,4293,4293,4293,4293,4293,4293,4293,4293,4293,4261,4261,4261,4261,4293,6406,8519,4294,4293,4261,4293,4293,4261,4294,4293,4261,4293,4293,4293,4293,4293,4261,4261,4293,4261,4261,4293,4293,4293,4293,4294,4293,4293,4261,4261,4261,4261,4261,4261,4293,4293,4261,4261,4261,4261,4293,4293,4293,4294,4261,4261,4261,4261,4293,4261,4293,4261,4261,4261,4261,4293,4293,4261,4293,4293,4293,4293,4293,4293,4293,4293,4261,4293,4293,4293,4293,4293,4293,4261,4293,4293,4293,4293,4293,4293,4293,4293,4261,4261,4294,35,12746,27537,16972,3,6342,6309,4228,14728,16809,16776,16776,16744,16744,16744,16776,16776,14728,12648,12616,12648,12648,12648,10568,10568,10568,10568,10535,8422}, {4293,4261,4261,4293,4293,4293,4261,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4261,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4261,4293,6374,6374,4293,4293,4293,4325,4293,4293,4293,4293,4293,4293,4294,4293,4293,4261,4294,4294,4293,4293,4293,4294,4293,4261,4261,4293,4261,4293,4294,4293,4293,4293,4293,4294,4261,4293,4294,4293,4293,4294,4293,4261,4261,4261,4261,6341,6373,4293,4293,4293,4261,4293,6342,4293,4261,4293,4293,4261,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4261,4293,4293,4294,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,2181,8488,16972,10633,2149,6342,6309,6276,14696,16809,16776,16776,16744,14696,16776,16776,14696,12648,12648,12648,12648,10600,10600,10568,10568,10568,10568,8487,8422}, {4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4261,4293,4293,6374,8487,8519,6439,8487,8487,8487,8487,8487,8519,6374,4293,4293,4261,4261,4293,4293,4294,6374,8487,8487,8487,8487,8487,6406,4294,4261,4293,4293,6374,8487,8487,8487,8487,8519,8520,4293,6374,8487,8487,8487,8487,6374,4261,4293,4261,4293,8487,10599,8486,8486,8487,8487,8520,8520,6374,4261,4261,4261,4294,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,6439,6374,4293,4261,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4261,6374,2213,3,2181,4294,4293,6341,6309,12648,14728,16776,16776,16744,16776,16776,14728,14696,12616,12648,12648,12648,10568,10600,10568,10568,10568,10600,8487,6374}, {4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4294,4293,4261,4261,4294,4294,4293,4293,4261,4293,4261,4294,4261,4294,4261,4293,4293,4293,4293,4293,4293,4293,4293,4293,4261,4293,6341,2,2,1,2,1,1,33,1,1,1,2,8454,6341,4261,4261,4261,4293,6373,34,2,2,1,1,1,2,4260,6341,4260,6373,1,34,2,2,1,1,0,4261,2,33,1,1,33,1,6341,6340,6340,8485,0,0,1,2,3,0,1,1,34,8422,6309,6309,4196,2,2,2,1,34,1,2,1,2,2,1,2082,6373,4292,4261,4293,4261,4261,4293,4293,4261,4293,4261,4262,4261,4261,4228,4228,4229,4229,4229,4197,4196,6244,6276,12583,16777,14696,14729,14729,14696,14696,12616,12616,12616,10568,10568,10568,10568,10568,10568,10568,10568,10568,8455,6374}, {4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4261,4293,4293,4293,4293,4293,4293,4261,4294,4293,4294,4261,4261,4294,4261,4261,4293,4293,4293,4293,4293,4293,4293,4294,4261,4293,6373,2115,16938,35955,33842,35922,35922,35922,35922,35922,33841,35954,23277,2,6374,4261,4293,6341,6405,2,27503,35955,33842,33874,33874,35922,31697,4195,4228,8453,34,23244,35955,33875,35923,33842,40147,40180,6374,21197,35922,33874,33841,35954,23245,34,8453,6340,1,40180,42325,33874,33842,35923,35921,38067,44407,21132,35,6342,2116,10600,33842,35923,33842,33874,33842,35922,35890,35922,33842,35923,35922,16938,2,6373,4293,4293,4261,4261,4293,4293,4261,4293,4261,6310,4228,8454,10568,10567,10535,10536,10536,10535,12583,12583,12583,14728,16809,16777,16809,16777,14729,14729,14729,14729,12681,12681,12681,12681,12681,12681,10633,12681,12681,12681,10600,8487}, {4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4326,4261,4293,4293,4293,4261,4261,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4325,4293,8486,2,27471,55004,52859,54939,54940,54940,52859,54940,54972,55004,35955,3,4229,2115,6373,4260,8518,1,44406,55004,52924,52859,52891,55005,46553,2,6341,8519,1,35987,55004,52892,52892,52859,59230,63422,10567,35923,54972,52891,52859,57052,38035,2,10567,4195,1,61310,65535,54939,54940,52892,52827,59198,65535,31729,3,10567,3,16907,50779,54972,52860,52892,52892,54972,52891,52859,54972,52891,54939,27503,1,8486,4261,4293,4261,4261,4293,4293,4293,4293,4261,6310,6211,12583,16841,18889,16841,16841,16841,16809,18889,18889,16809,18857,18857,16809,18889,16809,16842,16810,14794,14794,14794,14827,14794,14827,14827,14827,14827,14827,14827,14826,12713,10600}, {4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,6374,6406,12745,10632,4261,4294,4294,4293,4326,4261,4293,4293,4293,4293,4293,4293,4293,4293,4293,4228,8454,2,25390,52859,52827,52826,50779,50779,50779,52827,50747,50747,48634,46489,42295,31762,2,8486,4260,33,40148,52891,50779,52859,50779,52859,46488,3,8486,12680,2,33842,52891,50779,52860,50779,57085,59197,8487,33810,52892,50779,52827,52859,35890,2,2,31696,48600,54939,52892,52827,50779,52859,50779,52892,54973,48666,40214,67,34,14858,50747,50812,50779,50779,52860,50779,52859,52859,50779,52827,52859,27438,2,6406,4261,4261,4261,4261,4293,4261,4293,4293,4261,6342,16743,18857,18889,18856,16776,18824,18857,18857,18824,18824,16744,16776,16744,16744,16777,16777,14761,14729,12649,12681,12681,12681,12681,12681,10633,10633,10601,10601,10601,10600,8520,8455}, {4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4294,4293,4293,4293,4293,4293,6374,6406,12745,10632,4261,4326,4294,4293,6374,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,6341,8454,35,25423,52859,52859,52827,50779,52860,50779,52860,52860,50780,52828,52892,50747,38068,1,4259,19018,29583,46520,52859,50779,50811,50779,52892,46521,3,8454,12712,34,33842,52924,50811,52860,50779,57117,59197,8486,33810,54940,50747,50747,52892,35890,1,1,35922,54972,52827,50747,52859,50746,52827,52828,50779,50779,52892,46585,6373,67,14857,50747,50779,50812,50812,50779,50779,50779,52859,50779,50779,52859,27438,2,6406,4261,4261,4261,4261,4293,4261,4293,4293,4261,6342,18824,18856,18824,18856,18857,18856,18824,18824,18824,18824,16744,16744,16744,14696,16777,14729,14729,14697,12616,12616,12616,12648,12648,10568,10600,10568,10568,10536,10568,10568,10535,8422}, {4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4294,4293,4294,4294,4293,4293,4293,4326,4261,4293,4293,4293,4261,4293,4293,4326,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,6374,2,25390,52891,52859,50779,52892,50811,50746,52860,52860,52860,52828,50779,52892,42294,1,33,33841,65535,59198,50714,52860,50779,50779,52892,46521,35,6374,8486,1,33874,52892,50779,50779,50747,57117,59198,8486,33842,52892,52828,52827,54940,33874,1,1,33809,52891,52827,52860,50779,54940,52891,52827,52892,50779,52891,46519,1,34,16938,50746,52859,52860,52860,52860,52892,52892,52892,52924,52891,54972,27503,2,8486,4293,4294,4261,4261,4293,4293,4293,4293,4261,6342,18824,20905,20904,20872,18824,18824,18824,18824,18824,18792,16712,16744,16744,14696,14697,14729,14729,14697,12648,12648,12648,12648,12649,12649,10568,10568,10536,10536,10568,10568,10535,8422}, {4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4294,4294,4294,4294,4294,4294,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,6374,4293,4293,4325,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,6373,4260,8486,35,25423,52891,50811,50811,50778,55036,59230,42326,38068,50811,50811,50779,52891,42294,1,1,27535,59197,52891,52859,50779,52859,52827,54940,46488,2,2115,10566,1,35922,52859,52827,52860,52795,59165,59197,8518,33842,52892,52860,52860,54940,33842,6340,50745,50778,52859,50779,50779,52892,42294,33874,50778,50778,50778,52859,50778,52890,33841,6341,50746,52891,50779,50779,50714,33842,35955,35923,33842,33875,35955,16971,35,6374,4293,6342,6342,6342,4293,4293,4325,4293,4261,8422,18824,20905,20905,18824,18824,18824,18824,18825,18825,18824,16777,16777,16809,16810,14762,14762,14762,14762,14762,14762,12714,12714,12714,12714,12714,12682,12682,12682,12714,12681,10600,10535}, {4293,4293,4293,4293,4293,4293,4293,4325,4293,4293,4294,4294,4294,4294,4294,4294,4293,4293,4293,4293,4293,4325,4325,4293,4293,4293,4293,4293,6374,4293,4325,4293,4294,4294,4293,4293,4293,4293,4293,4293,6373,4293,8486,2,27503,52891,50779,50811,50778,55069,63487,29648,21196,52891,50811,50811,52892,40214,34,1,25422,50778,50779,50779,52859,52859,50778,52859,48601,16938,12680,10534,1,35922,54940,50779,52827,52795,59165,59197,8486,33842,54972,50747,50779,54972,31761,12712,63455,61343,50746,50779,52859,52892,31761,2,52826,52859,52858,50778,54971,65535,42326,34,50746,52891,50778,54972,46488,2,2,2,2,2,2,2148,8454,4293,4293,4294,6342,6342,4326,4293,4325,4293,6309,8422,18825,18825,18824,18825,18857,18825,18824,18825,18824,18825,18857,16809,16810,16842,14795,14795,14795,14795,14795,14795,14795,14795,14795,14795,14795,14795,14795,14795,14795,14794,12681,10568}, {4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4294,4294,4294,4294,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4325,4293,4326,4294,4293,4293,4325,4293,4293,4293,4293,4293,8486,2,27503,52859,50779,52859,50746,57117,65535,25389,16937,52891,52858,50779,52892,42294,2,2,27503,52891,50811,50779,52859,50779,52859,50746,54940,65503,42262,1,1,35922,52891,52859,52827,52827,57117,59197,10599,31794,52892,50779,52859,52892,33874,2147,40213,46552,52859,52859,50779,52924,31761,4260,59197,61342,61310,61310,61343,65535,42326,2,50746,52859,52826,54939,46520,1,2,2,8486,10599,10567,6406,4261,4293,4293,4293,6342,6341,6374,4293,4325,4261,6309,8390,18824,18857,18857,18857,18825,18857,18857,18825,18825,18857,16809,16810,16810,14795,14795,14795,14795,12747,14795,14795,14795,14827,12747,12747,14795,14795,14827,12747,14795,14795,12681,10569}, {4293,4293,4293,4293,4293,4293,4293,4293,4325,4293,4293,4293,4294,4294,4294,4294,4293,4293,4325,4325,4325,4325,4325,4325,4293,4325,4325,4293,4293,4293,4293,4293,4294,4293,4293,4325,4325,4293,4293,4293,4293,4293,8486,2,27503,52859,52859,52860,50778,57084,63455,46551,42325,52890,52858,50779,54940,42262,2,2148,27471,52891,50811,52860,52859,52892,50779,52859,52859,63423,40181,2,2,35955,52891,52827,52827,52795,57085,59197,12712,33842,54972,50779,50779,54940,33875,35,27536,40214,52859,52859,50779,52892,42294,35955,61342,57084,48632,46520,50714,52827,33810,10600,50746,52859,52859,50778,50713,38068,40148,38035,25357,19019,10567,8454,4261,6374,4294,4261,6342,6342,4294,4293,4326,4293,8422,10502,16808,16808,18857,18857,18857,18857,18856,18824,16809,16777,16809,16809,14762,14762,12714,12714,12747,12747,14827,12714,12714,12714,12714,12714,12714,12714,12714,12714,12714,12714,10601,8488}, {4293,4293,4293,4293,4293,4293,4293,4293,4325,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4325,4293,4293,4293,4293,4325,4293,4293,4325,4325,4325,4325,4293,4293,4325,4325,4325,4293,4293,4293,4293,6406,35,27503,52859,52859,52859,52795,57086,63423,65535,63423,50746,52859,52859,54908,42295,35,35,25391,52827,52859,50779,52859,52859,52859,52859,50746,52827,35923,35,34,35923,52892,52827,52828,50779,57052,57085,12713,33842,52892,52827,52827,54940,33875,2083,2,33842,52859,50778,52859,50779,52892,52892,63422,50744,1,2082,2,2,2084,19020,50747,52859,52859,50746,52826,59230,59198,57117,38035,27503,12680,8454,4293,4325,4293,6341,6341,6342,4293,4293,4325,4293,10535,14696,16808,16808,18856,18857,16808,16776,16776,16776,16744,14696,14696,14696,14729,12649,10601,10601,14795,12747,12746,10601,8520,10568,8488,10568,10568,10536,10568,10536,10568,10568,8455,6342}, {4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4325,4325,4293,4293,4293,4293,4325,4293,4293,6374,6406,6438,6406,6406,6406,6406,4325,4293,4293,4293,4293,4325,4325,4325,4325,4325,4325,4293,4293,4325,4293,8454,2148,27471,52826,52794,50746,50747,52827,54940,52826,54907,52794,52794,50714,54908,42263,2,50714,57052,50746,50714,52827,61311,55005,48665,52827,50747,52860,35891,4228,4260,35923,52859,50714,50747,50747,54972,57052,14793,33843,52827,50714,50746,52859,35891,6341,3,42262,63423,52826,50746,50714,50746,50714,52858,54971,57084,29616,3,18987,12648,19052,50714,52827,50746,50746,50746,52826,50746,52826,59165,46487,2082,10600,6373,4261,4293,6374,6341,6342,4293,4326,4325,4260,12615,16809,18856,18856,16808,18856,16808,16776,16744,16744,16776,16776,16776,16777,14729,12648,12648,10601,14827,14795,14827,12746,12714,14794,14794,14794,14794,14794,14794,14762,14794,14794,12649,10568}, {4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4325,4293,4293,4325,6374,4326,6374,4326,4326,6374,6439,8487,6439,8487,8487,6407,6406,6374,6374,6374,6374,4293,4293,4293,4293,4294,4294,4294,4293,4293,4293,8454,6341,29551,52794,52762,52762,50714,52762,50681,50713,50713,52762,50714,50682,48569,38004,2,59101,61278,52762,52762,52762,57085,57052,52794,50713,50714,54875,35891,12615,8454,35922,52827,50714,52795,50714,57020,57084,16874,35890,52826,50714,52762,52794,35891,10503,4196,40117,59101,54907,52794,52794,50714,52794,50680,57019,63391,40084,23212,16874,14761,21100,48601,52794,50714,50746,52794,50713,50681,52762,65439,52761,2050,10600,6373,6341,4293,6341,6309,6342,4293,6374,4326,6309,14696,18889,18856,18856,18856,18856,18824,16776,16744,16744,16744,16776,16776,14696,12648,12648,10600,10568,12747,12747,12747,12714,12714,12746,12746,12714,12746,12714,14794,12714,12714,12714,10601,8488}, {4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4325,4293,4293,6374,6406,8487,8487,8487,6439,8487,8487,8487,6407,6407,6439,6439,6407,6439,8487,8487,6439,4293,6341,4325,4293,4293,4294,4294,4294,4293,6341,8454,10535,29584,52794,52762,52762,52794,52762,52761,52761,50681,54874,52794,52762,23148,16808,16808,54874,59100,52729,54842,52762,35857,42196,52826,52762,52762,54843,35890,4131,14695,35890,54874,52762,52794,52729,56987,59099,21034,35858,54874,52762,52762,54842,37939,12582,21067,16809,6243,59132,63358,52761,54874,52762,52762,52729,50681,54842,48536,16873,16841,23180,50681,52762,52762,52761,52794,54874,54874,54842,65439,52761,4163,14793,4293,6374,4293,6341,6341,6342,4293,6406,6407,8422,14728,18857,18856,18824,18824,18824,16776,16744,16744,16744,16744,16776,16776,14696,12648,12648,12648,10568,12747,12779,14827,10633,8520,8520,8520,10568,10568,10568,10568,10568,10568,10568,8487,6374}, {4293,4293,4293,4293,4293,4293,4293,4293,4325,4293,4293,6374,6374,6406,6406,6438,6406,6407,6407,6439,6439,6439,6439,6439,6439,8487,8487,8487,8487,8487,8487,6439,6374,6406,6374,6341,4294,4294,4294,4294,4293,6341,8422,12616,31600,52730,52729,52729,48599,54906,57051,59132,54906,42228,42196,37938,23147,21066,18920,50615,54841,52728,52697,50616,27405,40083,52728,52728,52696,52729,46390,40051,21001,37938,52761,52697,52697,52664,56954,59066,23147,35857,52761,50648,52696,54809,40018,16776,23114,21034,18921,42131,44309,35857,46422,52729,52697,52697,52729,52761,46390,16808,18953,27341,50648,52697,52697,52697,50584,37970,40018,40018,46389,37970,16873,10567,4228,6374,6341,6341,6341,6374,6374,6439,8487,8454,16776,18856,18824,18825,18825,18825,16744,16744,16744,16744,16744,16777,14728,14696,12648,10600,10600,10568,12714,12747,12746,10601,10568,10568,10568,10600,10568,10568,10568,10568,10600,10600,8487,8422}, {4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,4293,6406,6438,6438,6406,6406,6439,6407,6407,6407,6406,6406,6406,6407,6407,6439,6439,6407,6439,8487,8487,8487,8486,8486,8454,6374,4326,4294,4294,4294,6341,6341,8422,12648,29551,50617,50616,50616,48599,54906,63325,61212,54906,33744,25292,16776,23179,23146,23113,46389,52696,50583,52664,52665,25259,37937,52728,50615,52664,50584,52697,52697,23146,37905,52696,50616,52664,50615,56889,56920,23147,37905,52728,50615,52664,52696,37937,18888,25227,25227,27340,21033,21001,18888,42163,52696,50584,52664,50616,52696,48470,29421,25227,27308,50583,52696,50616,52729,46357,16776,18888,20969,14630,18921,23180,12680,6341,4293,6341,6341,6341,6374,6439,8487,6439,8422,14696,18856,18824,18825,18825,16744,16744,16744,16745,16745,16777,14728,14696,12648,12648,10568,10568,10600,14795,14795,14794,10633,10568,10600,10568,10568,10568,10568,10568,10568,10568,10568,8486,8422}, {4293,4293,4293,6341,4326,4294,4294,4294,6341,6374,6406,8454,6438,6438,6438,6438,8454,8454,8454,8454,8454,8454,8454,8454,6406,6406,6406,6406,6406,6406,8454,8454,6407,6407,6407,6407,8455,8455,6374,4293,4293,4292,6341,16840,31599,52696,50647,50647,52663,54808,63260,37937,25195,27308,27276,25195,25194,25162,23081,48437,54776,52664,52663,54744,52631,52599,52663,54711,54710,52630,59034,61083,25194,37872,54744,54711,54679,54712,58904,61049,27339,39953,54744,52664,52632,54777,39985,25161,33614,44146,52663,52631,52631,52696,39985,29420,52599,52664,52696,52663,54775,63195,44210,25194,52664,54712,54680,54712,50486,25162,27242,27242,27274,27209,27242,27242,21066,4228,6374,8487,8454,8487,6439,8487,8455,8390,14696,16841,18857,18857,18856,16776,16744,16776,16776,14696,14728,14696,12648,12648,12648,10568,10568,10568,12746,14795,14794,12681,12648,12648,10568,10568,10568,10568,10568,10568,10568,10568,8487,8422}, {4293,4293,4293,4293,4293,4294,6342,6374,6374,6374,8454,8454,6406,6406,6406,6406,6406,6406,6406,6406,8454,8454,8454,8454,6406,6406,6406,6406,6406,6406,8454,8454,6406,6439,6439,8455,8455,8455,6374,6374,6406,6373,8389,18921,33679,52696,52695,52695,50582,56888,61147,35792,16743,20969,20937,21001,25194,25194,25161,48437,52664,52664,52631,52566,52631,52599,52631,52598,52630,50549,56856,56889,27275,37872,54711,52630,52599,52566,56791,56823,27274,39920,54712,52631,50550,54711,39920,27210,31468,44146,54711,52631,52631,54711,39920,27242,52599,52599,52631,52630,54711,65275,44211,25194,50550,52631,52567,54647,50454,35662,35694,35726,35694,35662,35694,31468,23179,6276,8454,8487,8487,8455,6439,6407,10536,12616,16809,16809,18824,18857,18856,16776,16744,16744,16776,14728,14728,14696,12616,12648,12616,10568,10568,10568,12714,12746,14794,12681,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10535,8422}, {4261,6341,4294,4294,4294,6342,6374,6374,8455,8423,8454,8454,8454,8454,6406,6406,6406,6406,6406,6406,6406,8454,8454,8454,6406,6406,6406,6406,6406,6406,8454,8454,6406,8454,8487,8455,8455,8423,8455,8455,8455,8422,8389,21002,35728,54712,52664,52664,54711,56824,59002,37872,18889,14663,10502,14631,27275,27274,25097,50485,54744,52632,52567,52566,50453,52533,50485,50453,52565,50485,50517,48372,27242,39888,52598,50485,52533,52533,52566,50420,29258,39855,52566,50485,52565,52598,39920,27177,27177,39887,50485,50485,52533,52565,39855,29258,50452,50517,50485,52533,54646,61050,44146,27210,50485,52565,52533,52533,50453,46194,44114,46194,44145,46194,46194,35662,25195,6276,8422,8455,8455,8455,8455,8423,12616,16810,16841,16809,18824,18824,18824,16776,16744,16744,16776,14728,14728,14696,12616,12616,10568,10568,10568,10600,12747,14827,14795,12681,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,8487,6374}, {4261,4294,6374,6374,6374,6374,6406,8455,8455,8455,8454,8422,8454,8454,8454,6406,6406,6406,6406,6406,6406,6406,6406,8454,6406,6406,6406,6406,6406,6406,6406,6406,6406,8454,8487,8455,8455,8423,8455,8455,8455,8422,10470,23083,35728,52599,52566,52598,50485,54711,58937,37840,23115,12615,12583,14728,27243,42000,54678,52533,52598,52566,52534,52469,56792,58872,58807,54614,52565,52533,54614,52533,33484,37742,48339,52501,52533,54581,52533,52533,50323,52468,54581,52533,52533,54646,41968,29258,29290,41968,54646,52533,52532,54581,52468,50355,52532,54613,52532,52533,50420,44016,35597,33483,52532,54613,52532,54580,52500,52500,52468,52468,50452,52500,52500,35694,25195,6276,8422,8487,8455,8455,8487,8423,10536,16810,16809,16809,18824,18824,16776,16744,16744,16776,16776,14728,14729,14696,12648,10568,10568,10568,10568,10568,12746,12747,14795,12714,12714,14794,14762,12714,12714,14762,12714,12714,12746,12714,12681,10568}, {4261,4294,6406,6407,6407,6406,6407,6407,8455,8423,8423,8423,8455,8455,8454,6374,6406,6406,6406,6406,6407,6407,6407,6407,6407,6407,6406,6406,6406,6407,6407,6407,6439,6439,6439,6439,6407,6407,6407,6407,6406,8454,12550,25163,37743,52501,52500,52533,52500,54645,58839,39888,23115,12615,10503,16808,27178,46097,60920,54581,52501,52533,54581,54614,54614,54646,54581,54549,52468,54549,54581,52435,35532,37677,41968,50420,54549,54516,54548,54548,56629,54548,52500,52468,52500,50388,39823,33419,31306,43984,56694,52468,52500,52500,54548,54548,52500,54548,52467,56661,52435,31273,33386,37644,52467,54580,52500,54548,54548,54548,54548,54516,52500,52500,52533,37775,25195,6244,8422,8487,8487,6439,8487,6407,10535,16809,16809,16809,18856,18824,16744,16744,16776,16776,16776,14696,14728,14696,12648,12616,10568,10568,10568,10568,14827,14827,14827,12714,12714,14795,14794,14794,14794,14794,12746,14794,14794,14794,12681,10568}, {4293,6374,6406,6407,6407,6406,6406,6407,6407,8455,6374,8455,8455,8455,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6407,6406,6407,6407,6407,6407,6407,6407,8454,8486,12550,27243,37710,50355,50322,50322,48273,54613,63000,41935,23082,12615,12583,16743,29258,41871,52403,50290,50355,46194,56726,58807,35564,31273,33385,48177,52435,50322,50290,50322,35532,33418,33450,50355,56661,52370,52403,52371,50322,50354,50322,52435,50322,29225,35564,37677,33452,50323,63001,54548,50354,50322,52402,52403,52370,52402,54451,60855,58742,37547,37580,37580,50289,52402,50354,50354,52370,52338,52402,52370,52370,52370,52435,37742,27275,6243,8454,10600,8487,6438,6439,6407,10536,16810,16809,18857,18856,16776,16744,16744,16776,16776,14728,14696,14696,12648,12648,12616,10568,10568,10568,10568,12747,12747,12747,10601,10568,10568,8488,10568,10568,10568,8520,8520,10568,10568,8455,6342}, {4293,4326,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,8454,8422,8422,8454,8454,6374,6406,8454,8487,10534,14598,29323,41871,54516,54515,54515,54516,52370,50257,39757,27307,12517,10502,16711,31371,43984,54516,54580,52468,52500,54580,54579,37676,35498,37579,52337,54516,54516,54548,54483,37611,35531,35563,43983,48111,43885,50257,52403,52435,52435,54515,46063,41837,35564,31338,27144,27112,37709,50290,43951,46063,52370,52370,52370,54451,52273,45934,52273,48144,37547,37579,39692,52369,52402,52402,52402,52370,52370,52402,52402,54418,54418,54450,39822,29355,8291,10502,10567,8486,6438,6406,8455,12584,18858,18857,18825,18856,16776,16744,16744,16776,16776,14728,14728,12648,12648,12648,12616,10568,10568,10568,10568,12747,12747,14795,12714,12682,12682,12714,12714,12714,12714,12714,12681,12713,12713,10600,8487}, {4293,6342,6406,6407,6406,6406,6406,6406,6406,6407,6406,6406,6406,6406,6406,6406,6374,6374,6374,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,8422,8422,8422,8422,6374,6374,6374,8455,10599,12615,14630,29323,41871,54516,54516,54483,56596,48144,31240,35531,29388,10436,8388,16743,31403,44016,54580,52468,54548,52500,50386,48240,35596,35531,35531,52370,54580,54516,54515,52435,37644,35531,33515,33450,35466,35466,46031,52370,50289,52402,54547,41837,33418,35564,25064,10338,16677,25064,31370,33386,41772,52369,50289,50322,54386,48080,35434,33386,33418,35531,35499,39660,52337,52337,52369,52370,50289,52402,50289,50322,52337,52337,52369,39789,29355,6210,10502,10567,8486,8487,6407,8455,12552,18858,18825,18825,18824,18824,16776,16776,16776,14696,14728,14728,12648,12648,12648,10568,10568,10568,10568,10568,12747,12747,14795,14794,14794,14827,14794,14794,14794,14794,14794,14794,14826,14794,12681,10568}, {6309,6341,6374,6374,6373,6374,6341,6374,6374,6374,6341,6374,6374,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6374,6374,6406,6374,6374,6375,8487,10568,10567,10567,12517,31436,35629,37677,37677,39724,39724,37676,37676,23016,10501,8454,8421,14663,33548,37644,39724,39724,39725,39725,37677,37677,16677,27177,37644,39692,39692,39724,39692,37676,35628,29355,14597,16710,27112,37644,39692,39692,37676,37676,37677,37677,31403,16678,14663,12583,12582,14663,18758,33483,37677,39724,39724,39724,39692,37644,35629,23048,14661,12516,31338,37645,41740,41740,39692,39724,39692,39692,39693,39693,39692,37644,37676,37709,29420,10501,12615,10567,8454,8486,8487,10535,12584,18825,18825,18825,18824,18824,16744,16744,16776,16776,14728,14728,12648,12648,10568,10568,10568,10568,10568,10600,14795,14827,14795,12681,10568,10568,10568,10600,10568,10568,10600,10600,10600,10568,8487,8422}, {8390,8454,10567,10535,10535,10567,10567,10567,10535,10567,12648,8454,6374,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,8454,6374,6406,8487,8487,8455,8488,10568,10600,10535,12582,25195,29323,27242,27242,27242,27209,27242,27307,14662,6308,8487,8455,12583,25195,27242,29289,29257,29226,29226,27210,27210,8388,18888,29323,29290,29257,29290,29258,27210,29355,23082,10469,10469,20871,29290,29290,29257,29290,27209,27242,29323,25162,12550,10535,12616,10535,10503,8356,25162,27274,27242,27209,29290,29258,29322,25226,14726,6340,8388,20969,29323,31306,31305,29257,29257,29258,29258,29259,29259,27210,27210,27210,27243,23114,10534,10535,10535,8454,8486,8486,12648,14729,18857,18857,18824,18824,18824,16744,16744,16776,16776,14728,14728,12648,12648,10568,10568,10568,10568,10568,10600,12746,14795,14794,10601,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,8455,8422}, {10470,12583,14728,14728,14728,14728,16776,16809,16808,16809,16841,10535,8422,6374,6374,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6405,6373,6406,8519,10600,10568,10568,10600,10600,8520,10567,8422,8357,8389,8421,6341,8389,6276,6276,8454,10568,8456,8456,8424,6277,6309,6308,8324,8324,8357,8389,8389,8486,8422,8357,8324,8357,8390,8357,8390,6276,10502,10567,10567,12551,8357,8357,8357,8389,8389,8389,8389,10502,10502,12648,12648,10568,12648,12615,8389,6276,6276,8356,8324,8356,6308,6276,8422,8487,8486,6341,6276,8324,8324,8324,8324,8324,8324,8325,6309,8324,8357,8356,6276,6309,8455,10536,8455,8455,8486,8486,14760,16841,16809,16808,16808,18824,18824,16776,16744,16776,16776,14728,14728,12648,12648,10568,10568,10568,10568,10568,10600,12746,14826,14794,10633,10568,10568,10568,10568,10568,10568,10568,10568,10600,10568,10535,8454}, {8390,12551,14696,14728,14696,16776,16744,16744,16744,16776,18889,14696,12615,8454,8422,8422,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6405,8486,8519,10600,10568,10536,10568,10568,8552,8520,8520,8487,10568,10600,8552,6471,6439,8520,8520,8487,8456,8456,8456,8456,8488,8488,8487,8487,8487,8487,8487,8519,8455,10568,10600,10568,8521,8553,10601,10601,10600,10568,10568,8519,10568,10536,10601,10601,10568,10568,10568,10568,10568,12648,10567,10503,10535,10535,8455,10567,10568,10600,8520,8487,8487,8552,8487,8487,8455,8487,8487,8519,8519,8487,10535,10535,10535,10535,8487,8519,8487,8487,8487,8519,8487,8488,8423,8455,8455,8487,8454,14761,16841,16776,16808,16808,18824,18824,16744,16744,16744,16776,14728,14728,12648,12648,10568,10568,10568,10568,10568,10600,12746,14826,14794,10601,10536,10568,10568,10568,10568,10568,10568,10568,10568,10568,8487,8422}, {8422,12551,14696,16776,16776,16776,16744,16744,16744,16744,18857,16777,14728,8422,8422,8422,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,8519,10600,10568,10536,10535,10568,10568,8520,8487,6407,8487,8488,8488,6471,6439,6471,6439,6439,6407,8455,10503,8423,8423,8455,8487,8487,8487,8487,6439,6406,6406,8454,8487,10568,10568,8552,8552,10600,10568,10600,10568,10567,10568,10568,10568,10600,8520,12648,10568,10600,10600,10568,10567,10535,12648,10567,10567,8519,8487,8487,8519,8487,8455,6439,6439,8487,8454,8454,8454,8486,6471,6471,6471,8487,8487,8487,8486,8486,8486,8487,6407,6439,8487,6439,6407,8456,10536,8455,8487,8422,14761,18857,18793,18857,18856,18824,18824,16744,16744,16744,16776,14728,14728,12648,12648,10568,10568,10568,10568,10568,10600,12747,14827,14794,10601,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,8487,8454}, {8390,10502,12615,14696,14696,16744,16744,16712,18857,18857,18825,18857,14696,8390,8422,8422,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,8552,8520,8520,10568,8487,8455,8455,8487,6407,8519,8487,8487,8455,8487,8487,6439,6439,8487,6439,6407,8454,8454,10535,8455,8455,6407,8487,8487,8487,8487,8487,8487,10600,10568,8520,10600,10600,8519,10568,10568,10535,10536,10567,12648,10535,10568,10568,10568,10535,10568,10600,10568,8519,10568,10567,10567,12648,10535,10632,8487,8520,8487,8455,8487,6471,6406,8487,8454,10534,8454,8486,6438,6471,6439,6439,8487,8487,8487,8486,8486,6407,8487,8487,6438,8487,8487,8488,8455,8454,8487,8454,14761,18857,18793,18857,18824,18792,18792,16744,16744,16744,16776,14728,14729,12648,12648,10568,10568,10568,10568,10568,10600,12746,12746,12746,10601,8488,10568,10568,10568,10568,10568,10568,10568,10568,10568,8487,6374}, {8422,10535,12648,12648,14696,16744,16744,16776,18824,18825,18825,18857,16809,12616,10503,8422,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,8488,8487,8487,8487,8487,8487,8486,6438,6471,6438,6406,8487,8487,8455,8455,8488,8455,8422,8487,6439,8487,8518,6405,6470,6439,6439,8487,8455,8454,8454,8455,10536,10568,10600,10568,10568,10567,10599,10600,10535,10568,10568,20870,10568,10536,10568,10599,10567,10600,10567,10568,10568,10600,10600,10568,10568,10535,12648,8520,10600,8455,8487,8487,8486,6407,8487,8519,6406,8455,10567,8519,6439,6439,6439,8487,8487,6439,6439,8487,8455,8487,8455,8487,8487,8519,6439,6407,8455,6438,8486,8486,14760,18857,18825,18824,18824,18792,18791,16744,16744,16744,16776,14728,14729,12648,12648,10568,10568,10568,10568,10568,10600,12779,14827,14827,12714,12714,12714,12714,12714,12714,12714,12714,12714,12714,12713,10601,10568}, {6374,8487,12648,12648,12615,14696,16744,16776,18825,18825,18825,16777,16809,14761,10568,8422,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6407,8455,8487,8455,8454,8487,8518,6438,6470,6470,8519,6406,8454,8487,8455,8455,10503,10503,6407,6439,8486,6438,6502,6470,6471,6439,8487,8487,8487,8487,10536,10568,8520,10600,10568,10568,10567,10534,12648,10568,10568,10568,10600,20871,10568,20871,12647,12647,10599,20870,10568,10568,10568,10568,10568,10568,10568,10535,10568,10568,8520,8520,8486,8486,8487,8487,6439,6407,8487,10568,8487,6439,6439,6439,8487,8487,6439,6439,8487,8455,8455,8455,8487,6438,6438,8487,6407,8487,6438,6438,8486,14760,18857,18825,18824,18824,18791,18791,16744,16744,16744,16776,14728,14729,12648,12648,10568,10568,10568,10568,10568,10600,12747,12747,14827,12747,14794,14795,14794,14795,12746,14795,14795,14795,14826,12746,12713,10600}, {6374,10535,12648,12616,12648,12616,14728,14728,14728,16776,16808,16808,18857,16809,14631,8324,6406,6374,8454,8422,8422,8422,6407,6374,6406,6406,6406,6406,6406,6406,6406,6406,8487,8487,8487,8487,6439,6439,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,6439,6439,6439,8487,8487,8455,8487,10567,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10569,10569,10568,22919,31174,22951,10568,10567,12616,12616,22919,10568,10568,10600,10600,10599,10567,10568,10568,10568,10568,10568,10568,8488,8455,8487,8487,8455,8487,8487,8487,8487,8487,8487,8487,8487,6439,6439,8487,8487,8487,8487,8455,8487,6439,6439,6439,6439,8487,8487,8454,12582,16744,18856,18824,18824,18825,18791,18792,16744,16744,16776,14696,14696,12648,12648,10568,10568,10568,10568,10568,10567,10567,10600,14761,14794,12681,10568,10568,10600,10568,10568,10568,10568,10568,10568,10568,10535,8422}, {6374,8487,12648,12648,12648,12616,14728,14728,14728,16808,18857,16808,16809,16809,16744,12583,6439,6406,6374,6374,6374,8454,6407,6406,6406,6406,6406,6406,6406,6406,6406,6406,6407,6439,8487,8487,6439,6439,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,6439,6439,6439,8487,8487,8487,8487,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10536,22919,22919,12616,12616,10568,12616,10567,10568,10568,10568,10568,10568,10568,10567,10567,10567,10568,10568,10568,10568,10568,10568,8488,8487,8487,8487,8487,8487,8487,8487,8487,8487,6407,6407,8487,8487,8487,8487,8487,8487,8455,8487,8519,8519,8487,6439,8487,8455,10567,16744,18824,18856,18856,18824,18824,18824,18824,18824,16776,16776,14728,14728,14696,14761,12681,12648,10568,10568,10600,10600,10600,10600,12681,12713,12648,10568,10568,10600,10600,10600,10600,10600,10568,10600,10600,10535,8422}, {6374,8487,12648,12648,12648,12616,14728,14728,14728,16776,16809,16809,16809,16809,16809,16809,8487,8455,6374,8422,6374,6374,6406,6406,6406,6406,6406,6406,6406,6374,6406,6406,6406,6407,6439,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,10568,10600,10568,10568,10568,10568,10568,10568,10568,10568,10567,10568,10568,10568,20839,12616,12584,12584,22918,12583,12616,10568,31173,10568,10567,12616,12616,12615,12615,12615,10567,10568,10568,10568,10568,10568,10568,10568,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8455,8487,8519,8519,8487,6407,8487,8454,12648,18857,18857,18856,18856,18824,18824,18824,18824,18857,18824,16776,16776,14728,14729,14793,14729,12648,12648,12648,12648,12648,12648,12648,12648,12648,12648,12648,12648,12648,12648,12648,12648,10600,10600,12648,12648,10535,8422}, {8422,8487,10600,12648,12648,12616,14696,14728,14728,16776,16776,16808,16809,16809,16809,18857,6374,6374,6374,8455,6374,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6407,6439,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8455,8487,10568,10600,10568,10568,10568,10568,10568,10568,10568,10568,10567,10567,12615,12615,12616,12615,12615,12615,12615,12616,12616,12616,12647,10567,12647,22919,14664,12583,12583,12616,12616,12616,10600,10568,10568,10568,10568,10568,8520,8520,8520,8487,8487,8487,8487,8487,6407,8519,8552,8519,6407,8487,8487,8487,8487,8455,8487,8487,8487,8487,8455,8487,6374,14696,18889,18856,18824,18824,18857,18825,18824,18856,18857,18824,16776,16776,14728,14729,14761,12680,12648,12648,12648,12648,12648,12648,12648,12648,12648,12648,12648,12648,12648,12648,10600,12648,12648,12648,12648,12648,10567,8422}, {8422,8487,10568,12648,12648,12616,14696,14728,14728,14696,16744,16808,18857,18857,16809,18824,10535,10535,8422,8454,6406,6406,6406,6406,6407,6407,6406,6406,6407,6407,6407,6407,6439,6439,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8455,8487,10567,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,12615,12615,31173,14663,14631,16744,24966,33221,14696,12616,12616,22950,12615,12615,14696,14664,12583,12583,14664,12616,12616,10568,10567,10567,10568,10568,10568,10568,10600,10568,8487,8487,8487,8487,8487,6407,8519,8552,8519,6407,8487,8487,8487,8487,8487,8487,8454,8455,8487,8487,8455,8422,12648,18857,20872,18824,18824,18857,18825,18824,18857,18857,16776,16776,14696,14728,14728,14728,12648,12648,12648,12648,12648,12648,12648,12648,12648,12648,12616,12648,12648,12648,12616,10568,12648,12648,12648,12648,12648,10535,8422}, {8422,8487,10568,10568,12648,12616,14696,14728,14728,14696,16776,16808,18857,18857,18857,18825,16809,14696,8422,8454,6406,6407,6406,6406,6407,6407,6439,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8455,8487,8487,8487,10568,10568,10568,10568,10568,10568,10568,10568,10568,10600,10568,12616,12616,12615,14663,14663,14663,16711,27047,16711,24966,27047,24966,24966,14695,12615,14663,14663,14663,14663,14664,14664,12616,12616,12616,10568,10568,10568,10568,10567,10568,10568,10568,8519,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8455,8487,8487,8454,8455,8487,8487,8455,8422,14696,18857,20905,18856,18824,18825,18825,18857,18857,18857,16776,16744,16776,16776,14728,14729,14696,12648,12648,12648,12648,12648,12648,12648,12648,12648,10568,10568,12648,12648,10568,10568,12648,12648,12648,12648,12616,10535,8422}, {8422,8487,10568,10568,12648,12616,14696,14728,14728,16776,16776,16776,16776,18857,18857,18857,18857,14696,8389,8454,6406,6471,8487,8487,8487,8487,8487,8487,6439,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8455,8455,8487,8519,20871,10568,10568,10568,10568,10568,10568,10568,8553,10568,12616,14663,14663,14663,14663,14663,14630,16711,16744,16744,16744,16743,16711,24933,16711,14663,14663,14663,14663,14663,14664,14664,12616,12616,12616,12616,10568,10568,10600,10600,10568,10568,10568,10568,8487,8487,8487,8519,8487,6407,6407,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8455,8422,14696,18857,20905,18856,18856,18825,18824,18825,18857,18857,16776,16744,16776,16776,14728,16777,14728,12648,12648,12648,12648,12648,12648,12648,12648,12648,10568,10568,12616,12616,10568,12648,12648,12648,12648,12648,12616,10535,8422}, {8422,8487,10568,10568,12616,12648,14729,14729,14728,16776,16744,16744,16776,18857,18857,18824,18825,14696,8390,8454,6406,6438,6406,6439,8487,8487,8487,8487,6439,6439,6439,8455,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,6407,8487,8487,8487,8455,8487,8487,10568,10567,10568,10568,10568,10568,12616,10568,10568,8521,10568,12616,14663,14663,14663,14663,14663,14631,16679,24934,29095,29095,26981,18726,16678,27014,16711,16711,14663,14663,14663,14664,12616,12616,14696,14696,12648,10568,10568,10600,10600,10568,10568,10568,10568,8519,8487,8519,10600,8487,8487,8487,6439,6439,8487,8487,8487,8487,6407,6438,6438,8487,8455,8455,8487,8422,14696,18857,20905,18856,18856,18856,18825,18825,18857,18825,16744,16744,16776,16776,14696,14728,14696,12648,12648,12648,12648,12648,12648,12648,12648,12648,12616,12616,12648,12648,12616,12648,12648,12648,12648,12648,12648,10535,8422}, {8422,8455,10568,12616,12648,12648,12616,12648,14728,14696,16776,16776,16776,18856,18825,18825,18825,18857,16809,8487,6406,6438,8487,6439,8487,8487,8487,8487,6439,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,6439,8487,8487,8487,8455,8487,8487,10568,20870,10568,10568,10568,10568,10568,10568,10568,10568,12616,14664,14663,12616,12616,14663,14663,14631,16679,26949,16548,18596,16483,18661,26981,20872,18759,16678,16678,14663,14663,14663,12615,12616,12616,12616,12616,10568,10567,10567,10568,10568,10568,10568,10568,10568,10568,8487,8487,8487,8487,8487,8487,8487,6439,6439,8487,6439,6439,6439,8487,8487,8455,8455,8455,8422,12616,18857,20905,18856,18824,18824,18825,18825,18857,18825,16776,16744,16776,16776,14696,14696,14696,12648,12648,12648,12648,12616,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10535,8422}, {8422,8455,10568,12648,12648,12648,12616,12648,14728,14728,16776,16776,16744,16776,18825,18825,18825,18857,16841,10535,8454,8487,8487,8487,8487,8487,8487,8487,6439,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,6439,6439,8487,8487,8487,20838,10568,10568,10568,29126,10600,20871,20871,31174,12616,12616,12615,14663,14664,14664,14632,14664,14663,16711,16678,20774,29095,33255,37383,35335,29095,22822,20807,20774,18726,16678,16711,14663,14663,14663,12615,12616,12616,12616,12616,10568,10568,10568,10568,10568,10568,10568,10568,10568,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,6439,6439,6439,6439,8487,8487,8455,8487,8455,14728,18889,20872,18856,18856,18824,18825,18857,18857,18857,16776,16744,16776,16776,14728,14696,12648,12648,12648,12648,12648,12648,12616,12616,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10535,8422}, {8422,8455,10568,12648,12648,12648,12616,14696,14728,14728,16776,16744,16744,16744,16776,18857,18857,18825,16809,10535,8454,8454,6407,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,6439,8487,8487,8455,8487,10568,10600,10568,20870,10568,10600,10600,10568,10568,12616,12616,14663,14663,14664,14664,14632,16711,18758,20774,20740,26981,35204,49831,53926,51878,39430,26818,22822,20774,20774,20774,18759,16679,16711,14663,14663,12615,12647,12648,12648,12616,12616,12584,10600,10568,10568,10568,10568,10568,8487,8455,8487,8519,8519,8487,6439,8487,8487,8487,6439,6439,6439,6439,8487,8487,8455,8487,10535,14728,18889,18856,18856,18856,18824,18824,18857,18857,18856,16776,16744,16776,16776,14728,14696,12648,12648,12648,12648,12648,12648,12648,12648,10600,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10535,8422}, {6342,8455,12648,12648,12648,12648,12648,12648,14696,14696,14728,16776,16776,16744,16776,18825,18857,18824,16809,16809,12680,8487,8454,8455,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,6439,6439,8487,8455,8487,10568,10568,10568,10567,10567,10568,10568,10568,10568,12616,12616,14663,14663,14631,16679,16712,18759,20774,20773,24869,28964,35074,51781,55843,53860,41380,28800,22822,22789,20742,22822,20774,18726,18759,16711,14663,22918,12615,12615,22918,12616,31141,12583,10600,10600,10568,10568,10568,10568,8487,8455,8487,8487,8487,8487,6439,8487,8487,6439,6439,6439,6439,6439,8487,8487,8487,8487,8455,14696,18857,20872,18856,18856,18824,18824,18857,18857,18824,16776,16744,16776,14728,14728,14696,12648,12648,12648,12648,12648,12648,12648,12648,10600,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10535,8422}, {6309,8455,12648,12648,12616,12648,12648,12648,12648,14696,14728,16776,16776,16744,16777,18857,18824,18857,16809,18889,16809,8454,8455,8455,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,6439,6439,8487,8487,10535,20838,10567,20870,22919,10568,20870,10567,10567,12615,22918,12616,14663,14631,16678,18726,20807,20806,20805,22820,22788,28964,35041,51749,55843,55876,43428,26688,24869,22789,22789,22789,22822,20774,18726,18726,26981,14630,14663,22918,14663,22918,12616,12584,10568,10568,10568,10568,10568,10568,8519,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8422,12615,18857,20904,20904,18824,18824,18824,18824,18824,16776,16776,16776,16776,14728,14728,12648,12648,12648,12648,12648,12648,12648,12648,10600,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,8487,8422}, {6309,8455,12648,12648,10568,12648,12648,12648,12648,14696,14728,14728,14696,16776,16777,18857,18856,18856,16776,16809,14696,8422,8455,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,6439,6439,8455,8487,10535,10535,10567,10567,22951,12648,10567,10567,10567,12616,12616,14664,14663,14631,18694,20741,20806,22854,22853,22788,26884,28866,30752,51683,57924,55844,43460,28801,26917,24837,24805,22789,22789,22789,20741,29029,18726,16678,33189,14663,24966,14663,14664,12616,10568,10568,10568,10568,10568,10568,10568,10568,8487,8487,8455,8487,8487,8487,8487,8487,8455,8455,8487,8487,8487,8487,8455,8487,8454,12615,18856,20872,18824,18824,20872,20840,16744,16744,16776,16776,16776,14728,14696,12648,12648,12648,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,8487,8422}, {6342,8455,10600,10600,10600,12648,12648,12648,12648,14696,14728,14728,14696,16744,16776,16777,16808,18856,18857,18857,18857,14664,10567,8455,8487,8487,8487,8487,8455,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,6439,8487,8454,8454,10535,22919,12616,10535,12648,22950,10567,10567,12615,22918,14663,14664,14663,16678,20741,20741,20774,20775,20774,22788,26785,39267,49603,57859,59906,57924,43396,28769,26885,26885,24836,24837,24837,22789,22789,20742,20774,18726,26982,16679,14663,14663,12616,12648,10568,10568,10568,10568,10568,10568,10568,10568,8487,8487,8487,8487,8487,8487,8487,8487,8455,8455,8455,8487,8487,8487,8455,8487,8454,12615,18824,18792,18824,18823,20840,18791,16743,16744,16744,16744,14696,14696,12648,12648,10568,10568,10568,10568,10568,10568,10567,10567,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,8487,8422}, {8454,8455,10568,10600,12648,12648,12648,12648,12648,14696,14728,16776,14728,16744,16744,16744,18856,18824,18857,16744,18857,18890,12648,8455,8487,8487,8487,8487,8455,8455,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,6439,8487,8454,8422,10535,14728,14696,10535,10535,10567,10567,12615,12615,12616,22918,14664,14663,16710,20773,22789,20742,20775,20774,24836,28865,45508,57924,59906,59906,57892,43396,30850,28933,26885,26885,26917,24869,24837,22789,31077,22822,20775,29030,16679,14631,14631,22918,31173,20871,10600,10600,10568,10568,10568,10568,10568,8455,8487,8487,8455,6407,8487,8487,6439,8455,8455,8455,8455,8487,8487,8455,8487,8454,12615,18824,18791,18823,18791,18791,18759,18824,16744,16711,14663,14663,12616,12616,12648,10568,10568,10568,10568,10568,10568,10568,10567,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,8487,8422}, {8422,8455,10600,10567,10600,10632,12680,10632,10600,12648,12648,14729,14729,14729,14729,16777,18857,18857,16808,18824,18856,20872,18792,14664,10535,8455,6439,6439,8487,8455,8487,8455,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8486,6406,8487,8455,8487,10568,10567,10568,10567,20870,10568,12616,12615,14663,16678,16678,20741,20741,20774,20741,22821,22756,24804,30946,51748,59938,61953,63937,61921,61987,47458,34912,39268,35075,30849,30883,28900,26853,24805,22757,31076,20773,29029,18694,18693,18693,26981,18758,22886,10567,20870,10568,10567,12615,10568,10568,8487,8487,8487,8455,8455,8487,8487,8487,6470,8486,8487,8487,8487,8455,8487,8487,8486,10535,12583,16776,18824,20872,18791,16743,16744,16744,14695,14663,12615,12615,12648,12648,12615,10567,10567,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10567,10567,8487,8422}, {8422,8487,10600,10567,8519,10568,10568,10568,10600,10600,12648,12648,14696,14696,14696,14696,16776,16776,16776,16776,18792,18792,18792,16776,10502,8454,8487,6439,8487,8455,8455,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8486,8487,8487,8487,8487,10568,10568,10568,10568,10568,10568,12616,12615,14631,16678,16646,20741,20741,20774,20741,22821,24836,26852,35074,53828,59938,61921,63969,63968,61954,53731,47458,45476,45476,43429,35140,31012,26852,26885,22756,22820,20773,29029,20774,20773,18693,26981,16678,22918,12615,10567,10567,12615,12615,12615,10567,8487,8487,8487,8455,8455,8487,8487,8487,6470,8486,8487,8487,8487,8455,8487,8487,8454,8454,12550,18824,20872,18824,18824,18791,16776,16776,16776,16744,14696,14696,14696,14728,12680,12648,12616,12648,12616,10568,10600,10600,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10535,8422}, {8422,8455,10600,8487,8455,8455,8455,8455,10568,10568,10568,12648,12648,12616,14696,14696,16712,16712,16744,16744,16744,18792,18824,18857,10470,8454,8487,8487,8487,8487,8454,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8455,8487,10568,10567,10567,12615,10567,10567,12615,12583,14631,16678,18694,22822,22822,22821,20741,22788,26884,28867,37090,55843,59905,61920,64065,64032,64000,61953,59938,55810,55811,53861,43460,35172,28932,26917,24870,22820,22788,31076,31077,31077,20741,18693,26981,14663,14663,12583,12615,12583,12583,12583,12583,8487,8487,8487,8487,8487,8487,8486,8486,8487,8487,8487,8487,8487,8455,8487,8487,8487,8487,10470,16776,20905,18792,20904,18856,18824,18824,16808,16776,16776,14728,14728,14728,14729,14728,12648,12648,12648,12648,12648,12648,12648,12648,12648,12648,12648,12648,12648,12648,12648,12648,12648,12648,12680,12680,10567,8454}, {8422,10535,10600,8487,8455,8455,8455,8487,8487,8487,10568,12616,12648,12648,12616,14664,16744,16712,14663,16743,16743,16744,18792,18824,16776,14696,8454,8487,6438,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8486,8487,8487,8455,8487,10535,10535,10535,12615,12583,12615,12583,14631,16679,18727,20775,20742,20741,20773,22788,24836,28965,30915,37090,57892,61953,61920,64000,64000,61920,61920,64000,61952,59905,57922,43328,32960,28932,26852,24837,24869,22789,31044,24838,24838,20742,18693,18726,14663,14631,12583,12583,12583,12583,12583,12583,8454,8487,8487,8487,8487,8487,8486,8486,8487,8487,8487,8487,8487,8455,8487,8487,8487,8486,10502,16809,18889,18824,18856,18824,18825,18825,18856,16776,16776,16776,14728,14728,14729,14728,12648,12648,12648,12648,12648,12648,12648,12648,12648,10600,10600,12648,12648,12648,12648,12648,12648,12648,12648,12648,10535,8422}, {8422,10535,10600,8487,8487,8455,8487,8487,8487,10567,10568,12616,12648,12648,12648,12616,16744,16744,16744,16776,16776,16743,18791,18792,18857,16744,8422,8487,8519,8487,8487,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8487,8487,8487,8487,8487,8486,8487,8487,8455,8455,8455,10503,10535,12615,12583,12583,12583,14631,16678,18726,20774,22822,22789,22821,24869,26885,31013,30915,37090,55811,59905,61985,61984,61984,64097,64064,61984,64001,61920,59905,49536,39201,33026,28932,26885,24837,33125,24838,22758,22758,22790,18725,26980,16679,16679,14598,14598,14598,12582,12583,12583,8454,8454,8487,8487,8455,8487,8486,8486,8487,8487,8487,8455,8455,8455,8455,8455,8487,8454,10502,14728,18824,18856,18824,18824,18824,18824,18824,16776,16776,16776,14728,14728,14728,14696,12616,12648,12648,12648,12616,12616,12648,12648,12648,12648,12648,12648,12648,12648,12648,12648,12648,12648,12648,12648,10567,8454}, {8422,8455,10568,8455,8455,8455,8455,8487,10568,10568,10600,10568,10568,12648,12648,12648,14663,14664,16744,16776,16776,16775,18824,20904,20872,16712,10437,8454,8486,8487,8487,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8486,8487,8487,8487,8455,8454,10535,12583,12583,12583,12583,14631,16679,16678,18694,18694,20741,22789,22789,24837,26852,28868,30914,39137,57891,59905,59904,57856,62080,64323,64161,61984,61952,61920,59904,57922,49700,32961,32995,28932,26885,26918,24838,22758,31045,20774,18725,26948,16646,16646,14598,14598,14598,14598,14598,12582,8422,8454,8454,8455,8455,8487,8486,8486,8487,8455,8455,8455,8455,8455,8455,8455,8487,8454,8422,12583,16711,18824,18824,18856,18824,18824,18824,16744,16744,16776,16776,14728,14729,14696,12648,12616,12648,12616,12616,12616,10568,10568,12648,12648,12648,12648,10568,10568,10568,10568,10568,10568,10567,10567,8487,8422}, {8422,8487,10600,8487,8455,8455,8487,8520,10600,10600,10600,10568,10568,12648,12648,12648,14696,14696,16776,16776,16775,16776,18824,18824,20904,18824,16744,12583,8487,8487,8487,8455,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8487,8454,8455,8455,10470,12582,12583,12583,12582,14630,14631,16678,16646,18693,20741,22821,22821,24837,26885,28933,30948,37155,45442,57889,62081,64258,62209,62240,64353,64192,62016,64096,64097,62017,60003,51781,35009,33027,28931,26884,26885,26885,24837,22821,20773,18725,16644,16678,16646,14598,14597,14598,14598,14598,12550,10470,8454,8454,8455,8455,8487,8487,8487,8455,8455,8455,8455,8455,8455,8455,8455,6406,8422,8422,14696,18824,18824,18824,18824,18824,18824,18824,16744,16744,16776,16776,16776,16777,14696,14696,12616,12648,12648,12616,12616,12616,12648,12648,12648,12648,12648,12648,12616,10568,12648,10600,10568,10568,10568,10535,8422}, {8422,8455,10600,8455,8454,8455,8519,10600,8520,10600,10568,10568,10600,12648,12648,12648,14728,14728,14696,16744,16776,18856,18856,18856,20872,20873,20937,12551,8422,8454,8454,8455,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8455,8455,10470,12583,14630,14630,14598,14598,14630,16678,18726,20774,20806,22821,22821,24837,26885,28932,30915,39267,47555,57954,64194,64322,64386,64385,64385,64224,62048,64161,64161,62017,60003,51780,37121,32994,30979,28932,26884,26852,24836,22821,20773,18725,18725,18726,16646,16645,14597,14598,14598,14598,12550,10502,10502,8455,8454,8455,8455,8487,8454,8455,8455,8455,8455,6407,8455,8455,8454,8454,8454,8421,16808,20937,18824,18856,18824,18824,18824,18824,16776,16744,16744,16776,16776,16776,14696,14664,14664,12648,12648,12648,12616,12648,12648,12648,12648,12648,12648,12648,12648,12648,12648,12648,10600,10568,10568,8487,8422}, {8422,8455,10600,8455,8454,8454,6406,8487,8487,8454,8454,8455,8455,8455,10535,10568,10568,12616,12583,16809,18857,18857,18856,18856,20872,20872,20905,12550,8422,8455,8455,8455,8454,8454,8454,8454,8454,8487,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8455,8454,10470,12550,12582,14598,14630,14598,16646,16646,18694,20806,22886,22822,22822,22789,26917,28932,30979,32993,41249,57955,60001,60032,62241,62304,64385,64224,59968,64096,62016,62017,60003,53797,34944,35041,33027,30980,28933,26885,26917,24869,20773,20774,18726,16646,16646,16678,14597,14598,14598,14598,14631,10502,8454,8455,8455,8455,8455,8455,8455,8454,8454,6406,6406,6406,8454,8454,8454,8454,8454,8422,16808,18857,18824,18824,20904,18824,18824,18824,16776,16744,16744,16776,16776,16776,16777,14696,14696,12616,12648,12648,12648,12648,12648,12648,12648,12648,12648,12648,12648,12648,12648,12648,12648,12648,10568,10535,8422}, {8422,8455,10600,8455,8454,8454,6406,8454,8454,6406,8454,8454,8455,8455,10535,10568,10600,10568,12584,16777,18857,18857,16808,18856,20872,20872,20872,16712,12583,8454,8487,8487,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8455,8454,10470,12550,12582,14598,14598,14598,16646,16646,18693,20774,22854,20742,22822,24837,26885,26884,30980,32994,39201,55907,60066,62145,62209,62272,64385,64321,62144,64096,64096,62017,62051,57924,47523,43394,39235,33028,28900,26885,26885,24837,22789,22822,20742,16678,16646,16678,14597,14598,14598,14598,12550,10502,10502,8455,8455,8455,8455,8455,8455,8454,8454,6406,6438,6406,8454,8454,8454,8454,8486,8421,16808,18889,20904,20904,18791,20872,20872,18824,18824,16776,16744,16776,16776,16776,14728,14728,14729,14729,12648,12648,12648,12648,12648,12648,12616,12648,12648,12648,12648,12648,12648,12648,12648,12648,12648,10535,8422}, {8422,8455,10600,8487,8454,8487,6406,8454,8454,6406,8454,8454,8455,8455,8487,10600,10600,10568,12584,16777,16777,18857,16808,18856,18824,20904,20905,20905,16776,8422,8454,6406,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8455,8454,10470,12550,14598,14598,14598,14598,16646,16646,18661,20773,20773,20741,22790,26917,26917,26885,28932,33026,39233,55907,62146,64290,64256,62240,64352,64385,64385,64096,64096,61984,62017,62083,60036,53794,45473,35074,28899,26885,26885,26885,24805,22789,22789,16678,16646,16678,14597,14598,14598,14598,12550,10502,10502,8455,8455,8455,8455,8455,8455,8454,8454,6438,6438,6406,6406,8454,8454,8454,8454,8421,16808,18856,18857,18824,20872,18824,18824,18824,16776,16744,16744,16776,16776,16776,14728,14729,16809,14761,12648,12616,12648,12648,12648,10600,10568,10568,10600,12648,12648,12648,12648,12648,12648,12648,12648,10535,8422}, {8455,8455,10600,8455,8454,8487,6406,6406,8454,6406,8454,8454,8455,8455,8487,10600,10600,10568,12584,16745,16777,18857,18857,18824,18857,20904,18792,20905,18857,14663,12615,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8455,8454,10470,12550,14598,14598,14598,14598,16646,16646,18661,20741,20741,22789,22756,26852,26852,28965,31012,33026,39168,55907,62146,64289,64288,64353,64417,64385,62304,64096,64064,64096,62017,64097,62017,59970,53794,37120,30946,28964,26917,26885,24804,24837,22789,16678,16646,16678,14597,14598,14598,14598,12550,10502,10502,8455,8455,8455,8423,8455,8455,8454,8454,6438,6438,6438,6406,8454,8454,8454,8454,8454,10534,14663,20970,18856,18824,18824,18824,18824,16743,16743,16744,16776,16776,16776,14696,14728,16809,14729,12648,10568,12648,10568,10600,10568,10568,10568,10568,10600,10568,12616,12648,12648,12648,12648,12648,10535,8454}, {8455,8487,10568,8455,8454,8454,8454,8454,8454,8454,8454,8454,8454,8455,10535,10568,10600,10568,12616,14697,16777,18857,18857,18824,18824,18856,18856,20872,18856,16776,12615,8421,8487,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8455,8454,10470,12550,14598,14598,14598,14598,16646,16646,18693,20741,20773,24836,26916,31077,31044,31045,33028,39203,45377,59970,64161,64257,64353,64353,64417,64384,64417,64160,62080,62048,64097,64065,61952,62017,60035,45409,37154,28931,26917,26885,24805,22789,22789,16646,16646,16678,14597,14597,14598,14598,12550,10502,10502,8455,8455,8455,8423,8454,8454,8454,8454,6438,6438,6438,6406,8454,8454,8454,8454,8454,8389,10502,16776,16776,18857,18824,18824,18791,16743,16743,16744,16776,16744,16744,14696,14728,14728,14728,12648,12648,10568,10568,10600,10600,10568,10568,10600,10568,10568,10568,10600,12616,12648,12648,12648,10567,8454}, {8455,8487,10568,8455,8454,8454,8454,8454,8454,8454,8454,8454,8455,8455,10535,10600,10567,10568,10568,14697,16777,18825,18825,18825,18824,18856,18824,18824,20904,20937,14630,8324,8487,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8455,8454,10470,12550,14598,14598,14598,16646,16646,18694,18694,20774,20774,22755,29062,35336,35238,31045,32994,45476,55811,59969,62048,60032,64321,64385,64417,62368,62368,64321,64224,60000,62049,64032,64065,64065,59970,53762,45475,30914,26884,26917,24837,22789,22789,16646,16646,16678,16645,14597,14598,14598,12550,10502,8454,8454,8455,8455,8455,8454,8454,8454,8454,6438,6438,6438,6406,8454,8454,8454,8454,8454,8454,10470,8389,14696,16841,20872,20872,18823,18791,16743,16776,16776,16776,16744,16776,16776,14696,14696,12648,12648,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,12616,12648,12648,10567,8455}, {8455,8487,10600,8455,8454,8454,8454,8454,8454,8454,8455,8487,8455,8455,10535,10600,10567,10568,10568,14729,16777,18825,18825,18825,18824,18856,18856,20904,20872,20937,18824,16743,8487,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8455,8486,10502,12582,14598,14598,14598,16646,16646,16646,18694,20774,20774,22789,26982,31111,31045,31044,33025,49668,57955,62049,64128,62112,64353,64384,62400,64609,64706,64448,64352,64257,62113,61984,64065,62017,59970,60003,49635,30913,26916,24869,24869,22789,22789,18694,18694,18726,16646,14565,16646,14598,14630,10502,8454,8454,8455,8455,8454,8454,6406,8454,8454,6439,6439,6407,6407,8455,8455,8454,8455,6406,8454,8422,8422,12615,14696,20871,18824,18791,18791,16743,18824,18824,18824,16744,16776,16776,14696,12648,12648,12648,12616,10568,10568,8519,8519,8487,8487,10568,10600,10568,10568,10568,10568,12648,12648,10535,8455}, {8455,8487,10600,8487,8454,8487,8454,8454,8454,8454,8454,8455,8455,8455,10535,10568,10567,10599,10568,14729,16745,16745,18793,18825,18856,18856,18823,20904,20872,20937,20936,20937,8487,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8455,8486,10502,12582,14598,14598,14598,16646,16646,16646,18694,20774,20806,22854,24870,24805,26852,28996,30945,49699,60035,62017,64096,62112,64321,64416,62432,64738,64835,64480,64384,64386,62112,62049,64065,62049,59970,59971,51716,28832,26948,24868,22821,22789,22790,18694,18726,18758,16646,16613,16646,14598,14630,10502,8454,8454,8454,8455,8454,8454,8486,8454,8454,6439,6439,6407,6407,8455,8455,8455,8454,6406,8487,8422,8422,10503,12648,18791,18791,18791,18791,18823,18824,18856,18856,16776,16744,14696,14696,12616,12616,12648,12648,10568,8487,8487,8487,8455,8455,8487,10600,10568,10568,10568,10568,12648,12648,10535,8455}, {8455,8455,10600,8455,8454,8454,6407,6407,8455,8455,8454,8454,8487,8487,8454,8454,10568,10568,12616,14729,16776,16744,16776,18825,18857,18825,18824,20872,20872,20872,20872,22952,10470,8421,8454,6438,6406,6407,8455,8455,8454,8454,6406,6406,8454,8454,6407,6407,8455,8455,10503,10471,8454,10502,10534,12583,14598,14598,14566,16646,16646,18694,20774,22854,22788,24869,24869,26917,28997,32995,51747,60003,59968,64193,64386,60320,62560,64834,64897,64897,62464,62400,64352,64192,64096,64065,62049,59970,60003,51683,32993,28963,24836,24869,22789,22821,18694,18693,18694,18726,18726,16646,14598,14598,10437,10470,10470,10502,8422,8422,8454,8454,8454,6406,6439,6439,6439,6406,8455,8423,8455,8455,6438,6406,8486,8389,16744,18825,18824,18856,18824,18824,20873,20873,18825,18825,16744,16744,14728,14728,14728,12648,10568,10536,10568,10535,8487,8487,8455,8455,8455,8487,10600,10568,12616,10568,10568,12648,10535,8454}, {8454,8455,10600,8487,8454,8487,8487,8487,8455,8455,8455,8455,8487,8487,8487,8487,10568,10568,10568,14696,16776,16744,16776,18857,18825,18824,18824,20872,20872,20872,20904,22952,14695,12583,8421,8487,8487,6407,8423,8455,8455,8454,6406,6406,8454,6406,6407,6407,8455,8455,8455,10503,8454,8454,10502,12550,14598,14598,14566,16646,16646,16645,20774,20774,22789,22821,24869,26949,28998,32994,51747,60002,59968,64225,64418,60352,62592,64898,64962,64897,64609,64512,64384,62144,64064,64065,62049,59969,60003,51715,30912,28963,24868,24902,22821,22789,18694,16645,18694,18726,16678,16646,14598,14598,14663,12550,10470,10502,8454,8454,8422,8454,8454,8454,6439,6439,6407,6407,8455,8455,8455,8455,6406,6406,8486,8422,16776,20905,18824,18857,18824,18824,18825,18825,18825,18857,18824,16776,14728,14728,14728,12648,12616,10536,10568,10535,8455,8455,8487,8455,8455,8455,10567,10535,10568,10568,10568,12648,10535,8454}, {8454,8455,10600,8487,8487,8487,8487,8487,8455,8455,8487,8487,8487,8487,8487,8487,10568,10568,10568,14696,14728,16776,16808,18857,18825,18825,18825,20872,20872,20872,20872,20904,20905,18824,8421,6373,6406,6407,8487,6407,8454,8454,8454,8454,6406,6406,6407,6407,8454,8454,8454,10502,8454,8454,10502,10502,12550,14598,14598,16678,16646,16645,18694,20774,20773,22821,24902,26982,29030,33026,49667,60034,60000,64224,62369,60384,60544,64897,64929,62880,64769,64641,64384,62144,62016,64064,64096,62017,60003,51715,28864,26948,24901,24902,22822,22789,16646,16645,16645,16646,16646,14597,14598,14598,14728,12583,10502,10502,8454,8454,8422,8454,8422,8454,6406,6406,6406,8454,8422,8422,8455,6374,6406,6406,6373,8389,14696,18857,18857,18857,18857,18857,18857,18857,18857,18857,18857,16808,14696,14728,14728,12648,12616,10568,10568,8487,8487,8455,8487,8487,8487,8455,8455,10535,10568,10568,12648,12648,10567,8454}, {8454,8455,10600,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,10568,10568,10567,14696,14729,16776,16776,16776,18825,18825,18857,18825,20872,20872,20872,20872,22953,18824,10469,8454,6406,6406,6406,6407,6406,6374,6406,6406,8454,6406,6406,6406,8454,8454,8454,8454,8454,8454,8453,10502,12550,14598,24901,16678,16645,16645,18694,20774,20773,22821,24902,26982,29030,33027,49699,60066,60000,62208,62432,64673,64833,64929,64961,64960,64865,64737,62368,62176,62016,64064,64064,62016,60003,51715,28864,26948,24869,22789,22790,22790,16645,16646,16645,16645,14565,14597,14598,12582,12582,12582,10502,8422,8422,8454,8454,8454,8422,8422,6406,6406,6406,6374,8454,8422,8422,6374,6438,6438,6405,8421,14696,18922,16809,16809,16809,16809,16809,16809,16809,16809,18857,16808,16776,16776,14728,12616,12616,10568,10600,10568,8487,8487,8487,8487,8487,8455,8455,8487,10600,10568,10600,12648,10567,8454}, {8454,8455,10600,8487,8455,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,10568,10568,10568,12680,14761,14728,16776,16744,16776,18824,18825,18825,18824,20872,20872,20872,22952,18824,14663,10534,6374,6406,6406,6406,6406,6374,8422,8422,6374,8454,8454,8454,8454,8454,8454,8454,8454,8454,10502,10502,14598,14598,16646,16646,16645,18693,20774,20774,22821,22821,24902,26950,29029,30978,49699,60066,60064,62272,62400,64770,64898,64929,64961,64928,64897,64769,62400,64288,64128,64064,64064,64064,62051,51716,28833,26916,24837,22790,22790,22790,16645,16646,16646,16645,14565,14598,14598,14630,10437,10470,10502,8422,8422,8422,8422,8422,8454,8454,8454,6406,6407,6407,8455,8455,6406,6406,6438,6438,6438,6406,12647,16776,14728,14728,14728,14729,14761,14760,14728,16776,16776,16776,16776,16776,14696,12615,12615,10568,10600,10568,10568,8519,8487,8487,8487,8487,8455,8487,10600,10568,10568,12648,10535,8454}, {8454,8455,10600,8487,6407,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,10568,10568,10568,12680,14729,14728,16776,16776,16744,16744,18824,18825,18824,20872,20904,20904,22920,22952,18856,12582,6341,6406,6471,6406,6406,8422,8422,8422,6374,6406,8454,8454,8454,8454,8454,8454,8454,8454,10502,20805,12582,14598,14598,16646,16646,18694,20774,20774,22789,22789,24869,24901,26949,30978,49699,58018,64354,64417,60384,64770,64897,64928,64961,64896,64929,64801,62400,64321,64193,62048,64096,64064,62051,51684,28833,26917,24837,24838,22790,22790,16646,18726,16646,16646,14598,14598,14630,12550,10470,10470,10470,10470,8454,8454,8422,8454,8454,8454,6406,6406,6406,6406,8454,8455,6407,6406,4358,4390,6406,6374,8454,8422,8389,8390,8422,8422,8422,8422,8421,8422,14696,16776,16776,16776,14728,12615,12616,10567,10568,10568,10568,8487,8487,8487,8487,8487,8455,8487,10600,10600,10568,10568,8487,8422}, {8422,8454,10600,8487,8455,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,10568,10568,12680,14729,14728,16776,16776,16744,16744,18824,18824,18824,20872,20904,20904,22920,22920,20937,18824,12647,6373,6406,6406,6374,8422,8422,6374,6406,6406,6406,8454,6406,8454,8454,8454,8454,8454,10502,10502,12550,14630,14598,16646,16646,16646,18726,18726,22820,22820,24901,24869,26949,30978,49699,58019,64355,64417,60384,64801,64929,64960,64960,64928,64930,64769,62400,64353,64289,62048,62048,62016,57923,47588,26818,24837,22789,22822,22790,22790,16678,16678,16678,14598,14598,14598,12550,12550,10502,10502,8454,8454,8454,8454,8454,8454,8422,8422,8454,6406,6406,6406,6374,6374,6406,6374,4358,6406,6406,6406,8422,8422,8422,8422,8422,6374,6406,6374,8422,8422,14696,16776,16744,16776,16776,14696,12648,10567,10568,10568,10568,8487,8487,8487,8487,8487,8455,8487,10600,10568,10568,10568,8487,6374}, {8422,8454,10600,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8455,10535,10568,12680,14728,14728,16776,16744,16744,18824,18824,18824,18824,18824,20872,20872,20871,20872,20904,20905,16841,8421,6374,8454,8422,8422,6374,6406,6406,6406,6406,8454,8454,8454,8454,8454,8454,8454,10502,10470,12582,14630,14598,14598,16646,16646,18694,18694,20773,22821,24902,24869,28965,33026,49699,60067,64322,62336,60416,64802,64897,64961,62881,64961,64899,64738,60352,64385,64322,60000,62048,59969,53762,45508,26818,24869,20741,20774,20741,20773,16678,16678,16678,14598,14598,14598,12550,10470,8421,10502,10502,8454,8422,8454,8454,8422,8422,8422,8455,8454,8454,6374,8454,8454,6406,6406,6406,6406,6374,6406,8454,8422,8422,8422,6374,6406,6406,6374,8422,8454,14728,16776,16744,16744,16776,14728,12648,10535,10600,10600,10568,8487,8487,8487,8487,8455,8455,8487,10600,10568,10568,10568,8454,6341}, {6374,8454,10600,8487,8487,8487,8487,8455,8487,8487,8487,8487,8487,8487,8487,8487,8454,8487,12616,14728,14728,14696,16744,16776,16744,16744,16744,18824,18824,18824,20872,20872,18824,20904,20872,20937,16744,8357,8390,8422,8423,8422,8422,6374,6406,6406,6406,8422,8455,8454,8422,8454,8454,8454,10470,10470,10502,12550,14598,20904,20904,16646,18694,26981,20805,20773,22854,24837,31077,41412,51780,57986,62145,64352,60320,64804,64900,64964,62884,64965,64934,64739,60320,64417,64322,60000,62050,59970,49570,41315,26851,22821,20773,20774,18725,18692,16678,16678,16646,14598,14598,14630,12550,10470,10470,10502,8454,8454,8422,8422,8422,8455,8422,8422,8422,8454,8423,8422,8422,8422,8422,6374,6406,6406,6374,8422,8422,8423,8422,8422,6406,6406,6406,6406,8454,8422,14728,16776,16744,16744,16744,14728,12648,12615,10568,10568,10568,8487,8455,8455,8455,8455,10568,10568,10568,10568,10568,10568,8454,4261}, {8422,8455,10600,8487,8487,8487,8487,8455,8487,8487,8487,8487,8487,8487,8487,8487,8454,10535,10567,12648,14728,16776,16776,16744,16744,16712,16744,18824,18824,18824,18824,20872,18856,18856,20872,20872,18824,14663,12583,8390,8422,8422,6374,6406,6406,6406,8422,8422,8422,8422,8422,8422,8454,10470,10470,10470,10470,12518,14630,18792,18791,16646,16646,18726,20838,20838,24935,26918,31077,39299,51780,58019,60098,60193,60355,62565,60613,54404,54438,54406,56421,58469,58274,62371,64323,60033,60002,57956,49668,41380,26883,22853,20773,18726,18725,18693,16678,16646,14598,14598,14598,14631,12550,10470,10470,10470,8454,8422,8422,8422,8422,8422,8422,8422,8422,8422,6374,6374,6374,6374,8422,6374,6374,6374,6374,8422,8422,8422,8422,6374,6406,6406,6406,6406,6406,8422,12615,14696,16776,16776,14696,14696,12648,12648,10568,10568,10568,10567,8487,8487,8487,8487,10568,10600,10568,10568,10568,10600,8455,4261}, {6374,8487,10600,8487,8455,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8455,10535,10567,12616,14696,14728,16776,16744,16744,16744,16776,18824,18824,18856,18856,20904,18856,18856,20904,20872,20905,20905,14631,8357,8423,8422,6374,6407,6406,6406,6406,8454,8422,8422,8454,8454,8454,8454,10502,10502,20805,12550,12550,14598,14565,14533,16646,16678,20872,22952,24968,26983,31109,35171,47684,53924,53923,58180,60391,52069,41634,28992,28992,29024,22656,45796,56295,58278,58149,55972,55972,53925,49766,39397,26883,22788,20741,20775,18726,16646,16678,16646,14598,14598,14630,12550,12550,10470,10502,8454,8454,8454,8454,8422,8422,8422,8454,8454,8454,8454,6406,6406,6406,6406,6406,6406,6406,6406,6406,6374,8422,8422,8422,6374,6407,6407,6406,6406,6374,8422,8357,12551,14696,14696,14664,12615,12616,12648,12648,12648,10600,10568,10600,10600,10600,10600,10568,10568,10568,10568,10568,10568,8454,4261}, {6374,8455,10600,8487,6407,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8455,10535,10568,12648,12616,14696,14696,14696,16744,16744,16744,16744,16776,18824,18856,18824,18856,18824,20905,20872,20873,20905,16776,14696,8454,8422,6374,6406,6406,6406,6406,6406,8422,8422,8454,8454,8454,8454,10502,10502,8421,10502,12582,14630,14598,16646,18759,20872,20872,22920,22888,26983,29062,31044,39364,43492,41442,43523,41508,41540,37444,33252,33253,31173,33221,35301,39492,43620,43555,43523,43524,41444,37283,33188,26949,27015,24967,22919,18759,16646,14630,14598,14597,14598,12550,12550,10502,10470,8454,8454,8454,8422,8454,8422,8454,8422,8454,8454,8454,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6374,6374,6374,6406,6406,6406,6374,8422,8390,12583,14728,14728,14664,12616,12648,12616,12648,12616,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10567,8487,6374,4293}, {6374,8487,10600,8487,6439,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8455,8455,10568,12648,12648,12616,14696,14729,14728,14728,14696,14696,16776,16776,18856,16808,18825,18792,20873,20840,18792,18792,16776,16841,8454,6406,6406,6406,6406,6406,6406,6406,6374,6406,6406,6406,6406,8454,8454,8454,8454,10534,22885,14630,14630,24901,27046,18856,20872,20840,22888,22888,27015,26982,31077,31109,31108,31108,31075,31140,31173,31205,31141,29061,29062,29028,26947,29027,31140,31140,31108,29060,26980,26981,26982,24967,24967,22919,20806,16645,14630,14598,14630,14630,12582,10502,10502,8454,8454,8454,8454,8454,8454,8454,8454,8422,8454,8454,8454,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,6406,8454,8454,8454,8454,8455,8455,8454,8422,8422,10535,12616,12648,12648,12648,12648,12648,12648,10568,10568,10568,10568,10568,10568,10568,10600,10568,10568,10568,8487,6406,6341,4293}, {8454,8487,10600,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8455,8455,10568,12648,12648,12648,14729,14729,14729,14728,14696,14728,16808,16808,16808,18825,18825,18825,20905,20905,18857,16809,14761,8422,6374,6374,6374,8422,6374,6373,6373,8422,8422,8422,8422,8421,8422,8421,8421,10469,10469,10437,12549,14597,14565,16711,20904,20871,20872,22921,22920,24967,27015,27014,27014,27013,27045,29094,29094,29093,29061,29061,29029,29063,29062,29093,29093,26981,26981,27046,24998,24966,24967,24935,24935,22918,22918,18726,14532,14597,14597,14597,14597,12549,10469,10469,10502,8453,8421,8421,8421,8421,8422,8421,8421,8421,8422,8422,8422,8422,8422,6374,6374,6374,6374,6374,6374,6374,6374,6374,6406,8422,6374,6374,6374,6374,6374,6374,6374,8422,8390,8422,10535,12648,12648,12648,12648,10600,10568,10600,10600,10600,10600,10600,10600,10568,10600,10568,8455,8454,6406,6374,4293}, {6374,8422,8519,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8488,6407,8455,8487,10568,10568,10568,12648,12648,12648,12616,12616,12615,12647,14695,14696,14696,14696,14696,14696,14696,16776,14728,14728,10567,10567,10536,12551,12551,14632,12583,12583,12583,12615,12615,12615,14663,14663,14663,14663,14663,14663,16711,18759,18759,20775,20807,20839,20871,22919,22920,24968,24967,24966,27046,27046,27046,27046,29095,29062,29094,29094,31142,31142,29062,31175,29094,29061,31142,31175,29095,27046,24967,27015,27016,27015,24966,20871,20839,18759,18758,18758,18758,18759,16711,16711,16711,14663,14663,14663,12615,12615,12615,12615,12583,12583,12583,12583,12583,12615,12615,12615,12615,12615,10535,10535,10535,10535,10535,10567,10567,10567,10567,10567,10567,8487,10536,10536,8487,8487,10567,8487,8487,10535,10567,10535,10535,10568,8487,8487,8487,8487,8487,8487,8487,8487,8487,8519,8487,8455,6406,8454,6406,4293}, {6341,6341,8487,8455,8487,6439,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,6439,8487,8487,8455,8455,8455,10503,10536,10536,10568,10568,10568,12615,12615,12583,12615,12616,12616,12648,12648,12615,12647,12615,12648,10599,12648,14696,14664,16680,16712,16744,14696,16744,16744,14696,16776,16776,16744,18792,18792,16776,18824,20904,20839,20807,22920,22887,22887,22951,25032,22887,27048,27047,24966,27047,27047,25030,27079,29095,31176,31142,31175,31110,31110,31174,31142,29094,31175,31143,31143,29095,27047,27048,24967,27016,27015,24999,22951,20872,20872,22887,22887,20839,20839,20872,20872,18792,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,16744,14696,14696,14696,14696,12648,12648,14664,14664,12648,12648,12648,12648,10600,10600,10600,10600,10568,10568,10568,10568,10568,10600,10600,8487,8454,8454,8455,8422,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8487,8487,8487,6406,4293}, {6341,6374,8486,8487,8454,8487,8455,8455,8487,8487,8487,8455,8487,6407,8487,8487,8455,10535,10568,10568,10568,10568,10568,10568,10568,10568,10568,10567,10568,10568,10568,10568,10568,12616,12648,12648,12648,12648,12648,12648,12648,12648,12616,12616,12616,12648,14664,12616,14663,14664,16744,16744,16712,16712,16744,16744,16744,18792,18791,18791,18824,20872,20871,20871,22886,22887,24967,24999,24999,24967,24967,24967,27015,27015,27015,27015,27015,29063,29063,27015,29063,27015,27015,27015,27015,27015,27015,27015,24967,24967,24967,24968,24967,22887,22887,22887,20872,20872,18824,18792,18791,16743,16743,16743,16744,16776,16776,16743,16711,16711,16712,16712,14663,14664,14696,14664,12616,12616,12616,12648,12616,12648,12648,12648,12648,12648,12648,12648,10600,10568,10568,10600,10600,10567,10568,10600,10568,54971,10568,8487,54971,8487,54971,54971,54971,54971,6407,54971,6407,8486,6406,54971,6438,8487,54971,54971,8455,8455,6406,4293}, {6341,6374,8487,54971,8455,8487,54971,8487,54971,54971,54971,54971,8487,54971,8487,8487,8487,54971,10568,10568,54971,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,12616,12648,12648,12648,12648,12648,12648,12648,12648,12648,12648,12648,12616,12616,12616,14664,14664,14664,16744,16744,16712,16744,16744,16744,16744,18792,18791,18791,18791,18791,18791,22887,22887,22919,22919,22919,24967,24967,24968,25000,27016,27015,27015,27015,27015,27015,27015,27015,27015,27015,24967,27015,27015,27015,24968,24967,24967,24967,22919,22887,22887,22887,22887,18791,18791,18791,18792,16743,16743,16743,16776,16776,16744,16744,16744,16744,16744,16744,16711,12615,14664,14664,14664,12616,12616,12648,12648,12616,12648,12648,12648,12648,12648,10600,10568,10600,10600,10568,10568,10568,10568,10568,10600,10568,54971,10600,54971,10568,8455,54971,8519,8488,8488,8455,54971,8487,8487,8519,54971,8486,54971,8487,8455,54971,8487,6374,4293}, {6341,8454,10600,54971,10568,54971,10600,10600,54971,8455,10632,8487,10600,54971,10600,10568,10568,54971,10568,54971,54971,10568,10568,10568,10600,10568,10600,10600,10568,10568,10536,10600,10568,10568,10600,10600,10600,12648,12648,12648,12648,12648,12648,12616,12616,12616,12616,12616,14664,14664,14664,14664,14664,14664,16744,16776,16744,16744,16744,16743,16743,16743,18791,18791,20839,20839,20839,20871,20871,22919,22952,22952,22952,22951,24967,24967,24967,24967,24967,24999,24967,24967,24967,24967,24967,24967,24967,22919,22919,22952,22919,20839,20839,20839,20839,20839,18791,18759,16743,16744,16743,16743,16744,16744,16744,16744,14695,14696,16744,16744,14696,14663,12616,12616,14664,12616,12616,12648,12648,12648,12648,12648,12648,12648,12648,12648,10600,10568,10568,10600,10568,10568,10568,10600,10600,10568,10568,54971,54971,10568,8487,8487,54971,54971,54971,10600,12713,12681,54971,54971,54971,10567,8454,54971,10600,8487,54971,8455,8454,8487}, {6374,8487,10600,54971,54971,10600,10568,10568,54971,54971,54971,10600,10568,10600,54971,54971,54971,10600,10568,10568,54971,10568,10568,10568,10600,10567,10600,10568,10568,10568,10568,10600,10568,10568,10568,10568,10568,10568,12648,12648,12680,12648,12648,12648,12648,14696,12648,12648,12616,12616,12616,14664,14664,14664,14696,16776,16744,16744,16744,16744,16744,16743,16743,16743,18791,18791,18791,18824,20871,20872,20872,20872,20872,20871,22919,22952,22952,22919,20903,22951,22951,22919,22919,22919,22919,22919,20871,20871,20871,20871,20871,18791,18791,18791,18791,18791,18791,16744,16744,16744,16776,16744,16744,14663,14696,14664,14663,14663,14696,14696,14664,12616,12616,12648,12648,12648,12648,12648,12648,12648,12648,12648,12648,10568,10568,10568,10568,10568,10568,10568,10568,10568,10600,10568,10600,10568,10600,54971,10568,54971,10600,10568,54971,10567,2147,2115,2084,2116,2116,54971,8455,10568,10567,54971,10568,10568,54971,10568,8487,6374}, {8422,8455,10568,54971,10536,54971,10568,10568,54971,10600,10600,12681,12713,12713,12680,54971,10568,10568,10568,10568,54971,10568,10568,10568,10568,10568,10600,10568,10568,10600,10568,10568,10600,10568,10568,10568,10568,10568,10600,10600,12648,12648,10600,10568,10568,12616,12648,12648,12616,12616,12616,12616,12616,12616,14696,14728,14696,14696,14696,16776,16776,16744,16744,16744,16744,16744,16744,18824,18824,18824,18823,18823,18823,18791,20871,20904,20904,20904,18856,18856,20904,20904,20872,20871,20871,20871,18823,18791,18791,18759,18791,18791,16775,16743,16743,16743,16744,16776,16776,16744,14663,14696,14663,12583,14663,14664,12616,12616,12616,12616,12648,12616,12648,12648,12648,12648,12648,12648,12648,12616,12648,12648,12648,10600,10568,10600,10600,10568,10568,10568,10535,10568,10568,10535,10568,10568,10536,54971,10568,10568,54971,10600,54971,54971,54971,54971,29616,29585,29617,54971,21133,10600,10600,10600,54971,54971,10568,10568,8487,8422}, {8422,8455,10568,54971,10568,10600,54971,10600,54971,54971,54971,54971,3,35,8422,54971,10568,10568,10568,54971,54971,54971,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10600,10568,10568,10568,10568,10568,10568,10600,10568,10568,10567,10535,8455,8454,10535,12616,12616,12648,12648,12648,12648,12616,12648,12648,14728,14728,14728,14696,16776,16776,16776,16776,16744,16744,16744,16776,16776,16743,16743,16743,16711,16711,18791,18791,18824,18856,18856,18824,18856,18824,20872,20840,18824,18824,18823,18791,18759,16678,16678,16711,16775,16776,16744,16744,16744,16776,16776,14663,12583,12583,12583,12583,12616,12616,12648,12648,12616,12648,12648,12648,12648,12648,12648,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10568,10535,8455,10568,10568,8455,10535,10568,10568,10568,10568,10568,10568,14826,35,12713,52890,57052,57052,57052,54972,57085,38035,2,16906,12681,10568,10568,10568,10568,10535,8422}, {8422,8455,10568,10568,10568,10568,10535,10535,2083,21100,29584,42262,46488,44407,29616,2,12712,10600,10567,10568,10568,10568,10536,8455,8487,8487,8487,10568,10568,8455,10568,10568,10600,10568,10568,10568,10600,10568,10568,10568,10568,10567,10535,8487,8454,8454,10535,10568,10535,10568,12616,12616,10568,12616,12616,12616,12648,14696,14696,14664,14664,14696,14728,16776,16776,14696,14696,16776,16744,16711,16711,16743,16711,16679,16678,16679,16711,16776,16776,16776,16776,16776,18792,18792,18792,18824,16711,16678,16711,16678,14598,14631,14695,16744,16744,16744,14728,14696,14663,12583,12550,10502,10502,12551,10535,12584,12616,12648,10568,10568,10600,10600,10600,12648,10568,10535,10535,8487,10535,10535,10568,10568,10568,10568,10568,10600,10600,10568,10535,8455,8422,10535,10567,8422,8455,10535,10568,10568,12648,12648,14761,3,35923,46520,54971,57052,55004,54971,54971,57052,50713,42294,16874,12648,12648,12649,10536,10568,8455,8454}, {8423,8455,10568,10568,10568,10568,10568,12680,16906,29584,40181,52859,57053,59198,40181,14760,14825,12680,10567,10567,10568,10568,8487,6374,6374,8454,6374,10568,10567,6374,8487,10600,10568,10568,10568,10600,10600,10568,10568,10568,10567,8487,8455,8454,8455,8455,10535,10567,8455,10535,10568,10568,10568,10568,10568,10568,10535,12616,12616,12583,10535,12583,14696,14728,14729,14697,14728,16776,16744,14663,14663,16711,16711,16678,14598,14566,14631,16743,16744,16776,16744,16744,16744,16744,16744,16743,16679,14566,16711,16679,14598,14598,14631,16744,16776,16744,14728,12615,12582,12582,12583,10502,10470,10502,10470,10503,10568,10568,10568,10568,10568,10568,10567,10568,10567,8487,8454,8454,8455,8455,10568,10568,10568,10568,10568,10568,10568,10568,8422,8422,8422,10567,10567,8422,8422,8422,10568,10568,10568,12681,18987,12712,46520,59166,52891,54939,54971,54972,55003,54971,57084,54971,27438,16874,14794,12649,10536,12648,8454,8422}, {8422,10535,10600,10567,10568,12712,2,10535,50713,52859,54939,54939,54972,54972,54939,52826,12712,34,10632,10600,10567,8422,8487,6374,8422,8454,6374,10567,10567,8454,10568,10600,10568,10568,10568,10568,10568,10568,10568,10568,8454,8422,8422,8422,8422,8422,8487,10567,8455,8455,8455,10535,10568,10568,10568,10567,10568,10535,10502,10502,10502,10502,12615,14696,12616,12616,12648,14664,14663,12550,14663,16711,14630,14598,14598,14598,14631,16711,16744,16776,16744,16744,16776,16776,16744,14598,14598,14598,16711,14631,14598,12550,14631,14664,14696,14664,14728,12615,10502,10470,10502,10502,10502,10502,10503,10503,12616,10568,10568,10600,10568,10600,10600,10535,8422,8422,8422,8422,8422,8454,8422,10535,10568,10568,10568,10568,10568,10567,8454,8454,8422,10567,10599,10568,8455,8422,8422,8455,12680,4229,29584,54940,54972,54939,23278,40182,57118,57053,57085,55003,54939,54971,55004,44374,3,14794,10568,10568,10567,6374}, {8422,8455,10535,10600,10599,6341,31665,40148,54939,54972,54971,54972,54971,54972,57052,54939,40213,29616,8486,10567,8487,8454,6374,8454,8454,8454,8422,10567,10567,6374,8487,8487,10600,10600,10568,10568,10568,10568,10568,10567,8422,8422,8422,8422,8422,8454,10535,10599,8455,8455,8455,10535,10568,10568,10568,10568,10567,10535,8454,10502,8454,10502,10534,12583,12648,12648,12648,12615,12583,10470,14631,14663,14630,14598,14598,14598,14598,14631,16744,16776,16776,14696,14696,14696,14663,14631,14598,14631,14663,12582,12550,12550,12551,12583,12583,12615,12615,10534,10502,10502,10502,10502,10502,10503,8422,10535,10568,10568,10568,10568,10568,10568,10568,8487,8422,8422,8454,8422,8422,8422,8454,10535,10568,10568,10567,10568,10567,10535,8454,8454,8422,8487,10567,10599,8455,8422,8422,8422,10600,2115,31664,54972,57052,52859,19053,29619,46489,44408,46489,55004,55004,54971,57117,46487,2115,14761,10600,10568,8487,8422}, {8422,8455,12680,10600,12680,2,44375,59165,54971,54972,54971,54972,54971,54971,54971,54971,59165,46487,2,10599,8454,8422,8422,8422,8454,8454,8454,10567,10567,8454,8454,8422,10568,10568,10600,10600,10568,10568,10568,10568,8422,8422,8422,8422,8454,8454,8487,10567,8455,8454,8454,8487,10568,10568,10568,10568,8455,8455,8454,10502,8454,10502,10502,10502,12648,12648,12647,10567,10502,10470,12615,14663,12582,14630,14630,12550,12550,14631,14695,16776,14728,14696,12648,12615,12583,12550,12550,12583,12615,12583,10502,10502,10470,10470,8454,8454,10502,8454,8454,10502,10502,10502,10470,10502,8455,10535,10535,10568,10600,10568,10568,10600,10600,10535,8454,8422,8454,8454,8454,8454,8422,8486,10567,10599,10567,10567,8486,8422,8454,8454,8454,8454,8486,10600,8486,8454,8422,8422,10567,2,27503,57052,55004,54939,21168,12683,14796,2085,29585,57086,55005,54972,57052,44406,2115,12713,10567,12680,8455,6374}, {8422,10535,12648,35,27471,50746,54939,57052,54971,55003,54971,57051,55003,54971,54971,54971,54971,54939,50745,27503,2,10567,8455,8454,8422,8454,8454,8454,8487,10567,8455,8422,8455,8487,10568,10600,10568,10567,10568,10568,8454,8422,8422,8422,8454,8454,8454,8486,10535,10535,8487,8487,8455,8455,8455,8454,8422,8454,8454,8454,8454,10502,8454,10502,10535,10535,10534,8454,8454,8454,10534,12615,10502,10502,12550,12550,10502,10502,12582,12583,14696,12648,10567,10535,10502,10502,10502,10502,10502,10535,10535,10502,10502,10503,10535,8454,10502,8454,8454,10502,10502,8422,8422,8454,10535,10535,8454,10567,10600,10600,10600,10600,12648,10535,8454,8422,8454,8454,8454,8454,8422,8454,8486,8486,8454,8454,8454,8422,8454,8422,8454,8422,8454,12648,8487,8422,8455,8422,4228,38068,46520,55004,55004,54939,23248,16909,19022,19054,23215,29585,27504,31729,54939,54971,50746,27503,2115,10600,6374,6342}, {6374,10567,10600,35,25390,50778,54939,54971,54971,55003,54971,54971,54971,54971,55003,54971,54971,54939,52826,25390,2,10535,8422,8422,8422,8422,8454,8422,8454,10535,10535,8455,6374,8455,10567,10568,10600,10568,10567,10535,8454,8422,8422,8422,8454,8454,8454,8454,10567,10600,10567,8487,8422,8422,8422,6374,8422,8454,8454,8454,8454,10502,10503,8454,8454,8454,8454,8454,8454,10534,10535,12615,10502,10470,10502,10502,10502,10502,10502,8422,10567,10567,10535,10534,8454,8454,8454,8454,8422,10535,10567,10535,8454,10535,8455,8454,8454,8454,8454,8454,8454,8422,8454,10535,10568,10535,8422,8455,10567,8487,10568,10567,10567,8487,8422,8422,8422,8422,8454,8422,8454,8454,8454,8422,8422,8422,8454,8454,8422,8422,8454,6374,8454,10600,8487,8422,8455,8422,4229,38068,46520,54972,54972,54939,21200,14828,19022,19022,23247,27505,27472,31729,54971,52859,52859,25391,2116,12681,8455,4261}, {8454,8455,10600,8487,10632,1,44374,57084,54939,54971,54971,54971,54971,54971,55003,54971,57084,44374,1,10535,10535,8422,8455,8454,8454,8454,8454,8454,8422,8455,8487,10568,8455,8455,8455,8487,10568,10568,8487,8454,8422,8422,8422,8422,8454,8454,8454,8454,8487,10568,10567,8455,8422,8455,8455,8455,8422,8454,8454,8422,8454,8454,10502,8454,10503,8454,8454,8454,8486,10568,10567,10567,10503,10502,8454,10502,10503,10503,10502,8454,8454,8454,8454,8454,8454,8454,8454,8455,8486,10535,10568,10568,10535,8455,8454,8422,8422,8422,8454,8454,8422,8422,8487,10567,10568,10535,8454,8454,8455,8422,8455,8455,8454,8422,8422,8422,8454,8454,8454,8422,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8454,8455,10600,8455,8422,8422,8455,10535,2,27471,55004,54972,54939,23279,14827,16973,2117,29617,57086,55005,57084,57052,44407,10600,14793,6342,8423,6342,4261}, {6374,6374,8487,8454,10632,34,44407,55036,54971,55003,54971,55003,55004,54971,57052,54971,57084,44407,2115,12647,8454,8422,8422,8422,8455,8455,8455,8455,8455,8422,8487,10568,8487,8455,8454,8487,8519,8487,8455,8422,8454,8454,8454,8454,8454,8454,8454,8454,10568,10568,10567,8487,8455,8454,8455,8455,8455,8455,8455,8455,8454,8454,8454,8454,10503,10503,8454,8454,8455,10568,10535,10503,8455,8454,8454,8454,8454,8455,8454,8455,8454,8454,8454,10470,8454,8455,8455,8455,8455,8455,8487,10568,10568,8487,8455,8455,8422,8454,8454,8454,8454,8487,10567,10600,8487,8455,8455,8455,8454,8422,8422,8455,8454,8454,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8454,8455,8487,8519,8487,8487,8487,8487,8487,10568,8487,8455,8455,8455,10535,3,29616,54972,55004,52859,21165,19085,29617,40247,46553,54972,54939,54971,57085,46456,8422,12681,8455,8455,6374,6341}, {4261,6374,8454,8487,10599,34,44374,57085,54971,54971,54938,54938,54939,52891,54971,54971,57084,44374,2,12680,8486,8487,8455,8455,8455,8455,8455,8455,8455,8455,10536,10568,8487,8487,8487,8454,8454,8454,8454,8454,8455,8455,8454,8454,8454,8454,8486,8486,10568,8487,8455,8487,8455,8455,8455,8455,8455,8455,8455,8455,8455,8454,8454,8454,10471,10503,10503,10503,8455,10568,10503,8455,8455,8455,8455,8455,8455,8455,8455,8455,8454,8454,10502,10502,8454,8454,8455,8455,8455,8455,8455,10535,10568,10568,10535,8454,8487,8455,8454,8454,8487,10568,10568,10568,8487,8454,8455,8455,8487,8487,8455,8455,8455,8455,8455,8455,8455,8455,8455,8487,8454,8455,8455,8487,8487,8455,8487,10568,10600,10600,10568,10600,10568,10568,8487,8455,8455,8455,10568,2083,27503,54940,54972,52891,25390,29649,38101,52892,55036,54971,55003,54939,54972,44375,3,12681,8455,8455,8454,6341}, {4261,6374,8454,8454,12680,2,44407,57052,57085,44407,14792,21131,19051,12712,44407,57084,57085,44375,2,12680,8455,8487,8455,8454,8455,8455,8455,8455,8455,8455,8455,8455,10568,8487,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8487,10600,8487,8487,10567,10535,8455,8455,8454,8455,8454,8454,8487,8487,8454,8455,10535,10567,8487,8455,8487,8455,8487,10567,8487,8487,8487,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8487,10567,10568,10567,10568,10567,10567,10567,10567,10567,8487,8454,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8454,8454,8455,8455,8455,8455,8455,8455,10568,10568,10600,10600,10568,10568,10568,10568,8455,8487,8455,12680,16938,14793,46520,57117,52890,52890,54938,54971,54971,54972,57084,54972,31664,21132,14793,10567,8422,8455,8455,8455}, {4261,6341,8486,8487,12680,34,46455,57052,57052,44407,2082,10566,8486,1,44407,55004,57085,44407,35,10600,10535,8455,8422,8455,8455,8455,8455,8455,8455,8455,8455,8455,8487,10567,10567,8487,8487,8455,8455,8487,8487,8455,8455,8487,8487,8487,8487,8487,8487,8487,10568,8487,8454,8455,8454,8455,8455,8454,8487,8487,8454,8455,8487,10535,8487,8487,8487,8487,8487,10567,8487,8454,8487,8487,8455,8455,8455,8455,8455,8455,8455,8455,8455,8487,8455,8455,8455,8455,8455,8455,8454,8454,8487,8487,8487,8487,8487,10567,10567,10567,10567,10567,10567,10567,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,10567,10567,10567,10567,8487,10536,10568,10568,10568,8487,10567,10600,12713,2,35923,46552,54971,55004,55004,54971,54971,57052,50713,42294,21164,14793,12648,10535,8455,10535,8455,8422}, {6341,6341,8454,8455,10600,2,44407,57085,57085,44407,2083,14793,12744,2,44407,57085,57085,44407,2,12680,8487,8422,8454,8487,8455,8455,8455,8455,8455,8455,8487,8487,8454,8487,10568,10568,10567,8487,8455,8455,8455,8455,8487,10567,10600,10568,8487,8455,8454,8487,10568,8487,8454,8455,8455,8455,8454,8454,8454,8454,8454,8454,8455,8487,10568,10568,10568,10568,10567,10567,10567,8455,8455,8455,8455,8455,8454,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8454,8454,8455,8487,8455,8454,8454,8454,8455,8455,8454,8455,8487,10567,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8454,8455,8455,8455,8455,8455,8455,8487,10568,10568,10568,10600,10568,10600,16906,2115,12712,52891,55004,55004,55004,54972,57117,38035,2,16906,10599,8454,8454,8487,10600,8487,6374}, {4261,6374,8487,8487,8455,6342,23245,31697,29616,25358,10600,12680,10599,8487,23278,29617,29617,23245,6341,8454,8487,8487,8487,6374,8455,8455,8455,8455,8455,8455,8455,8455,8455,8487,8487,8487,8487,10567,10568,10567,10568,10568,10568,8487,8487,8487,8487,8455,8454,8487,10568,10567,8487,8455,8455,8455,8487,8454,8454,8454,8454,8454,8454,8454,8487,8487,8487,10567,10567,8487,8487,8454,8455,8454,8454,8454,8454,8454,8454,8454,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8454,8455,8455,8454,8454,8455,8455,8487,8455,8454,8455,8487,8487,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8455,8454,8487,8455,8455,8487,8487,8455,8487,10600,10568,10600,10567,10567,8487,8454,10567,14793,29583,29616,29616,29616,29616,29649,21132,10567,12680,10568,10567,8487,10568,10568,8454,6342}, {4261,6342,8455,8455,8455,8455,2083,2,3,6309,14761,10568,8487,12680,4228,35,3,2116,8455,8454,8455,8454,8487,8487,8455,8455,8455,8455,8487,8487,8486,8486,8487,8487,8454,8454,8487,10567,10567,10567,10567,10600,10567,8487,8454,8454,8487,8487,8454,8487,10567,10568,10567,8455,8455,8487,8487,8487,8487,8487,8487,8487,8455,8455,8455,8455,8455,10568,10567,8454,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8454,8454,8454,8454,8454,8454,8454,8454,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8454,8487,8487,8455,8455,8487,10568,10568,10568,10600,8455,8487,8487,8454,8454,2115,2115,35,2115,35,35,8454,8487,10567,10568,10568,10568,10568,10567,6374,4261}, {4261,6342,8487,8455,8487,8455,8487,10600,10535,10568,10535,10535,8487,8455,8487,10568,10568,10567,8454,8455,8422,8454,8455,8455,8454,8454,8455,8455,8455,8455,8454,8454,8454,8454,8487,8487,8487,8487,8487,8454,8454,8454,8487,8487,8487,8487,8487,8454,8487,8487,8455,10567,10567,8455,8455,8487,8487,8454,8454,8487,8487,8487,8454,8455,8487,8455,8487,10568,10567,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8454,8454,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8454,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8454,8454,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8487,8519,10600,10600,10568,8487,8487,8487,8487,8487,8487,10600,8487,10600,10568,10600,10568,10568,8455,10600,10567,8455,8422,8487,8487,6374,4261}, {6342,4294,6406,6342,6342,8487,6342,6342,8422,8487,8455,8422,6374,6342,6374,6375,6374,6374,8455,6342,8454,8455,6374,6342,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6406,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,8454,8487,8454,8454,6374,6374,6374,6374,6374,6374,6374,6374,6406,6374,6374,8455,8455,6406,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,6374,8455,8487,8455,8454,6341,6374,6374,6342,6374,6342,6374,6374,6342,6374,4261,8455,8455,8455,8455,6374,6374,6374,6374,6342,6342}, {4294,4294,4293,4293,6342,4229,6341,6342,8422,8422,8423,6342,4261,6342,4261,6342,6341,6341,4261,6342,6342,4261,6342,6341,4293,4293,6341,6341,6341,6341,6341,6341,6341,4293,4293,6341,6341,6341,6341,6341,6341,6341,6341,6341,6341,6341,6341,6341,4293,6341,4261,6374,8454,6374,6374,4261,4293,4261,4293,4293,4293,4293,6341,6341,4261,6342,8454,6342,4293,6341,4261,4261,6341,6341,6341,6341,6341,6341,6341,6341,6341,6341,6341,6341,6341,6341,6341,6341,6341,6341,6341,6341,6341,4293,4293,6341,6341,6341,6341,6341,6341,6341,6341,6341,4293,4293,6341,6341,6341,6341,6341,6341,6341,6341,6341,6341,6341,6341,6341,6341,6341,6341,6341,6341,6341,4293,4293,4293,4293,6341,6341,6341,6341,6341,4261,4261,6374,6374,4261,6342,4261,6342,4261,6342,6342,6342,6342,6342,6342,6342,6342,8422,6374,6342,6341,6341,6341,4261,6341,6342}, };
-
-//purple big tank
-const uint16_t pd[40][40] = { {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,32,32,0,0,0,32,32,32,32,0,0,0,32,32,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,32,12456,14569,2112,0,0,8294,14474,14442,8294,0,0,2112,14569,10407,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,2113,2145,0,0,4258,16523,18636,6307,2113,2145,14473,20557,20589,14473,2145,2113,4259,18636,14506,4226,0,0,2113,2113,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,2080,16649,14569,32,32,14537,37589,39669,18635,14443,14442,39764,46070,46102,37716,14441,14442,18635,39701,35540,14505,0,32,16618,14601,32,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,2112,16523,16491,6307,6339,18668,39702,41782,16396,14347,20653,41909,46166,46134,41909,20653,14347,16396,41782,39702,18669,8388,6339,16460,16523,2112,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,64,16554,16396,16491,20749,39734,41814,37653,14379,18572,44054,44053,44021,44021,44054,44023,18572,16427,37653,41814,39734,20749,16491,16396,16554,2112,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,64,14506,16397,14348,20653,41814,22766,18572,39765,41909,44053,44021,44021,44021,44021,44054,41909,39764,18573,22766,41846,20653,14347,16396,16554,2112,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,64,14506,16396,14347,20621,39701,20685,18539,44022,46166,44021,44021,44022,44021,44021,44021,46166,44022,18571,20653,39702,20621,16395,16396,16554,2112,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,64,14506,16396,14347,14347,16460,39765,44054,44021,44022,46134,46134,46134,46134,46134,46134,44022,44022,44054,39764,16460,14347,14347,16396,16554,2112,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,64,14474,16428,20653,18572,16395,39797,46166,44054,44022,39796,39764,39764,39796,39796,39796,44022,46102,46166,39829,16394,18572,20653,16396,14506,64,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,64,14441,18541,46103,41845,16459,37716,44086,46134,41877,16458,16427,16459,16459,14379,14411,41877,46134,46134,39764,16459,41877,46102,18541,14473,64,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,64,14441,18541,46134,41877,16459,39797,44054,20717,18637,31346,31378,29330,29330,31379,29298,20717,20684,44021,39796,16427,41877,46134,18541,14473,64,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,64,14441,18541,44054,39797,16427,39796,46103,16395,14379,33556,31539,31507,31507,33587,33556,14380,14347,43990,39828,16427,39796,44054,18541,14473,64,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,64,14441,18541,44054,39797,16427,39796,46102,18508,16460,31475,31507,31475,31475,31475,31475,16492,16395,43990,39828,16459,39796,44054,18541,14473,64,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,64,14441,18541,44054,39828,16427,39796,46102,18508,16492,31475,31475,31475,31475,31507,31475,16492,16427,44022,39796,16459,39828,44054,18541,14473,2112,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,64,14441,18541,44054,39828,16427,39796,46102,18508,16460,31475,31475,31475,31475,31507,31475,16492,16427,44022,39796,16459,39828,44054,18541,14473,2112,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,64,14441,18541,44054,39828,16427,39796,46102,18508,16492,33555,31539,31507,31507,31539,33555,16492,16427,44022,39796,16459,39828,44054,18541,14473,64,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,64,14441,18541,44054,39828,16427,39796,46102,18508,16460,31443,31443,31411,31411,31443,31443,16492,16427,44021,39796,16459,39828,44054,18541,14473,2112,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,64,14441,18541,44054,41844,16427,39796,46102,16460,14347,16428,16428,16396,16428,16428,16460,14347,16395,43990,39797,16427,39828,44054,18541,14473,64,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,64,14441,18541,46134,41877,16427,39829,44086,20717,18572,14347,16427,16459,16458,16427,14347,18540,20717,44054,41877,16427,41877,46134,20589,14473,64,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,2112,12393,16491,46103,41877,16459,39765,46134,46134,41877,14378,20876,23115,23083,20875,14378,41878,46134,46134,39765,16427,41846,44054,16492,14441,2112,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,2080,14568,14536,18636,18573,14347,18540,20749,44021,46134,41877,25164,21034,21034,25164,41877,46134,44022,20749,18540,14347,18573,18636,14536,14568,2081,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,32,14664,18858,14346,16395,18509,14347,16460,41941,46134,46134,25196,21002,21002,25196,46134,46134,41909,16459,14347,18508,16396,14346,16809,14664,32,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,2081,12519,8293,14346,20653,39702,20589,16460,41941,46134,44053,25164,21002,21001,25196,44054,46134,43990,16460,20589,39702,20654,12298,8293,12519,2113,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,2081,12551,10406,14346,20653,41814,20589,16427,44022,46135,44053,25196,21002,21002,25196,44053,46134,44022,16427,20589,41814,20654,12298,10406,12552,2081,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,32,16713,18858,14378,20621,39734,20621,18508,43990,46134,44053,25196,18954,18954,25196,44053,46134,43990,18507,20621,39734,20622,14378,18858,16713,33,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,2081,12519,10406,14346,20653,39766,39701,37556,18604,22861,44086,18889,12614,12582,18889,46134,22830,20653,37556,39669,39766,20622,12298,10406,12519,2081,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,2081,12519,8325,14346,20621,37621,41814,39701,14347,18508,44022,20971,14728,16776,20971,44022,16492,14347,39702,41846,37621,20622,14346,8325,12519,2081,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,32,14664,18858,16459,16396,18508,37620,39702,18508,14347,18540,39796,42005,44053,39796,18540,14347,16460,39701,37620,18508,16396,16459,18858,16744,32,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,32,14696,14568,16554,16522,14347,37588,39734,18508,14347,14346,41877,46166,46166,41845,14347,14347,18508,39733,39637,16395,14474,16554,14536,14696,32,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,4226,10470,6340,4226,16586,39669,39734,18509,14347,16395,39797,46134,46134,39796,16395,14347,18508,41782,37653,16586,2178,8388,10502,4226,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,6339,18700,20622,16396,14347,16395,41877,46134,46134,41877,16395,16395,16396,20622,18699,6339,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,10407,16491,16395,16396,16491,39764,46133,46134,39764,16491,16427,16395,16491,12455,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,2113,4226,14378,16522,6180,24878,48247,48247,24878,6180,16554,14378,4194,2113,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,14569,14600,4162,20812,43958,43958,20812,4162,14568,14537,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2112,32,32,4194,14443,16491,4194,32,32,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2081,2081,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, };
-const uint16_t pdl[40][40] = { {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,61277,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,52730,22989,44342,65535,63455,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,52762,20845,20781,52826,65535,65535,65535,63390,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,52762,20877,12299,27280,65503,52889,46391,46391,16683,54939,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,52762,22957,14347,18573,12299,31441,25102,33395,33395,22989,57051,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,54842,22957,12299,18572,14347,24943,39669,39701,41814,37589,37908,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,54842,22957,16396,22830,12298,18573,35508,33394,33394,37588,22830,14347,35763,63454,33745,46423,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,54875,23022,10250,37683,43958,24942,12298,31345,16427,22797,31313,10250,18477,16459,35635,16395,16556,48504,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,54907,22990,10250,35603,46134,39796,18444,29264,44022,37683,39796,44022,35603,39764,37683,46103,39764,14347,14410,59132,65535,65503,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,56955,22989,10250,37651,46134,39796,14347,29264,44054,44021,44022,44022,44021,44054,44054,44054,44021,46135,39797,46422,65535,63455,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,56987,22989,10250,35603,46134,39796,16395,29232,46102,41941,44022,44054,44022,44021,44021,44021,44021,44021,44022,31377,31505,63422,65535,59132,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,57019,22989,12298,35603,46134,39796,16395,29232,44054,44022,25006,31345,35603,35570,46102,44021,44022,44021,44021,43990,27087,14347,29393,46423,16651,42197,65535,65503,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65503,65535,57020,22989,10250,35603,46134,39828,16395,29200,44022,44022,29200,6152,22926,27120,14347,35570,44054,44022,44021,44021,43989,25007,8233,29136,37588,25070,52794,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65503,65535,57020,20972,12297,35603,46134,41877,16395,27152,44022,44022,29200,8201,22927,31475,33556,29233,14346,35538,46102,44021,44021,44022,33490,27088,41782,39669,29329,61277,65535,65503,65535,65535}, {65535,65535,65535,65535,65535,65503,65535,57052,23084,10471,22924,43990,41877,16396,27119,44022,44022,29200,8202,22927,31475,31507,29427,31507,29265,14347,33457,44022,44021,44054,37683,27056,39733,33362,27343,61277,65535,65535,65535,65535}, {65535,65535,65535,65535,65503,65535,59100,23052,2049,16714,12299,27055,22829,27151,44022,44022,29200,8201,22894,31443,31475,31475,31475,31475,33555,29266,20781,41909,44054,44022,25070,14347,37620,37621,44246,65535,50649,54906,65535,65535}, {65535,65535,65535,65503,65535,59132,25165,10406,14505,14347,16396,12299,16396,41877,44054,27119,8202,20814,31443,31475,31475,31475,31475,31474,31475,31443,27152,41909,44021,44054,39829,33363,37588,18605,16588,35763,14347,29424,65535,65535}, {65535,65535,65535,65535,59132,23084,6147,18795,14347,20685,37556,27024,10250,25006,44021,35603,18476,16492,29265,33524,31475,31475,31475,31475,31443,22926,4104,31344,44054,44022,29231,18605,20717,14347,16460,14347,23022,57052,65535,65535}, {65535,65535,65535,59164,25229,10373,12456,14346,18572,37589,37556,16428,16396,37651,44053,39796,16396,16395,14347,27217,33556,31474,31475,31475,22926,10250,25007,41909,44022,27152,16395,16395,14347,18572,14347,23022,59100,65535,65503,65535}, {65535,65503,65535,46423,12487,14538,16395,20717,37588,35508,12298,14347,37651,44054,44053,39828,22956,20876,16427,14347,27185,33555,31475,22927,8201,25006,41941,44054,27151,16396,41877,35603,16428,14347,22990,57052,65535,65503,65535,65535}, {65535,65535,65535,59197,29488,23022,14347,27088,39734,37588,27023,37652,46102,41973,44054,35697,23083,23115,22988,16523,16395,27185,22959,10249,24974,41941,44054,27151,16396,41877,46134,35603,12299,23021,57052,65535,65503,65535,65535,65535}, {65535,65535,65535,65535,65535,52698,16396,24975,39701,39702,29168,37683,44022,44054,35665,18922,21034,21035,20970,18635,12298,14347,12298,24942,41941,44054,29232,16395,39828,46134,35603,10250,22989,57020,65535,65503,65535,65535,65535,65535}, {65535,65535,65535,65503,65535,44342,27120,39701,39702,27088,6152,27087,44054,35697,20970,21034,23083,18921,31472,27183,33458,20749,22830,41909,44054,29232,16395,39828,46134,35603,10250,23022,56987,65535,65503,65535,65535,65535,65535,65535}, {65535,65535,65535,65503,65535,52794,35540,41782,27088,12298,20717,41909,35665,16808,21067,23115,18889,31472,44054,44021,46134,41909,39860,46102,29232,14347,39796,46134,35603,12298,25070,56955,65535,65503,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,63423,23053,16396,24976,14347,16492,14347,33489,16776,12614,21002,18921,31471,44054,44021,46102,37716,37715,46103,29232,14347,39796,46134,37651,12298,23022,54907,65535,65503,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,50585,18668,14379,18572,10250,31345,44022,35697,14728,6307,29422,44086,44021,44054,39797,18540,16396,27120,18604,39796,46134,37651,12298,22990,54875,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,40084,16396,18605,12298,31345,44054,44053,44054,35698,29391,44021,39764,46102,39829,18605,14347,18541,6153,33426,46103,37683,14346,22957,54874,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,25199,27311,42133,29232,46102,44021,44021,46102,35603,29296,31345,8201,33458,22829,8201,33395,33395,14347,16460,29296,16395,22925,54842,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65503,54906,18828,35603,44054,44021,46102,35603,14347,14347,10249,22830,37556,29169,31314,39701,24975,14347,16683,8229,20876,54842,65535,63455,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65503,65535,61277,35602,46070,44054,44054,35571,14347,16428,14347,22798,37621,41814,41782,37653,22863,12298,14473,8292,23052,52794,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,59196,16619,39797,41845,22733,25102,16396,16396,22830,39701,41814,33394,35507,24943,12299,18763,8325,18858,52761,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,40117,31537,35698,42197,42133,12299,12299,29137,39734,31249,4104,16396,16395,14473,10438,23020,50681,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,54874,16492,25167,27216,16620,37812,27311,37844,18636,16683,6212,18858,50649,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,44310,61277,61245,48536,65535,65503,63358,25165,3,23084,50649,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,50648,31632,50648,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, };
-const uint16_t pdr[40][40] = { {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,65503,65535,54906,29424,57052,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,50649,14347,23022,59100,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,42197,52794,61277,61277,65535,35763,14347,23022,57052,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,59132,16651,25070,29329,27343,44246,16588,16460,14347,22990,57052,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63455,65535,46423,37588,39669,33362,37621,18605,14347,18572,14347,23021,57020,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,59132,65535,63422,29393,29136,41782,39733,37620,37588,20717,14347,16428,12299,23021,56987,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,48504,14410,46390,31505,14347,8233,27088,27056,14347,33363,18605,16395,35603,35603,10250,23022,54907,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,46423,16556,14347,39797,31377,27087,25007,33490,37683,25070,39829,29231,16395,41877,46134,35603,10250,25070,54907,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65503,65535,33745,16395,39764,46135,44022,43990,43989,44022,44054,44022,44054,44022,27152,16396,41877,46134,35603,12298,23022,54875,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,63454,35635,46103,44021,44021,44021,44021,44021,44021,44054,44021,44054,44022,27151,16396,39828,46134,35603,12298,22990,54874,65535,63455,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,54939,57051,65535,35763,16459,37683,44054,44021,44021,44021,44021,44022,41909,41909,31344,41909,44054,27151,16395,39828,46134,37651,12298,22957,54842,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,63390,16683,22989,37908,14347,18477,39764,44054,44021,44022,44022,46102,33457,20781,27152,4104,25007,41941,44054,29232,16395,39796,46134,37651,14346,22925,54842,65535,65503,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,46391,33395,37589,22830,10250,35603,44054,44021,44021,44054,35538,14347,29266,31443,22926,10250,25006,41941,44054,29232,14347,39796,46134,37683,16395,20876,52794,65535,65503,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,63455,65535,46391,33395,41814,37588,31313,44022,44021,44021,46102,35570,14346,29265,33555,31475,31443,22926,8201,24974,41941,44054,29232,14347,39796,46103,29296,8229,23052,52761,65535,65503,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,52889,25102,39701,33394,22797,39796,44022,44022,35570,14347,29233,31507,31475,31474,31475,31475,22927,10249,24942,41909,46102,29232,18604,33426,16460,16683,8292,18858,50681,65535,65503,65535,65535,65535,65535}, {65535,65535,65535,44342,52826,65503,31441,39669,33394,16427,37683,44022,44054,35603,27120,33556,29427,31475,31475,31475,31475,31475,22959,12298,22830,39860,46103,27120,6153,14347,14347,14473,8325,23020,50649,65535,65503,65535,65535,65535}, {65535,65535,61277,22989,20781,27280,12299,24943,35508,31345,44022,44021,44022,31345,22926,31475,31507,31475,31475,31475,31474,33555,27185,14347,20749,41909,37715,16396,18541,33395,24975,12298,18763,10438,18858,50649,65535,65535,65535,65535}, {65535,65535,65535,52730,20845,12299,18573,14347,18573,12298,29264,44054,41941,25006,6152,22927,31475,31475,31475,31475,33556,27185,16395,12298,33458,46134,37716,18540,14347,33395,39701,22863,12299,14473,6212,23084,50648,65535,65535,65535}, {65535,65535,65535,65535,52762,20877,14347,18572,12298,24942,18444,29264,46102,44022,29200,8201,22927,31443,31475,33524,27217,14347,16523,18635,27183,44021,46102,39797,18605,8201,31314,37653,24943,16395,16683,3,31632,65535,65535,65535}, {65535,65535,65535,65503,65535,52762,22957,12299,22830,43958,39796,14347,29232,44054,44022,29200,8202,22894,31443,29265,14347,16427,22988,20970,31472,44054,44021,44054,39829,22829,29169,41782,35507,16396,18636,25165,48600,65535,65535,65535}, {65535,65535,65535,65535,65503,65535,52762,22957,16396,37683,46134,39796,16395,29232,44022,44022,29200,8201,20814,16492,16395,20876,23115,21035,18921,31472,44054,44021,46102,33458,37556,41814,33394,4104,37844,63358,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65503,65535,54842,22957,10250,35603,46134,39796,16395,29200,44022,44022,29200,8202,18476,16396,22956,23083,21034,23083,18889,31471,44086,39764,8201,22830,37621,41814,31249,27311,65503,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65503,65535,54842,23022,10250,37651,46134,39796,16395,27152,44022,44022,27119,35603,39796,39828,35697,18922,21034,23115,18921,29422,44021,31345,10249,22798,39701,39702,37812,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65503,65535,54875,22990,10250,35603,46134,39828,16395,27119,44022,44054,43989,44053,44053,44054,35665,20970,21067,21002,6307,29391,29296,14347,14347,22830,29137,16620,48536,65535,65503,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,54907,22989,10250,35603,46134,41877,16396,27151,41877,25006,37651,44054,41973,44054,35697,16808,12614,14728,35698,35603,14347,16428,16396,12299,27216,61245,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,56955,22989,12298,35603,46134,41877,22829,16396,10250,16395,37651,46102,44022,44054,35665,16776,35697,44054,46102,35603,14347,16396,12299,25167,61277,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,56987,22989,10250,35603,43990,27055,12299,27023,16428,14347,37652,37683,27087,41909,33489,44022,44053,44021,46102,35571,25102,42133,16492,44310,65535,65503,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,57019,22989,12297,22924,12299,16396,37556,37556,12298,27023,29168,6152,20717,14347,31345,44054,44021,44021,44054,22733,42197,54874,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,57020,20972,10471,16714,14347,20685,37589,35508,37588,39702,27088,12298,16492,10250,31345,46102,44054,44054,41845,35698,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,57020,23084,2049,14505,14347,18573,37588,39734,39701,39702,27088,14347,18572,12298,29232,35603,44022,39797,31537,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,57052,23052,10406,18795,14346,20717,27088,24975,39701,41782,24976,14379,18605,42133,18860,35602,16619,40117,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,59100,25165,6147,12456,16395,14347,16396,27120,35540,16396,18668,16396,27311,54906,61277,59196,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,59132,23084,10373,14538,23022,52698,44342,52794,23053,50585,40084,25199,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,59132,25229,12487,29488,65535,65535,65535,63423,65535,65535,65535,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,59164,46423,59197,65535,65503,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, };
-const uint16_t pl[40][40] = { {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,32,32,2081,2081,32,2081,2081,32,2080,2112,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,2112,2080,0,0,0,0,0}, {0,0,0,0,0,0,0,4226,14696,14664,12519,12519,16713,12551,12519,14664,14568,12393,14441,14441,14441,14441,14441,14441,14441,14441,14441,14441,14474,14506,14506,14506,16554,16523,16649,2113,0,0,0,0}, {0,0,0,0,0,0,0,10470,14568,18858,8325,10406,18858,10406,8293,18858,14536,16491,18541,18541,18541,18541,18541,18541,18541,18541,18541,18541,16428,16396,16396,16397,16396,16491,14569,2145,0,0,0,0}, {0,0,0,0,0,0,0,6340,16554,16459,14346,14346,14378,14346,14346,14346,18636,46103,46134,44054,44054,44054,44054,44054,44054,44054,46134,46103,20653,14347,14347,14348,16491,6307,32,0,0,0,0,0}, {0,0,0,0,0,0,0,4226,16522,16396,20621,20653,20621,20653,20653,16395,18573,41877,41877,41844,39828,39828,39828,39828,39797,39797,41877,41845,18572,14347,20621,20653,20749,6339,32,0,0,0,0,0}, {0,0,0,0,0,0,6339,16586,14347,18508,37621,39766,39734,41814,39702,18509,14347,16459,16427,16427,16427,16427,16427,16427,16427,16427,16459,16459,16395,16460,39701,41814,39734,18668,14537,4258,32,0,0,0}, {0,0,0,0,2113,10407,18700,39669,37588,37620,41814,39701,20621,20589,20589,14347,18540,39765,39829,39796,39796,39796,39796,39796,39796,39796,39797,37716,39797,39765,20685,22766,41814,39702,37589,16523,12456,32,0,0}, {0,0,0,32,4226,16491,20622,39734,39734,39702,39701,37556,18508,16427,16460,16460,20749,46134,44086,46102,46102,46102,46102,46102,46102,46103,44054,44086,46166,44054,18539,18572,37653,41782,39669,18636,14569,32,0,0}, {0,0,2112,14569,14378,16395,16396,18509,18508,18508,14347,18604,43990,44022,41941,41941,44021,46134,20717,16460,18508,18508,18508,18508,18508,16395,20717,46134,44054,44021,44022,39765,14379,16396,18635,6307,2112,0,0,0}, {0,0,32,14600,16522,16396,14347,14347,14347,14347,18508,22861,46134,46135,46134,46134,46134,41877,18572,14347,16460,16492,16460,16492,16460,14379,18637,41877,44022,44022,46166,41909,18572,14347,14443,2113,0,0,0,0}, {0,0,32,4162,6180,16491,16395,16395,14346,18540,44022,44086,44053,44053,44053,46134,41877,14378,14347,16428,31443,33555,31475,31475,31475,33556,31346,16458,39796,46134,44021,44053,44054,20653,14442,2145,0,0,0,0}, {0,0,4194,20812,24878,39764,41877,39797,41877,39796,20971,18889,25196,25196,25164,25196,25164,20876,16427,16428,31443,31539,31475,31475,31507,31539,31378,16427,39764,46134,44021,44021,44053,41909,39764,14473,8294,32,0,0}, {0,2081,14443,43958,48247,46133,46134,46134,46166,42005,14728,12614,18954,21002,21002,21002,21034,23115,16459,16396,31411,31507,31475,31475,31475,31507,29330,16459,39764,46134,44022,44021,44021,46166,46070,20557,14474,32,0,0}, {0,2081,16491,43958,48247,46134,46134,46134,46166,44053,16776,12582,18954,21002,21001,21002,21034,23083,16458,16428,31411,31507,31475,31475,31475,31507,29330,16459,39796,46134,44021,44021,44021,46134,46102,20589,14442,32,0,0}, {0,0,4194,20812,24878,39764,41877,39796,41845,39796,20971,18889,25196,25196,25196,25196,25164,20875,16427,16428,31443,31539,31507,31507,31475,33587,31379,14379,39796,46134,44021,44021,44054,41909,37716,14473,8294,32,0,0}, {0,0,32,4162,6180,16491,16395,16395,14347,18540,44022,46134,44053,44053,44054,46134,41877,14378,14347,16460,31443,33555,31475,31475,31475,33556,29298,14411,39796,46134,44021,44054,44023,20653,14441,2145,0,0,0,0}, {0,0,32,14568,16554,16427,16395,14347,14347,14347,16492,22830,46134,46134,46134,46134,46134,41878,18540,14347,16492,16492,16492,16492,16492,14380,20717,41877,44022,44022,46166,41909,18572,14347,14442,2113,0,0,0,0}, {0,0,32,14537,14378,16395,16396,18508,18508,16460,14347,20653,43990,44022,43990,41909,44022,46134,20717,16395,16427,16427,16427,16427,16395,14347,20684,46134,46102,44022,44022,39764,16427,16396,18635,4259,2112,0,0,0}, {0,0,0,32,4194,16491,20622,41782,39733,39701,39702,37556,18507,16427,16460,16459,20749,46134,44054,43990,44021,44022,44022,44022,43990,43990,44021,46134,46166,44054,18571,18573,37653,41782,39701,18636,14569,32,0,0}, {0,0,0,0,2113,12455,18699,37653,39637,37620,41846,39669,20621,20589,20589,14347,18540,39765,41877,39797,39796,39796,39796,39796,39828,39828,39796,39764,39829,39764,20653,22766,41814,39702,35540,14506,10407,32,0,0}, {0,0,0,0,0,0,6339,16586,16395,18508,37621,39766,39734,41814,39702,18508,14347,16427,16427,16427,16459,16459,16459,16459,16459,16427,16427,16459,16394,16460,39702,41846,39734,18669,14505,4226,0,0,0,0}, {0,0,0,0,0,0,0,2178,14474,16396,20622,20622,20622,20654,20654,16396,18573,41846,41877,39828,39828,39828,39828,39828,39796,39796,41877,41877,18572,14347,20621,20653,20749,8388,0,0,0,0,0,0}, {0,0,0,0,0,0,0,8388,16554,16459,14346,12298,14378,12298,12298,14346,18636,44054,46134,44054,44054,44054,44054,44054,44054,44054,46134,46102,20653,14347,16395,14347,16491,6339,32,0,0,0,0,0}, {0,0,0,0,0,0,0,10502,14536,18858,8325,10406,18858,10406,8293,16809,14536,16492,20589,18541,18541,18541,18541,18541,18541,18541,18541,18541,16396,16396,16396,16396,16396,16460,16618,2113,0,0,0,0}, {0,0,0,0,0,0,0,4226,14696,16744,12519,12519,16713,12552,12519,14664,14568,14441,14473,14473,14473,14473,14473,14473,14473,14473,14473,14473,14506,16554,16554,16554,16554,16523,14601,2113,0,0,0,0}, {0,0,0,0,0,0,0,0,32,32,2081,2081,33,2081,2113,32,2081,2112,64,64,2112,64,2112,2112,64,64,64,64,64,2112,2112,2112,2112,2112,32,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, };
-const uint16_t pr[40][40] = { {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,32,2112,2112,2112,2112,2112,64,64,64,64,64,2112,2112,64,2112,64,64,2112,2081,32,2113,2081,33,2081,2081,32,32,0,0,0,0,0,0,0,0}, {0,0,0,0,2113,14601,16523,16554,16554,16554,16554,14506,14473,14473,14473,14473,14473,14473,14473,14473,14473,14473,14441,14568,14664,12519,12552,16713,12519,12519,16744,14696,4226,0,0,0,0,0,0,0}, {0,0,0,0,2113,16618,16460,16396,16396,16396,16396,16396,18541,18541,18541,18541,18541,18541,18541,18541,18541,20589,16492,14536,16809,8293,10406,18858,10406,8325,18858,14536,10502,0,0,0,0,0,0,0}, {0,0,0,0,0,32,6339,16491,14347,16395,14347,20653,46102,46134,44054,44054,44054,44054,44054,44054,44054,46134,44054,18636,14346,12298,12298,14378,12298,14346,16459,16554,8388,0,0,0,0,0,0,0}, {0,0,0,0,0,0,8388,20749,20653,20621,14347,18572,41877,41877,39796,39796,39828,39828,39828,39828,39828,41877,41846,18573,16396,20654,20654,20622,20622,20622,16396,14474,2178,0,0,0,0,0,0,0}, {0,0,0,0,4226,14505,18669,39734,41846,39702,16460,16394,16459,16427,16427,16459,16459,16459,16459,16459,16427,16427,16427,14347,18508,39702,41814,39734,39766,37621,18508,16395,16586,6339,0,0,0,0,0,0}, {0,0,32,10407,14506,35540,39702,41814,22766,20653,39764,39829,39764,39796,39828,39828,39796,39796,39796,39796,39797,41877,39765,18540,14347,20589,20589,20621,39669,41846,37620,39637,37653,18699,12455,2113,0,0,0,0}, {0,0,32,14569,18636,39701,41782,37653,18573,18571,44054,46166,46134,44021,43990,43990,44022,44022,44022,44021,43990,44054,46134,20749,16459,16460,16427,18507,37556,39702,39701,39733,41782,20622,16491,4194,32,0,0,0}, {0,0,0,2112,4259,18635,16396,16427,39764,44022,44022,46102,46134,20684,14347,16395,16427,16427,16427,16427,16395,20717,46134,44022,41909,43990,44022,43990,20653,14347,16460,18508,18508,16396,16395,14378,14537,32,0,0}, {0,0,0,0,2113,14442,14347,18572,41909,46166,44022,44022,41877,20717,14380,16492,16492,16492,16492,16492,14347,18540,41878,46134,46134,46134,46134,46134,22830,16492,14347,14347,14347,16395,16427,16554,14568,32,0,0}, {0,0,0,0,2145,14441,20653,44023,44054,44021,46134,39796,14411,29298,33556,31475,31475,31475,33555,31443,16460,14347,14378,41877,46134,44054,44053,44053,46134,44022,18540,14347,16395,16395,16491,6180,4162,32,0,0}, {0,0,32,8294,14473,37716,41909,44054,44021,44021,46134,39796,14379,31379,33587,31475,31507,31507,31539,31443,16428,16427,20875,25164,25196,25196,25196,25196,18889,20971,39796,41845,39796,41877,39764,24878,20812,4194,0,0}, {0,0,32,14442,20589,46102,46134,44021,44021,44021,46134,39796,16459,29330,31507,31475,31475,31475,31507,31411,16428,16458,23083,21034,21002,21001,21002,18954,12582,16776,44053,46166,46134,46134,46134,48247,43958,16491,2081,0}, {0,0,32,14474,20557,46070,46166,44021,44021,44022,46134,39764,16459,29330,31507,31475,31475,31475,31507,31411,16396,16459,23115,21034,21002,21002,21002,18954,12614,14728,42005,46166,46134,46134,46133,48247,43958,14443,2081,0}, {0,0,32,8294,14473,39764,41909,44053,44021,44021,46134,39764,16427,31378,31539,31507,31475,31475,31539,31443,16428,16427,20876,25164,25196,25164,25196,25196,18889,20971,39796,41877,39797,41877,39764,24878,20812,4194,0,0}, {0,0,0,0,2145,14442,20653,44054,44053,44021,46134,39796,16458,31346,33556,31475,31475,31475,33555,31443,16428,14347,14378,41877,46134,44053,44053,44053,44086,44022,18540,14346,16395,16395,16491,6180,4162,32,0,0}, {0,0,0,0,2113,14443,14347,18572,41909,46166,44022,44022,41877,18637,14379,16460,16492,16460,16492,16460,14347,18572,41877,46134,46134,46134,46135,46134,22861,18508,14347,14347,14347,14347,16396,16522,14600,32,0,0}, {0,0,0,2112,6307,18635,16396,14379,39765,44022,44021,44054,46134,20717,16395,18508,18508,18508,18508,18508,16460,20717,46134,44021,41941,41941,44022,43990,18604,14347,18508,18508,18509,16396,16395,14378,14569,2112,0,0}, {0,0,32,14569,18636,39669,41782,37653,18572,18539,44054,46166,44086,44054,46103,46102,46102,46102,46102,46102,46102,44086,46134,20749,16460,16460,16427,18508,37556,39701,39702,39734,39734,20622,16491,4226,32,0,0,0}, {0,0,32,12456,16523,37589,39702,41814,22766,20685,39765,39797,37716,39797,39796,39796,39796,39796,39796,39796,39796,39829,39765,18540,14347,20589,20589,20621,39701,41814,37620,37588,39669,18700,10407,2113,0,0,0,0}, {0,0,0,32,4258,14537,18668,39734,41814,39701,16460,16395,16459,16459,16427,16427,16427,16427,16427,16427,16427,16427,16459,14347,18509,39702,41814,39734,39766,37621,18508,14347,16586,6339,0,0,0,0,0,0}, {0,0,0,0,0,32,6339,20749,20653,20621,14347,18572,41845,41877,39797,39797,39828,39828,39828,39828,41844,41877,41877,18573,16395,20653,20653,20621,20653,20621,16396,16522,4226,0,0,0,0,0,0,0}, {0,0,0,0,0,32,6307,16491,14348,14347,14347,20653,46103,46134,44054,44054,44054,44054,44054,44054,44054,46134,46103,18636,14346,14346,14346,14378,14346,14346,16459,16554,6340,0,0,0,0,0,0,0}, {0,0,0,0,2145,14569,16491,16396,16397,16396,16396,16428,18541,18541,18541,18541,18541,18541,18541,18541,18541,18541,16491,14536,18858,8293,10406,18858,10406,8325,18858,14568,10470,0,0,0,0,0,0,0}, {0,0,0,0,2113,16649,16523,16554,14506,14506,14506,14474,14441,14441,14441,14441,14441,14441,14441,14441,14441,14441,12393,14568,14664,12519,12551,16713,12519,12519,14664,14696,4226,0,0,0,0,0,0,0}, {0,0,0,0,0,2080,2112,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,2112,2080,32,2081,2081,32,2081,2081,32,32,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, };
-const uint16_t pul[40][40] = { {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65503,65535,59197,46423,59164,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,65535,65535,65535,63423,65535,65535,65535,29488,12487,25229,59132,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,25199,40084,50585,23053,52794,44342,52698,23022,14538,10373,23084,59132,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,59196,61277,54906,27311,16396,18668,16396,35540,27120,16396,14347,16395,12456,6147,25165,59100,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,40117,16619,35602,18860,42133,18605,14379,24976,41782,39701,24975,27088,20717,14346,18795,10406,23052,57052,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,31537,39797,44022,35603,29232,12298,18572,14347,27088,39702,39701,39734,37588,18573,14347,14505,2049,23084,57020,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,35698,41845,44054,44054,46102,31345,10250,16492,12298,27088,39702,37588,35508,37589,20685,14347,16714,10471,20972,57020,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,54874,42197,22733,44054,44021,44021,44054,31345,14347,20717,6152,29168,27023,12298,37556,37556,16396,12299,22924,12297,22989,57019,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65503,65535,44310,16492,42133,25102,35571,46102,44021,44053,44022,33489,41909,27087,37683,37652,14347,16428,27023,12299,27055,43990,35603,10250,22989,56987,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,61277,25167,12299,16396,14347,35603,46102,44054,35697,16776,35665,44054,44022,46102,37651,16395,10250,16396,22829,41877,46134,35603,12298,22989,56955,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,61245,27216,12299,16396,16428,14347,35603,35698,14728,12614,16808,35697,44054,41973,44054,37651,25006,41877,27151,16396,41877,46134,35603,10250,22989,54907,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65503,65535,48536,16620,29137,22830,14347,14347,29296,29391,6307,21002,21067,20970,35665,44054,44053,44053,43989,44054,44022,27119,16395,39828,46134,35603,10250,22990,54875,65535,65503,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,37812,39702,39701,22798,10249,31345,44021,29422,18921,23115,21034,18922,35697,39828,39796,35603,27119,44022,44022,27152,16395,39796,46134,37651,10250,23022,54842,65535,65503,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65503,27311,31249,41814,37621,22830,8201,39764,44086,31471,18889,23083,21034,23083,22956,16396,18476,8202,29200,44022,44022,29200,16395,39796,46134,35603,10250,22957,54842,65535,65503,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,63358,37844,4104,33394,41814,37556,33458,46102,44021,44054,31472,18921,21035,23115,20876,16395,16492,20814,8201,29200,44022,44022,29232,16395,39796,46134,37683,16396,22957,52762,65535,65503,65535,65535,65535,65535}, {65535,65535,65535,48600,25165,18636,16396,35507,41782,29169,22829,39829,44054,44021,44054,31472,20970,22988,16427,14347,29265,31443,22894,8202,29200,44022,44054,29232,14347,39796,43958,22830,12299,22957,52762,65535,65503,65535,65535,65535}, {65535,65535,65535,31632,3,16683,16395,24943,37653,31314,8201,18605,39797,46102,44021,27183,18635,16523,14347,27217,33524,31475,31443,22927,8201,29200,44022,46102,29264,18444,24942,12298,18572,14347,20877,52762,65535,65535,65535,65535}, {65535,65535,65535,50648,23084,6212,14473,12299,22863,39701,33395,14347,18540,37716,46134,33458,12298,16395,27185,33556,31475,31475,31475,31475,22927,6152,25006,41941,44054,29264,12298,18573,14347,18573,12299,20845,52730,65535,65535,65535}, {65535,65535,65535,65535,50649,18858,10438,18763,12298,24975,33395,18541,16396,37715,41909,20749,14347,27185,33555,31474,31475,31475,31475,31507,31475,22926,31345,44022,44021,44022,31345,35508,24943,12299,27280,20781,22989,61277,65535,65535}, {65535,65535,65535,65503,65535,50649,23020,8325,14473,14347,14347,6153,27120,46103,39860,22830,12298,22959,31475,31475,31475,31475,31475,29427,33556,27120,35603,44054,44022,37683,16427,33394,39669,31441,65503,52826,44342,65535,65535,65535}, {65535,65535,65535,65535,65503,65535,50681,18858,8292,16683,16460,33426,18604,29232,46102,41909,24942,10249,22927,31475,31475,31474,31475,31507,29233,14347,35570,44022,44022,39796,22797,33394,39701,25102,52889,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65503,65535,52761,23052,8229,29296,46103,39796,14347,29232,44054,41941,24974,8201,22926,31443,31475,33555,29265,14346,35570,46102,44021,44021,44022,31313,37588,41814,33395,46391,65535,63455,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65503,65535,52794,20876,16395,37683,46134,39796,14347,29232,44054,41941,25006,10250,22926,31443,29266,14347,35538,44054,44021,44021,44054,35603,10250,22830,37589,33395,46391,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65503,65535,54842,22925,14346,37651,46134,39796,16395,29232,44054,41941,25007,4104,27152,20781,33457,46102,44022,44022,44021,44054,39764,18477,14347,37908,22989,16683,63390,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,54842,22957,12298,37651,46134,39828,16395,27151,44054,41909,31344,41909,41909,44022,44021,44021,44021,44021,44054,37683,16459,35763,65535,57051,54939,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,63455,65535,54874,22990,12298,35603,46134,39828,16396,27151,44022,44054,44021,44054,44021,44021,44021,44021,44021,44021,46103,35635,63454,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,54875,23022,12298,35603,46134,41877,16396,27152,44022,44054,44022,44054,44022,43989,43990,44022,46135,39764,16395,33745,65535,65503,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,54907,25070,10250,35603,46134,41877,16395,29231,39829,25070,37683,33490,25007,27087,31377,39797,14347,16556,46423,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,54907,23022,10250,35603,35603,16395,18605,33363,14347,27056,27088,8233,14347,31505,46390,14410,48504,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,56987,23021,12299,16428,14347,20717,37588,37620,39733,41782,29136,29393,63422,65535,59132,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,57020,23021,14347,18572,14347,18605,37621,33362,39669,37588,46423,65535,63455,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,57052,22990,14347,16460,16588,44246,27343,29329,25070,16651,59132,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,57052,23022,14347,35763,65535,61277,61277,52794,42197,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,59100,23022,14347,50649,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,57052,29424,54906,65535,65503,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, };
-const uint16_t pur[40][40] = { {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,50648,31632,50648,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,50649,23084,3,25165,63358,65503,65535,48536,61245,61277,44310,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,50649,18858,6212,16683,18636,37844,27311,37812,16620,27216,25167,16492,54874,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,50681,23020,10438,14473,16395,16396,4104,31249,39734,29137,12299,12299,42133,42197,35698,31537,40117,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,52761,18858,8325,18763,12299,24943,35507,33394,41814,39701,22830,16396,16396,25102,22733,41845,39797,16619,59196,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,52794,23052,8292,14473,12298,22863,37653,41782,41814,37621,22798,14347,16428,14347,35571,44054,44054,46070,35602,61277,65535,65503,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63455,65535,54842,20876,8229,16683,14347,24975,39701,31314,29169,37556,22830,10249,14347,14347,35603,46102,44021,44054,35603,18828,54906,65503,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,54842,22925,16395,29296,16460,14347,33395,33395,8201,22829,33458,8201,31345,29296,35603,46102,44021,44021,46102,29232,42133,27311,25199,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,54874,22957,14346,37683,46103,33426,6153,18541,14347,18605,39829,46102,39764,44021,29391,35698,44054,44053,44054,31345,12298,18605,16396,40084,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,54875,22990,12298,37651,46134,39796,18604,27120,16396,18540,39797,44054,44021,44086,29422,6307,14728,35697,44022,31345,10250,18572,14379,18668,50585,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65503,65535,54907,23022,12298,37651,46134,39796,14347,29232,46103,37715,37716,46102,44021,44054,31471,18921,21002,12614,16776,33489,14347,16492,14347,24976,16396,23053,63423,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65503,65535,56955,25070,12298,35603,46134,39796,14347,29232,46102,39860,41909,46134,44021,44054,31472,18889,23115,21067,16808,35665,41909,20717,12298,27088,41782,35540,52794,65535,65503,65535,65535,65535}, {65535,65535,65535,65535,65535,65503,65535,56987,23022,10250,35603,46134,39828,16395,29232,44054,41909,22830,20749,33458,27183,31472,18921,23083,21034,20970,35697,44054,27087,6152,27088,39702,39701,27120,44342,65535,65503,65535,65535,65535}, {65535,65535,65535,65535,65503,65535,57020,22989,10250,35603,46134,39828,16395,29232,44054,41941,24942,12298,14347,12298,18635,20970,21035,21034,18922,35665,44054,44022,37683,29168,39702,39701,24975,16396,52698,65535,65535,65535,65535,65535}, {65535,65535,65535,65503,65535,57052,23021,12299,35603,46134,41877,16396,27151,44054,41941,24974,10249,22959,27185,16395,16523,22988,23115,23083,35697,44054,41973,46102,37652,27023,37588,39734,27088,14347,23022,29488,59197,65535,65535,65535}, {65535,65535,65503,65535,57052,22990,14347,16428,35603,41877,16396,27151,44054,41941,25006,8201,22927,31475,33555,27185,14347,16427,20876,22956,39828,44053,44054,37651,14347,12298,35508,37588,20717,16395,14538,12487,46423,65535,65503,65535}, {65535,65503,65535,59100,23022,14347,18572,14347,16395,16395,27152,44022,41909,25007,10250,22926,31475,31475,31474,33556,27217,14347,16395,16396,39796,44053,37651,16396,16428,37556,37589,18572,14346,12456,10373,25229,59164,65535,65535,65535}, {65535,65535,57052,23022,14347,16460,14347,20717,18605,29231,44022,44054,31344,4104,22926,31443,31475,31475,31475,31475,33524,29265,16492,18476,35603,44021,25006,10250,27024,37556,20685,14347,18795,6147,23084,59132,65535,65535,65535,65535}, {65535,65535,29424,14347,35763,16588,18605,37588,33363,39829,44054,44021,41909,27152,31443,31475,31474,31475,31475,31475,31475,31443,20814,8202,27119,44054,41877,16396,12299,16396,14347,14505,10406,25165,59132,65535,65503,65535,65535,65535}, {65535,65535,54906,50649,65535,44246,37621,37620,14347,25070,44022,44054,41909,20781,29266,33555,31475,31475,31475,31475,31443,22894,8201,29200,44022,44022,27151,22829,27055,12299,16714,2049,23052,59100,65535,65503,65535,65535,65535,65535}, {65535,65535,65535,65535,61277,27343,33362,39733,27056,37683,44054,44021,44022,33457,14347,29265,31507,29427,31507,31475,22927,8202,29200,44022,44022,27119,16396,41877,43990,22924,10471,23084,57052,65535,65503,65535,65535,65535,65535,65535}, {65535,65535,65503,65535,61277,29329,39669,41782,27088,33490,44022,44021,44021,46102,35538,14346,29233,33556,31475,22927,8201,29200,44022,44022,27152,16395,41877,46134,35603,12297,20972,57020,65535,65503,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,52794,25070,37588,29136,8233,25007,43989,44021,44021,44022,44054,35570,14347,27120,22926,6152,29200,44022,44022,29200,16395,39828,46134,35603,10250,22989,57020,65535,65503,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65503,65535,42197,16651,46423,29393,14347,27087,43990,44021,44021,44022,44021,46102,35570,35603,31345,25006,44022,44054,29232,16395,39796,46134,35603,12298,22989,57019,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,59132,65535,63422,31505,31377,44022,44021,44021,44021,44021,44021,44022,44054,44022,41941,46102,29232,16395,39796,46134,35603,10250,22989,56987,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,63455,65535,46422,39797,46135,44021,44054,44054,44054,44021,44022,44022,44021,44054,29264,14347,39796,46134,37651,10250,22989,56955,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65503,65535,59132,14410,14347,39764,46103,37683,39764,35603,44022,39796,37683,44022,29264,18444,39796,46134,35603,10250,22990,54907,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,48504,16556,16395,35635,16459,18477,10250,31313,22797,16427,31345,12298,24942,43958,37683,10250,23022,54875,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,46423,33745,63454,35763,14347,22830,37588,33394,33394,35508,18573,12298,22830,16396,22957,54842,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,37908,37589,41814,39701,39669,24943,14347,18572,12299,22957,54842,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,57051,22989,33395,33395,25102,31441,12299,18573,14347,22957,52762,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,54939,16683,46391,46391,52889,65503,27280,12299,20877,52762,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63390,65535,65535,65535,52826,20781,20845,52762,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63455,65535,44342,22989,52730,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,61277,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, };
-const uint16_t pu[40][40] = { {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2081,2081,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,32,32,4194,16491,14443,4194,32,32,2112,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,14537,14568,4162,20812,43958,43958,20812,4162,14600,14569,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,2113,4194,14378,16554,6180,24878,48247,48247,24878,6180,16522,14378,4226,2113,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,12455,16491,16395,16427,16491,39764,46134,46133,39764,16491,16396,16395,16491,10407,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,6339,18699,20622,16396,16395,16395,41877,46134,46134,41877,16395,14347,16396,20622,18700,6339,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,4226,10502,8388,2178,16586,37653,41782,18508,14347,16395,39796,46134,46134,39797,16395,14347,18509,39734,39669,16586,4226,6340,10470,4226,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,32,14696,14536,16554,14474,16395,39637,39733,18508,14347,14347,41845,46166,46166,41877,14346,14347,18508,39734,37588,14347,16522,16554,14568,14696,32,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,32,16744,18858,16459,16396,18508,37620,39701,16460,14347,18540,39796,44053,42005,39796,18540,14347,18508,39702,37620,18508,16396,16459,18858,14664,32,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,2081,12519,8325,14346,20622,37621,41846,39702,14347,16492,44022,20971,16776,14728,20971,44022,18508,14347,39701,41814,37621,20621,14346,8325,12519,2081,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,2081,12519,10406,12298,20622,39766,39669,37556,20653,22830,46134,18889,12582,12614,18889,44086,22861,18604,37556,39701,39766,20653,14346,10406,12519,2081,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,33,16713,18858,14378,20622,39734,20621,18507,43990,46134,44053,25196,18954,18954,25196,44053,46134,43990,18508,20621,39734,20621,14378,18858,16713,32,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,2081,12552,10406,12298,20654,41814,20589,16427,44022,46134,44053,25196,21002,21002,25196,44053,46135,44022,16427,20589,41814,20653,14346,10406,12551,2081,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,2113,12519,8293,12298,20654,39702,20589,16460,43990,46134,44054,25196,21001,21002,25164,44053,46134,41941,16460,20589,39702,20653,14346,8293,12519,2081,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,32,14664,16809,14346,16396,18508,14347,16459,41909,46134,46134,25196,21002,21002,25196,46134,46134,41941,16460,14347,18509,16395,14346,18858,14664,32,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,2081,14568,14536,18636,18573,14347,18540,20749,44022,46134,41877,25164,21034,21034,25164,41877,46134,44021,20749,18540,14347,18573,18636,14536,14568,2080,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,2112,14441,16492,44054,41846,16427,39765,46134,46134,41878,14378,20875,23083,23115,20876,14378,41877,46134,46134,39765,16459,41877,46103,16491,12393,2112,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,64,14473,20589,46134,41877,16427,41877,44054,20717,18540,14347,16427,16458,16459,16427,14347,18572,20717,44086,39829,16427,41877,46134,18541,14441,64,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,64,14473,18541,44054,39828,16427,39797,43990,16395,14347,16460,16428,16428,16396,16428,16428,14347,16460,46102,39796,16427,41844,44054,18541,14441,64,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,2112,14473,18541,44054,39828,16459,39796,44021,16427,16492,31443,31443,31411,31411,31443,31443,16460,18508,46102,39796,16427,39828,44054,18541,14441,64,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,64,14473,18541,44054,39828,16459,39796,44022,16427,16492,33555,31539,31507,31507,31539,33555,16492,18508,46102,39796,16427,39828,44054,18541,14441,64,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,2112,14473,18541,44054,39828,16459,39796,44022,16427,16492,31475,31507,31475,31475,31475,31475,16460,18508,46102,39796,16427,39828,44054,18541,14441,64,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,2112,14473,18541,44054,39828,16459,39796,44022,16427,16492,31475,31507,31475,31475,31475,31475,16492,18508,46102,39796,16427,39828,44054,18541,14441,64,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,64,14473,18541,44054,39796,16459,39828,43990,16395,16492,31475,31475,31475,31475,31507,31475,16460,18508,46102,39796,16427,39797,44054,18541,14441,64,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,64,14473,18541,44054,39796,16427,39828,43990,14347,14380,33556,33587,31507,31507,31539,33556,14379,16395,46103,39796,16427,39797,44054,18541,14441,64,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,64,14473,18541,46134,41877,16427,39796,44021,20684,20717,29298,31379,29330,29330,31378,31346,18637,20717,44054,39797,16459,41877,46134,18541,14441,64,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,64,14473,18541,46102,41877,16459,39764,46134,46134,41877,14411,14379,16459,16459,16427,16458,41877,46134,44086,37716,16459,41845,46103,18541,14441,64,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,64,14506,16396,20653,18572,16394,39829,46166,46102,44022,39796,39796,39796,39764,39764,39796,44022,44054,46166,39797,16395,18572,20653,16428,14474,64,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,2112,16554,16396,14347,14347,16460,39764,44054,44022,44022,46134,46134,46134,46134,46134,46134,44022,44021,44054,39765,16460,14347,14347,16396,14506,64,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,2112,16554,16396,16395,20621,39702,20653,18571,44022,46166,44021,44021,44021,44022,44021,44021,46166,44022,18539,20685,39701,20621,14347,16396,14506,64,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,2112,16554,16396,14347,20653,41846,22766,18573,39764,41909,44054,44021,44021,44021,44021,44053,41909,39765,18572,22766,41814,20653,14348,16397,14506,64,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,2112,16554,16396,16491,20749,39734,41814,37653,16427,18572,44023,44054,44021,44021,44053,44054,18572,14379,37653,41814,39734,20749,16491,16396,16554,64,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,2112,16523,16460,6339,8388,18669,39702,41782,16396,14347,20653,41909,46134,46166,41909,20653,14347,16396,41782,39702,18668,6339,6307,16491,16523,2112,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,32,14601,16618,32,0,14505,35540,39701,18635,14442,14441,37716,46102,46070,39764,14442,14443,18635,39669,37589,14537,32,32,14569,16649,2080,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,2113,2113,0,0,4226,14506,18636,4259,2113,2145,14473,20589,20557,14473,2145,2113,6307,18636,16523,4258,0,0,2145,2113,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,10407,14569,2112,0,0,8294,14442,14474,8294,0,0,2112,14569,12456,32,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,32,32,0,0,0,32,32,32,32,0,0,0,32,32,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, };
-
-//brown big tank
-const uint16_t bd[40][40] = { {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,6307,6339,6339,6339,6339,6339,6339,6339,6339,6339,6339,6339,6339,2081,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,6307,10533,8484,10532,6371,6339,10532,12613,12645,12645,12645,12645,12645,12645,12645,12645,12645,12645,12645,12613,10532,6307,33,8452,10532,8452,10532,6307,0,0,0,0,0,0}, {0,0,0,0,0,33,14823,27436,25356,27404,19017,10533,16839,33710,33743,33711,33711,33711,33711,33711,33711,33711,33711,33711,33711,33743,21033,12613,10500,21130,27436,25356,27436,16871,32,0,0,0,0,0}, {0,0,0,0,0,2081,16871,25323,25291,25323,18984,12613,31662,40082,40049,40049,40049,40049,40049,40049,40049,40049,40049,40049,40049,40049,37969,33743,16839,18984,25323,23243,25323,16839,2081,0,0,0,0,0}, {0,0,0,0,0,8452,12645,12613,12580,12613,12613,12645,33743,40049,37936,37937,37937,37937,37937,37937,37937,37937,37936,37936,37936,37936,37969,40114,27436,10532,12613,10533,12613,12645,8452,4226,0,0,0,0}, {0,0,0,0,2081,12645,12613,21064,27436,29484,21097,12581,33710,40049,37936,37969,40049,38001,38001,38001,37969,37937,37969,40049,37969,37936,37936,40081,27404,12580,25291,27436,27436,16871,12613,10533,0,0,0,0}, {0,0,0,0,32,12645,12613,25258,35888,37904,27371,10500,33710,40049,37969,35824,33743,33743,33743,33743,35791,37969,35824,33711,35824,37969,37969,37969,25291,12580,31630,37904,35856,18984,12613,10565,0,0,0,0}, {0,0,0,0,32,12613,12613,23210,35823,35824,25291,10532,33710,40082,42195,21033,10468,12613,12581,10500,18887,44275,21065,8323,21033,42195,38001,37937,25259,12581,29517,35823,35791,18952,12613,10565,0,0,0,0}, {0,0,0,0,32,12613,12613,23178,35823,35823,25291,10532,33743,35856,25258,21065,21033,21065,21065,21032,21065,25259,21097,21032,21065,25258,35824,40049,25259,12580,29517,35791,35791,18952,12613,10565,0,0,0,0}, {0,0,0,0,32,12613,12613,23178,35823,35823,25291,10532,35823,33710,8387,23178,31597,29485,29485,31597,25291,8387,23178,31630,23178,8387,31630,40050,25259,12580,29517,35791,35791,18952,12613,10533,0,0,0,0}, {0,0,0,0,32,12613,12613,23210,35823,35823,25291,10532,33775,33711,10532,23178,29485,29452,29452,29485,25259,10500,23178,31597,23178,10532,31662,40050,25259,12580,29517,35823,35791,18952,12613,10533,0,0,0,0}, {0,0,0,0,32,12613,12613,23210,35823,35823,25291,10532,33775,33711,10532,23178,29485,29452,29452,29485,25259,10532,23178,31597,23178,10532,31662,40050,25259,12580,29517,35791,35791,18952,12613,10533,0,0,0,0}, {0,0,0,0,32,12613,12613,23210,35823,35823,25291,10532,33775,33711,10532,23178,29485,29452,29452,29485,25258,10532,23178,31597,23178,10532,31662,40050,25259,12580,29517,35791,35791,18952,12613,10533,0,0,0,0}, {0,0,0,0,32,12613,12613,23210,35823,35823,25291,10532,33775,33711,10532,23178,29485,29452,29452,29485,25258,10532,23178,31597,23178,10532,31662,40049,25259,12580,29517,35791,35791,18952,12613,10533,0,0,0,0}, {0,0,0,0,32,12613,12613,23210,35823,35823,25291,10532,33775,33711,10532,23178,29485,29452,29452,29485,25258,10532,23178,31597,23178,10532,31662,40049,25259,12581,29517,35791,35791,18952,12613,10532,0,0,0,0}, {0,0,0,0,32,12613,12613,23210,35823,35823,25291,10532,33775,33711,10532,23178,29485,29452,29452,29485,25258,10532,23178,31597,23178,10532,31662,40049,25259,12581,29517,35791,35791,18952,12613,10532,0,0,0,0}, {0,0,0,0,33,12613,12613,23210,35823,35823,25291,10532,33775,33711,10532,23178,29485,29452,29452,29485,25258,10532,23178,31597,23178,10532,31662,40049,25259,12581,29517,35823,35791,18952,12613,10532,0,0,0,0}, {0,0,0,0,33,12645,12613,23210,35823,35823,25291,10532,33775,33711,10532,23178,29485,29452,29452,29485,25258,10532,23178,31597,23178,10532,31662,40049,25259,12580,29517,35823,35791,18952,12613,10533,0,0,0,0}, {0,0,0,0,32,12645,12613,23210,35823,35823,25291,10532,33775,33743,10532,23178,29485,29452,29452,29485,25259,10500,23178,31565,23178,10532,31630,40049,25291,12580,31565,35791,35791,18952,12613,10533,0,0,0,0}, {0,0,0,0,33,12645,12613,23210,35823,35823,25291,10532,33775,33711,10500,23178,29517,29485,29485,29517,25259,10468,23178,31598,23178,10468,31630,40050,25291,12580,29517,35791,35791,18952,12613,10565,0,0,0,0}, {0,0,0,0,33,12645,12613,25258,35823,35824,25291,10532,33743,33743,12645,21065,25259,25258,23210,25259,21097,14694,23146,29485,23146,12613,33710,40050,25259,12580,31565,35823,35791,18952,12613,10565,0,0,0,0}, {0,0,0,0,2081,12645,12581,25259,37936,37936,27371,10532,33710,40049,38001,18952,8419,12580,10532,10500,16839,40082,21065,10468,21033,37969,37969,37969,25259,12580,31630,37904,35856,18984,12613,10565,0,0,0,0}, {0,0,0,0,2081,12645,12613,16839,23178,23178,18920,12613,33710,40049,40049,29485,25258,25291,25291,25259,27404,40114,21097,10500,21065,40082,37969,37969,25259,12613,21065,23178,23178,16839,10565,10532,0,0,0,0}, {0,0,0,0,0,6339,12646,12645,12613,12613,12613,12613,33711,38001,37937,38001,40082,40049,40049,40050,40049,38001,23178,12646,23145,40017,37969,37969,25291,12613,12613,12613,12613,12645,6306,2113,0,0,0,0}, {0,0,0,0,0,0,21130,48566,46518,48599,33743,10500,33710,38001,37937,37937,37937,37937,37969,37937,37969,40049,23178,12645,21097,40017,37969,37969,25259,10532,40147,48599,48598,21130,0,0,0,0,0,0}, {0,0,0,0,0,0,16936,35921,33840,35921,25356,10532,33743,40081,37936,37936,37936,37936,37936,37968,37969,40049,23177,12645,21097,40049,37969,38001,25291,10533,29614,35920,35953,19049,0,0,0,0,0,0}, {0,0,0,0,0,0,2145,4226,4194,2145,8452,12645,23178,37969,40049,37969,37969,37969,37969,37969,40049,40082,23178,12645,23178,40082,40049,33775,18920,8452,4194,4194,4226,4194,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,2113,8452,10532,21097,33710,35823,35856,35856,35856,35856,35856,37936,21097,14694,21097,35823,23145,14726,10532,4226,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,32,8420,12646,14726,14758,14726,14726,14726,14726,14726,14726,16839,16839,16839,14726,12645,6339,2113,32,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,4226,8452,8452,8452,8452,8452,8452,8452,8452,14758,16871,12645,8452,4194,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10565,18984,6339,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10565,18952,6339,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10533,16839,6307,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6339,8484,4226,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, };
-const uint16_t bdl[40][40] = { {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,57050,52857,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,46518,25324,25323,38066,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,46486,23210,16807,21097,27501,23210,38001,65535,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63454,65535,50712,21097,8322,14726,12613,21130,27469,25324,54970,63422,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,54937,21130,6177,21065,31597,21097,10467,21065,18984,12613,25324,35888,52857,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,57051,23178,8290,16872,31597,35791,33710,23178,10468,14726,27404,29517,18919,19017,50744,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,59196,23243,8354,16839,31565,35791,33710,33710,23145,10500,31597,40017,40049,35856,16839,18984,48566,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65503,65535,61309,27437,10435,14758,29485,33743,33710,33743,23178,6242,29517,37969,37936,37936,37969,37904,21032,14759,44373,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,63422,29582,10500,14726,27404,33743,33710,33743,25259,4161,27404,37969,37936,37936,37936,37936,37969,37936,23178,12645,40179,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,33808,12613,12645,27372,35791,33710,35791,27371,6209,25291,40017,37969,37969,37969,37936,37936,37936,37969,37936,25291,12613,35953,65502,65535,65503,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,38033,14726,12581,25291,33743,33710,35791,27404,6274,23178,37969,31630,31597,33678,27371,37936,37969,37936,37936,37936,37969,27404,10500,33775,63422,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,42227,16871,10468,25258,33710,33710,33743,29485,8387,21065,37969,33743,10500,16839,23145,2048,23210,37936,37969,37936,37936,37969,37969,29517,8387,29549,61277,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,44405,18952,8387,23178,33710,33710,33743,31565,12580,18952,37936,35823,14726,14726,27371,29484,23145,6306,21097,35856,37936,37936,37936,37936,37969,31630,12613,29549,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,48599,18984,8354,21097,33710,33710,33743,31597,14694,16839,35856,37904,16871,12613,27371,29484,29484,29484,23210,8387,18984,37936,37969,37936,37936,37936,40049,31597,18984,59164,65535,65503,65535,65535,65535,65535}, {65535,65535,65535,50712,21097,6209,21032,33678,33743,33743,31630,16806,12646,35823,37936,18952,10500,25291,29484,29452,29452,29452,29517,23178,29484,37969,35856,37969,37936,37936,37969,37936,18952,40179,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,33808,6241,21065,31597,33743,33743,33710,18920,10532,33743,37969,21097,8387,25258,29484,29452,29452,29452,29452,29485,23145,25258,27404,14726,31630,37969,37936,37936,37969,29485,25356,52857,57051,65535,65535,65535,65535}, {65535,65535,57083,25291,0,25259,35791,33743,33710,21032,8419,31630,40049,25258,6306,23178,29484,29452,29452,29484,29452,29484,25258,8419,18920,25259,12613,23210,37969,37936,37936,40049,31597,14758,25324,25291,52825,65535,65535,65535}, {65535,65535,38034,40147,27501,0,25291,33710,23145,6242,31597,40049,27371,6274,23178,29484,29452,29452,29484,29452,29484,25258,10500,16871,29484,31565,25258,31597,37969,37936,37969,35823,18952,16839,27436,25356,21130,52825,65535,65535}, {65535,65535,38066,42292,46518,27501,10468,18952,8387,27436,37969,27372,6274,21065,29484,29452,29452,29452,29452,29484,27339,10533,16839,27404,29484,27372,12645,21032,37936,37936,33710,18984,12613,14726,14726,27436,25388,38034,65535,65503}, {65535,65535,59164,29549,38066,46486,23211,0,27372,37969,37936,21032,18952,29484,29484,29452,29484,29484,29484,27371,12645,14758,27404,29485,27372,14759,12613,33710,37969,33743,21065,10468,29484,29517,14726,14758,23178,46453,65535,65503}, {65535,65535,65535,63390,33775,29549,12646,25259,37969,37936,37969,29517,21065,27404,29452,29484,29452,29484,27372,14726,14693,27371,29485,27404,16871,10500,31630,37969,35791,23178,8387,27404,35791,35791,31597,14693,35921,65535,65535,65535}, {65535,65535,63454,65535,52824,10500,23178,37936,37969,37969,37936,21032,8420,23178,27372,29452,29484,27404,16839,12581,27339,29485,29452,18952,8419,31597,37969,35823,25258,8355,25291,35791,33710,33743,27404,14694,21097,61277,65535,65535}, {65535,65535,65503,65535,52857,16839,31597,40049,37936,37936,37969,35823,18984,10500,21097,27404,29452,18919,10500,25259,29484,29452,21065,6306,29485,37969,35856,25291,8387,25258,33743,33710,35791,29484,12645,10500,27469,63390,65535,65535}, {65535,65535,65503,65535,54938,14758,29517,37969,37936,37936,37936,37969,35856,23145,6307,18984,16871,8419,25258,29484,29484,23145,4193,27372,37969,35856,27404,8420,23145,33743,33710,35791,29517,14726,10468,27436,63390,65535,65535,65535}, {65535,65535,65535,65535,61309,27469,25258,37936,37969,37936,37969,37936,37969,37936,23178,29485,29517,23145,29517,29484,23178,6274,25291,37969,35856,29484,10500,21065,33710,33743,35791,31565,16839,8355,23210,59196,65535,65503,65535,65535}, {65535,65535,65535,65503,65535,40179,12581,29517,37969,37936,37936,37969,37936,37969,37936,40049,29485,18984,27404,23210,8387,23210,37936,37936,29517,12613,18952,33710,33743,33743,31597,16871,8322,21130,54970,65535,65503,65535,65535,65535}, {65535,65535,65535,65535,65535,61277,31695,10500,29485,37969,37969,37936,37936,37936,40017,31597,12613,8419,23178,14758,21032,37936,37936,31597,14726,16839,31630,33743,33743,33678,18952,8354,21065,52824,65535,65503,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,63422,35888,10500,27371,37969,37969,37936,40017,31630,14759,14726,21097,35856,33743,35823,37969,31630,16839,14726,31597,33743,33710,33710,21065,8322,18984,48631,65535,65503,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65503,65535,65535,38066,12613,25258,37936,40049,33710,16839,14726,18984,35856,37969,37969,37936,33710,16872,12613,31565,35791,33743,33710,21097,8354,18984,44405,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,42292,14759,23145,33743,18952,12646,16871,35791,37969,37936,37936,33710,18984,10500,29484,35791,33710,33710,23178,10468,16839,42227,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,46518,18984,14726,16839,18952,33710,37969,37936,37969,35791,23145,12613,29484,35791,33710,33743,25259,10500,14758,38033,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,63422,25356,14758,12645,29484,40017,40049,37969,35856,23210,0,14758,31630,35791,33743,27371,10532,12613,35888,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,27469,14758,18952,21097,18952,23145,29484,31630,23178,12613,27469,16871,10468,31597,29484,12613,12613,31662,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,29582,16806,14726,48599,57051,44373,31662,23210,14758,27469,21097,44373,42292,19017,10500,8387,10467,27437,61309,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,35888,16807,44405,65535,65535,65535,65535,61341,52825,65535,52792,27436,46486,35953,27436,31695,23210,61277,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,63454,52825,65535,65535,65503,65503,65535,65535,65535,65535,65535,50712,33808,35921,57115,63422,59196,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63454,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, };
-const uint16_t bdr[40][40] = { {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,52825,38034,46453,65535,61277,63390,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,52825,21130,25388,23178,35921,21097,27469,63390,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,57051,25291,25356,27436,14758,14693,14694,10500,27436,59196,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,52857,25324,27436,14726,14726,31597,27404,12645,10468,23210,54970,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,59164,40179,25356,14758,16839,14726,29517,35791,33743,29484,14726,8355,21130,52824,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,61277,29549,18984,18952,29485,31597,18952,12613,29484,35791,33710,35791,29517,16839,8322,21065,48631,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63422,29549,12613,31597,37936,37969,40049,35823,18984,10468,27404,35791,33710,35791,31565,16871,8354,18984,44405,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65502,33775,8387,31630,40049,37969,37936,37936,37969,33710,21065,8387,25291,33743,33710,35791,31597,18952,8322,18984,42227,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,35953,10500,29517,37969,37936,37936,37936,37936,37936,37936,33743,23178,8355,25258,33743,33743,33743,33678,21065,8354,16839,38033,65535,65535,65503,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,40179,12613,27404,37969,37936,37936,37936,37969,37969,37969,37936,37969,35791,25258,8387,23145,33710,33743,33743,33710,21097,10468,14758,35888,65503,65535,65503,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,44373,12645,25291,37969,37969,37936,37936,37969,31630,23210,31597,21032,33710,37969,35823,25291,8420,21065,33710,33743,33710,33710,23178,10500,12613,31662,61309,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,48566,14759,23178,37936,37936,37936,37936,37969,35856,14726,12613,25258,12645,12613,31630,37969,35856,27404,10500,18952,31630,33743,33743,33710,25259,10532,12613,27437,61277,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,50744,18984,21032,37936,37969,37936,37936,37936,37936,37969,27404,25259,31565,27372,14759,10500,31597,37969,35856,29484,12613,16839,31597,35791,33710,33743,27371,12613,10467,23210,59196,65535,65535}, {65535,65535,65535,65535,65535,65535,52857,19017,16839,37904,37969,37936,37936,37969,35856,18984,29484,25258,18920,29484,29484,27372,16871,8419,29485,37969,35856,29517,14726,14726,31565,35791,33710,33743,29484,8387,31695,63422,65535,65535}, {65535,65535,65535,65535,65503,65535,35888,18919,35856,37969,37936,37936,37969,37936,21097,8387,23178,23145,8419,16871,27404,29485,27404,18952,6306,27372,37969,37936,31597,16839,12613,29484,35791,35791,31597,10500,27436,57115,65535,65535}, {65535,65535,65535,65535,65535,63422,25324,29517,40049,37936,37936,37936,37936,23210,6306,23210,29517,29485,25258,10500,16839,27404,29485,29452,21065,4193,25291,37936,37936,31630,16872,10500,29484,31630,10468,19017,35953,35921,65535,65535}, {65535,65535,65535,65535,65535,54970,12613,27404,40017,37936,37936,37969,27371,2048,23145,29484,29452,29452,29484,25258,10533,14758,27371,29485,29452,23145,6274,23210,37936,37969,33710,18984,12613,14758,16871,42292,46486,33808,63454,65535}, {65535,65535,65535,65535,38001,25324,18984,14726,31597,37969,37936,37969,33678,23145,29484,29484,29452,29452,29452,29484,27339,12645,14693,27339,29484,29484,23178,8387,21032,35823,37936,33710,23145,0,27469,44373,27436,50712,65535,65535}, {65535,65535,65535,38066,23210,27469,21065,10468,10500,29517,37969,37969,31597,16839,27371,29484,29452,29452,29484,29452,29484,27371,14726,12581,25259,29484,29484,23210,14758,33743,37969,37936,35791,23210,12613,21097,52792,65535,65535,65535}, {65503,65535,52857,25323,27501,21130,10467,23178,23145,6242,27404,40017,31630,10500,14726,27371,29484,29452,29452,29484,29452,29484,27372,16839,10500,25258,29517,27404,23178,35856,37969,37936,37969,35856,23178,27469,65535,65535,65535,65535}, {65503,65535,57050,25324,21097,12613,21097,33710,33710,23178,4161,25291,37969,33743,14726,12613,25291,29484,29452,29452,29452,29484,29484,27404,18919,8419,23145,18984,8419,21097,35856,37969,37936,37969,31630,14758,52825,65535,65535,65535}, {65535,65535,65535,46518,16807,14726,31597,35791,33710,33743,25259,6209,23178,37969,35823,16871,10500,25258,29484,29452,29452,29484,29452,29484,29452,16871,29517,29485,12613,14726,18984,35791,37969,40049,29484,23210,61341,65535,65535,65535}, {65535,65535,65535,65503,23210,8322,21065,31597,35791,33710,33743,27371,6274,21065,37936,37904,18952,8387,23178,29484,29452,29452,29484,29452,27404,18984,29485,40049,31597,14759,14726,16871,33710,40017,23145,31662,65535,65535,65535,65535}, {65535,65535,65535,65535,46486,21097,6177,16872,31565,33743,33710,35791,27404,8387,18952,35856,37936,21097,6306,23178,29484,29484,29452,27372,21097,6307,23178,37936,40017,31630,16839,12646,18952,29484,18952,44373,65535,65503,65535,65535}, {65535,65535,65535,65535,65535,50712,21130,8290,16839,29485,33743,33710,35791,29485,12580,16839,35823,37969,25258,6274,21065,29484,27404,23178,10500,23145,37936,37969,37936,40017,33710,18952,16839,12645,21097,57051,65535,65503,65535,65535}, {65535,65535,65535,65535,65535,65535,54937,23178,8354,14758,27404,35791,33710,33743,31565,14694,12646,33743,40049,27371,6274,18952,21065,8420,18984,35856,37969,37936,37936,37936,40049,33743,14726,14758,18952,48599,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,63454,65535,57051,23243,10435,14726,27372,33743,33710,33743,31597,16806,10532,31630,40049,27372,21032,29517,21032,35823,37969,37936,37969,37936,37969,37936,23145,18984,25356,14758,14726,44405,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65503,65535,59196,27437,10500,12645,25291,33710,33710,33743,31630,18920,8419,31597,37969,37936,37969,37936,37969,37936,37969,37936,37969,37969,25258,14759,46518,63422,27469,16806,16807,52825,65535,65503}, {65535,65535,65535,65535,65535,65535,65535,65503,65535,61309,29582,12613,12581,25258,33710,33710,33743,33710,21032,6242,27436,37969,37936,37969,37936,37936,37936,37936,37969,27371,12613,42292,65535,65535,65503,29582,35888,63454,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,63422,33808,14726,10468,23178,33710,33743,33743,33710,23145,8387,27372,37969,37969,37936,37936,37969,37969,29485,10500,38066,65535,65535,65503,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,65535,38033,16871,8387,21097,33678,33743,33743,33710,18952,0,25259,37936,40049,37969,37936,29517,10500,35888,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,42227,18952,8354,21032,31597,35791,25291,10468,23211,12646,23178,31597,29517,25258,12581,31695,63422,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,44405,18984,6209,21065,25259,0,27501,46486,29549,10500,16839,14758,27469,40179,61277,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,48599,21097,6241,0,27501,46518,38066,33775,52824,52857,54938,61309,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,50712,33808,25291,40147,42292,29549,63390,65535,65535,65535,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,57083,38034,38066,59164,65535,63454,65503,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, };
-const uint16_t bl[40][40] = { {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,2081,2081,33,33,32,33,33,32,32,32,32,32,32,32,32,32,32,2081,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,6339,12645,12645,12645,12645,12645,12645,12613,12613,12613,12613,12613,12613,12613,12613,12613,12613,12645,12645,8452,2081,33,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,2145,16936,21130,12646,12613,12581,12613,12613,12613,12613,12613,12613,12613,12613,12613,12613,12613,12613,12613,12613,12613,12613,12645,16871,14823,6307,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,4226,35921,48566,12645,16839,25259,25258,23210,23210,23210,23210,23210,23210,23210,23210,23210,23210,23178,23178,23210,25258,21064,12613,25323,27436,10533,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,4194,33840,46518,12613,23178,37936,35823,35823,35823,35823,35823,35823,35823,35823,35823,35823,35823,35823,35823,35823,35888,27436,12580,25291,25356,8484,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,2145,35921,48599,12613,23178,37936,35824,35823,35823,35823,35823,35823,35823,35823,35823,35823,35823,35823,35823,35824,37904,29484,12613,25323,27404,10532,0,0,0,0}, {0,0,0,0,0,0,0,0,0,2113,8452,25356,33743,12613,18920,27371,25291,25291,25291,25291,25291,25291,25291,25291,25291,25291,25291,25291,25291,25291,27371,21097,12613,18984,19017,6371,0,0,0,0}, {0,0,0,0,0,0,0,0,32,8452,12645,10532,10500,12613,12613,10532,10532,10532,10532,10532,10532,10532,10532,10532,10532,10532,10532,10532,10532,10532,10500,12581,12645,12613,10533,6339,0,0,0,0}, {0,0,0,0,0,0,0,0,8420,10532,23178,33743,33710,33711,33710,33710,33743,33775,33775,33775,33775,33775,33775,33775,33775,33775,33775,35823,33743,33710,33710,33710,33743,31662,16839,10532,0,0,0,0}, {0,0,0,0,0,0,0,4226,12646,21097,37969,40081,38001,38001,40049,40049,33743,33711,33743,33711,33711,33711,33711,33711,33711,33711,33711,33710,35856,40082,40049,40049,40049,40082,33710,12613,6307,0,0,0}, {0,0,0,0,0,0,0,8452,14726,33710,40049,37936,37937,37937,40049,38001,12645,10500,10532,10532,10532,10532,10532,10532,10532,10532,10532,8387,25258,42195,37969,37936,37936,40049,33743,12645,6339,0,0,0}, {0,0,0,0,0,0,0,8452,14758,35823,37969,37936,37937,38001,29485,18952,21065,23178,23178,23178,23178,23178,23178,23178,23178,23178,23178,23178,21065,21033,35824,37969,37937,40049,33711,12645,6339,0,0,0}, {0,0,0,0,0,0,0,8452,14726,35856,37969,37936,37937,40082,25258,8419,25259,29517,29485,29485,29485,29485,29485,29485,29485,29485,29485,31597,21033,10468,33743,40049,37937,40049,33711,12645,6339,0,0,0}, {0,0,0,0,0,0,0,8452,14726,35856,37969,37936,37937,40049,25291,12580,25258,29485,29452,29452,29452,29452,29452,29452,29452,29452,29452,29485,21065,12613,33743,38001,37937,40049,33711,12645,6339,0,0,0}, {0,0,0,0,0,0,0,8452,14726,35856,37969,37936,37969,40049,25291,10532,23210,29485,29452,29452,29452,29452,29452,29452,29452,29452,29452,29485,21065,12581,33743,38001,37937,40049,33711,12645,6339,0,0,0}, {0,0,0,0,0,0,0,8452,14726,35856,37969,37968,37937,40050,25259,10500,25259,29517,29485,29485,29485,29485,29485,29485,29485,29485,29485,31597,21032,10500,33743,38001,37937,40049,33711,12645,6339,0,0,0}, {0,0,0,0,0,0,0,8452,14726,35856,40049,37969,37969,40049,27404,16839,21097,25259,25259,25258,25258,25258,25258,25258,25258,25259,25259,25291,21065,18887,35791,37969,37937,40049,33711,12645,6339,0,0,0}, {0,0,0,0,0,0,0,8452,14726,37936,40082,40049,40049,38001,40114,40082,14694,10468,10500,10532,10532,10532,10532,10532,10532,10532,10500,8387,25259,44275,37969,37937,37937,40049,33711,12645,6339,0,0,0}, {0,0,0,6339,10533,10565,10565,14758,16839,21097,23178,23177,23178,23178,21097,21065,23146,23178,23178,23178,23178,23178,23178,23178,23178,23178,23178,23178,21097,21065,35824,37969,37936,40049,33711,12645,6339,0,0,0}, {0,0,0,8484,16839,18952,18984,16871,16839,14694,12645,12645,12645,12646,10500,10468,29485,31598,31565,31597,31597,31597,31597,31597,31597,31597,31597,31630,21032,8323,33711,40049,37936,40049,33711,12645,6339,0,0,0}, {0,0,0,4226,6307,6339,6339,12645,16839,21097,23178,21097,21097,23145,21065,21033,23146,23178,23178,23178,23178,23178,23178,23178,23178,23178,23178,23178,21065,21033,35824,37969,37936,40049,33711,12645,6339,0,0,0}, {0,0,0,0,0,0,0,8452,14726,35823,40082,40049,40017,40017,40082,37969,12613,10468,10532,10532,10532,10532,10532,10532,10532,10532,10532,8387,25258,42195,37969,37936,37936,40049,33743,12613,6339,0,0,0}, {0,0,0,0,0,0,0,4194,12645,23145,40049,37969,37969,37969,37969,37969,33710,31630,31630,31662,31662,31662,31662,31662,31662,31662,31662,31630,35824,38001,37969,37936,37969,37969,21033,10532,2081,0,0,0}, {0,0,0,0,0,0,0,0,6339,14726,33775,38001,37969,37969,37969,37969,40050,40050,40049,40049,40049,40049,40049,40049,40050,40050,40050,40050,40049,37937,37969,40081,40114,33743,12613,6307,0,0,0,0}, {0,0,0,0,0,0,0,0,2113,10532,18920,25291,25259,25291,25259,25259,25259,25291,25291,25259,25259,25259,25259,25259,25259,25259,25259,25259,25259,25259,25291,27404,27436,16839,10500,33,0,0,0,0}, {0,0,0,0,0,0,0,0,32,4226,8452,10533,10532,12613,12613,12580,12580,12580,12580,12580,12581,12581,12581,12580,12580,12580,12580,12580,12580,12581,12580,12580,10532,18984,21130,8452,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,4194,29614,40147,12613,21065,31630,31565,29517,31565,29517,29517,29517,29517,29517,29517,29517,29517,29517,29517,29517,31630,25291,12613,25323,27436,10532,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,4194,35920,48599,12613,23178,37904,35823,35791,35791,35823,35823,35791,35791,35791,35791,35791,35823,35791,35791,35823,37904,27436,10533,23243,25356,8452,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,4226,35953,48598,12613,23178,35856,35791,35791,35791,35791,35791,35791,35791,35791,35791,35791,35791,35791,35791,35791,35856,27436,12613,25323,27436,10532,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,4194,19049,21130,12645,16839,18984,18952,18952,18952,18952,18952,18952,18952,18952,18952,18952,18952,18952,18952,18952,18984,16871,12645,16839,16871,6307,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,6306,10565,12613,12613,12613,12613,12613,12613,12613,12613,12613,12613,12613,12613,12613,12613,12613,12613,12613,8452,2081,32,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,2113,10532,10565,10565,10565,10533,10533,10532,10532,10532,10533,10533,10533,10533,10533,10565,10565,10565,10533,4226,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, };
-const uint16_t br[40][40] = { {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,4226,10533,10565,10565,10565,10533,10533,10533,10533,10533,10532,10532,10532,10533,10533,10565,10565,10565,10532,2113,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,32,2081,8452,12613,12613,12613,12613,12613,12613,12613,12613,12613,12613,12613,12613,12613,12613,12613,12613,12613,10565,6306,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,6307,16871,16839,12645,16871,18984,18952,18952,18952,18952,18952,18952,18952,18952,18952,18952,18952,18952,18952,18952,18984,16839,12645,21130,19049,4194,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,10532,27436,25323,12613,27436,35856,35791,35791,35791,35791,35791,35791,35791,35791,35791,35791,35791,35791,35791,35791,35856,23178,12613,48598,35953,4226,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,8452,25356,23243,10533,27436,37904,35823,35791,35791,35823,35791,35791,35791,35791,35791,35823,35823,35791,35791,35823,37904,23178,12613,48599,35920,4194,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,10532,27436,25323,12613,25291,31630,29517,29517,29517,29517,29517,29517,29517,29517,29517,29517,29517,31565,29517,31565,31630,21065,12613,40147,29614,4194,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,8452,21130,18984,10532,12580,12580,12581,12580,12580,12580,12580,12580,12580,12581,12581,12581,12580,12580,12580,12580,12580,12613,12613,10532,10533,8452,4226,32,0,0,0,0,0,0,0,0}, {0,0,0,0,33,10500,16839,27436,27404,25291,25259,25259,25259,25259,25259,25259,25259,25259,25259,25259,25259,25291,25291,25259,25259,25259,25291,25259,25291,18920,10532,2113,0,0,0,0,0,0,0,0}, {0,0,0,0,6307,12613,33743,40114,40081,37969,37937,40049,40050,40050,40050,40050,40049,40049,40049,40049,40049,40049,40050,40050,37969,37969,37969,37969,38001,33775,14726,6339,0,0,0,0,0,0,0,0}, {0,0,0,2081,10532,21033,37969,37969,37936,37969,38001,35824,31630,31662,31662,31662,31662,31662,31662,31662,31662,31630,31630,33710,37969,37969,37969,37969,37969,40049,23145,12645,4194,0,0,0,0,0,0,0}, {0,0,0,6339,12613,33743,40049,37936,37936,37969,42195,25258,8387,10532,10532,10532,10532,10532,10532,10532,10532,10532,10468,12613,37969,40082,40017,40017,40049,40082,35823,14726,8452,0,0,0,0,0,0,0}, {0,0,0,6339,12645,33711,40049,37936,37969,35824,21033,21065,23178,23178,23178,23178,23178,23178,23178,23178,23178,23178,23178,23146,21033,21065,23145,21097,21097,23178,21097,16839,12645,6339,6339,6307,4226,0,0,0}, {0,0,0,6339,12645,33711,40049,37936,40049,33711,8323,21032,31630,31597,31597,31597,31597,31597,31597,31597,31597,31565,31598,29485,10468,10500,12646,12645,12645,12645,14694,16839,16871,18984,18952,16839,8484,0,0,0}, {0,0,0,6339,12645,33711,40049,37936,37969,35824,21065,21097,23178,23178,23178,23178,23178,23178,23178,23178,23178,23178,23178,23146,21065,21097,23178,23178,23177,23178,21097,16839,14758,10565,10565,10533,6339,0,0,0}, {0,0,0,6339,12645,33711,40049,37937,37937,37969,44275,25259,8387,10500,10532,10532,10532,10532,10532,10532,10532,10500,10468,14694,40082,40114,38001,40049,40049,40082,37936,14726,8452,0,0,0,0,0,0,0}, {0,0,0,6339,12645,33711,40049,37937,37969,35791,18887,21065,25291,25259,25259,25258,25258,25258,25258,25258,25258,25259,25259,21097,16839,27404,40049,37969,37969,40049,35856,14726,8452,0,0,0,0,0,0,0}, {0,0,0,6339,12645,33711,40049,37937,38001,33743,10500,21032,31597,29485,29485,29485,29485,29485,29485,29485,29485,29485,29517,25259,10500,25259,40050,37937,37968,37969,35856,14726,8452,0,0,0,0,0,0,0}, {0,0,0,6339,12645,33711,40049,37937,38001,33743,12581,21065,29485,29452,29452,29452,29452,29452,29452,29452,29452,29452,29485,23210,10532,25291,40049,37969,37936,37969,35856,14726,8452,0,0,0,0,0,0,0}, {0,0,0,6339,12645,33711,40049,37937,38001,33743,12613,21065,29485,29452,29452,29452,29452,29452,29452,29452,29452,29452,29485,25258,12580,25291,40049,37937,37936,37969,35856,14726,8452,0,0,0,0,0,0,0}, {0,0,0,6339,12645,33711,40049,37937,40049,33743,10468,21033,31597,29485,29485,29485,29485,29485,29485,29485,29485,29485,29517,25259,8419,25258,40082,37937,37936,37969,35856,14726,8452,0,0,0,0,0,0,0}, {0,0,0,6339,12645,33711,40049,37937,37969,35824,21033,21065,23178,23178,23178,23178,23178,23178,23178,23178,23178,23178,23178,21065,18952,29485,38001,37937,37936,37969,35823,14758,8452,0,0,0,0,0,0,0}, {0,0,0,6339,12645,33743,40049,37936,37936,37969,42195,25258,8387,10532,10532,10532,10532,10532,10532,10532,10532,10532,10500,12645,38001,40049,37937,37937,37936,40049,33710,14726,8452,0,0,0,0,0,0,0}, {0,0,0,6307,12613,33710,40082,40049,40049,40049,40082,35856,33710,33711,33711,33711,33711,33711,33711,33711,33711,33743,33711,33743,40049,40049,38001,38001,40081,37969,21097,12646,4226,0,0,0,0,0,0,0}, {0,0,0,0,10532,16839,31662,33743,33710,33710,33710,33743,35823,33775,33775,33775,33775,33775,33775,33775,33775,33775,33775,33743,33710,33710,33711,33710,33743,23178,10532,8420,0,0,0,0,0,0,0,0}, {0,0,0,0,6339,10533,12613,12645,12581,10500,10532,10532,10532,10532,10532,10532,10532,10532,10532,10532,10532,10532,10532,10532,10532,12613,12613,10500,10532,12645,8452,32,0,0,0,0,0,0,0,0}, {0,0,0,0,6371,19017,18984,12613,21097,27371,25291,25291,25291,25291,25291,25291,25291,25291,25291,25291,25291,25291,25291,25291,27371,18920,12613,33743,25356,8452,2113,0,0,0,0,0,0,0,0,0}, {0,0,0,0,10532,27404,25323,12613,29484,37904,35824,35823,35823,35823,35823,35823,35823,35823,35823,35823,35823,35823,35823,35824,37936,23178,12613,48599,35921,2145,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,8484,25356,25291,12580,27436,35888,35823,35823,35823,35823,35823,35823,35823,35823,35823,35823,35823,35823,35823,35823,37936,23178,12613,46518,33840,4194,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,10533,27436,25323,12613,21064,25258,23210,23178,23178,23210,23210,23210,23210,23210,23210,23210,23210,23210,23210,25258,25259,16839,12645,48566,35921,4226,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,6307,14823,16871,12645,12613,12613,12613,12613,12613,12613,12613,12613,12613,12613,12613,12613,12613,12613,12613,12613,12581,12613,12646,21130,16936,2145,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,33,2081,8452,12645,12645,12613,12613,12613,12613,12613,12613,12613,12613,12613,12613,12645,12645,12645,12645,12645,12645,6339,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,2081,32,32,32,32,32,32,32,32,32,32,33,33,32,33,33,2081,2081,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, };
-const uint16_t bul[40][40] = { {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65503,63454,65535,59164,38066,38034,57083,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,65535,65535,65535,63390,29549,42292,40147,25291,33808,50712,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,61309,54938,52857,52824,33775,38066,46518,27501,0,6241,21097,48599,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,61277,40179,27469,14758,16839,10500,29549,46486,27501,0,25259,21065,6209,18984,44405,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63422,31695,12581,25258,29517,31597,23178,12646,23211,10468,25291,35791,31597,21032,8354,18952,42227,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,35888,10500,29517,37936,37969,40049,37936,25259,0,18952,33710,33743,33743,33678,21097,8387,16871,38033,65535,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65503,65535,65535,38066,10500,29485,37969,37969,37936,37936,37969,37969,27372,8387,23145,33710,33743,33743,33710,23178,10468,14726,33808,63422,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,63454,35888,29582,65503,65535,65535,42292,12613,27371,37969,37936,37936,37936,37936,37969,37936,37969,27436,6242,21032,33710,33743,33710,33710,25258,12581,12613,29582,61309,65535,65503,65535,65535,65535,65535,65535,65535,65535}, {65503,65535,52825,16807,16806,27469,63422,46518,14759,25258,37969,37969,37936,37969,37936,37969,37936,37969,37936,37969,31597,8419,18920,31630,33743,33710,33710,25291,12645,10500,27437,59196,65535,65503,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,44405,14726,14758,25356,18984,23145,37936,37969,37936,37969,37936,37969,35823,21032,29517,21032,27372,40049,31630,10532,16806,31597,33743,33710,33743,27372,14726,10435,23243,57051,65535,63454,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,48599,18952,14758,14726,33743,40049,37936,37936,37936,37969,35856,18984,8420,21065,18952,6274,27371,40049,33743,12646,14694,31565,33743,33710,35791,27404,14758,8354,23178,54937,65535,65535,65535,65535,65535,65535}, {65535,65535,65503,65535,57051,21097,12645,16839,18952,33710,40017,37936,37969,37936,23145,10500,23178,27404,29484,21065,6274,25258,37969,35823,16839,12580,29485,35791,33710,33743,29485,16839,8290,21130,50712,65535,65535,65535,65535,65535}, {65535,65535,65503,65535,44373,18952,29484,18952,12646,16839,31630,40017,37936,23178,6307,21097,27372,29452,29484,29484,23178,6306,21097,37936,35856,18952,8387,27404,35791,33710,33743,31565,16872,6177,21097,46486,65535,65535,65535,65535}, {65535,65535,65535,65535,31662,23145,40017,33710,16871,14726,14759,31597,40049,29485,18984,27404,29452,29484,29452,29452,29484,23178,8387,18952,37904,37936,21065,6274,27371,33743,33710,35791,31597,21065,8322,23210,65503,65535,65535,65535}, {65535,65535,65535,61341,23210,29484,40049,37969,35791,18984,14726,12613,29485,29517,16871,29452,29484,29452,29484,29452,29452,29484,25258,10500,16871,35823,37969,23178,6209,25259,33743,33710,35791,31597,14726,16807,46518,65535,65535,65535}, {65535,65535,65535,52825,14758,31630,37969,37936,37969,35856,21097,8419,18984,23145,8419,18919,27404,29484,29484,29452,29452,29452,29484,25291,12613,14726,33743,37969,25291,4161,23178,33710,33710,21097,12613,21097,25324,57050,65535,65503}, {65535,65535,65535,65535,27469,23178,35856,37969,37936,37969,35856,23178,27404,29517,25258,10500,16839,27372,29484,29452,29484,29452,29452,29484,27371,14726,10500,31630,40017,27404,6242,23145,23178,10467,21130,27501,25323,52857,65535,65503}, {65535,65535,65535,52792,21097,12613,23210,35791,37936,37969,33743,14758,23210,29484,29484,25259,12581,14726,27371,29484,29452,29484,29452,29452,29484,27371,16839,31597,37969,37969,29517,10500,10468,21065,27469,23210,38066,65535,65535,65535}, {65535,65535,50712,27436,44373,27469,0,23145,33710,37936,35823,21032,8387,23178,29484,29484,27339,14693,12645,27339,29484,29452,29452,29452,29484,29484,23145,33678,37969,37936,37969,31597,14726,18984,25324,38001,65535,65535,65535,65535}, {65535,63454,33808,46486,42292,16871,14758,12613,18984,33710,37969,37936,23210,6274,23145,29452,29485,27371,14758,10533,25258,29484,29452,29452,29484,23145,2048,27371,37969,37936,37936,40017,27404,12613,54970,65535,65535,65535,65535,65535}, {65535,65535,35921,35953,19017,10468,31630,29484,10500,16872,31630,37936,37936,25291,4193,21065,29452,29485,27404,16839,10500,25258,29485,29517,23210,6306,23210,37936,37936,37936,37936,40049,29517,25324,63422,65535,65535,65535,65535,65535}, {65535,65535,57115,27436,10500,31597,35791,35791,29484,12613,16839,31597,37936,37969,27372,6306,18952,27404,29485,27404,16871,8419,23145,23178,8387,21097,37936,37969,37936,37936,37969,35856,18919,35888,65535,65503,65535,65535,65535,65535}, {65535,65535,63422,31695,8387,29484,33743,33710,35791,31565,14726,14726,29517,35856,37969,29485,8419,16871,27372,29484,29484,18920,25258,29484,18984,35856,37969,37936,37936,37969,37904,16839,19017,52857,65535,65535,65535,65535,65535,65535}, {65535,65535,59196,23210,10467,12613,27371,33743,33710,35791,31597,16839,12613,29484,35856,37969,31597,10500,14759,27372,31565,25259,27404,37969,37936,37936,37936,37936,37969,37936,21032,18984,50744,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,61277,27437,12613,10532,25259,33710,33743,33743,31630,18952,10500,27404,35856,37969,31630,12613,12645,25258,12613,14726,35856,37969,37936,37936,37936,37936,23178,14759,48566,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,61309,31662,12613,10500,23178,33710,33710,33743,33710,21065,8420,25291,35823,37969,33710,21032,31597,23210,31630,37969,37936,37936,37969,37969,25291,12645,44373,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65503,65535,65503,35888,14758,10468,21097,33710,33743,33743,33710,23145,8387,25258,35791,37969,37936,37969,37969,37969,37936,37936,37936,37969,27404,12613,40179,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65503,65535,65535,38033,16839,8354,21065,33678,33743,33743,33743,25258,8355,23178,33743,37936,37936,37936,37936,37936,37936,37969,29517,10500,35953,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,42227,18984,8322,18952,31597,35791,33710,33743,25291,8387,21065,33710,37969,37936,37936,37969,40049,31630,8387,33775,65502,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,44405,18984,8354,16871,31565,35791,33710,35791,27404,10468,18984,35823,40049,37969,37936,31597,12613,29549,63422,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,48631,21065,8322,16839,29517,35791,33710,35791,29484,12613,18952,31597,29485,18952,18984,29549,61277,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,52824,21130,8355,14726,29484,33743,35791,29517,14726,16839,14758,25356,40179,59164,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,54970,23210,10468,12645,27404,31597,14726,14726,27436,25324,52857,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,59196,27436,10500,14694,14693,14758,27436,25356,25291,57051,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,63390,27469,21097,35921,23178,25388,21130,52825,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,63390,61277,65535,46453,38034,52825,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, };
-const uint16_t bur[40][40] = { {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63454,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,59196,63422,57115,35921,33808,50712,65535,65535,65535,65535,65535,65503,65503,65535,65535,52825,63454,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,61277,23210,31695,27436,35953,46486,27436,52792,65535,52825,61341,65535,65535,65535,65535,44405,16807,35888,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,61309,27437,10467,8387,10500,19017,42292,44373,21097,27469,14758,23210,31662,44373,57051,48599,14726,16806,29582,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,31662,12613,12613,29484,31597,10468,16871,27469,12613,23178,31630,29484,23145,18952,21097,18952,14758,27469,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,35888,12613,10532,27371,33743,35791,31630,14758,0,23210,35856,37969,40049,40017,29484,12645,14758,25356,63422,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,38033,14758,10500,25259,33743,33710,35791,29484,12613,23145,35791,37969,37936,37969,33710,18952,16839,14726,18984,46518,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,42227,16839,10468,23178,33710,33710,35791,29484,10500,18984,33710,37936,37936,37969,35791,16871,12646,18952,33743,23145,14759,42292,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,44405,18984,8354,21097,33710,33743,35791,31565,12613,16872,33710,37936,37969,37969,35856,18984,14726,16839,33710,40049,37936,25258,12613,38066,65535,65535,65503,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65503,65535,48631,18984,8322,21065,33710,33710,33743,31597,14726,16839,31630,37969,35823,33743,35856,21097,14726,14759,31630,40017,37936,37969,37969,27371,10500,35888,63422,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65503,65535,52824,21065,8354,18952,33678,33743,33743,31630,16839,14726,31597,37936,37936,21032,14758,23178,8419,12613,31597,40017,37936,37936,37936,37969,37969,29485,10500,31695,61277,65535,65535,65535,65535,65535}, {65535,65535,65535,65503,65535,54970,21130,8322,16871,31597,33743,33743,33710,18952,12613,29517,37936,37936,23210,8387,23210,27404,18984,29485,40049,37936,37969,37936,37969,37936,37936,37969,29517,12581,40179,65535,65503,65535,65535,65535}, {65535,65535,65503,65535,59196,23210,8355,16839,31565,35791,33743,33710,21065,10500,29484,35856,37969,25291,6274,23178,29484,29517,23145,29517,29485,23178,37936,37969,37936,37969,37936,37969,37936,25258,27469,61309,65535,65535,65535,65535}, {65535,65535,65535,63390,27436,10468,14726,29517,35791,33710,33743,23145,8420,27404,35856,37969,27372,4193,23145,29484,29484,25258,8419,16871,18984,6307,23145,35856,37969,37936,37936,37936,37969,29517,14758,54938,65535,65503,65535,65535}, {65535,65535,63390,27469,10500,12645,29484,35791,33710,33743,25258,8387,25291,35856,37969,29485,6306,21065,29452,29484,25259,10500,18919,29452,27404,21097,10500,18984,35823,37969,37936,37936,40049,31597,16839,52857,65535,65503,65535,65535}, {65535,65535,61277,21097,14694,27404,33743,33710,35791,25291,8355,25258,35823,37969,31597,8419,18952,29452,29485,27339,12581,16839,27404,29484,29452,27372,23178,8420,21032,37936,37969,37969,37936,23178,10500,52824,65535,63454,65535,65535}, {65535,65535,65535,35921,14693,31597,35791,35791,27404,8387,23178,35791,37969,31630,10500,16871,27404,29485,27371,14693,14726,27372,29484,29452,29484,29452,27404,21065,29517,37969,37936,37969,25259,12646,29549,33775,63390,65535,65535,65535}, {65503,65535,46453,23178,14758,14726,29517,29484,10468,21065,33743,37969,33710,12613,14759,27372,29485,27404,14758,12645,27371,29484,29484,29484,29452,29484,29484,18952,21032,37936,37969,27372,0,23211,46486,38066,29549,59164,65535,65535}, {65503,65535,38034,25388,27436,14726,14726,12613,18984,33710,37936,37936,21032,12645,27372,29484,27404,16839,10533,27339,29484,29452,29452,29452,29452,29484,21065,6274,27372,37969,27436,8387,18952,10468,27501,46518,42292,38066,65535,65535}, {65535,65535,52825,21130,25356,27436,16839,18952,35823,37969,37936,37969,31597,25258,31565,29484,16871,10500,25258,29484,29452,29484,29452,29452,29484,23178,6274,27371,40049,31597,6242,23145,33710,25291,0,27501,40147,38034,65535,65535}, {65535,65535,65535,52825,25291,25324,14758,31597,40049,37936,37936,37969,23210,12613,25259,18920,8419,25258,29484,29452,29484,29452,29452,29484,23178,6306,25258,40049,31630,8419,21032,33710,33743,35791,25259,0,25291,57083,65535,65535}, {65535,65535,65535,65535,57051,52857,25356,29485,37969,37936,37936,37969,31630,14726,27404,25258,23145,29485,29452,29452,29452,29452,29484,25258,8387,21097,37969,33743,10532,18920,33710,33743,33743,31597,21065,6241,33808,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,40179,18952,37936,37969,37936,37936,37969,35856,37969,29484,23178,29517,29452,29452,29452,29484,25291,10500,18952,37936,35823,12646,16806,31630,33743,33743,33678,21032,6209,21097,50712,65535,65535,65535}, {65535,65535,65535,65535,65503,65535,59164,18984,31597,40049,37936,37936,37936,37969,37936,18984,8387,23210,29484,29484,29484,27371,12613,16871,37904,35856,16839,14694,31597,33743,33710,33710,21097,8354,18984,48599,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,29549,12613,31630,37969,37936,37936,37936,37936,35856,21097,6306,23145,29484,27371,14726,14726,35823,37936,18952,12580,31565,33743,33710,33710,23178,8387,18952,44405,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,61277,29549,8387,29517,37969,37969,37936,37936,37969,37936,23210,2048,23145,16839,10500,33743,37969,21065,8387,29485,33743,33710,33710,25258,10468,16871,42227,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,63422,33775,10500,27404,37969,37936,37936,37936,37969,37936,27371,33678,31597,31630,37969,23178,6274,27404,35791,33710,33743,25291,12581,14726,38033,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65503,65535,65502,35953,12613,25291,37936,37969,37936,37936,37936,37969,37969,37969,40017,25291,6209,27371,35791,33710,35791,27372,12645,12613,33808,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,40179,12645,23178,37936,37969,37936,37936,37936,37936,37969,27404,4161,25259,33743,33710,33743,27404,14726,10500,29582,63422,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,44373,14759,21032,37904,37969,37936,37936,37969,29517,6242,23178,33743,33710,33743,29485,14758,10435,27437,61309,65535,65503,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,48566,18984,16839,35856,40049,40017,31597,10500,23145,33710,33710,35791,31565,16839,8354,23243,59196,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,50744,19017,18919,29517,27404,14726,10468,23178,33710,35791,31597,16872,8290,23178,57051,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,52857,35888,25324,12613,18984,21065,10467,21097,31597,21065,6177,21130,54937,65535,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,63422,54970,25324,27469,21130,12613,14726,8322,21097,50712,65535,63454,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65535,65535,38001,23210,27501,21097,16807,23210,46486,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,38066,25323,25324,46518,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,52857,57050,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65503,65503,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535,65535}, };
-const uint16_t bu[40][40] = { {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4226,8484,6339,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6307,16839,10533,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6339,18952,10565,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6339,18984,10565,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,4194,8452,12645,16871,14758,8452,8452,8452,8452,8452,8452,8452,8452,4226,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,32,2113,6339,12645,14726,16839,16839,16839,14726,14726,14726,14726,14726,14726,14758,14726,12646,8420,32,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,4226,10532,14726,23145,35823,21097,14694,21097,37936,35856,35856,35856,35856,35856,35823,33710,21097,10532,8452,2113,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,4194,4226,4194,4194,8452,18920,33775,40049,40082,23178,12645,23178,40082,40049,37969,37969,37969,37969,37969,40049,37969,23178,12645,8452,2145,4194,4226,2145,0,0,0,0,0,0}, {0,0,0,0,0,0,19049,35953,35920,29614,10533,25291,38001,37969,40049,21097,12645,23177,40049,37969,37968,37936,37936,37936,37936,37936,40081,33743,10532,25356,35921,33840,35921,16936,0,0,0,0,0,0}, {0,0,0,0,0,0,21130,48598,48599,40147,10532,25259,37969,37969,40017,21097,12645,23178,40049,37969,37937,37969,37937,37937,37937,37937,38001,33710,10500,33743,48599,46518,48566,21130,0,0,0,0,0,0}, {0,0,0,0,2113,6306,12645,12613,12613,12613,12613,25291,37969,37969,40017,23145,12646,23178,38001,40049,40050,40049,40049,40082,38001,37937,38001,33711,12613,12613,12613,12613,12645,12646,6339,0,0,0,0,0}, {0,0,0,0,10532,10565,16839,23178,23178,21065,12613,25259,37969,37969,40082,21065,10500,21097,40114,27404,25259,25291,25291,25258,29485,40049,40049,33710,12613,18920,23178,23178,16839,12613,12645,2081,0,0,0,0}, {0,0,0,0,10565,12613,18984,35856,37904,31630,12580,25259,37969,37969,37969,21033,10468,21065,40082,16839,10500,10532,12580,8419,18952,38001,40049,33710,10532,27371,37936,37936,25259,12581,12645,2081,0,0,0,0}, {0,0,0,0,10565,12613,18952,35791,35823,31565,12580,25259,40050,33710,12613,23146,29485,23146,14694,21097,25259,23210,25258,25259,21065,12645,33743,33743,10532,25291,35824,35823,25258,12613,12645,33,0,0,0,0}, {0,0,0,0,10565,12613,18952,35791,35791,29517,12580,25291,40050,31630,10468,23178,31598,23178,10468,25259,29517,29485,29485,29517,23178,10500,33711,33775,10532,25291,35823,35823,23210,12613,12645,33,0,0,0,0}, {0,0,0,0,10533,12613,18952,35791,35791,31565,12580,25291,40049,31630,10532,23178,31565,23178,10500,25259,29485,29452,29452,29485,23178,10532,33743,33775,10532,25291,35823,35823,23210,12613,12645,32,0,0,0,0}, {0,0,0,0,10533,12613,18952,35791,35823,29517,12580,25259,40049,31662,10532,23178,31597,23178,10532,25258,29485,29452,29452,29485,23178,10532,33711,33775,10532,25291,35823,35823,23210,12613,12645,33,0,0,0,0}, {0,0,0,0,10532,12613,18952,35791,35823,29517,12581,25259,40049,31662,10532,23178,31597,23178,10532,25258,29485,29452,29452,29485,23178,10532,33711,33775,10532,25291,35823,35823,23210,12613,12613,33,0,0,0,0}, {0,0,0,0,10532,12613,18952,35791,35791,29517,12581,25259,40049,31662,10532,23178,31597,23178,10532,25258,29485,29452,29452,29485,23178,10532,33711,33775,10532,25291,35823,35823,23210,12613,12613,32,0,0,0,0}, {0,0,0,0,10532,12613,18952,35791,35791,29517,12581,25259,40049,31662,10532,23178,31597,23178,10532,25258,29485,29452,29452,29485,23178,10532,33711,33775,10532,25291,35823,35823,23210,12613,12613,32,0,0,0,0}, {0,0,0,0,10533,12613,18952,35791,35791,29517,12580,25259,40049,31662,10532,23178,31597,23178,10532,25258,29485,29452,29452,29485,23178,10532,33711,33775,10532,25291,35823,35823,23210,12613,12613,32,0,0,0,0}, {0,0,0,0,10533,12613,18952,35791,35791,29517,12580,25259,40050,31662,10532,23178,31597,23178,10532,25258,29485,29452,29452,29485,23178,10532,33711,33775,10532,25291,35823,35823,23210,12613,12613,32,0,0,0,0}, {0,0,0,0,10533,12613,18952,35791,35791,29517,12580,25259,40050,31662,10532,23178,31597,23178,10532,25259,29485,29452,29452,29485,23178,10532,33711,33775,10532,25291,35823,35823,23210,12613,12613,32,0,0,0,0}, {0,0,0,0,10533,12613,18952,35791,35823,29517,12580,25259,40050,31662,10532,23178,31597,23178,10500,25259,29485,29452,29452,29485,23178,10532,33711,33775,10532,25291,35823,35823,23210,12613,12613,32,0,0,0,0}, {0,0,0,0,10533,12613,18952,35791,35791,29517,12580,25259,40050,31630,8387,23178,31630,23178,8387,25291,31597,29485,29485,31597,23178,8387,33710,35823,10532,25291,35823,35823,23178,12613,12613,32,0,0,0,0}, {0,0,0,0,10565,12613,18952,35791,35791,29517,12580,25259,40049,35824,25258,21065,21032,21097,25259,21065,21032,21065,21065,21033,21065,25258,35856,33743,10532,25291,35823,35823,23178,12613,12613,32,0,0,0,0}, {0,0,0,0,10565,12613,18952,35791,35823,29517,12581,25259,37937,38001,42195,21033,8323,21065,44275,18887,10500,12581,12613,10468,21033,42195,40082,33710,10532,25291,35824,35823,23210,12613,12613,32,0,0,0,0}, {0,0,0,0,10565,12613,18984,35856,37904,31630,12580,25291,37969,37969,37969,35824,33711,35824,37969,35791,33743,33743,33743,33743,35824,37969,40049,33710,10500,27371,37904,35888,25258,12613,12645,32,0,0,0,0}, {0,0,0,0,10533,12613,16871,27436,27436,25291,12580,27404,40081,37936,37936,37969,40049,37969,37937,37969,38001,38001,38001,40049,37969,37936,40049,33710,12581,21097,29484,27436,21064,12613,12645,2081,0,0,0,0}, {0,0,0,0,4226,8452,12645,12613,10533,12613,10532,27436,40114,37969,37936,37936,37936,37936,37937,37937,37937,37937,37937,37937,37937,37936,40049,33743,12645,12613,12613,12580,12613,12645,8452,0,0,0,0,0}, {0,0,0,0,0,2081,16839,25323,23243,25323,18984,16839,33743,37969,40049,40049,40049,40049,40049,40049,40049,40049,40049,40049,40049,40049,40082,31662,12613,18984,25323,25291,25323,16871,2081,0,0,0,0,0}, {0,0,0,0,0,32,16871,27436,25356,27436,21130,10500,12613,21033,33743,33711,33711,33711,33711,33711,33711,33711,33711,33711,33711,33743,33710,16839,10533,19017,27404,25356,27436,14823,33,0,0,0,0,0}, {0,0,0,0,0,0,6307,10532,8452,10532,8452,33,6307,10532,12613,12645,12645,12645,12645,12645,12645,12645,12645,12645,12645,12645,12613,10532,6339,6371,10532,8484,10533,6307,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,2081,6339,6339,6339,6339,6339,6339,6339,6339,6339,6339,6339,6339,6307,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, };
-
-//background
-const uint16_t map1[40][40] = { {64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130}, {64130,27404,10565,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64130}, {64130,23178,8420,6208,10434,8354,8354,8354,8354,8386,8354,8386,8354,8386,8354,10434,4193,0,0,0,10434,6306,10434,32,0,0,4160,10434,6306,8386,8354,8386,8354,8386,8354,8386,8354,8354,8386,64130}, {64130,0,0,29124,35364,33284,33284,35332,33284,33284,33284,35364,33284,35364,33284,37412,24963,0,0,8289,35364,33284,35364,16642,0,0,18722,35364,33284,33284,33284,35332,33284,33284,33284,35364,33284,35332,35364,64130}, {64130,0,0,31138,37378,35298,35299,35298,35298,35299,35299,35298,35299,35299,35298,37378,26978,0,0,10368,33250,35298,35298,20737,0,0,18689,35299,35298,35299,35299,35298,35298,35299,35298,35298,35299,35298,35298,64130}, {64130,33,0,29058,35298,33218,35298,37379,35298,35331,35331,37346,35298,35331,35298,39427,26978,0,0,10368,35298,37378,37378,20737,0,0,20737,37379,35298,35298,35299,37346,35298,35299,37378,37346,35331,35331,37378,64130}, {64130,0,0,35364,43685,41605,35364,26978,29090,29058,29090,29058,29090,27043,29058,29090,22818,0,0,8256,27010,29090,29058,18657,0,0,14529,29058,29058,27010,29090,29058,29058,27043,29090,29058,29091,29058,29058,64130}, {64130,0,0,29091,37411,37379,27010,0,0,0,0,0,0,0,0,0,2080,6208,6208,4128,0,0,0,4128,6208,6208,2080,0,0,0,0,0,0,0,0,0,0,0,0,64130}, {64130,0,0,29025,35265,33185,24865,0,4096,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64130}, {64130,0,0,33284,41604,39524,31171,0,4096,8289,16675,18755,16675,18723,16675,18723,16675,16675,16675,16675,18723,16675,18755,16675,16675,16675,16675,16675,16675,16675,16675,18723,16675,8321,0,4128,2048,2048,2048,64130}, {64130,0,0,33252,39524,39524,29123,0,0,14529,35364,37444,35364,37412,37412,37412,35364,37412,37412,35364,37444,37412,37412,35364,37444,37412,35364,37412,37412,37412,35364,37412,37412,20770,0,4128,0,0,0,64130}, {64130,0,0,29057,35266,35266,26977,0,0,12449,33218,35298,33218,35298,35266,35266,35298,35266,35266,35298,35298,35266,35266,35298,35266,35266,33218,35266,35266,33218,35298,35266,35266,20737,0,4096,0,0,0,64130}, {64130,0,0,31138,37411,37379,27010,0,0,14529,35331,39459,37379,37379,37379,37379,37411,37379,37379,37379,37379,37379,37379,37411,37379,37379,37379,37379,37379,37379,35331,37379,37379,20769,0,4096,0,0,0,64130}, {64130,0,0,35364,43685,41637,31204,0,4128,8288,22850,24930,24930,22850,24930,22850,24930,24898,24897,24930,22850,24930,22850,24930,22850,24898,22850,24930,22817,24963,39557,41637,41637,24963,0,6176,0,0,0,64130}, {64130,0,0,29058,35298,35266,26977,0,4128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31138,35298,35266,20737,0,2048,0,0,0,64130}, {64130,0,0,31138,35298,35298,26977,0,6176,0,0,0,0,0,6176,4128,4128,4128,4128,4128,0,0,0,2048,4128,4128,4128,8256,0,12417,33218,35298,35298,20737,0,4128,0,0,0,64130}, {64130,0,0,33284,41605,41605,31203,0,0,10369,22915,24995,24963,10401,0,2048,0,0,0,4160,24995,22915,24995,8353,0,2048,0,6176,0,12449,37444,41605,39557,24931,0,4128,0,0,0,64130}, {64130,0,0,31171,37412,37412,27043,0,0,14529,35331,39492,37412,18689,0,4128,0,2048,0,10369,37412,37412,37412,20770,0,6176,0,4128,0,12449,35331,37412,37412,20770,0,4128,0,0,0,64130}, {64130,0,0,26977,35265,33185,24897,0,0,12416,31137,35265,33185,16608,0,2048,0,2048,0,8288,33218,35266,35266,18689,0,4128,0,4096,0,10336,31105,35265,33185,20737,0,4096,0,0,0,64130}, {64130,0,0,33251,39492,39492,29091,0,0,14529,37412,39492,37444,20770,0,4128,0,2048,0,8321,35331,37379,37379,20737,0,4128,0,4128,0,12449,35332,39492,37444,22850,0,4128,0,0,0,64130}, {64130,0,0,33284,41605,39557,31204,0,0,16610,37477,41605,39557,20802,0,6208,2080,4128,2048,6208,14529,18689,16609,14497,0,4128,2080,6208,0,12481,37444,41605,39557,24931,0,6208,2080,0,0,64130}, {64130,0,0,26945,33185,33185,24865,0,0,12416,31105,33185,33185,16544,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8224,29057,33185,33185,18624,0,0,0,0,0,64130}, {64130,0,0,31171,37411,37379,27010,0,0,14529,35331,37411,37379,18689,0,0,0,0,0,0,4128,8256,6208,32,0,0,0,32,0,8321,33251,37411,37379,20770,0,32,0,0,0,64130}, {64130,0,0,33284,41605,41605,31204,0,0,16610,39525,41605,39525,33316,27076,29124,29124,29124,29156,27044,0,0,0,24963,31204,29124,29124,29124,27075,31204,37477,41605,39525,33316,27044,31204,22883,0,0,64130}, {64130,0,0,31138,37379,35331,27010,0,0,14497,33251,35331,35299,35331,37379,37379,35331,37379,37379,35299,4128,0,0,29090,37411,35331,35331,35331,37379,35331,35331,35299,35299,35331,35331,39459,29090,0,0,64130}, {64130,0,0,29025,35265,35265,26945,0,0,14497,35266,37346,35298,35298,35298,35298,35298,35298,37346,33218,4128,0,0,29058,37378,35298,35298,35298,35298,35298,35298,35298,35298,35298,35298,37378,29058,0,0,64130}, {64130,0,0,35332,41605,39557,31171,0,0,12449,31171,35299,33251,33251,33251,33250,33251,33251,33251,31171,6208,0,0,27010,35299,33218,33251,33251,33250,33251,33251,33250,33251,33251,33251,35299,27010,0,0,64130}, {64130,0,0,33252,39524,39524,29123,0,8288,6208,8321,10401,12449,8288,10368,8288,10368,8288,8288,8288,4128,0,0,4128,8288,8288,8288,8288,10336,8288,10368,8256,10336,10369,12449,10369,10368,2048,0,64130}, {64130,0,0,26945,33184,33184,24864,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64130}, {64130,0,0,33251,39492,39492,29123,65,8386,8354,8386,10434,10434,6208,4128,6176,6176,6176,6176,6176,0,0,0,4096,6176,6176,6176,6176,6176,6176,6176,6176,4096,10401,10434,10434,6273,0,0,64130}, {64130,0,0,33284,41605,39525,37445,33284,33284,33284,33284,35364,35332,16610,0,4096,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29091,35364,35364,27043,0,0,64130}, {64130,0,0,29058,35298,33218,33250,35298,35298,35299,35299,35298,35298,18657,0,2048,4128,8256,8256,8256,8256,8256,8256,2048,0,0,4128,8256,8256,8256,8256,8256,0,29058,37378,37379,29058,0,0,64130}, {64130,0,0,31138,37378,35298,35331,37378,37346,35331,35331,37378,37379,18657,0,6176,0,0,0,0,0,0,0,0,0,2048,0,0,0,0,0,0,0,26945,35298,35298,26977,0,0,64130}, {64130,0,0,22850,29090,29058,29090,29090,29090,29090,29090,29090,29090,16577,0,0,20802,31204,29156,27076,29156,27076,31204,10434,0,0,16642,31236,27076,29156,27076,29156,27076,37445,41605,43685,33284,0,0,64130}, {64130,0,0,0,0,0,0,0,0,0,0,0,0,0,8256,0,22850,37379,37379,35331,35331,37379,37379,20769,0,0,20738,37379,37379,35331,35331,37379,35331,35331,35331,37411,29090,0,0,64130}, {64130,0,0,0,0,0,0,0,0,0,0,0,0,0,6176,0,22849,35298,35298,35298,35298,35298,37346,18657,0,0,20737,37346,35266,35298,35298,35298,35266,35298,35266,37346,26977,1,1,64130}, {64130,0,0,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,0,6176,0,22850,35331,35331,35331,35331,37379,35331,22817,0,0,18689,35331,35331,35331,35331,35330,35331,35331,35331,37379,29091,0,0,64130}, {64130,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4128,10369,10368,10369,10369,12417,10368,8256,0,0,4128,10368,10368,10369,10369,10368,10369,10369,10368,12451,2048,16649,20876,64130}, {64130,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,20876,29231,64130}, {64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130}, };
-const uint16_t map2[40][40] = { {64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130}, {64130,27436,6307,0,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,2048,0,0,0,0,0,2048,2048,0,0,4096,0,29058,35298,35266,33250,35298,35266,35298,14529,0,2080,0,0,64130}, {64130,21065,32,33,65,65,33,33,33,33,33,33,65,33,33,65,33,0,0,0,32,65,65,33,0,4096,0,29090,39459,37379,37379,37379,37379,37379,18689,0,4128,0,0,64130}, {64130,0,0,35364,35364,37444,33317,37444,35364,35364,35397,35364,37444,35365,37444,35396,33284,0,6176,0,29124,37445,35396,33284,0,4096,0,14529,20769,18689,20770,18689,20769,18689,12448,0,2048,0,0,64130}, {64130,33,4128,31138,37378,35266,35298,35266,35298,35298,35298,35298,35266,35330,35266,37346,33218,8288,0,0,26978,35298,35298,31138,4128,0,2048,0,0,0,0,0,0,0,0,4128,2048,2048,0,64130}, {64130,0,0,33218,35266,35266,33250,35299,35298,35299,35299,35298,35298,33251,35298,35298,33218,0,4128,0,29058,37379,35298,31170,0,2048,0,2080,4128,4128,4128,4128,4128,4128,0,0,0,0,2048,64130}, {64130,0,4128,35364,41572,39524,37444,35331,37379,35331,35331,37379,35331,35363,35331,37379,33251,8288,0,0,27010,37379,37379,33218,4128,0,2048,0,0,0,0,0,0,0,14562,14594,16642,10434,0,64130}, {64130,0,0,39524,39524,41605,29123,0,12449,12449,10401,12449,10369,12449,10369,12449,10369,2080,0,0,6240,12449,12449,10368,2048,0,0,0,0,0,0,0,4128,0,33284,37444,39524,31203,0,64130}, {64130,0,4128,31105,35265,35265,24897,0,0,0,0,0,0,0,0,0,0,4128,4128,6176,2048,0,0,0,0,0,0,0,0,0,0,0,2048,0,29058,35298,35266,29057,0,64130}, {64130,0,0,33218,35298,37346,24897,0,6176,4128,4128,4128,4128,0,0,0,0,0,0,0,0,0,0,0,2048,0,0,0,0,0,0,0,4096,0,31138,35298,35298,29057,0,64130}, {64130,0,4128,37477,41605,41605,31203,0,4128,0,0,2048,0,18722,24996,22915,22916,24996,22915,24995,22916,24995,24996,20835,0,2048,0,0,0,0,0,0,4128,0,35364,41637,41605,35364,0,64130}, {64130,0,0,35364,37444,39492,27011,0,4128,0,0,4128,0,27043,39492,37412,37412,37444,37412,37412,37412,37412,39492,35331,0,0,0,0,0,0,0,0,4128,0,33252,39492,39492,31171,0,64130}, {64130,0,2080,31138,35266,35266,24897,0,4096,0,6176,8256,0,24897,35298,35266,35266,35266,35266,35266,33218,33217,35266,31137,0,0,0,0,0,0,2048,6208,6208,0,29058,35266,35266,29057,0,64130}, {64130,0,0,33250,35298,37379,24930,0,4128,0,0,0,0,24898,37378,35298,35299,35298,35298,35298,35331,37379,37411,33250,0,2048,0,0,0,2048,0,0,0,0,31138,35330,37379,29058,0,64130}, {64130,0,32,39557,43685,43685,31204,0,4128,32,31236,29156,31204,35397,43685,41637,41637,41637,41637,43685,33284,27010,29090,26978,6208,0,2048,0,2080,0,14562,33316,29156,31204,37477,43685,43685,37477,31236,64130}, {64130,0,32,33251,37379,37379,26978,0,0,8288,35331,37411,37379,35331,35331,35331,35331,35331,35299,37379,20769,0,0,0,0,0,0,0,4128,0,16609,37379,37379,37379,35331,35331,35299,35331,37379,64130}, {64130,0,0,33218,35266,35298,24897,0,0,6208,33218,35266,35266,33218,35266,35266,35266,35266,35266,35298,20737,0,6176,2048,0,0,0,0,4128,0,16577,35298,35266,35266,33250,35266,35266,33218,35266,64130}, {64130,0,32,35299,37411,39459,27010,0,0,8288,35331,37411,37379,37411,37379,37379,37411,37411,37379,39459,22849,0,4128,0,0,0,0,0,4128,0,16609,37411,37379,37379,37411,37379,37379,37411,37379,64130}, {64130,0,4128,18689,24930,22850,18689,0,0,8321,41605,41637,41637,41637,41637,41637,39557,20770,24897,22850,16609,0,2048,0,0,0,0,0,2048,0,10369,20770,24930,22818,22850,22850,22849,24930,20770,64130}, {64130,0,0,0,0,0,0,2080,0,8256,31138,35298,33218,35298,33218,35298,31138,0,0,0,0,2048,0,0,0,0,0,0,0,2048,0,0,0,0,0,0,0,0,0,64130}, {64130,0,0,0,0,0,2048,2048,0,4160,35299,35298,35298,33251,35298,35298,33218,0,4128,4128,2048,0,0,0,0,0,0,0,0,0,0,4128,4128,4128,4128,4128,4128,4128,4128,64130}, {64130,0,0,10434,8386,10434,4193,0,0,8288,33251,37411,35331,37379,35331,37379,33251,8256,0,2048,0,0,0,2080,10434,8386,10434,8386,10434,10434,8353,0,0,0,0,0,0,0,0,64130}, {64130,0,0,35396,35396,39524,24963,0,4128,2080,12449,16609,14529,16609,14529,16609,14529,4128,0,0,0,4128,0,14530,39524,35364,37444,35396,37444,37476,31204,0,4128,0,0,0,0,0,0,64130}, {64130,0,4128,31138,35298,35266,26977,0,4096,0,0,0,0,0,0,0,0,4128,4128,4128,0,2048,0,14497,33218,37346,35266,35298,35266,35298,31137,0,0,0,4128,4128,4128,2080,0,64130}, {64130,0,0,35298,35298,37379,24897,0,4128,0,4128,4128,4128,4128,4128,4128,2048,0,0,0,0,4128,0,12449,35298,33218,35266,33218,35266,35298,29058,0,2048,2048,0,0,0,0,2048,64130}, {64130,0,6176,29091,35331,35299,27010,0,4096,0,0,0,0,0,0,0,4160,22883,18755,22915,8353,0,0,16610,39525,41605,39525,39557,39556,41605,35364,0,2048,0,18755,20835,20835,16642,0,64130}, {64130,0,0,2080,4160,4128,2080,0,0,0,0,0,0,0,2080,0,10401,37444,37412,39492,22850,0,0,14561,39524,39492,39524,37444,39492,39524,33284,0,6176,0,33284,39492,39492,31171,0,64130}, {64130,6176,6176,0,0,0,0,0,0,0,6176,6176,6208,2048,2048,0,10368,33218,35266,35266,22817,0,0,12448,33186,35265,33185,33218,33185,35265,29057,0,2048,0,26977,35265,35266,29057,0,64130}, {64130,0,0,4096,2080,2048,2048,0,0,0,0,0,0,0,4128,0,10368,35298,35266,37346,20737,0,0,14497,39459,37379,37379,35331,37379,39459,33218,0,6176,0,33219,37379,37411,31138,0,64130}, {64130,27076,29124,0,0,0,0,2048,0,32,29156,27076,31204,14594,0,0,12481,41605,41637,43685,27043,0,0,12449,29058,33218,29090,31171,31138,31170,27010,2048,0,0,24930,33218,31170,27010,0,64130}, {64130,37411,37379,12449,0,4128,0,2048,0,6241,35331,37411,39459,24930,0,0,10369,35331,37379,37411,22850,0,4128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64130}, {64130,35266,33218,10368,0,2048,4096,6176,2048,8288,33218,35266,35298,22817,0,0,10336,33218,35266,35266,20737,0,4096,0,2048,2048,2048,2048,2048,2048,2048,0,0,0,6176,6176,6176,4128,0,64130}, {64130,37379,35331,10368,0,4128,0,0,0,0,35299,35331,37379,24898,0,0,10369,37379,37379,39459,22849,0,4128,0,0,0,0,0,0,0,0,0,0,2048,0,0,0,0,2048,64130}, {64130,41637,41637,12481,0,0,22883,35396,31236,33316,39557,41637,43685,27075,0,2048,8256,22850,27010,24930,18689,0,2080,0,0,0,0,0,0,0,0,0,4128,0,31204,33316,35364,27043,0,64130}, {64130,35298,33218,12448,0,0,24898,37379,37346,35331,35299,35298,35298,24897,0,4128,0,0,0,0,0,2048,0,0,0,0,0,0,0,0,0,0,2048,0,31138,37379,37378,31138,0,64130}, {64130,35298,35298,8256,0,0,22849,35298,35266,35298,35298,35266,37346,22817,0,4096,0,2048,4096,4096,2048,0,0,0,0,0,0,0,0,0,0,0,2048,0,31138,35266,35298,29025,0,64130}, {64130,37379,35331,14497,0,0,24930,39459,37379,37379,37379,37379,37411,26978,0,4128,0,2145,97,97,97,97,97,65,0,0,0,2113,97,97,97,97,4193,33,31203,39492,39492,31171,0,64130}, {64130,20737,16609,8288,0,0,10369,18689,18689,18689,18689,18689,18689,14529,0,0,8321,37444,35364,37444,35365,37444,37445,33284,0,6176,0,31204,37445,35396,35365,37445,35364,37444,39525,41637,43685,33316,0,64130}, {64130,0,0,0,0,0,0,0,0,0,0,0,0,0,4096,0,12417,33218,37346,35266,35298,35266,35298,31138,4128,0,0,26978,37346,35266,35298,35266,35298,35266,35266,33185,35265,29057,0,64130}, {64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130,64130}, };
-
-
-int led = 0;
-volatile int *ledr = (int *)0xFF200000;
-volatile int *KeyEdgeReg = (int *)(0xFF20005C);
-volatile int *SwReg = (int *)SW_BASE;
-
-volatile int *pixel_ctrl_ptr = (int *)0xFF203020;
-volatile int pixel_buffer_start;
-
-int tileWidth = 20;
-int tileHeight = 20;
-int tankWidth = 14;
-int tankHeight = 14;
-int bulletSpeed = 3;
-int maxBulletNum = 10;
-int wallNum = 45;
-int currentBulletCount = 0;
-
-bool startScreen = true;
-bool pauseScreen = false;
-bool gameRunning = false;
-bool p1Victory = false;
-bool isFirstMap = true;
-bool gamePaused = false;
-
-typedef struct point2d {
-    int x;
-    int y;
-} coord;
-
-typedef struct player {
-    int lifeLeft;
-    int xDir;
-    int yDir;
-    coord position;
-    bool stop;
-    short int playerColor;
-    coord lastDirection;
-} player;
-
-typedef struct bullet {
-    coord position;
-    coord direction;
-    bool render;
-    bool belongToP1;
-} bullet;
-
-void swap(int *first, int *second) {
-    int temp = *first;
-    *first = *second;
-    *second = temp;
-}
-
-void plot_pixel(int x, int y, short int line_color) {
-    *(short int *)(pixel_buffer_start + (y << 10) + (x << 1)) = line_color;
-}
-
-void clear_screen() {
-    for (int x = 0; x < 320; x++) {
-        for (int y = 0; y < 240; y++) {
-            plot_pixel(x, y, BLACK);
-        }
-    }
-}
-
-void draw_line(int x0, int y0, int x1, int y1, short int color) {
-    bool is_steep = ABS(y1 - y0) > ABS(x1 - x0);
-
-    if (is_steep) {
-        swap(&x0, &y0);
-        swap(&x1, &y1);
-    }
-    if (x0 > x1) {
-        swap(&x0, &x1);
-        swap(&y0, &y1);
-    }
-
-    int delta_x = x1 - x0;
-    int delta_y = ABS(y1 - y0);
-    int error = -(delta_x / 2);
-    int y = y0;
-    int y_step = y0 < y1 ? 1 : -1;
-
-    for (int x = x0; x <= x1; x++) {
-        if (is_steep) {
-            plot_pixel(y, x, color);
-        } else {
-            plot_pixel(x, y, color);
-        }
-        error += delta_y;
-        if (error > 0) {
-            y += y_step;
-            error -= delta_x;
-        }
-    }
-}
-
-void wait_for_vsync() {
-    volatile int *status_reg = (int *)0xFF20302C;
-    volatile int *buffer_reg = (int *)0xFF203020;
-    int status = *(status_reg);  // get the current status from status register
-    int sBitStatus = status & 0x01;
-
-    *buffer_reg = 1;
-
-    do {
-        sBitStatus = *status_reg & 0x01;
-    } while (sBitStatus);
-}
-
-void clearMainScreen() {
-    for (int x = 0; x < 12 * tileWidth; x++) {
-        for (int y = 0; y < 240; y++) {
-            plot_pixel(x, y, BLACK);
-        }
-    }
-    draw_line(12 * tileWidth, 0, 12 * tileWidth, RESOLUTION_Y - 1, ORANGE);
-}
-
-void drawBox(int startX, int startY, int endX, int endY, short int color, bool fill) {
-    if (!fill) {
-        draw_line(startX, startY, endX, startY, color);
-        draw_line(startX, endY, endX, endY, color);
-        draw_line(startX, startY, startX, endY, color);
-        draw_line(endX, startY, endX, endY, color);
-    } else {
-        int deltaY = endY - startY;
-        for (int iterator = 0; iterator < deltaY; iterator++) {
-            draw_line(startX, startY + iterator, endX, startY + iterator, color);
-        }
-    }
-}
-
-void textOnHex() {
-    int *hexBase = (int *)HEX3_HEX0_BASE;
-    int *hex4Base = (int *)HEX5_HEX4_BASE;
-
-    if (p1Victory) {
-        *hex4Base = 0b0111001100000110;
-        *hexBase = 0b0111110001111100011111100110111;
-    } else {
-        *hex4Base = 0b0111001101011011;
-        *hexBase = 0b0111110001111100011111100110111;
-    }
-}
-
-void drawStartScreen() {
-    // main window
-    //pause key
-    int pauseX = 10 * tileWidth;
-    for(int row = 0; row < 20; row++){
-        for(int col = 0; col < 40; col++){
-            plot_pixel(pauseX + col, row, pause[row][col]);
-        }
-    }
-    // game title
-    int titlePosition = 2 * tileWidth;
-    for(int row = 0; row < 60; row++){
-        for(int col = 0; col < 160; col++){
-            plot_pixel(titlePosition + col, titlePosition + row, gametitle[row][col]);
-        }
-    }
-    // drawBox(2 * tileWidth, 2 * tileHeight, 10 * tileWidth, 5 * tileHeight, WHITE, false);
-
-    //press to start
-    int presstostartX= 2 * tileWidth;
-    int presstostartY= 6 * tileWidth;
-    for(int row = 0; row < 20; row++){
-        for(int col = 0; col < 160; col++){
-            plot_pixel(presstostartX + col, presstostartY + row, presskeytostart[row][col]);
-        }
-    }
-    
-    //map selection
-    int switch00x = 8 * tileHeight;
-    int switch01x = 2 * tileHeight;
-    int switch0y = 8 * tileHeight - 15;
-    int mapy = 8 * tileHeight;
-    
-    for(int row = 0; row < 15 ; row++){
-        for(int col = 0; col < 40; col++){
-            plot_pixel(switch00x + col, switch0y + row, switch00[row][col]);
-            plot_pixel(switch01x + col, switch0y + row, switch01[row][col]);
-        }
-    }
-    for(int row = 0; row < 40 ; row++){
-        for(int col = 0; col < 40; col++){
-            plot_pixel(switch00x + col, mapy + row, map1[row][col]);
-            plot_pixel(switch01x + col, mapy + row, map2[row][col]);
-        }
-    }
-
-
-    // splitter
-    draw_line(12 * tileWidth, 0, 12 * tileWidth, RESOLUTION_Y - 1, ORANGE);
-
-    // status pane
-    draw_line(12 * tileWidth, 4 * tileHeight, 16 * tileWidth, 4 * tileHeight, ORANGE);
-    draw_line(12 * tileWidth, 6 * tileHeight, 16 * tileWidth, 6 * tileHeight, ORANGE);
-    draw_line(12 * tileWidth, 8 * tileHeight, 16 * tileWidth, 8 * tileHeight, ORANGE);
-    
-    // player1
-    int player1X = 12 * tileWidth + 1;
-     for(int row = 0; row < 20 ; row++){
-        for(int col = 0; col < 80; col++){
-            plot_pixel(player1X + col, row + 1, player1[row][col]);
-        }
-    }
-    
-    // upper small tanks(hearts)
-    int heartUpY = tileHeight + (tileHeight - tankHeight)/2;
-    int heartUpX1 = 13 * tileWidth - tankWidth / 2;
-    int heartUpX2 = 14 * tileWidth - tankWidth / 2;
-    int heartUpX3 = 15 * tileWidth - tankWidth / 2;
-    for(int row = 0; row < 14 ; row++){
-        for(int col = 0; col < 14; col++){
-            if(heart[row][col] == 63422) continue;
-            plot_pixel(heartUpX1 + col, heartUpY + row, heart[row][col]);
-            plot_pixel(heartUpX2 + col, heartUpY + row, heart[row][col]);
-            plot_pixel(heartUpX3 + col, heartUpY + row, heart[row][col]);
-        }
-    }
-
-    // upper big Purple tank
-    int bigPurpleX = 13 * tileHeight;
-    int bigPurpleY = 2 * tileHeight;
-    
-    for(int row = 0; row < 40 ; row++){
-        for(int col = 0; col < 40; col++){
-            plot_pixel(bigPurpleX + col, bigPurpleY + row, bigPurpleTankUp[row][col]);
-            // plot_pixel(switch01x + col, switch0y + row, switch01[row][col]);
-        }
-    }
-    
-    // player1
-    int player2X = 12 * tileWidth + 1;
-    int player2Y = 8 * tileHeight + 1;
-    for(int row = 0; row < 20 ; row++){
-        for(int col = 0; col < 80; col++){
-            plot_pixel(player2X + col, player2Y + row, player2[row][col]);
-        }
-    }
-    
-    // lower small tanks(hearts)
-    int heartLowY = 9 * tileHeight + (tileHeight - tankHeight) / 2;
-    int heartLowX1 = 13 * tileWidth - tankWidth / 2;
-    int heartLowX2 = 14 * tileWidth - tankWidth / 2;
-    int heartLowX3 = 15 * tileWidth - tankWidth / 2;
-    for(int row = 0; row < 14 ; row++){
-        for(int col = 0; col < 14; col++){
-            if(heart[row][col] == 63422) continue;
-            plot_pixel(heartLowX1 + col, heartLowY + row, heart[row][col]);
-            plot_pixel(heartLowX2 + col, heartLowY + row, heart[row][col]);
-            plot_pixel(heartLowX3 + col, heartLowY + row, heart[row][col]);
-        }
-    }
-
-    // lower big tank
-    int bigBrownX = 13 * tileHeight;
-    int bigBrownY = 10 * tileHeight;
-    for(int row = 0; row < 40 ; row++){
-        for(int col = 0; col < 40; col++){
-            plot_pixel(bigBrownX + col, bigBrownY + row, bigBrownTankUp[row][col]);
-            // plot_pixel(switch01x + col, switch0y + row, switch01[row][col]);
-        }
-    }
-}
-
-bool hitBoundaryBullet(coord pos) {
-    return (pos.x <= 0 || pos.x >= 12 * tileWidth || pos.y <= 2 || pos.y >= 12 * tileHeight);
-}
-
-bool withInBox(coord pos, coord boxStart, int boxWidth, int boxHeight) {
-    if ((pos.x >= boxStart.x && pos.x <= (boxStart.x + boxWidth)) && (pos.y >= boxStart.y && pos.y <= boxStart.y + boxHeight)) {
-        return true;
-    }
-    return false;
-}
-
-bool hitPlayer(bullet b, player p1, player p2) {
-    if (b.belongToP1) {
-        if (withInBox(b.position, p2.position, tankWidth, tankHeight)) {
-            return true;
-        }
-    } else {
-        if (withInBox(b.position, p1.position, tankWidth, tankHeight)) {
-            return true;
-        }
-    }
-    return false;
-}
-
-void displayPlayerLife(player p) {
-    int ledValue = *ledr;
-    if (p.playerColor == BLUE) {
-        for (int life = 0; life < (3 - p.lifeLeft); life++) {
-            drawBox((13 + life) * tileWidth - tankWidth / 2, tileHeight + (tileHeight - tankHeight) / 2, (13 + life) * tileWidth + tankWidth / 2,
-                    tileHeight + (tileHeight - tankHeight) / 2 + tankHeight, BLACK, true);
-        }
-        *ledr = (p.lifeLeft | ledValue);
-    } else {
-        for (int life = 0; life < (3 - p.lifeLeft); life++) {
-            drawBox((13 + life) * tileWidth - tankWidth / 2, 9 * tileHeight + (tileHeight - tankHeight) / 2, (13 + life) * tileWidth + tankWidth / 2,
-                    9 * tileHeight + (tileHeight - tankHeight) / 2 + tankHeight, BLACK, true);
-        }
-        *ledr = ((p.lifeLeft << 8) | ledValue);
-    }
-}
-
-void drawVictoryScreen() {
-    if (p1Victory) {
-        for(int row = 0; row < 120 ; row++){
-            for(int col = 0; col < 160; col++){
-                plot_pixel(2 * tileWidth + col, 3 * tileHeight + row, p1Won[row][col]);
-            }
-        }
-    } else {
-        for(int row = 0; row < 120 ; row++){
-            for(int col = 0; col < 160; col++){
-                plot_pixel(2 * tileWidth + col, 3 * tileHeight + row, p2Won[row][col]);
-            }
-        }
-        // drawBox(2 * tileWidth, 3 * tileHeight, 10 * tileWidth, 9 * tileHeight, RED, true);
-    }
-    textOnHex();
-}
-
-void drawBullets(bullet bullets[], int currentBulletCount) {
-    for (int bulletIte = 0; bulletIte < currentBulletCount; bulletIte++) {
-        if (bullets[bulletIte].render) {
-            draw_line(bullets[bulletIte].position.x, bullets[bulletIte].position.y,
-                      bullets[bulletIte].position.x - bullets[bulletIte].direction.x * 2, bullets[bulletIte].position.y - bullets[bulletIte].direction.y * 2,
-                      bullets[bulletIte].belongToP1 ? BLUE : RED);
-        }
-    }
-}
-
-void drawWalls(int x, int y) {
-    coord pos;
-    pos.x = x;
-    pos.y = y;
-    for(int row = 0; row < 20; row++){
-        for(int col = 0; col < 20; col++){
-            plot_pixel(x + col, y + row, brickMain[row][col]);
-        }
-    }
-    // drawBox(pos.x, pos.y, pos.x + tileWidth, pos.y + tileHeight, ORANGE, true);
-    // drawBox(pos.x + 5, pos.y + 5, pos.x + tileWidth - 5, pos.y + tileHeight - 5, GREY, true);
-}
-
-void drawPlayer(player p) {
-    if(p.playerColor == BLUE){
-        for(int row = 0; row < 14; row++){
-            for(int col = 0; col < 14; col++){
-                plot_pixel(p.position.x + col, p.position.y + row, psup[row][col]);
-            }
-        }
-    }else{
-        for(int row = 0; row < 14; row++){
-            for(int col = 0; col < 14; col++){
-                plot_pixel(p.position.x + col, p.position.y + row, bsup[row][col]);
-            }
-        }
-    }
-    // drawBox(p.position.x, p.position.y, p.position.x + tankWidth, p.position.y + tankHeight, p.playerColor, true);
-}
-
-void loadFirstGameMap(coord *walls) {
-    int wallIte = 0;
-    for (; wallIte < 4; wallIte++) {
-        drawWalls(tileWidth + tileWidth * wallIte, tileHeight);
-        walls[wallIte].x = (tileWidth + tileWidth * wallIte);
-        walls[wallIte].y = tileHeight;
-    }
-
-    for (; wallIte < 4 + 8; wallIte++) {
-        drawWalls(tileWidth, 2 * tileHeight + tileHeight * (wallIte - 4));
-        walls[wallIte].x = (tileWidth);
-        walls[wallIte].y = 2 * tileHeight + tileHeight * (wallIte - 4);
-    }
-
-    for (; wallIte < (12 + 7); wallIte++) {
-        drawWalls(3 * tileWidth + tileWidth * (wallIte - 12), 3 * tileHeight);
-        walls[wallIte].x = 3 * tileWidth + tileWidth * (wallIte - 12);
-        walls[wallIte].y = 3 * tileHeight;
-    }
-
-    for (; wallIte < (19 + 4); wallIte++) {
-        drawWalls(8 * tileWidth + tileWidth * (wallIte - 19), tileHeight);
-        walls[wallIte].x = 8 * tileWidth + tileWidth * (wallIte - 19);
-        walls[wallIte].y = tileHeight;
-    }
-
-    for (; wallIte < (23 + 3); wallIte++) {
-        drawWalls(9 * tileWidth, tileHeight * 4 + tileHeight * (wallIte - 23));
-        walls[wallIte].x = 9 * tileWidth;
-        walls[wallIte].y = tileHeight * 4 + tileHeight * (wallIte - 23);
-    }
-
-    for (; wallIte < (26 + 4); wallIte++) {
-        drawWalls(7 * tileWidth + (wallIte - 26) * tileWidth, 7 * tileHeight);
-        walls[wallIte].x = 7 * tileWidth + (wallIte - 26) * tileWidth;
-        walls[wallIte].y = 7 * tileHeight;
-    }
-
-    for (; wallIte < (30 + 2); wallIte++) {
-        drawWalls(2 * tileWidth + (wallIte - 30) * tileWidth, 9 * tileHeight);
-        walls[wallIte].x = 2 * tileWidth + (wallIte - 30) * tileWidth;
-        walls[wallIte].y = 9 * tileHeight;
-    }
-
-    for (; wallIte < (32 + 3); wallIte++) {
-        drawWalls(3 * tileWidth, 5 * tileHeight + (wallIte - 32) * tileHeight);
-        walls[wallIte].x = 3 * tileWidth;
-        walls[wallIte].y = 5 * tileHeight + (wallIte - 32) * tileHeight;
-    }
-
-    for (; wallIte < (35 + 2); wallIte++) {
-        drawWalls(4 * tileWidth + (wallIte - 35) * tileWidth, 7 * tileHeight);
-        walls[wallIte].x = 4 * tileWidth + (wallIte - 35) * tileWidth;
-        walls[wallIte].y = 7 * tileHeight;
-    }
-
-    for (; wallIte < (37 + 3); wallIte++) {
-        drawWalls(8 * tileWidth + (wallIte - 37) * tileWidth, 10 * tileHeight);
-        walls[wallIte].x = 8 * tileWidth + (wallIte - 37) * tileWidth;
-        walls[wallIte].y = 10 * tileHeight;
-    }
-
-    for (; wallIte < (40 + 2); wallIte++) {
-        drawWalls(5 * tileWidth + (wallIte - 40) * tileWidth, 10 * tileHeight);
-        walls[wallIte].x = 5 * tileWidth + (wallIte - 40) * tileWidth;
-        walls[wallIte].y = 10 * tileHeight;
-    }
-
-    drawWalls(6 * tileWidth, tileHeight);
-    walls[wallIte].x = 6 * tileWidth;
-    walls[wallIte].y = tileHeight;
-
-    drawWalls(6 * tileWidth, 5 * tileHeight);
-    walls[wallIte + 1].x = 6 * tileWidth;
-    walls[wallIte + 1].y = 5 * tileHeight;
-
-    drawWalls(10 * tileWidth, 9 * tileHeight);
-    walls[wallIte + 2].x = 10 * tileWidth;
-    walls[wallIte + 2].y = 9 * tileHeight;
-
-    // drawWalls(6 * tileWidth, 11 * tileHeight);
-}
-
-void loadSecondGameMap(coord *walls) {
-    int wallIte = 0;
-    for (; wallIte < 4; wallIte++) {
-        drawWalls(tileWidth + wallIte * tileWidth, tileHeight);
-        walls[wallIte].x = tileWidth + wallIte * tileWidth;
-        walls[wallIte].y = tileHeight;
-    }
-
-    for (; wallIte < (4 + 3); wallIte++) {
-        drawWalls(tileWidth, 2 * tileHeight + tileHeight * (wallIte - 4));
-        walls[wallIte].x = tileWidth;
-        walls[wallIte].y = 2 * tileHeight + tileHeight * (wallIte - 4);
-    }
-
-    for (; wallIte < (7 + 2); wallIte++) {
-        drawWalls(tileWidth * 8 + tileWidth * (wallIte - 7), 0);
-        walls[wallIte].x = tileWidth * 8 + tileWidth * (wallIte - 7);
-        walls[wallIte].y = 0;
-    }
-
-    for (; wallIte < (9 + 3); wallIte++) {
-        drawWalls(4 * tileWidth + (wallIte - 9) * tileWidth, 3 * tileHeight);
-        walls[wallIte].x = 4 * tileWidth + (wallIte - 9) * tileWidth;
-        walls[wallIte].y = 3 * tileHeight;
-    }
-
-    for (; wallIte < (12 + 3); wallIte++) {
-        drawWalls(3 * tileWidth + (wallIte - 12) * tileWidth, 4 * tileHeight);
-        walls[wallIte].x = 3 * tileWidth + (wallIte - 12) * tileWidth;
-        walls[wallIte].y = 4 * tileHeight;
-    }
-
-    for (; wallIte < (15 + 2); wallIte++) {
-        drawWalls(3 * tileWidth + (wallIte - 15) * tileWidth, 5 * tileHeight);
-        walls[wallIte].x = 3 * tileWidth + (wallIte - 15) * tileWidth;
-        walls[wallIte].y = 5 * tileHeight;
-    }
-
-    for (; wallIte < (17 + 2); wallIte++) {
-        drawWalls(10 * tileWidth, 2 * tileHeight + (wallIte - 17) * tileHeight);
-        walls[wallIte].x = 10 * tileWidth;
-        walls[wallIte].y = 2 * tileHeight + (wallIte - 17) * tileHeight;
-    }
-
-    for (; wallIte < (19 + 3); wallIte++) {
-        drawWalls(9 * tileWidth + (wallIte - 19) * tileWidth, 4 * tileHeight);
-        walls[wallIte].x = 9 * tileWidth + (wallIte - 19) * tileWidth;
-        walls[wallIte].y = 4 * tileHeight;
-    }
-
-    for (; wallIte < (22 + 2); wallIte++) {
-        drawWalls(7 * tileWidth + (wallIte - 22) * tileWidth, 6 * tileHeight);
-        walls[wallIte].x = 7 * tileWidth + (wallIte - 22) * tileWidth;
-        walls[wallIte].y = 6 * tileHeight;
-    }
-
-    for (; wallIte < (24 + 2); wallIte++) {
-        drawWalls(7 * tileWidth + (wallIte - 24) * tileWidth, 7 * tileHeight);
-        walls[wallIte].x = 7 * tileWidth + (wallIte - 24) * tileWidth;
-        walls[wallIte].y = 7 * tileHeight;
-    }
-
-    for (; wallIte < (26 + 2); wallIte++) {
-        drawWalls(0, 8 * tileHeight + (wallIte - 26) * tileHeight);
-        walls[wallIte].x = 0;
-        walls[wallIte].y = 8 * tileHeight + (wallIte - 26) * tileHeight;
-    }
-
-    for (; wallIte < (28 + 2); wallIte++) {
-        drawWalls(tileWidth + (wallIte - 28) * tileWidth, 11 * tileHeight);
-        walls[wallIte].x = tileWidth + (wallIte - 28) * tileWidth;
-        walls[wallIte].y = 11 * tileHeight;
-    }
-
-    for (; wallIte < (30 + 2); wallIte++) {
-        drawWalls(2 * tileWidth + (wallIte - 30) * tileWidth, 9 * tileHeight);
-        walls[wallIte].x = 2 * tileWidth + (wallIte - 30) * tileWidth;
-        walls[wallIte].y = 9 * tileHeight;
-    }
-
-    for (; wallIte < (32 + 2); wallIte++) {
-        drawWalls(5 * tileWidth + (wallIte - 32) * tileWidth, 10 * tileHeight);
-        walls[wallIte].x = 5 * tileWidth + (wallIte - 32) * tileWidth;
-        walls[wallIte].y = 10 * tileHeight;
-    }
-
-    for (; wallIte < (34 + 3); wallIte++) {
-        drawWalls(8 * tileWidth + (wallIte - 34) * tileWidth, 10 * tileHeight);
-        walls[wallIte].x = 8 * tileWidth + (wallIte - 34) * tileWidth;
-        walls[wallIte].y = 10 * tileHeight;
-    }
-
-    for (; wallIte < (37 + 2); wallIte++) {
-        drawWalls(5 * tileWidth, 7 * tileHeight + (wallIte - 37) * tileHeight);
-        walls[wallIte].x = 5 * tileWidth;
-        walls[wallIte].y = 7 * tileHeight + (wallIte - 37) * tileHeight;
-    }
-
-    drawWalls(6 * tileWidth, tileHeight);
-    walls[wallIte].x = 6 * tileWidth;
-    walls[wallIte].y = tileHeight;
-
-    wallIte++;
-    drawWalls(tileWidth, 6 * tileHeight);
-    walls[wallIte].x = tileWidth;
-    walls[wallIte].y = 6 * tileHeight;
-
-    wallIte++;
-    drawWalls(10 * tileWidth, 7 * tileHeight);
-    walls[wallIte].x = 10 * tileWidth;
-    walls[wallIte].y = 7 * tileHeight;
-
-    wallIte++;
-    drawWalls(6 * tileWidth, 11 * tileHeight);
-    walls[wallIte].x = 6 * tileWidth;
-    walls[wallIte].y = 11 * tileHeight;
-
-    wallIte++;
-    drawWalls(10 * tileWidth, 9 * tileHeight);
-    walls[wallIte].x = 10 * tileWidth;
-    walls[wallIte].y = 9 * tileHeight;
-
-    wallIte++;
-    drawWalls(3 * tileWidth, 8 * tileHeight);
-    walls[wallIte].x = 3 * tileWidth;
-    walls[wallIte].y = 8 * tileHeight;
-
-    // drawBox(2 * tileWidth, 2 * tileHeight, 10 * tileWidth, 10 * tileHeight, WHITE, false);
-}
-
-void drawLowerSmallTank() {
-    int heartLowY = 9 * tileHeight + (tileHeight - tankHeight) / 2;
-    int heartLowX1 = 13 * tileWidth - tankWidth / 2;
-    int heartLowX2 = 14 * tileWidth - tankWidth / 2;
-    int heartLowX3 = 15 * tileWidth - tankWidth / 2;
-    for(int row = 0; row < 14 ; row++){
-        for(int col = 0; col < 14; col++){
-            if(heart[row][col] == 63422) continue;
-            plot_pixel(heartLowX1 + col, heartLowY + row, heart[row][col]);
-            plot_pixel(heartLowX2 + col, heartLowY + row, heart[row][col]);
-            plot_pixel(heartLowX3 + col, heartLowY + row, heart[row][col]);
-        }
-    }
-}
-
-void drawUpperSmallTank() {
-    int heartUpY = tileHeight + (tileHeight - tankHeight)/2;
-    int heartUpX1 = 13 * tileWidth - tankWidth / 2;
-    int heartUpX2 = 14 * tileWidth - tankWidth / 2;
-    int heartUpX3 = 15 * tileWidth - tankWidth / 2;
-    for(int row = 0; row < 14 ; row++){
-        for(int col = 0; col < 14; col++){
-            if(heart[row][col] == 63422) continue;
-            plot_pixel(heartUpX1 + col, heartUpY + row, heart[row][col]);
-            plot_pixel(heartUpX2 + col, heartUpY + row, heart[row][col]);
-            plot_pixel(heartUpX3 + col, heartUpY + row, heart[row][col]);
-        }
-    }
-}
-
-void drawSideLabel() {
-    int manualY = 4 * tileHeight + 1;
-    int iconsY = 5 * tileHeight + 2;
-
-    int upX = 12 * tileWidth;
-    int downX = 13 * tileWidth - 4;
-    int leftX = 14 * tileWidth - 8;
-    int rightX = 15 * tileWidth - 12;
-    int fireX = 16 * tileWidth - 16;
-    for(int row = 0; row < 20 ; row++){
-        for(int col = 0; col < 80; col++){
-            plot_pixel(upX + col + 1, manualY + row, p1Text[row][col]);
-            
-        }
-    }
-    for(int row = 0; row < 16 ; row++){
-        for(int col = 0; col < 16; col++){
-            if(up[row][col] != 65535){
-                plot_pixel(upX + col, iconsY + row, up[row][col]);
-            }
-             if(down[row][col] != 65535){
-                plot_pixel(downX + col, iconsY + row, down[row][col]);
-            }
-             if(left[row][col] != 65535){
-                plot_pixel(leftX + col, iconsY + row, left[row][col]);
-            }
-             if(right[row][col] != 65535){
-                plot_pixel(rightX + col, iconsY + row, right[row][col]);
-            }
-            plot_pixel(fireX + col, iconsY + row, fire[row][col]);
-        }
-    }
-    
-    int manualDownY = 6 * tileHeight + 1;
-    int iconsDownY = 7 * tileHeight + 2;
-    for(int row = 0; row < 20 ; row++){
-        for(int col = 0; col < 80; col++){
-            plot_pixel(upX + col + 1, manualDownY + row, p2Text[row][col]);
-            
-        }
-    }
-
-    for(int row = 0; row < 16 ; row++){
-        for(int col = 0; col < 16; col++){
-            if(up[row][col] != 65535){
-                plot_pixel(upX + col, iconsDownY + row, up[row][col]);
-            }
-                if(down[row][col] != 65535){
-                plot_pixel(downX + col, iconsDownY + row, down[row][col]);
-            }
-                if(left[row][col] != 65535){
-                plot_pixel(leftX + col, iconsDownY + row, left[row][col]);
-            }
-                if(right[row][col] != 65535){
-                plot_pixel(rightX + col, iconsDownY + row, right[row][col]);
-            }
-            plot_pixel(fireX + col, iconsDownY + row, fire[row][col]);
-        }
-    }
-}
-
-void drawBigTank(player p) {
-    if (p.playerColor == BLUE) {
-        int bigPurpleX = 13 * tileHeight;
-        int bigPurpleY = 2 * tileHeight;
-        if(p.lastDirection.x == 0 && p.lastDirection.y == 1) {
-            drawBox(bigPurpleX, bigPurpleY, bigPurpleX + 40, bigPurpleY + 40, BLACK, true);
-            for(int row = 0; row < 40 ; row++){
-                for(int col = 0; col < 40; col++){
-                    if(pu[row][col] == 65535) continue;
-                    plot_pixel(bigPurpleX + col, bigPurpleY + row, pd[row][col]);
-                }
-            }
-        } else if (p.lastDirection.x == 0 && p.lastDirection.y == -1) {
-            drawBox(bigPurpleX, bigPurpleY, bigPurpleX + 40, bigPurpleY + 40, BLACK, true);
-            for(int row = 0; row < 40 ; row++){
-                for(int col = 0; col < 40; col++){
-                    if(pd[row][col] == 65535) continue;
-                    plot_pixel(bigPurpleX + col, bigPurpleY + row, pu[row][col]);
-                }
-            }
-        } else if (p.lastDirection.x == 1 && p.lastDirection.y == 0) {
-            drawBox(bigPurpleX, bigPurpleY, bigPurpleX + 40, bigPurpleY + 40, BLACK, true);
-            for(int row = 0; row < 40 ; row++){
-                for(int col = 0; col < 40; col++){
-                    if(pr[row][col] == 65535) continue;
-                    plot_pixel(bigPurpleX + col, bigPurpleY + row, pr[row][col]);
-                }
-            }
-        } else if (p.lastDirection.x == 1 && p.lastDirection.y == -1) {
-            drawBox(bigPurpleX, bigPurpleY, bigPurpleX + 40, bigPurpleY + 40, BLACK, true);
-            for(int row = 0; row < 40 ; row++){
-                for(int col = 0; col < 40; col++){
-                    if(pur[row][col] == 65535) continue;
-                    plot_pixel(bigPurpleX + col, bigPurpleY + row, pur[row][col]);
-                }
-            }
-        } else if (p.lastDirection.x == 1 && p.lastDirection.y == 1) {
-            drawBox(bigPurpleX, bigPurpleY, bigPurpleX + 40, bigPurpleY + 40, BLACK, true);
-            for(int row = 0; row < 40 ; row++){
-                for(int col = 0; col < 40; col++){
-                    if(pdr[row][col] == 65535) continue;
-                    plot_pixel(bigPurpleX + col, bigPurpleY + row, pdr[row][col]);
-                }
-            }
-        } else if (p.lastDirection.x == -1 && p.lastDirection.y == 0) {
-            drawBox(bigPurpleX, bigPurpleY, bigPurpleX + 40, bigPurpleY + 40, BLACK, true);
-            for(int row = 0; row < 40 ; row++){
-                for(int col = 0; col < 40; col++){
-                    if(pl[row][col] == 65535) continue;
-                    plot_pixel(bigPurpleX + col, bigPurpleY + row, pl[row][col]);
-                }
-            }
-        } else if (p.lastDirection.x == -1 && p.lastDirection.y == -1) {
-            drawBox(bigPurpleX, bigPurpleY, bigPurpleX + 40, bigPurpleY + 40, BLACK, true);
-            for(int row = 0; row < 40 ; row++){
-                for(int col = 0; col < 40; col++){
-                    if(pul[row][col] == 65535) continue;
-                    plot_pixel(bigPurpleX + col, bigPurpleY + row, pul[row][col]);
-                }
-            }
-        } else if (p.lastDirection.x == -1 && p.lastDirection.y == 1) {
-            drawBox(bigPurpleX, bigPurpleY, bigPurpleX + 40, bigPurpleY + 40, BLACK, true);
-            for(int row = 0; row < 40 ; row++){
-                for(int col = 0; col < 40; col++){
-                    if(pdl[row][col] == 65535) continue;
-                    plot_pixel(bigPurpleX + col, bigPurpleY + row, pdl[row][col]);
-                }
-            }
-        }
-    } else {
-        int bigBrownX = 13 * tileHeight;
-        int bigBrownY = 10 * tileHeight;
-        if(p.lastDirection.x == 0 && p.lastDirection.y == 1) {
-            drawBox(bigBrownX, bigBrownY, bigBrownX + 40, bigBrownY + 40, BLACK, true);
-            for(int row = 0; row < 40 ; row++){
-                for(int col = 0; col < 40; col++){
-                    if(bu[row][col] == 65535) continue;
-                    plot_pixel(bigBrownX + col, bigBrownY + row, bd[row][col]);
-                }
-            }
-        } else if (p.lastDirection.x == 0 && p.lastDirection.y == -1) {
-            drawBox(bigBrownX, bigBrownY, bigBrownX + 40, bigBrownY + 40, BLACK, true);
-            for(int row = 0; row < 40 ; row++){
-                for(int col = 0; col < 40; col++){
-                    if(bd[row][col] == 65535) continue;
-                    plot_pixel(bigBrownX + col, bigBrownY + row, bu[row][col]);
-                }
-            }
-        } else if (p.lastDirection.x == 1 && p.lastDirection.y == 0) {
-            drawBox(bigBrownX, bigBrownY, bigBrownX + 40, bigBrownY + 40, BLACK, true);
-            for(int row = 0; row < 40 ; row++){
-                for(int col = 0; col < 40; col++){
-                    if(br[row][col] == 65535) continue;
-                    plot_pixel(bigBrownX + col, bigBrownY + row, br[row][col]);
-                }
-            }
-        } else if (p.lastDirection.x == 1 && p.lastDirection.y == -1) {
-            drawBox(bigBrownX, bigBrownY, bigBrownX + 40, bigBrownY + 40, BLACK, true);
-            for(int row = 0; row < 40 ; row++){
-                for(int col = 0; col < 40; col++){
-                    if(bur[row][col] == 65535) continue;
-                    plot_pixel(bigBrownX + col, bigBrownY + row, bur[row][col]);
-                }
-            }
-        } else if (p.lastDirection.x == 1 && p.lastDirection.y == 1) {
-            drawBox(bigBrownX, bigBrownY, bigBrownX + 40, bigBrownY + 40, BLACK, true);
-            for(int row = 0; row < 40 ; row++){
-                for(int col = 0; col < 40; col++){
-                    if(bdr[row][col] == 65535) continue;
-                    plot_pixel(bigBrownX + col, bigBrownY + row, bdr[row][col]);
-                }
-            }
-        } else if (p.lastDirection.x == -1 && p.lastDirection.y == 0) {
-            drawBox(bigBrownX, bigBrownY, bigBrownX + 40, bigBrownY + 40, BLACK, true);
-            for(int row = 0; row < 40 ; row++){
-                for(int col = 0; col < 40; col++){
-                    if(bl[row][col] == 65535) continue;
-                    plot_pixel(bigBrownX + col, bigBrownY + row, bl[row][col]);
-                }
-            }
-        } else if (p.lastDirection.x == -1 && p.lastDirection.y == -1) {
-            drawBox(bigBrownX, bigBrownY, bigBrownX + 40, bigBrownY + 40, BLACK, true);
-            for(int row = 0; row < 40 ; row++){
-                for(int col = 0; col < 40; col++){
-                    if(bul[row][col] == 65535) continue;
-                    plot_pixel(bigBrownX + col, bigBrownY + row, bul[row][col]);
-                }
-            }
-        } else if (p.lastDirection.x == -1 && p.lastDirection.y == 1) {
-            drawBox(bigBrownX, bigBrownY, bigBrownX + 40, bigBrownY + 40, BLACK, true);
-            for(int row = 0; row < 40 ; row++){
-                for(int col = 0; col < 40; col++){
-                    if(bdl[row][col] == 65535) continue;
-                    plot_pixel(bigBrownX + col, bigBrownY + row, bdl[row][col]);
-                }
-            }
-        }
-    }
-}
-
-void clearPlayerTrace(player p1, player p2, bullet bullets[]) {
-    int startX = p1.position.x - 5;
-    int startY = p1.position.y - 5;
-    if (startX < 0) {
-        startX = 0;
-    }
-    if (startY < 0) {
-        startY = 0;
-    }
-    drawBox(startX, startY, startX + tileWidth, startY + tileHeight, BLACK, true);
-
-    startX = p2.position.x - 5;
-    startY = p2.position.y - 5;
-    if (startX < 0) {
-        startX = 0;
-    }
-    if (startY < 0) {
-        startY = 0;
-    }
-    drawBox(startX, startY, startX + tileWidth, startY + tileHeight, BLACK, true);
-
-    // splitters
-    draw_line(12 * tileWidth, 0, 12 * tileWidth, RESOLUTION_Y - 1, ORANGE);
-    draw_line(12 * tileWidth, 4 * tileHeight, 16 * tileWidth, 4 * tileHeight, ORANGE);
-    draw_line(12 * tileWidth, 6 * tileHeight, 16 * tileWidth, 6 * tileHeight, ORANGE);
-    draw_line(12 * tileWidth, 8 * tileHeight, 16 * tileWidth, 8 * tileHeight, ORANGE);
-
-    for (int bulletIte = 0; bulletIte < currentBulletCount; bulletIte++) {
-        draw_line(bullets[bulletIte].position.x, bullets[bulletIte].position.y,
-                  bullets[bulletIte].position.x - bullets[bulletIte].direction.x * 3, bullets[bulletIte].position.y - bullets[bulletIte].direction.y * 3,
-                  BLACK);
-    }
-
-    // side labels
-    drawSideLabel();
-
-    // big tank
-    drawBigTank(p1);
-    drawBigTank(p2);
-}
-
-void drawPauseScreen() {
-   for(int row = 0; row < 120 ; row++){
-        for(int col = 0; col < 160; col++){
-            plot_pixel(2 * tileWidth + col + 1, 3 * tileHeight + row, pausePage[row][col]);
-            
-        }
-    }
-//    drawBox(2 * tileWidth, 3 * tileHeight, 10 * tileWidth, 9 * tileHeight, PINK, true);
-}
-
-
-int main(void) {
-	volatile int *keyBoard = (int *) 0xff200100;
-    *(pixel_ctrl_ptr + 1) = 0xC8000000;
-    wait_for_vsync();
-    pixel_buffer_start = *pixel_ctrl_ptr;
-    clear_screen();
-    *(pixel_ctrl_ptr + 1) = 0xC0000000;
-    pixel_buffer_start = *(pixel_ctrl_ptr + 1);
-    clear_screen();
-
-    // draw start screen
-    drawStartScreen();
-    drawSideLabel();
-    wait_for_vsync();
-    pixel_buffer_start = *(pixel_ctrl_ptr + 1);  // new back buffer
-    drawStartScreen();
-    drawSideLabel();
-
-	unsigned char b1 = 0;
-	unsigned char b2 = 0;
-	unsigned char b3 = 0;
-	
-	
-    // pool for sw0 and key 0
-    // if sw0 = 0 and key 0 pressed, map 1 is selected
-    while (startScreen) {
-        if (*KeyEdgeReg & 0x1) {  // if bit 0 is set to 1
-            if ((*SwReg & 0b1) == 1) {
-                isFirstMap = false;
-            }
-            startScreen = false;   // breaks out of start screen
-            gameRunning = true;    // set game running flag to true
-            *KeyEdgeReg = 0b1111;  // reset all keys
-        }
-    }
-
-    clearMainScreen();
-    wait_for_vsync();
-    pixel_buffer_start = *(pixel_ctrl_ptr + 1);  // new back buffer
-    clearMainScreen();
-
-    player p1;
-    p1.stop = false;
-    p1.lifeLeft = 3;
-    p1.position.x = 222;
-    p1.position.y = 220;
-    p1.xDir = 0;
-    p1.yDir = 0;
-    p1.playerColor = BLUE;
-
-    player p2;
-    p2.stop = false;
-    p2.lifeLeft = 3;
-    p2.position.x = 2;
-    p2.position.y = 4;
-    p2.xDir = 0;
-    p2.yDir = 0;
-    p2.playerColor = RED;
-
-    coord walls[wallNum];
-
-    bullet bullets[maxBulletNum];
-    while (1) {
-        if (!gamePaused) {
-            if (startScreen) {
-                drawStartScreen();
-                wait_for_vsync();
-                pixel_buffer_start = *(pixel_ctrl_ptr + 1);  // new back buffer
-                drawStartScreen();
-            }
-
-            while (startScreen) {
-                if (*KeyEdgeReg & 0x1) {  // if bit 0 is set to 1
-                    if ((*SwReg & 0b1) == 1) {
-                        isFirstMap = false;
-                    } else if((*SwReg & 0b1) == 0){
-                        isFirstMap = true;
-                    }
-                    startScreen = false;   // breaks out of start screen
-                    gameRunning = true;    // set game running flag to true
-                    *KeyEdgeReg = 0b1111;  // reset all keys
-                }
-                // reset player 1 data
-                p1.stop = false;
-                p1.lifeLeft = 3;
-                p1.position.x = 222;
-                p1.position.y = 220;
-                p1.xDir = 0;
-                p1.yDir = 0;
-                p1.playerColor = BLUE;
-                p1.lastDirection.x = 0;
-                p1.lastDirection.y = 0;
-
-                // reset player 2 data
-                p2.stop = false;
-                p2.lifeLeft = 3;
-                p2.position.x = 2;
-                p2.position.y = 4;
-                p2.xDir = 0;
-                p2.yDir = 0;
-                p2.playerColor = RED;
-                p2.lastDirection.x = 0;
-                p2.lastDirection.y = 0;
-
-                // reset bullets
-                for (int bulletIte = 0; bulletIte < currentBulletCount; bulletIte++) {
-                    bullets[bulletIte].render = false;
-                }
-
-                // reset walls
-                for (int wallIte; wallIte < wallNum; wallIte++) {
-                    walls[wallIte].x = 0;
-                    walls[wallIte].y = 0;
-                }
-            }
-
-            clearMainScreen();
-            drawUpperSmallTank();
-            drawLowerSmallTank();
-
-            wait_for_vsync();
-            pixel_buffer_start = *(pixel_ctrl_ptr + 1);  // new back buffer
-
-            clearMainScreen();
-            drawUpperSmallTank();
-            drawLowerSmallTank();
-
-            int *hexBase = (int *)HEX3_HEX0_BASE;
-            int *hex4Base = (int *)HEX5_HEX4_BASE;
-            *hexBase = 0b0;
-            *hex4Base = 0b0;
-
-            while (gameRunning) {
-                if (*KeyEdgeReg & 0b10) {  // press key 1 to pause game
-                    gamePaused = true;
-                    *KeyEdgeReg = 0b10;  // reset key 1
-                    break;
-                }
-
-                clearPlayerTrace(p1, p2, bullets);
-                if (isFirstMap) {
-                    loadFirstGameMap(walls);
-                } else {
-                    loadSecondGameMap(walls);
-                }
-
-				
-				int data = *keyBoard;
-				
-				int rv = (data & 0xFFFF0000) >> 16;
-				
-				if(rv > 0){
-					b1 = b2;
-					b2 = b3;
-					b3 = data & 0xFF;
-					if((b2 == (char)0xF0) || (b1 == (char) 0xF0) || (b3 == (char) 0xF0)){
-						p1.yDir = 0;
-						p1.xDir = 0;
-					}else if((b2 == (char)0xE0) && (b3 == (char) 0x75) ){
-						p1.yDir = -1;
-					} else if((b2 == (char)0xE0) && (b3 == (char) 0x72)){
-						p1.yDir = 1;
-					} else if((b2 == (char)0xE0) && (b3 == (char) 0x6B)){
-						p1.xDir = -1;
-					} else if((b2 == (char)0xE0) && (b3 == (char) 0x74)){
-						p1.xDir = 1;
-					} 
-				}
-//				if(key == 0x1D){
-			//		p1.yDir = 1;
-			//	}
-				
-                int SwValue = *SwReg;
-                // handle player1 movement input
-                //p1.yDir = (SwValue & 0b1000) ? -1 : (SwValue & 0b100) ? 1
-                               //                                       : 0;
-                //p1.xDir = (SwValue & 0b10) ? -1 : (SwValue & 0b1) ? 1
-                //                                                  : 0;
-
-                //if ((SwValue & 0b1000) && (SwValue & 0b100)) {
-                //    p1.yDir = 0;
-                //}
-                //if ((SwValue & 0b10) && (SwValue & 0b1)) {
-                //    p1.xDir = 0;
-                //}
-
-                if (p1.xDir != 0 || p1.yDir != 0) {
-                    p1.lastDirection.x = p1.xDir;
-                    p1.lastDirection.y = p1.yDir;
-                }
-
-                // handle player 2 movement input
-                p2.yDir = (SwValue & 0b1000000000) ? -1 : (SwValue & 0b100000000) ? 1
-                                                                                  : 0;
-                p2.xDir = (SwValue & 0b10000000) ? -1 : (SwValue & 0b1000000) ? 1
-                                                                              : 0;
-
-                if ((SwValue & 0b1000000000) && (SwValue & 0b100000000)) {
-                    p2.yDir = 0;
-                }
-                if ((SwValue & 0b10000000) && (SwValue & 0b1000000)) {
-                    p2.xDir = 0;
-                }
-
-                if (p2.xDir != 0 || p2.yDir != 0) {
-                    p2.lastDirection.x = p2.xDir;
-                    p2.lastDirection.y = p2.yDir;
-                }
-
-                // handle player1's position
-                bool moveInX = false;
-                bool moveInY = false;
-                if ((p1.position.x != 0 && p1.position.x + tankWidth != 12 * tileWidth) ||
-                    (p1.position.x == 0 && p1.xDir == 1) ||
-                    (p1.position.x == 12 * tileWidth - tankWidth && p1.xDir == -1)) {
-                    moveInX = true;
-                }
-                if ((p1.position.y != 0 && p1.position.y + tankHeight != 12 * tileHeight) ||
-                    (p1.position.y == 0 && p1.yDir == 1) ||
-                    (p1.position.y == 12 * tileHeight - tankHeight && p1.yDir == -1)) {
-                    moveInY = true;
-                }
-
-                // handles wall collision for p1
-                for (int wallIte = 0; wallIte < wallNum; wallIte++) {
-                    coord corner1 = p1.position;
-                    coord corner2 = p1.position;
-                    coord corner3 = p1.position;
-                    coord corner4 = p1.position;
-
-                    corner2.x += tankWidth;
-                    corner3.y += tankHeight;
-                    corner4.x += tankWidth;
-                    corner4.y += tankHeight;
-                    if (withInBox(corner1, walls[wallIte], tileWidth, tileHeight) ||
-                        withInBox(corner2, walls[wallIte], tileWidth, tileHeight) ||
-                        withInBox(corner3, walls[wallIte], tileWidth, tileHeight) ||
-                        withInBox(corner4, walls[wallIte], tileWidth, tileHeight)) {
-                        if (corner1.y == walls[wallIte].y + tileHeight) {
-                            if (corner1.x < (walls[wallIte].x + tileWidth) && corner2.x > walls[wallIte].x) {
-                                if (p1.yDir == -1) {
-                                    moveInY = false;
-                                }
-                            }
-                        } else if (corner3.y == walls[wallIte].y) {
-                            if (corner1.x < (walls[wallIte].x + tileWidth) && corner2.x > walls[wallIte].x) {
-                                if (p1.yDir == 1) {
-                                    moveInY = false;
-                                }
-                            }
-                        } else if (corner1.x == walls[wallIte].x + tileWidth) {
-                            if (corner1.y < walls[wallIte].y + tileHeight && corner3.y > walls[wallIte].y) {
-                                if (p1.xDir == -1) {
-                                    moveInX = false;
-                                }
-                            }
-                        } else if (corner2.x == walls[wallIte].x) {
-                            if (corner1.y < walls[wallIte].y + tileHeight && corner3.y > walls[wallIte].y) {
-                                if (p1.xDir == 1) {
-                                    moveInX = false;
-                                }
-                            }
-                        }
-                    }
-                }
-
-                if (moveInX) {
-                    p1.position.x += p1.xDir;
-                }
-                if (moveInY) {
-                    p1.position.y += p1.yDir;
-                }
-
-                // handle player2's position
-                moveInX = false;
-                moveInY = false;
-                if ((p2.position.x != 0 && p2.position.x + tankWidth != 12 * tileWidth) ||
-                    (p2.position.x == 0 && p2.xDir == 1) ||
-                    (p2.position.x == 12 * tileWidth - tankWidth && p2.xDir == -1)) {
-                    moveInX = true;
-                }
-                if ((p2.position.y != 0 && p2.position.y + tankHeight != 12 * tileHeight) ||
-                    (p2.position.y == 0 && p2.yDir == 1) ||
-                    (p2.position.y == 12 * tileHeight - tankHeight && p2.yDir == -1)) {
-                    moveInY = true;
-                }
-
-                // handles wall collision for p2
-                for (int wallIte = 0; wallIte < wallNum; wallIte++) {
-                    coord corner1 = p2.position;
-                    coord corner2 = p2.position;
-                    coord corner3 = p2.position;
-                    coord corner4 = p2.position;
-
-                    corner2.x += tankWidth;
-                    corner3.y += tankHeight;
-                    corner4.x += tankWidth;
-                    corner4.y += tankHeight;
-                    if (withInBox(corner1, walls[wallIte], tileWidth, tileHeight) ||
-                        withInBox(corner2, walls[wallIte], tileWidth, tileHeight) ||
-                        withInBox(corner3, walls[wallIte], tileWidth, tileHeight) ||
-                        withInBox(corner4, walls[wallIte], tileWidth, tileHeight)) {
-                        if (corner1.y == walls[wallIte].y + tileHeight) {
-                            if (corner1.x < (walls[wallIte].x + tileWidth) && corner2.x > walls[wallIte].x) {
-                                if (p2.yDir == -1) {
-                                    moveInY = false;
-                                }
-                            }
-                        } else if (corner3.y == walls[wallIte].y) {
-                            if (corner1.x < (walls[wallIte].x + tileWidth) && corner2.x > walls[wallIte].x) {
-                                if (p2.yDir == 1) {
-                                    moveInY = false;
-                                }
-                            }
-                        } else if (corner1.x == walls[wallIte].x + tileWidth) {
-                            if (corner1.y < walls[wallIte].y + tileHeight && corner3.y > walls[wallIte].y) {
-                                if (p2.xDir == -1) {
-                                    moveInX = false;
-                                }
-                            }
-                        } else if (corner2.x == walls[wallIte].x) {
-                            if (corner1.y < walls[wallIte].y + tileHeight && corner3.y > walls[wallIte].y) {
-                                if (p2.xDir == 1) {
-                                    moveInX = false;
-                                }
-                            }
-                        }
-                    }
-                }
-
-                if (moveInX) {
-                    p2.position.x += p2.xDir;
-                }
-                if (moveInY) {
-                    p2.position.y += p2.yDir;
-                }
-
-                // handles bullets fire
-                // use do while(0) to break out of if statement
-                do {
-                    // key 0 is pressed, p1 shoots bullets
-                    if (*KeyEdgeReg & 0b1) {
-                        if (p1.lastDirection.x == 0 && p1.lastDirection.y == 0) {
-                            break;
-                        }
-                        if (currentBulletCount == maxBulletNum) {
-                            for (int ite = 0; ite < currentBulletCount; ite++) {
-                                if (!bullets[ite].render) {
-                                    bullets[ite].direction = p1.lastDirection;
-                                    bullets[ite].direction.x *= bulletSpeed;
-                                    bullets[ite].direction.y *= bulletSpeed;
-                                    bullets[ite].position = p1.position;
-                                    bullets[ite].render = true;
-                                    bullets[ite].belongToP1 = true;
-
-                                    bullets[ite].position.x += tankWidth / 2;
-                                    bullets[ite].position.y += tankHeight / 2;
-                                    break;
-                                }
-                            }
-                        } else {
-                            bullets[currentBulletCount].direction = p1.lastDirection;
-                            bullets[currentBulletCount].direction.x *= bulletSpeed;
-                            bullets[currentBulletCount].direction.y *= bulletSpeed;
-                            bullets[currentBulletCount].position = p1.position;
-                            bullets[currentBulletCount].render = true;
-                            bullets[currentBulletCount].belongToP1 = true;
-
-                            bullets[currentBulletCount].position.x += tankWidth / 2;
-                            bullets[currentBulletCount].position.y += tankHeight / 2;
-                            currentBulletCount++;
-                        }
-                        *KeyEdgeReg = 0b1;              // reset key 0
-                    } else if (*KeyEdgeReg & 0b1000) {  // key 3 is pressed
-                        if (p2.lastDirection.x == 0 && p2.lastDirection.y == 0) {
-                            break;
-                        }
-                        if (currentBulletCount == maxBulletNum) {
-                            for (int ite = 0; ite < currentBulletCount; ite++) {
-                                if (!bullets[ite].render) {
-                                    bullets[ite].direction = p2.lastDirection;
-                                    bullets[ite].direction.x *= bulletSpeed;
-                                    bullets[ite].direction.y *= bulletSpeed;
-                                    bullets[ite].position = p2.position;
-                                    bullets[ite].render = true;
-                                    bullets[ite].belongToP1 = false;
-
-                                    bullets[ite].position.x += tankWidth / 2;
-                                    bullets[ite].position.y += tankHeight / 2;
-                                    break;
-                                }
-                            }
-                        } else {
-                            bullets[currentBulletCount].direction = p2.lastDirection;
-                            bullets[currentBulletCount].direction.x *= bulletSpeed;
-                            bullets[currentBulletCount].direction.y *= bulletSpeed;
-                            bullets[currentBulletCount].position = p2.position;
-                            bullets[currentBulletCount].render = true;
-                            bullets[currentBulletCount].belongToP1 = false;
-
-                            bullets[currentBulletCount].position.x += tankWidth / 2;
-                            bullets[currentBulletCount].position.y += tankHeight / 2;
-                            currentBulletCount++;
-                        }
-                        *KeyEdgeReg = 0b1000;  // reset key 3
-                    }
-                } while (0);
-
-                // check if bullet has hit any thing or the player, disable render if so
-                for (int bulletIte = 0; bulletIte < currentBulletCount; bulletIte++) {
-                    if (!bullets[bulletIte].render) {
-                        continue;
-                    }
-                    if (hitBoundaryBullet(bullets[bulletIte].position)) {
-                        bullets[bulletIte].render = false;
-                        *ledr = 0b1;
-                        continue;
-                    } else if (hitPlayer(bullets[bulletIte], p1, p2)) {
-                        if (bullets[bulletIte].belongToP1) {
-                            p2.lifeLeft--;
-                        } else {
-                            p1.lifeLeft--;
-                        }
-                        bullets[bulletIte].render = false;
-                        *ledr = 0b10;
-                        continue;
-                    }
-
-                    // handles bullets wall collision
-                    bool hitWall = false;
-                    for (int wallIte = 0; wallIte < wallNum; wallIte++) {
-                        if (withInBox(bullets[bulletIte].position, walls[wallIte], tileWidth, tileHeight)) {
-                            hitWall = true;
-                            bullets[bulletIte].render = false;
-                            break;
-                        }
-                    }
-
-                    if (!hitWall) {
-                        bullets[bulletIte].position.x += bullets[bulletIte].direction.x;
-                        bullets[bulletIte].position.y += bullets[bulletIte].direction.y;
-                        *ledr = 0b0;
-                    }
-                }
-
-                drawPlayer(p1);
-                drawPlayer(p2);
-                drawBullets(bullets, currentBulletCount);
-
-                displayPlayerLife(p1);
-                displayPlayerLife(p2);
-
-                if (p1.lifeLeft == 0) {
-                    gameRunning = false;
-                    p1Victory = false;
-                } else if (p2.lifeLeft == 0) {
-                    gameRunning = false;
-                    p1Victory = true;
-                }
-
-                wait_for_vsync();
-                pixel_buffer_start = *(pixel_ctrl_ptr + 1);
-            }
-
-            if (!gamePaused) {
-                for (int bulletIte = 0; bulletIte < currentBulletCount; bulletIte++) {
-                    bullets[bulletIte].render = false;
-                }
-            }
-
-            while (!gameRunning && !gamePaused) {
-                drawVictoryScreen();
-
-                if (*KeyEdgeReg & 0b1) {  // press key 0 to restart
-                    startScreen = false;
-                    gameRunning = true;
-                    break;
-                } else if (*KeyEdgeReg & 0b10) {  // press key1 to go main
-                    startScreen = true;
-                    break;
-                }
-
-                wait_for_vsync();
-                pixel_buffer_start = *(pixel_ctrl_ptr + 1);
-            }
-
-            *KeyEdgeReg = 0b1111;
-
-            if (!gamePaused) {
-                p1.stop = false;
-                p1.lifeLeft = 3;
-                p1.position.x = 222;
-                p1.position.y = 220;
-                p1.xDir = 0;
-                p1.yDir = 0;
-                p1.playerColor = BLUE;
-                p1.lastDirection.x = 0;
-                p1.lastDirection.y = 0;
-
-                p2.stop = false;
-                p2.lifeLeft = 3;
-                p2.position.x = 2;
-                p2.position.y = 4;
-                p2.xDir = 0;
-                p2.yDir = 0;
-                p2.playerColor = RED;
-                p2.lastDirection.x = 0;
-                p2.lastDirection.y = 0;
-            }
-
-            if (!gamePaused) {
-                clearMainScreen();
-                wait_for_vsync();
-                pixel_buffer_start = *(pixel_ctrl_ptr + 1);  // new back buffer
-                clearMainScreen();
-            }
-        } else {
-            // clearMainScreen();
-            drawPauseScreen();
-
-            if (*KeyEdgeReg & 0b1) {  // press key 0 to restart
-                startScreen = false;
-                gameRunning = true;
-                gamePaused = false;
-            } else if (*KeyEdgeReg & 0b10) {
-                startScreen = true;
-                gameRunning = false;
-                gamePaused = false;
-            }
-
-            if (!gamePaused && startScreen && !gameRunning) {
-                *KeyEdgeReg = 0b1111;
-                clearMainScreen();
-                wait_for_vsync();
-                pixel_buffer_start = *(pixel_ctrl_ptr + 1);
-                clear_screen();
-            }
-
-            wait_for_vsync();
-            pixel_buffer_start = *(pixel_ctrl_ptr + 1);
-        }
-    }
-    return 0;
-}
-
-
+#define SDRAM_BASE 0xC0000000
+#define FPGA_ONCHIP_BASE 0xC8000000
+#define FPGA_CHAR_BASE 0xC9000000
+
+/* Cyclone V FPGA devices */
+#define LEDR_BASE 0xFF200000
+#define HEX3_HEX0_BASE 0xFF200020
+#define HEX5_HEX4_BASE 0xFF200030
+#define SW_BASE 0xFF200040
+#define KEY_BASE 0xFF200050
+#define TIMER_BASE 0xFF202000
+#define PIXEL_BUF_CTRL_BASE 0xFF203020
+#define CHAR_BUF_CTRL_BASE 0xFF203030
+
+/* VGA colors */
+#define WHITE 0xFFFF
+#define YELLOW 0xFFE0
+#define RED 0xF800
+#define GREEN 0x07E0
+#define BLUE 0x001F
+#define CYAN 0x07FF
+#define MAGENTA 0xF81F
+#define GREY 0xC618
+#define PINK 0xFC18
+#define ORANGE 0xFC00
+#define BLACK 0x0
+
+#define ABS(x) (((x) > 0) ? (x) : -(x))
+
+/* Screen size. */
+#define RESOLUTION_X 320
+#define RESOLUTION_Y 240
+
+/* Constants for animation */
+#define BOX_LEN 2
+#define NUM_BOXES 8
+
+#define FALSE 0
+#define TRUE 1
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdint.h>
+
+// the split loop hands input between two contexts, which only the interrupt driven input path is safe for
+#if defined(SPLIT_LOOP) && !defined(USE_INTERRUPTS)
+#define USE_INTERRUPTS
+#endif
+
+#ifdef HOST_BUILD
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#ifdef SPLIT_LOOP
+#include <pthread.h>
+#include <sched.h>
+#endif
+#endif
+
+#include "assets/assetpack.h"
+
+int led = 0;
+
+/* Platform layer
+ * Every hardware access in the game goes through the functions below. The
+ * default build drives the DE1-SoC memory mapped I/O. Compiling with
+ * -DHOST_BUILD swaps in a Linux backend: the pixel buffers live in ordinary
+ * memory, a swap completes at once, and keys, switches and PS/2 bytes come
+ * from a script file, so the game can run headless under perf/valgrind.
+ */
+#define PS2_BASE 0xFF200100
+#define PIXEL_BUF_STATUS_BASE 0xFF20302C
+#define MPCORE_GLOBAL_TIMER 0xFFFEC200
+
+// built by tools/assetpack.c, relative to the directory the game is built (board) or run (Linux) in
+#ifndef ASSET_PACK_PATH
+#define ASSET_PACK_PATH "assets/sprites.pack"
+#endif
+
+// pixel buffers the game draws into in turn, -DSWAP_CHAIN_LENGTH=3 for triple buffering
+#ifndef SWAP_CHAIN_LENGTH
+#define SWAP_CHAIN_LENGTH 2
+#endif
+#if SWAP_CHAIN_LENGTH < 2
+#error "SWAP_CHAIN_LENGTH must be at least 2"
+#endif
+
+volatile intptr_t pixel_buffer_start;
+
+// the character buffer lays characters of 8 x 8 VGA pixels over the picture, 4 x 4 pixels of a pixel buffer
+#define TEXT_COLUMNS 80
+#define TEXT_ROWS 60
+#define TEXT_CELL 4
+long pixelsTouched = 0;       // pixels written since the last buffer swap
+long framePixelsTouched = 0;  // pixelsTouched of the frame that was just swapped in
+
+/* Input queue
+ * PS/2 bytes wait here until the game decodes them, so a burst of scancodes
+ * arriving within one frame is kept whole. Normally pollPs2() moves whatever
+ * the PS/2 FIFO holds into the queue. Building with -DUSE_INTERRUPTS stops
+ * the game from polling the KEY and PS/2 registers: their interrupt handlers
+ * (the script player on Linux) post scancode bytes and key edges here, and
+ * readKeyEdges() and clearKeyEdges() serve the edges back with the meaning of
+ * the edge capture register, while the idle loops sleep in WFI.
+ */
+#define INPUT_QUEUE_SIZE 256  // as deep as the FIFO of the PS/2 core
+
+volatile unsigned char inputQueue[INPUT_QUEUE_SIZE];
+volatile int inputQueueHead = 0;  // next byte to read, only moved by the game
+volatile int inputQueueTail = 0;  // next free slot, only moved by the producer
+
+// a full queue drops the new byte, like the PS/2 core does when its FIFO overflows
+void postPs2Byte(unsigned char data) {
+    int next = (inputQueueTail + 1) % INPUT_QUEUE_SIZE;
+    if (next == inputQueueHead) {
+        return;
+    }
+    inputQueue[inputQueueTail] = data;
+    __atomic_store_n(&inputQueueTail, next, __ATOMIC_RELEASE);
+}
+
+// -1 once the queue is empty
+int popPs2Byte() {
+    if (inputQueueHead == __atomic_load_n(&inputQueueTail, __ATOMIC_ACQUIRE)) {
+        return -1;
+    }
+    int data = inputQueue[inputQueueHead];
+    inputQueueHead = (inputQueueHead + 1) % INPUT_QUEUE_SIZE;
+    return data;
+}
+
+#ifdef USE_INTERRUPTS
+volatile int pendingKeyEdges = 0;
+
+// the handler ORs in while the game clears, both are atomic so neither loses bits
+void postKeyEdges(int keys) {
+    __atomic_fetch_or(&pendingKeyEdges, keys, __ATOMIC_SEQ_CST);
+}
+
+int readKeyEdges() {
+    return pendingKeyEdges;
+}
+
+void clearKeyEdges(int keys) {
+    __atomic_fetch_and(&pendingKeyEdges, ~keys, __ATOMIC_SEQ_CST);
+}
+#endif
+
+/* Input recording
+ * The simulation reads all of its input once per tick into a tickInput, and
+ * a match can be recorded as the stream of those tick inputs and replayed
+ * through the same simulationStep() later, giving the same match tick for
+ * tick. A stream starts with a replayHeader followed by records. A record is
+ * one byte holding the REPLAY_* flags of the fields that changed since the
+ * previous tick in its low bits and, in its high bits, how many more ticks
+ * repeat the same input; the changed fields follow in the order of the
+ * flags, switches as two little endian bytes. A tick where nothing changes
+ * costs nothing unless the previous record's count is full, so an idle match
+ * takes one byte every 32 ticks.
+ */
+#define REPLAY_MAGIC 0x50524254  // "TBRP"
+#define REPLAY_VERSION 1
+#define REPLAY_BUFFER_SIZE 65536  // over 13000 ticks even if the input changes on every one
+#define REPLAY_ARROWS 0x1
+#define REPLAY_KEYS 0x2
+#define REPLAY_SWITCHES 0x4
+#define REPLAY_HOLD_SHIFT 3
+#define REPLAY_MAX_HOLD 31
+
+// player 1's arrow keys as they are held in a tickInput
+#define ARROW_UP 0x1
+#define ARROW_DOWN 0x2
+#define ARROW_LEFT 0x4
+#define ARROW_RIGHT 0x8
+
+typedef struct tickInput {
+    uint8_t arrows;     // ARROW_* bits held on the PS/2 keyboard
+    uint8_t keyEdges;   // KEY0 to KEY3 edge capture bits
+    uint16_t switches;  // SW0 to SW9
+} tickInput;
+
+typedef struct replayHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t maxBullets;  // bullet pool size of the recording build, a full pool refuses to fire
+    uint32_t ticks;
+    uint8_t map;
+    uint8_t bots;         // computer driven tanks of the recording build, they react to the recorded players
+    uint8_t reserved[2];
+} replayHeader;
+
+uint8_t inputRecording[REPLAY_BUFFER_SIZE] __attribute__((aligned(4)));
+int recordingSize = 0;   // bytes of inputRecording in use, 0 while nothing is recorded
+int lastRecord = -1;     // offset of the record the next unchanged tick extends
+tickInput recordedInput;  // input of the last recorded tick
+
+const uint8_t *replayData = NULL;
+int replaySize = 0;
+int replayOffset = 0;
+int replayHold = 0;  // ticks left on the current record
+uint32_t replayTicksLeft = 0;
+tickInput replayInput;
+replayHeader replayInfo;  // header of the loaded replay
+
+// drops any earlier recording
+void startRecording(int map, int maxBullets, int bots) {
+    replayHeader *header = (replayHeader *)inputRecording;
+    memset(header, 0, sizeof(replayHeader));
+    header->magic = REPLAY_MAGIC;
+    header->version = REPLAY_VERSION;
+    header->maxBullets = maxBullets;
+    header->map = map;
+    header->bots = bots;
+    recordingSize = sizeof(replayHeader);
+    lastRecord = -1;
+}
+
+// a full buffer keeps the ticks recorded so far
+void recordTick(const tickInput *input) {
+    if (recordingSize == 0) {
+        return;
+    }
+    int fields = (input->arrows != recordedInput.arrows ? REPLAY_ARROWS : 0) |
+                 (input->keyEdges != recordedInput.keyEdges ? REPLAY_KEYS : 0) |
+                 (input->switches != recordedInput.switches ? REPLAY_SWITCHES : 0);
+    replayHeader *header = (replayHeader *)inputRecording;
+    if (fields == 0 && lastRecord >= 0 && (inputRecording[lastRecord] >> REPLAY_HOLD_SHIFT) < REPLAY_MAX_HOLD) {
+        inputRecording[lastRecord] += 1 << REPLAY_HOLD_SHIFT;
+        header->ticks++;
+        return;
+    }
+    if (lastRecord < 0) {
+        fields = REPLAY_ARROWS | REPLAY_KEYS | REPLAY_SWITCHES;
+    }
+    if (recordingSize + 5 > REPLAY_BUFFER_SIZE) {  // the longest record
+        return;
+    }
+
+    lastRecord = recordingSize;
+    inputRecording[recordingSize++] = fields;
+    if (fields & REPLAY_ARROWS) {
+        inputRecording[recordingSize++] = input->arrows;
+    }
+    if (fields & REPLAY_KEYS) {
+        inputRecording[recordingSize++] = input->keyEdges;
+    }
+    if (fields & REPLAY_SWITCHES) {
+        inputRecording[recordingSize++] = input->switches & 0xFF;
+        inputRecording[recordingSize++] = input->switches >> 8;
+    }
+    recordedInput = *input;
+    header->ticks++;
+}
+
+// checks the header and rewinds to the first tick, false if data is not a replay
+bool startReplay(const uint8_t *data, int size) {
+    if (data == NULL || size < (int)sizeof(replayHeader)) {
+        return false;
+    }
+    memcpy(&replayInfo, data, sizeof(replayHeader));
+    if (replayInfo.magic != REPLAY_MAGIC || replayInfo.version != REPLAY_VERSION) {
+        return false;
+    }
+    replayData = data;
+    replaySize = size;
+    replayOffset = sizeof(replayHeader);
+    replayHold = 0;
+    replayTicksLeft = replayInfo.ticks;
+    memset(&replayInput, 0, sizeof(replayInput));
+    return true;
+}
+
+// the input of the next recorded tick, false once the replay has run out or is cut short
+bool replayTick(tickInput *input) {
+    if (replayTicksLeft == 0) {
+        return false;
+    }
+    if (replayHold == 0) {
+        if (replayOffset >= replaySize) {
+            replayTicksLeft = 0;
+            return false;
+        }
+        int fields = replayData[replayOffset++];
+        int length = ((fields & REPLAY_ARROWS) ? 1 : 0) + ((fields & REPLAY_KEYS) ? 1 : 0) +
+                     ((fields & REPLAY_SWITCHES) ? 2 : 0);
+        if (replayOffset + length > replaySize) {
+            replayTicksLeft = 0;
+            return false;
+        }
+        if (fields & REPLAY_ARROWS) {
+            replayInput.arrows = replayData[replayOffset++];
+        }
+        if (fields & REPLAY_KEYS) {
+            replayInput.keyEdges = replayData[replayOffset++];
+        }
+        if (fields & REPLAY_SWITCHES) {
+            replayInput.switches = replayData[replayOffset] | (replayData[replayOffset + 1] << 8);
+            replayOffset += 2;
+        }
+        replayHold = (fields >> REPLAY_HOLD_SHIFT) + 1;
+    }
+    replayHold--;
+    replayTicksLeft--;
+    *input = replayInput;
+    return true;
+}
+
+#ifndef HOST_BUILD
+
+volatile int *ledr = (int *)LEDR_BASE;
+volatile int *KeyEdgeReg = (int *)(KEY_BASE + 0xC);
+volatile int *SwReg = (int *)SW_BASE;
+volatile int *ps2Reg = (int *)PS2_BASE;
+volatile int *pixel_ctrl_ptr = (int *)PIXEL_BUF_CTRL_BASE;
+volatile int *globalTimer = (int *)MPCORE_GLOBAL_TIMER;
+volatile char *charBuffer = (char *)FPGA_CHAR_BASE;
+
+// the A9 global timer runs off the 200 MHz peripheral clock, and unlike the private timers both cores see one count
+#define PLATFORM_TICKS_PER_SECOND 200000000
+
+#ifdef USE_INTERRUPTS
+#define INTERVAL_TIMER_BASE 0xFF202000
+#define INTERVAL_TIMER_CLOCK 100000000
+#define INTERVAL_TIMER_HZ 1000  // wakes the vsync wait often enough to catch the swap within a millisecond
+#define GIC_CPU_BASE 0xFFFEC100
+#define GIC_DIST_BASE 0xFFFED000
+#define IRQ_INTERVAL_TIMER 72
+#define IRQ_KEYS 73
+#define IRQ_PS2 79
+
+volatile int *intervalTimer = (int *)INTERVAL_TIMER_BASE;
+volatile uint32_t timerInterrupts = 0;
+
+// routes one interrupt to CPU 0 and enables it in the distributor
+void configGicInterrupt(int id) {
+    *(volatile char *)(GIC_DIST_BASE + 0x800 + id) = 1;
+    *(volatile int *)(GIC_DIST_BASE + 0x100 + (id >> 5) * 4) = 1 << (id & 31);
+}
+
+void configGic() {
+    configGicInterrupt(IRQ_INTERVAL_TIMER);
+    configGicInterrupt(IRQ_KEYS);
+    configGicInterrupt(IRQ_PS2);
+    *(volatile int *)(GIC_CPU_BASE + 0x04) = 0xFFFF;  // let interrupts of every priority through
+    *(volatile int *)(GIC_CPU_BASE) = 1;              // enable the CPU interface
+    *(volatile int *)(GIC_DIST_BASE) = 1;             // enable the distributor
+}
+
+// IRQ mode has its own stack pointer, put it at the top of the A9 on-chip memory
+void setIrqStack() {
+    uint32_t stack = 0xFFFFFFFF - 7;
+    __asm__ volatile("msr cpsr_c, %0" : : "r"(0b11010010));  // IRQ mode, interrupts masked
+    __asm__ volatile("mov sp, %0" : : "r"(stack));
+    __asm__ volatile("msr cpsr_c, %0" : : "r"(0b11010011));  // back to SVC mode
+}
+
+void timerInterrupt() {
+    *intervalTimer = 0;  // clear TO
+    timerInterrupts++;
+}
+
+void keyInterrupt() {
+    int keys = *KeyEdgeReg;
+    *KeyEdgeReg = keys;
+    postKeyEdges(keys);
+}
+
+// drains the whole FIFO, reading the data register pops a byte and clears the interrupt once it is empty
+void ps2Interrupt() {
+    int data = *ps2Reg;
+    while (data & 0x8000) {
+        postPs2Byte(data & 0xFF);
+        data = *ps2Reg;
+    }
+}
+
+void __attribute__((interrupt)) __cs3_isr_irq() {
+    int id = *(volatile int *)(GIC_CPU_BASE + 0x0C);  // acknowledge
+    if (id == IRQ_INTERVAL_TIMER) {
+        timerInterrupt();
+    } else if (id == IRQ_KEYS) {
+        keyInterrupt();
+    } else if (id == IRQ_PS2) {
+        ps2Interrupt();
+    }
+    *(volatile int *)(GIC_CPU_BASE + 0x10) = id;  // end of interrupt
+}
+
+void enableInterrupts() {
+    uint32_t period = INTERVAL_TIMER_CLOCK / INTERVAL_TIMER_HZ - 1;
+    *(intervalTimer + 2) = period & 0xFFFF;
+    *(intervalTimer + 3) = period >> 16;
+    *(intervalTimer + 1) = 0b0111;  // START, CONT, ITO
+
+    *(volatile int *)(KEY_BASE + 0x8) = 0xF;  // interrupt on all four keys
+    *KeyEdgeReg = 0xF;
+    *(ps2Reg + 1) = 1;                        // RE, interrupt when data arrives
+
+    setIrqStack();
+    configGic();
+    __asm__ volatile("msr cpsr_c, %0" : : "r"(0b01010011));  // SVC mode, IRQ unmasked
+}
+#endif
+
+#ifdef SPLIT_LOOP
+/* Second core
+ * The split loop runs its simulation task on CPU 1, which the preloader
+ * leaves held in reset. Out of reset a core starts at address 0, where the
+ * program's vector table sits, so, like Linux does on this SoC, the first
+ * four vectors (reset, undefined, SVC and prefetch abort, none of which the
+ * game takes after start up) are replaced by a trampoline that jumps to the
+ * address in the system manager's cpu1startaddr register. core1Start sets up
+ * a stack, turns on VFP and NEON, which come out of reset disabled, and
+ * calls core1Main(), which keeps running whatever task is set until the
+ * program ends. CPU 1 takes no interrupts, the GIC routes them all to CPU 0.
+ * Both cores run with the caches off as the Monitor Program starts programs,
+ * so what one core stores the other sees without cache maintenance. This
+ * path is untested on the board: the snapshot exchange is an exclusive load
+ * and store, and whether the exclusive monitor covers the Strongly-ordered
+ * memory the cores see with the MMU off is implementation defined.
+ */
+#define RSTMGR_MPUMODRST 0xFFD05010
+#define SYSMGR_CPU1STARTADDR 0xFFD080C4
+#define MPUMODRST_CPU1 0b10
+#define CORE1_STACK_WORDS 4096  // 32 KB
+
+uint64_t core1Stack[CORE1_STACK_WORDS];
+uint64_t *const core1StackTop = &core1Stack[CORE1_STACK_WORDS];
+
+void (*volatile core1Task)() = NULL;
+volatile uint32_t core1Rounds = 0;  // passes of core1Main() that have started, to know when a task is done
+bool core1Started = false;
+
+// ldr r0, [pc, #4]; ldr r0, [r0]; bx r0; followed by the address it loads from
+const uint32_t core1Trampoline[4] = {0xE59F0004, 0xE5900000, 0xE12FFF10, SYSMGR_CPU1STARTADDR};
+
+__asm__(".text\n"
+        ".balign 4\n"
+        ".global core1Start\n"
+        "core1Start:\n"
+        "msr cpsr_c, #0xD3\n"          // SVC mode, IRQ and FIQ masked
+        "ldr r0, =core1StackTop\n"
+        "ldr sp, [r0]\n"
+        "mrc p15, 0, r0, c1, c0, 2\n"
+        "orr r0, r0, #0xF00000\n"      // CPACR: full access to cp10 and cp11
+        "mcr p15, 0, r0, c1, c0, 2\n"
+        "isb\n"
+        "mov r0, #0x40000000\n"
+        "vmsr fpexc, r0\n"             // FPEXC.EN
+        "b core1Main\n"
+        ".ltorg\n"
+        ".previous\n");
+extern const uint8_t core1Start[];
+
+// 0 on the core that runs the game, 1 on the simulation core
+int coreId() {
+    uint32_t mpidr;
+    __asm__ volatile("mrc p15, 0, %0, c0, c0, 5" : "=r"(mpidr));
+    return mpidr & 0b11;
+}
+
+void core1Main() {
+    while (true) {
+        __atomic_add_fetch(&core1Rounds, 1, __ATOMIC_SEQ_CST);
+        void (*task)() = __atomic_load_n(&core1Task, __ATOMIC_SEQ_CST);
+        if (task != NULL) {
+            task();
+        }
+    }
+}
+
+// the store goes through asm since the vector table sits at the null pointer
+void writeVector(int index, uint32_t word) {
+    __asm__ volatile("str %0, [%1]" : : "r"(word), "r"(index * 4) : "memory");
+}
+
+void startCore1() {
+    volatile uint32_t *reset = (uint32_t *)RSTMGR_MPUMODRST;
+    *reset |= MPUMODRST_CPU1;
+    for (int vector = 0; vector < 4; vector++) {
+        writeVector(vector, core1Trampoline[vector]);
+    }
+    *(volatile uint32_t *)SYSMGR_CPU1STARTADDR = (uint32_t)(uintptr_t)core1Start;
+    __asm__ volatile("dsb" : : : "memory");
+    *reset &= ~MPUMODRST_CPU1;
+    core1Started = true;
+}
+
+// CPU 1 calls the task over and over until it is stopped, starting the core the first time
+void startSimulationTask(void (*task)()) {
+    __atomic_store_n(&core1Task, task, __ATOMIC_SEQ_CST);
+    if (!core1Started) {
+        startCore1();
+    }
+}
+
+// returns once the task has finished its last call, which is certain once two more passes have started: the first
+// of them cannot have seen the task any more
+void stopSimulationTask() {
+    __atomic_store_n(&core1Task, NULL, __ATOMIC_SEQ_CST);
+    uint32_t rounds = __atomic_load_n(&core1Rounds, __ATOMIC_SEQ_CST);
+    while (__atomic_load_n(&core1Rounds, __ATOMIC_SEQ_CST) - rounds < 2) {
+    }
+}
+#endif
+
+void platformInit() {
+    *(globalTimer + 2) = 1;  // enabled, no prescaler
+#ifdef PROFILE_PMU
+    __asm__ volatile("mcr p15, 0, %0, c9, c12, 0" : : "r"(0b101));       // PMCR: counters enabled, cycle counter reset
+    __asm__ volatile("mcr p15, 0, %0, c9, c12, 1" : : "r"(0x80000000));  // PMCNTENSET: cycle counter on
+#endif
+#ifdef USE_INTERRUPTS
+    enableInterrupts();
+#endif
+}
+
+// the low half of the 64 bit count, wraps roughly every 21 seconds
+uint32_t platformTicks() {
+    return *globalTimer;
+}
+
+// clock for timing the parts of a frame, -DPROFILE_PMU counts CPU cycles instead of global timer ticks
+#ifdef PROFILE_PMU
+#ifndef CPU_CLOCK_HZ
+#define CPU_CLOCK_HZ 800000000
+#endif
+#define PROFILE_TICKS_PER_SECOND CPU_CLOCK_HZ
+
+// wraps about every 5 seconds
+uint32_t profileTicks() {
+    uint32_t cycles;
+    __asm__ volatile("mrc p15, 0, %0, c9, c13, 0" : "=r"(cycles));  // PMCCNTR
+    return cycles;
+}
+#else
+#define PROFILE_TICKS_PER_SECOND PLATFORM_TICKS_PER_SECOND
+
+uint32_t profileTicks() {
+    return platformTicks();
+}
+#endif
+
+#ifndef USE_INTERRUPTS
+int readKeyEdges() {
+    return *KeyEdgeReg;
+}
+
+// writing a 1 to a bit of the edge capture register clears it
+void clearKeyEdges(int keys) {
+    *KeyEdgeReg = keys;
+}
+#endif
+
+int readSwitches() {
+    return *SwReg;
+}
+
+int readLeds() {
+    return *ledr;
+}
+
+void writeLeds(int value) {
+    *ledr = value;
+}
+
+void writeHexDisplays(int hex3to0, int hex5to4) {
+    *(volatile int *)HEX3_HEX0_BASE = hex3to0;
+    *(volatile int *)HEX5_HEX4_BASE = hex5to4;
+}
+
+#ifndef USE_INTERRUPTS
+// bit 15 is RVALID, bits 31-16 hold RAVAIL, the low byte is the scancode
+int readPs2() {
+    return *ps2Reg;
+}
+#endif
+
+// the pack is assembled into the program image as one aligned read-only blob
+__asm__(".section .rodata\n"
+        ".balign 16\n"
+        ".global assetPackStart\n"
+        "assetPackStart:\n"
+        ".incbin \"" ASSET_PACK_PATH "\"\n"
+        ".global assetPackEnd\n"
+        "assetPackEnd:\n"
+        ".previous\n");
+extern const uint8_t assetPackStart[];
+extern const uint8_t assetPackEnd[];
+
+const uint8_t *platformAssetPack(size_t *size) {
+    *size = assetPackEnd - assetPackStart;
+    return assetPackStart;
+}
+
+// -DREPLAY_PATH assembles a recording into the program the same way, read inputRecording with the debugger to save one
+#ifdef REPLAY_PATH
+__asm__(".section .rodata\n"
+        ".balign 4\n"
+        ".global replayStart\n"
+        "replayStart:\n"
+        ".incbin \"" REPLAY_PATH "\"\n"
+        ".global replayEnd\n"
+        "replayEnd:\n"
+        ".previous\n");
+extern const uint8_t replayStart[];
+extern const uint8_t replayEnd[];
+
+const uint8_t *platformReplay(size_t *size) {
+    *size = replayEnd - replayStart;
+    return replayStart;
+}
+#else
+const uint8_t *platformReplay(size_t *size) {
+    *size = 0;
+    return NULL;
+}
+#endif
+
+#define PIXEL_BUFFER_SPAN 0x40000  // 256 rows of 1024 bytes
+
+// buffer 0 is the on-chip memory, the rest follow each other in SDRAM
+intptr_t pixelBufferAddress(int index) {
+    return index == 0 ? FPGA_ONCHIP_BASE : SDRAM_BASE + (index - 1) * PIXEL_BUFFER_SPAN;
+}
+
+// the buffer on screen, it changes when a requested swap is carried out
+intptr_t frontBuffer() {
+    return *pixel_ctrl_ptr;
+}
+
+// the S bit stays set from a swap request until the vertical sync that carries it out
+bool swapPending() {
+    volatile int *status_reg = (int *)PIXEL_BUF_STATUS_BASE;
+    return *status_reg & 0x01;
+}
+
+// writing 1 to the buffer register swaps in the back buffer register at the next vertical sync
+void requestSwap(intptr_t address) {
+    *(pixel_ctrl_ptr + 1) = address;
+    *pixel_ctrl_ptr = 1;
+}
+
+void waitForSwap() {
+#ifdef USE_INTERRUPTS
+    __asm__ volatile("wfi");
+#endif
+}
+
+// white on the picture, a space lets the pixels under it through
+void writeCharacter(int column, int row, char character) {
+    *(charBuffer + (row << 7) + column) = character;
+}
+
+// called by loops that only poll for input, with interrupts on it sleeps until the next one
+void waitForInput() {
+#ifdef USE_INTERRUPTS
+    __asm__ volatile("wfi");
+#endif
+}
+
+uint32_t gameClock() {
+    return platformTicks();
+}
+
+#else
+
+/* Host script format, one event per line, '#' starts a comment:
+ *     <frame> key <n>        sets bit n of the key edge capture register
+ *     <frame> sw <mask>      sets the switches (decimal, 0x.. or 0b..)
+ *     <frame> ps2 <xx> ...   queues raw scancode bytes in hex
+ *     <frame> quit           stops the run
+ * Frames count calls to wait_for_vsync() and waitForInput(). Set TANK_SCRIPT to
+ * the script path, TANK_FRAMES to cap the run (default 600) and TANK_DUMP to
+ * write the front buffer as a PPM image on exit. TANK_STATS prints the number
+ * of pixels written in every frame to stderr. TANK_ASSETS overrides the path
+ * of the asset pack. With -DUSE_INTERRUPTS the key and ps2 events are posted
+ * the way the board's interrupt handlers do. TANK_RECORD saves the input of
+ * the last match to a file on exit and TANK_REPLAY plays such a file back as
+ * the first match, starting it without waiting for KEY0. TANK_VSYNC=<hz>
+ * makes a swap wait for the next refresh of a display running at that rate in
+ * real time, the way the board's does.
+ */
+#define HOST_BUFFER_PITCH 512
+#define HOST_BUFFER_ROWS 256
+#define HOST_MAX_EVENTS 4096
+#define HOST_PS2_FIFO_SIZE 256
+
+enum { HOST_KEY, HOST_SWITCHES, HOST_PS2, HOST_QUIT };
+
+typedef struct hostEvent {
+    long frame;
+    int type;
+    int value;
+} hostEvent;
+
+// one spare row above and below each buffer absorbs the odd off-screen plot
+uint16_t hostPixelBuffers[SWAP_CHAIN_LENGTH][HOST_BUFFER_PITCH * (HOST_BUFFER_ROWS + 2)];
+intptr_t hostFront;
+intptr_t hostQueued = 0;        // the buffer a swap request waits to show
+uint32_t hostSwapDue;           // platformTicks() of the refresh that shows it
+uint32_t hostRefreshTicks = 0;  // 0 unless TANK_VSYNC is set, then swaps are carried out at once
+char hostCharacters[TEXT_ROWS << 7];  // rows of 128 like the board's character buffer, only 80 are shown
+
+int hostKeyEdges = 0;
+int hostSwitches = 0;
+int hostLeds = 0;
+int hostHex[2];
+
+unsigned char hostPs2Fifo[HOST_PS2_FIFO_SIZE];
+int hostPs2Head = 0;
+int hostPs2Count = 0;
+
+hostEvent hostEvents[HOST_MAX_EVENTS];
+int hostEventCount = 0;
+int hostNextEvent = 0;
+long hostFrame = 0;
+long hostClockFrame = 0;  // hostFrame once its events are in, what a simulation thread may go by
+long hostFrameLimit = 600;
+const char *hostDumpPath = NULL;
+const char *hostRecordPath = NULL;
+bool hostStats = false;
+uint8_t *hostReplay = NULL;
+size_t hostReplaySize = 0;
+
+#define PLATFORM_TICKS_PER_SECOND 1000000
+#define HOST_FRAME_RATE 60
+
+uint32_t platformTicks() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)(now.tv_sec * 1000000 + now.tv_nsec / 1000);
+}
+
+#define PROFILE_TICKS_PER_SECOND 1000000000
+
+// nanoseconds, most parts of a frame take well under a microsecond here
+uint32_t profileTicks() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)(now.tv_sec * 1000000000 + now.tv_nsec);
+}
+
+/* Host text overlay
+ * The board's video out draws the character buffer itself. Here the front
+ * buffer is composited with this font when a frame is saved: '!' to '~',
+ * 8 rows per character, bit 0 the leftmost pixel.
+ */
+const uint8_t hostFont['~' - '!' + 1][8] = {
+    {0x18, 0x3C, 0x3C, 0x18, 0x18, 0x00, 0x18, 0x00},  // !
+    {0x36, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},  // "
+    {0x36, 0x36, 0x7F, 0x36, 0x7F, 0x36, 0x36, 0x00},  // #
+    {0x0C, 0x3E, 0x03, 0x1E, 0x30, 0x1F, 0x0C, 0x00},  // $
+    {0x00, 0x63, 0x33, 0x18, 0x0C, 0x66, 0x63, 0x00},  // %
+    {0x1C, 0x36, 0x1C, 0x6E, 0x3B, 0x33, 0x6E, 0x00},  // &
+    {0x06, 0x06, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00},  // '
+    {0x18, 0x0C, 0x06, 0x06, 0x06, 0x0C, 0x18, 0x00},  // (
+    {0x06, 0x0C, 0x18, 0x18, 0x18, 0x0C, 0x06, 0x00},  // )
+    {0x00, 0x66, 0x3C, 0xFF, 0x3C, 0x66, 0x00, 0x00},  // *
+    {0x00, 0x0C, 0x0C, 0x3F, 0x0C, 0x0C, 0x00, 0x00},  // +
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x06},  // ,
+    {0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00},  // -
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x00},  // .
+    {0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x00},  // /
+    {0x3E, 0x63, 0x73, 0x7B, 0x6F, 0x67, 0x3E, 0x00},  // 0
+    {0x0C, 0x0E, 0x0C, 0x0C, 0x0C, 0x0C, 0x3F, 0x00},  // 1
+    {0x1E, 0x33, 0x30, 0x1C, 0x06, 0x33, 0x3F, 0x00},  // 2
+    {0x1E, 0x33, 0x30, 0x1C, 0x30, 0x33, 0x1E, 0x00},  // 3
+    {0x38, 0x3C, 0x36, 0x33, 0x7F, 0x30, 0x78, 0x00},  // 4
+    {0x3F, 0x03, 0x1F, 0x30, 0x30, 0x33, 0x1E, 0x00},  // 5
+    {0x1C, 0x06, 0x03, 0x1F, 0x33, 0x33, 0x1E, 0x00},  // 6
+    {0x3F, 0x33, 0x30, 0x18, 0x0C, 0x0C, 0x0C, 0x00},  // 7
+    {0x1E, 0x33, 0x33, 0x1E, 0x33, 0x33, 0x1E, 0x00},  // 8
+    {0x1E, 0x33, 0x33, 0x3E, 0x30, 0x18, 0x0E, 0x00},  // 9
+    {0x00, 0x0C, 0x0C, 0x00, 0x00, 0x0C, 0x0C, 0x00},  // :
+    {0x00, 0x0C, 0x0C, 0x00, 0x00, 0x0C, 0x0C, 0x06},  // ;
+    {0x18, 0x0C, 0x06, 0x03, 0x06, 0x0C, 0x18, 0x00},  // <
+    {0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00},  // =
+    {0x06, 0x0C, 0x18, 0x30, 0x18, 0x0C, 0x06, 0x00},  // >
+    {0x1E, 0x33, 0x30, 0x18, 0x0C, 0x00, 0x0C, 0x00},  // ?
+    {0x3E, 0x63, 0x7B, 0x7B, 0x7B, 0x03, 0x1E, 0x00},  // @
+    {0x0C, 0x1E, 0x33, 0x33, 0x3F, 0x33, 0x33, 0x00},  // A
+    {0x3F, 0x66, 0x66, 0x3E, 0x66, 0x66, 0x3F, 0x00},  // B
+    {0x3C, 0x66, 0x03, 0x03, 0x03, 0x66, 0x3C, 0x00},  // C
+    {0x1F, 0x36, 0x66, 0x66, 0x66, 0x36, 0x1F, 0x00},  // D
+    {0x7F, 0x46, 0x16, 0x1E, 0x16, 0x46, 0x7F, 0x00},  // E
+    {0x7F, 0x46, 0x16, 0x1E, 0x16, 0x06, 0x0F, 0x00},  // F
+    {0x3C, 0x66, 0x03, 0x03, 0x73, 0x66, 0x7C, 0x00},  // G
+    {0x33, 0x33, 0x33, 0x3F, 0x33, 0x33, 0x33, 0x00},  // H
+    {0x1E, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x1E, 0x00},  // I
+    {0x78, 0x30, 0x30, 0x30, 0x33, 0x33, 0x1E, 0x00},  // J
+    {0x67, 0x66, 0x36, 0x1E, 0x36, 0x66, 0x67, 0x00},  // K
+    {0x0F, 0x06, 0x06, 0x06, 0x46, 0x66, 0x7F, 0x00},  // L
+    {0x63, 0x77, 0x7F, 0x7F, 0x6B, 0x63, 0x63, 0x00},  // M
+    {0x63, 0x67, 0x6F, 0x7B, 0x73, 0x63, 0x63, 0x00},  // N
+    {0x1C, 0x36, 0x63, 0x63, 0x63, 0x36, 0x1C, 0x00},  // O
+    {0x3F, 0x66, 0x66, 0x3E, 0x06, 0x06, 0x0F, 0x00},  // P
+    {0x1E, 0x33, 0x33, 0x33, 0x3B, 0x1E, 0x38, 0x00},  // Q
+    {0x3F, 0x66, 0x66, 0x3E, 0x36, 0x66, 0x67, 0x00},  // R
+    {0x1E, 0x33, 0x07, 0x0E, 0x38, 0x33, 0x1E, 0x00},  // S
+    {0x3F, 0x2D, 0x0C, 0x0C, 0x0C, 0x0C, 0x1E, 0x00},  // T
+    {0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3F, 0x00},  // U
+    {0x33, 0x33, 0x33, 0x33, 0x33, 0x1E, 0x0C, 0x00},  // V
+    {0x63, 0x63, 0x63, 0x6B, 0x7F, 0x77, 0x63, 0x00},  // W
+    {0x63, 0x63, 0x36, 0x1C, 0x1C, 0x36, 0x63, 0x00},  // X
+    {0x33, 0x33, 0x33, 0x1E, 0x0C, 0x0C, 0x1E, 0x00},  // Y
+    {0x7F, 0x63, 0x31, 0x18, 0x4C, 0x66, 0x7F, 0x00},  // Z
+    {0x1E, 0x06, 0x06, 0x06, 0x06, 0x06, 0x1E, 0x00},  // [
+    {0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0x40, 0x00},  // backslash
+    {0x1E, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1E, 0x00},  // ]
+    {0x08, 0x1C, 0x36, 0x63, 0x00, 0x00, 0x00, 0x00},  // ^
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF},  // _
+    {0x0C, 0x0C, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00},  // `
+    {0x00, 0x00, 0x1E, 0x30, 0x3E, 0x33, 0x6E, 0x00},  // a
+    {0x07, 0x06, 0x06, 0x3E, 0x66, 0x66, 0x3B, 0x00},  // b
+    {0x00, 0x00, 0x1E, 0x33, 0x03, 0x33, 0x1E, 0x00},  // c
+    {0x38, 0x30, 0x30, 0x3E, 0x33, 0x33, 0x6E, 0x00},  // d
+    {0x00, 0x00, 0x1E, 0x33, 0x3F, 0x03, 0x1E, 0x00},  // e
+    {0x1C, 0x36, 0x06, 0x0F, 0x06, 0x06, 0x0F, 0x00},  // f
+    {0x00, 0x00, 0x6E, 0x33, 0x33, 0x3E, 0x30, 0x1F},  // g
+    {0x07, 0x06, 0x36, 0x6E, 0x66, 0x66, 0x67, 0x00},  // h
+    {0x0C, 0x00, 0x0E, 0x0C, 0x0C, 0x0C, 0x1E, 0x00},  // i
+    {0x30, 0x00, 0x30, 0x30, 0x30, 0x33, 0x33, 0x1E},  // j
+    {0x07, 0x06, 0x66, 0x36, 0x1E, 0x36, 0x67, 0x00},  // k
+    {0x0E, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x1E, 0x00},  // l
+    {0x00, 0x00, 0x33, 0x7F, 0x7F, 0x6B, 0x63, 0x00},  // m
+    {0x00, 0x00, 0x1F, 0x33, 0x33, 0x33, 0x33, 0x00},  // n
+    {0x00, 0x00, 0x1E, 0x33, 0x33, 0x33, 0x1E, 0x00},  // o
+    {0x00, 0x00, 0x3B, 0x66, 0x66, 0x3E, 0x06, 0x0F},  // p
+    {0x00, 0x00, 0x6E, 0x33, 0x33, 0x3E, 0x30, 0x78},  // q
+    {0x00, 0x00, 0x3B, 0x6E, 0x66, 0x06, 0x0F, 0x00},  // r
+    {0x00, 0x00, 0x3E, 0x03, 0x1E, 0x30, 0x1F, 0x00},  // s
+    {0x08, 0x0C, 0x3E, 0x0C, 0x0C, 0x2C, 0x18, 0x00},  // t
+    {0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x6E, 0x00},  // u
+    {0x00, 0x00, 0x33, 0x33, 0x33, 0x1E, 0x0C, 0x00},  // v
+    {0x00, 0x00, 0x63, 0x6B, 0x7F, 0x7F, 0x36, 0x00},  // w
+    {0x00, 0x00, 0x63, 0x36, 0x1C, 0x36, 0x63, 0x00},  // x
+    {0x00, 0x00, 0x33, 0x33, 0x33, 0x3E, 0x30, 0x1F},  // y
+    {0x00, 0x00, 0x3F, 0x19, 0x0C, 0x26, 0x3F, 0x00},  // z
+    {0x38, 0x0C, 0x0C, 0x07, 0x0C, 0x0C, 0x38, 0x00},  // {
+    {0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x00},  // |
+    {0x07, 0x0C, 0x0C, 0x38, 0x0C, 0x0C, 0x07, 0x00},  // }
+    {0x6E, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},  // ~
+};
+
+bool hostTextShown() {
+    for (int row = 0; row < TEXT_ROWS; row++) {
+        for (int column = 0; column < TEXT_COLUMNS; column++) {
+            if (hostCharacters[(row << 7) + column] != ' ') {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// the colour of VGA pixel (x, y), 640 x 480 with every buffer pixel doubled
+uint16_t hostShownPixel(intptr_t buffer, int x, int y) {
+    unsigned char character = hostCharacters[((y >> 3) << 7) + (x >> 3)];
+    if (character >= '!' && character <= '~' && (hostFont[character - '!'][y & 7] >> (x & 7) & 1)) {
+        return WHITE;
+    }
+    return *(uint16_t *)(buffer + ((y >> 1) << 10) + ((x >> 1) << 1));
+}
+
+uint32_t hostCrcByte(uint32_t crc, uint8_t byte) {
+    crc ^= byte;
+    for (int bit = 0; bit < 8; bit++) {
+        crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+    }
+    return crc;
+}
+
+// the overlay only counts once something is written on it
+uint32_t hostChecksum(intptr_t buffer) {
+    uint32_t crc = 0xFFFFFFFF;
+    for (int y = 0; y < RESOLUTION_Y; y++) {
+        for (int x = 0; x < RESOLUTION_X; x++) {
+            uint16_t pixel = *(uint16_t *)(buffer + (y << 10) + (x << 1));
+            crc = hostCrcByte(crc, pixel & 0xFF);
+            crc = hostCrcByte(crc, pixel >> 8);
+        }
+    }
+    if (hostTextShown()) {
+        for (int row = 0; row < TEXT_ROWS; row++) {
+            for (int column = 0; column < TEXT_COLUMNS; column++) {
+                crc = hostCrcByte(crc, hostCharacters[(row << 7) + column]);
+            }
+        }
+    }
+    return ~crc;
+}
+
+void hostDumpFrame(const char *path, intptr_t buffer) {
+    FILE *file = fopen(path, "wb");
+    if (file == NULL) {
+        perror(path);
+        return;
+    }
+    // with text on the overlay the frame is saved the size the VGA out shows it
+    int scale = hostTextShown() ? 1 : 2;
+    fprintf(file, "P6\n%d %d\n255\n", RESOLUTION_X * 2 / scale, RESOLUTION_Y * 2 / scale);
+    for (int y = 0; y < RESOLUTION_Y * 2; y += scale) {
+        for (int x = 0; x < RESOLUTION_X * 2; x += scale) {
+            uint16_t pixel = hostShownPixel(buffer, x, y);
+            fputc(((pixel >> 11) & 0x1F) << 3, file);
+            fputc(((pixel >> 5) & 0x3F) << 2, file);
+            fputc((pixel & 0x1F) << 3, file);
+        }
+    }
+    fclose(file);
+}
+
+void hostReport() {
+    printf("frames %ld front crc %08x leds %03x hex %08x %04x\n", hostFrame, hostChecksum(hostFront), hostLeds,
+           hostHex[0], hostHex[1]);
+    if (hostDumpPath != NULL) {
+        hostDumpFrame(hostDumpPath, hostFront);
+    }
+}
+
+void hostSaveRecording() {
+    if (recordingSize == 0) {
+        return;
+    }
+    FILE *file = fopen(hostRecordPath, "wb");
+    if (file == NULL || fwrite(inputRecording, 1, recordingSize, file) != (size_t)recordingSize || fclose(file) != 0) {
+        perror(hostRecordPath);
+    }
+}
+
+void hostLoadReplay(const char *path) {
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) {
+        perror(path);
+        exit(1);
+    }
+    fseek(file, 0, SEEK_END);
+    hostReplaySize = ftell(file);
+    rewind(file);
+    hostReplay = malloc(hostReplaySize);
+    if (hostReplay == NULL || fread(hostReplay, 1, hostReplaySize, file) != hostReplaySize) {
+        perror(path);
+        exit(1);
+    }
+    fclose(file);
+}
+
+void hostAddEvent(long frame, int type, int value) {
+    if (hostEventCount == HOST_MAX_EVENTS) {
+        fprintf(stderr, "script: more than %d events\n", HOST_MAX_EVENTS);
+        exit(1);
+    }
+    hostEvents[hostEventCount].frame = frame;
+    hostEvents[hostEventCount].type = type;
+    hostEvents[hostEventCount].value = value;
+    hostEventCount++;
+}
+
+void hostLoadScript(const char *path) {
+    FILE *file = fopen(path, "r");
+    if (file == NULL) {
+        perror(path);
+        exit(1);
+    }
+    char line[256];
+    int lineNum = 0;
+    while (fgets(line, sizeof(line), file) != NULL) {
+        lineNum++;
+        char *comment = strchr(line, '#');
+        if (comment != NULL) {
+            *comment = '\0';
+        }
+        char *token = strtok(line, " \t\r\n");
+        if (token == NULL) {
+            continue;
+        }
+        long frame = strtol(token, NULL, 10);
+        char *command = strtok(NULL, " \t\r\n");
+        char *arg = strtok(NULL, " \t\r\n");
+        if (command == NULL || (strcmp(command, "quit") != 0 && arg == NULL)) {
+            fprintf(stderr, "%s:%d: malformed event\n", path, lineNum);
+            exit(1);
+        }
+        if (strcmp(command, "key") == 0) {
+            hostAddEvent(frame, HOST_KEY, 1 << atoi(arg));
+        } else if (strcmp(command, "sw") == 0) {
+            if (strncmp(arg, "0b", 2) == 0) {
+                hostAddEvent(frame, HOST_SWITCHES, (int)strtol(arg + 2, NULL, 2));
+            } else {
+                hostAddEvent(frame, HOST_SWITCHES, (int)strtol(arg, NULL, 0));
+            }
+        } else if (strcmp(command, "ps2") == 0) {
+            for (; arg != NULL; arg = strtok(NULL, " \t\r\n")) {
+                hostAddEvent(frame, HOST_PS2, (int)strtol(arg, NULL, 16));
+            }
+        } else if (strcmp(command, "quit") == 0) {
+            hostAddEvent(frame, HOST_QUIT, 0);
+        } else {
+            fprintf(stderr, "%s:%d: unknown command '%s'\n", path, lineNum, command);
+            exit(1);
+        }
+    }
+    fclose(file);
+}
+
+// applies every scripted event that is due at the current frame
+void hostApplyEvents() {
+    while (hostNextEvent < hostEventCount && hostEvents[hostNextEvent].frame <= hostFrame) {
+        hostEvent *event = &hostEvents[hostNextEvent++];
+        if (event->type == HOST_KEY) {
+#ifdef USE_INTERRUPTS
+            postKeyEdges(event->value);
+#else
+            hostKeyEdges |= event->value;
+#endif
+        } else if (event->type == HOST_SWITCHES) {
+            __atomic_store_n(&hostSwitches, event->value, __ATOMIC_RELAXED);
+        } else if (event->type == HOST_PS2) {
+#ifdef USE_INTERRUPTS
+            postPs2Byte(event->value);
+#else
+            if (hostPs2Count < HOST_PS2_FIFO_SIZE) {
+                hostPs2Fifo[(hostPs2Head + hostPs2Count) % HOST_PS2_FIFO_SIZE] = event->value;
+                hostPs2Count++;
+            }
+#endif
+        } else {
+            exit(0);
+        }
+    }
+}
+
+void hostAdvanceFrame() {
+    hostFrame++;
+    if (hostFrameLimit > 0 && hostFrame >= hostFrameLimit) {
+        exit(0);
+    }
+    hostApplyEvents();
+    __atomic_store_n(&hostClockFrame, hostFrame, __ATOMIC_RELEASE);
+}
+
+#ifndef USE_INTERRUPTS
+int readKeyEdges() {
+    return hostKeyEdges;
+}
+
+void clearKeyEdges(int keys) {
+    hostKeyEdges &= ~keys;
+}
+#endif
+
+int readSwitches() {
+    return __atomic_load_n(&hostSwitches, __ATOMIC_RELAXED);
+}
+
+int readLeds() {
+    return __atomic_load_n(&hostLeds, __ATOMIC_RELAXED);
+}
+
+void writeLeds(int value) {
+    __atomic_store_n(&hostLeds, value & 0x3FF, __ATOMIC_RELAXED);
+}
+
+void writeHexDisplays(int hex3to0, int hex5to4) {
+    hostHex[0] = hex3to0;
+    hostHex[1] = hex5to4;
+}
+
+#ifndef USE_INTERRUPTS
+// same layout as the PS/2 data register, reading pops one byte
+int readPs2() {
+    if (hostPs2Count == 0) {
+        return 0;
+    }
+    int data = (hostPs2Count << 16) | 0x8000 | hostPs2Fifo[hostPs2Head];
+    hostPs2Head = (hostPs2Head + 1) % HOST_PS2_FIFO_SIZE;
+    hostPs2Count--;
+    return data;
+}
+#endif
+
+intptr_t pixelBufferAddress(int index) {
+    return (intptr_t)&hostPixelBuffers[index][HOST_BUFFER_PITCH];
+}
+
+// maps the pack read-only, the sprites point straight into the mapping
+const uint8_t *platformAssetPack(size_t *size) {
+    const char *path = getenv("TANK_ASSETS");
+    if (path == NULL) {
+        path = ASSET_PACK_PATH;
+    }
+    int file = open(path, O_RDONLY);
+    struct stat info;
+    if (file < 0 || fstat(file, &info) != 0) {
+        perror(path);
+        exit(1);
+    }
+    void *pack = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+    if (pack == MAP_FAILED) {
+        perror(path);
+        exit(1);
+    }
+    close(file);
+    *size = info.st_size;
+    return pack;
+}
+
+const uint8_t *platformReplay(size_t *size) {
+    *size = hostReplaySize;
+    return hostReplay;
+}
+
+intptr_t frontBuffer() {
+    return hostFront;
+}
+
+void writeCharacter(int column, int row, char character) {
+    hostCharacters[(row << 7) + column] = character;
+}
+
+bool swapPending() {
+    if (hostQueued != 0 && (int32_t)(platformTicks() - hostSwapDue) >= 0) {
+        hostFront = hostQueued;
+        hostQueued = 0;
+    }
+    return hostQueued != 0;
+}
+
+void platformInit() {
+    hostFront = pixelBufferAddress(1);
+    memset(hostCharacters, ' ', sizeof(hostCharacters));
+
+    const char *frames = getenv("TANK_FRAMES");
+    if (frames != NULL) {
+        hostFrameLimit = atol(frames);
+    }
+    hostDumpPath = getenv("TANK_DUMP");
+    hostStats = getenv("TANK_STATS") != NULL;
+    const char *script = getenv("TANK_SCRIPT");
+    if (script != NULL) {
+        hostLoadScript(script);
+    }
+    const char *replay = getenv("TANK_REPLAY");
+    if (replay != NULL) {
+        hostLoadReplay(replay);
+    }
+    const char *vsync = getenv("TANK_VSYNC");
+    if (vsync != NULL && atoi(vsync) > 0) {
+        hostRefreshTicks = PLATFORM_TICKS_PER_SECOND / atoi(vsync);
+    }
+    hostRecordPath = getenv("TANK_RECORD");
+    if (hostRecordPath != NULL) {
+        atexit(hostSaveRecording);
+    }
+#ifndef BENCHMARK
+    atexit(hostReport);
+#else
+    hostFrameLimit = 0;  // the benchmarks decide how many frames they play
+#endif
+    hostApplyEvents();
+}
+
+// without TANK_VSYNC there is no display to wait for and the swap completes immediately
+void requestSwap(intptr_t address) {
+    if (hostRefreshTicks == 0) {
+        hostFront = address;
+    } else {
+        uint32_t now = platformTicks();
+        hostQueued = address;
+        hostSwapDue = now - now % hostRefreshTicks + hostRefreshTicks;
+    }
+    if (hostStats) {
+        fprintf(stderr, "frame %ld pixels %ld\n", hostFrame, framePixelsTouched);
+    }
+    hostAdvanceFrame();
+}
+
+// sleeps until the refresh that carries out the pending swap
+void waitForSwap() {
+    int32_t left = hostSwapDue - platformTicks();
+    if (left > 0) {
+        struct timespec pause = {0, left * (1000000000 / PLATFORM_TICKS_PER_SECOND)};
+        nanosleep(&pause, NULL);
+    }
+}
+
+void waitForInput() {
+    hostAdvanceFrame();
+}
+
+// frames are not paced on Linux, time moves on by one display frame per frame so runs are reproducible
+uint32_t gameClock() {
+    return (uint32_t)__atomic_load_n(&hostClockFrame, __ATOMIC_ACQUIRE) * (PLATFORM_TICKS_PER_SECOND / HOST_FRAME_RATE);
+}
+
+#ifdef SPLIT_LOOP
+pthread_t hostSimulationThread;
+void (*hostSimulationTask)() = NULL;
+volatile bool hostSimulationRunning = false;
+
+void *hostRunSimulation(void *unused) {
+    (void)unused;
+    while (__atomic_load_n(&hostSimulationRunning, __ATOMIC_ACQUIRE)) {
+        hostSimulationTask();
+        sched_yield();
+    }
+    return NULL;
+}
+
+// calls the task over and over on a thread of its own until it is stopped
+void startSimulationTask(void (*task)()) {
+    hostSimulationTask = task;
+    __atomic_store_n(&hostSimulationRunning, true, __ATOMIC_RELEASE);
+    if (pthread_create(&hostSimulationThread, NULL, hostRunSimulation, NULL) != 0) {
+        perror("pthread_create");
+        exit(1);
+    }
+}
+
+// returns once the task has finished its last call
+void stopSimulationTask() {
+    __atomic_store_n(&hostSimulationRunning, false, __ATOMIC_RELEASE);
+    pthread_join(hostSimulationThread, NULL);
+}
+#endif
+
+#endif
+
+/* Swap chain
+ * The game draws into the SWAP_CHAIN_LENGTH pixel buffers in turn.
+ * wait_for_vsync() hands the finished back buffer to the display and moves
+ * on to a buffer that is neither on screen nor waiting to be. The display
+ * takes one swap request at a time, so with two buffers there is no such
+ * buffer until the vertical sync and the game stalls for it on every frame.
+ * With three it draws the next frame right away and only waits if the swap
+ * it asked for a frame ago has still not happened when it is done.
+ */
+int drawingBuffer = 0;   // backBuffer(), the buffer frames are drawn into
+int queuedBuffer = -1;   // the buffer last handed to the display
+
+// a buffer other than the back buffer that may be drawn into now, or -1 while there is none
+int availableBuffer() {
+    bool pending = swapPending();
+    intptr_t front = frontBuffer();
+    for (int step = 1; step < SWAP_CHAIN_LENGTH; step++) {
+        int buffer = (drawingBuffer + step) % SWAP_CHAIN_LENGTH;
+        if (pixelBufferAddress(buffer) != front && !(pending && buffer == queuedBuffer)) {
+            return buffer;
+        }
+    }
+    return -1;
+}
+
+bool bufferAvailable() {
+    return availableBuffer() >= 0;
+}
+
+intptr_t backBuffer() {
+    return pixelBufferAddress(drawingBuffer);
+}
+
+// shows the back buffer and returns once there is a new one to draw into
+void wait_for_vsync() {
+    while (swapPending()) {
+        waitForSwap();
+    }
+    framePixelsTouched = pixelsTouched;
+    pixelsTouched = 0;
+    requestSwap(backBuffer());
+    queuedBuffer = drawingBuffer;
+
+    int next = availableBuffer();
+    while (next < 0) {
+        waitForSwap();
+        next = availableBuffer();
+    }
+    drawingBuffer = next;
+}
+
+// draws the same screen into every buffer of the chain, all but the last one are shown
+void drawEveryBuffer(void (*draw)()) {
+    draw();
+    for (int buffer = 1; buffer < SWAP_CHAIN_LENGTH; buffer++) {
+        wait_for_vsync();
+        pixel_buffer_start = backBuffer();
+        draw();
+    }
+}
+
+/* Text overlay
+ * The character buffer shows TEXT_COLUMNS x TEXT_ROWS characters on top of
+ * the pixel buffers, at one byte per character and with no drawing at all,
+ * so labels and numbers that change often cost next to nothing. It is not
+ * double buffered: a character shows as soon as it is written and stays
+ * until it is overwritten, whatever buffer is on screen. Positions are in
+ * characters, a pixel position divided by TEXT_CELL. Building with
+ * -DTEXT_HUD writes the labels of the start screen and the side panel here
+ * instead of drawing them as sprites, and adds the match clock and the wins.
+ */
+void drawText(int column, int row, const char *text) {
+    while (*text != '\0' && column < TEXT_COLUMNS) {
+        writeCharacter(column++, row, *text++);
+    }
+}
+
+// blanks columns x0 up to x1 of rows y0 up to y1
+void clearTextArea(int x0, int y0, int x1, int y1) {
+    for (int row = y0; row < y1; row++) {
+        for (int column = x0; column < x1; column++) {
+            writeCharacter(column, row, ' ');
+        }
+    }
+}
+
+void clearText() {
+    clearTextArea(0, 0, TEXT_COLUMNS, TEXT_ROWS);
+}
+
+#ifdef TEXT_HUD
+int matchTicks = 0;  // ticks played in the current match
+int matchWins[2] = {0, 0};
+#endif
+
+/* Keyboard
+ * Decodes scancode set 2 into a bitmap of the keys held down. A key sends its
+ * make code when pressed and F0 followed by the make code when released;
+ * extended keys such as the arrows put E0 in front of both. Key codes below
+ * are the make code, plus KEY_EXTENDED for the E0 keys.
+ */
+#define KEY_EXTENDED 0x100
+#define KEY_CODE_COUNT 0x200
+#define KEY_UP_ARROW (KEY_EXTENDED | 0x75)
+#define KEY_DOWN_ARROW (KEY_EXTENDED | 0x72)
+#define KEY_LEFT_ARROW (KEY_EXTENDED | 0x6B)
+#define KEY_RIGHT_ARROW (KEY_EXTENDED | 0x74)
+
+uint32_t keysDown[KEY_CODE_COUNT / 32];
+bool ps2Extended = false;  // an E0 prefix is waiting for its code
+bool ps2Break = false;     // an F0 prefix is waiting for its code
+
+#ifndef USE_INTERRUPTS
+// moves every byte in the PS/2 FIFO to the input queue, RVALID stays set until the FIFO is empty
+void pollPs2() {
+    int data = readPs2();
+    while (data & 0x8000) {
+        postPs2Byte(data & 0xFF);
+        data = readPs2();
+    }
+}
+#endif
+
+void decodePs2Byte(unsigned char data) {
+    if (data == 0xE0) {
+        ps2Extended = true;
+    } else if (data == 0xF0) {
+        ps2Break = true;
+    } else if (data > 0x83) {
+        // not a key: E1 of the pause key, or a reply from the keyboard such as FA (ack) or AA (self test)
+        ps2Extended = false;
+        ps2Break = false;
+    } else {
+        int code = data | (ps2Extended ? KEY_EXTENDED : 0);
+        if (ps2Break) {
+            keysDown[code >> 5] &= ~(1u << (code & 31));
+        } else {
+            keysDown[code >> 5] |= 1u << (code & 31);
+        }
+        ps2Extended = false;
+        ps2Break = false;
+    }
+}
+
+// decodes everything that arrived since the last call
+void updateKeyboard() {
+#ifndef USE_INTERRUPTS
+    pollPs2();
+#endif
+    int data = popPs2Byte();
+    while (data >= 0) {
+        decodePs2Byte(data);
+        data = popPs2Byte();
+    }
+}
+
+bool keyDown(int code) {
+    return keysDown[code >> 5] & (1u << (code & 31));
+}
+
+int tileWidth = 20;
+int tileHeight = 20;
+int tankWidth = 14;
+int tankHeight = 14;
+int bulletSpeed = 3;
+
+bool startScreen = true;
+bool pauseScreen = false;
+bool gameRunning = false;
+bool p1Victory = false;
+int selectedMap = 0;
+bool gamePaused = false;
+
+typedef struct point2d {
+    int x;
+    int y;
+} coord;
+
+/* Bullet pool
+ * Live bullets are packed at the front of the arrays, one array per field,
+ * so the per-tick loops touch only bullets in flight and only the fields
+ * they need. Firing appends at count and a spent bullet is replaced by the
+ * last one, both in constant time. Build with -DMAX_BULLETS=<n> for more.
+ */
+#ifndef MAX_BULLETS
+#ifdef BENCHMARK
+#define MAX_BULLETS 1000
+#else
+#define MAX_BULLETS 10
+#endif
+#endif
+#define BULLET_LANES 8  // int16_t lanes in a 128-bit NEON or SSE register
+#define BULLET_ARRAY_SIZE ((MAX_BULLETS + BULLET_LANES - 1) / BULLET_LANES * BULLET_LANES)
+
+// the arrays are padded to whole vectors, the kernels may read and write slots past count
+typedef struct bulletPool {
+    int16_t x[BULLET_ARRAY_SIZE];
+    int16_t y[BULLET_ARRAY_SIZE];
+    int16_t dx[BULLET_ARRAY_SIZE];
+    int16_t dy[BULLET_ARRAY_SIZE];
+    int16_t previousX[BULLET_ARRAY_SIZE];  // position before the last simulation tick
+    int16_t previousY[BULLET_ARRAY_SIZE];
+    int16_t owner[BULLET_ARRAY_SIZE];      // tank that fired it
+    int16_t team[BULLET_ARRAY_SIZE];       // team of that tank, it hits tanks of every other team
+    int count;
+} bulletPool;
+
+void clearBullets(bulletPool *pool) {
+    pool->count = 0;
+}
+
+// index of the new bullet, -1 when the pool is full
+int spawnBullet(bulletPool *pool, coord position, coord direction, int owner, int team) {
+    if (pool->count == MAX_BULLETS) {
+        return -1;
+    }
+    int index = pool->count++;
+    pool->x[index] = position.x;
+    pool->y[index] = position.y;
+    pool->dx[index] = direction.x;
+    pool->dy[index] = direction.y;
+    pool->previousX[index] = position.x;
+    pool->previousY[index] = position.y;
+    pool->owner[index] = owner;
+    pool->team[index] = team;
+    return index;
+}
+
+// the last live bullet moves into the freed slot, loops over the pool revisit index afterwards
+void removeBullet(bulletPool *pool, int index) {
+    int last = --pool->count;
+    pool->x[index] = pool->x[last];
+    pool->y[index] = pool->y[last];
+    pool->dx[index] = pool->dx[last];
+    pool->dy[index] = pool->dy[last];
+    pool->previousX[index] = pool->previousX[last];
+    pool->previousY[index] = pool->previousY[last];
+    pool->owner[index] = pool->owner[last];
+    pool->team[index] = pool->team[last];
+}
+
+/* Tanks
+ * Every tank of a match is one slot of a tankStore, laid out one array per
+ * field like the bullet pool, so movement, firing and the bullet hit tests
+ * are single loops over however many tanks there are. Tank 0 is player 1
+ * and tank 1 player 2, both are always there; any further tanks join one of
+ * the TEAM_COUNT teams. A match is lost by the team with no tank left alive.
+ * Build with -DMAX_TANKS=<n> to change the limit.
+ */
+#ifndef MAX_TANKS
+#define MAX_TANKS 64
+#endif
+#define PLAYER_TANKS 2
+#define TEAM_COUNT 2
+#ifndef BOT_TANKS
+#define BOT_TANKS 0
+#endif
+#if BOT_TANKS >= MAX_TANKS
+#error "BOT_TANKS must leave room for player 1 in MAX_TANKS"
+#endif
+
+typedef struct tankStore {
+    int16_t x[MAX_TANKS];
+    int16_t y[MAX_TANKS];
+    int16_t previousX[MAX_TANKS];  // position before the last simulation tick
+    int16_t previousY[MAX_TANKS];
+    int8_t xDir[MAX_TANKS];        // where it drives this tick, 0 0 standing still
+    int8_t yDir[MAX_TANKS];
+    int8_t lastDirectionX[MAX_TANKS];  // where it last drove, it faces and fires that way
+    int8_t lastDirectionY[MAX_TANKS];
+    int8_t lifeLeft[MAX_TANKS];
+    uint8_t team[MAX_TANKS];
+    uint8_t sprite[MAX_TANKS];     // spriteId of its small tank
+    bool bot[MAX_TANKS];           // driven by updateBots() instead of a player
+    uint8_t goal[MAX_TANKS];       // tile a bot is heading for
+    int8_t quarry[MAX_TANKS];      // tank a bot hunts, -1 for none
+    uint8_t thinkIn[MAX_TANKS];    // ticks before a bot picks its quarry and goal again
+    uint8_t reload[MAX_TANKS];     // ticks before a bot may fire again
+    int count;
+} tankStore;
+
+void clearTanks(tankStore *tanks) {
+    tanks->count = 0;
+}
+
+// index of the new tank, standing still with three lives; -1 when the store is full
+int addTank(tankStore *tanks, int x, int y, int team, int sprite) {
+    if (tanks->count == MAX_TANKS) {
+        return -1;
+    }
+    int index = tanks->count++;
+    tanks->x[index] = x;
+    tanks->y[index] = y;
+    tanks->previousX[index] = x;
+    tanks->previousY[index] = y;
+    tanks->xDir[index] = 0;
+    tanks->yDir[index] = 0;
+    tanks->lastDirectionX[index] = 0;
+    tanks->lastDirectionY[index] = 0;
+    tanks->lifeLeft[index] = 3;
+    tanks->team[index] = team;
+    tanks->sprite[index] = sprite;
+    tanks->bot[index] = false;
+    return index;
+}
+
+bool tankAlive(const tankStore *tanks, int tank) {
+    return tanks->lifeLeft[tank] > 0;
+}
+
+bool teamAlive(const tankStore *tanks, int team) {
+    for (int tank = 0; tank < tanks->count; tank++) {
+        if (tanks->team[tank] == team && tankAlive(tanks, tank)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void swap(int *first, int *second) {
+    int temp = *first;
+    *first = *second;
+    *second = temp;
+}
+
+void plot_pixel(int x, int y, short int line_color) {
+    *(short int *)(pixel_buffer_start + (y << 10) + (x << 1)) = line_color;
+}
+
+// the pixel buffer rows are 512 pixels apart, so plain uint32_t stores may alias the short int plots
+typedef uint32_t __attribute__((may_alias)) pixelPair;
+
+// fills [x0, x1) x [y0, y1) one row at a time, writing two pixels per store
+void fillRect(int x0, int y0, int x1, int y1, short int color) {
+    if (x0 < 0) {
+        x0 = 0;
+    }
+    if (y0 < 0) {
+        y0 = 0;
+    }
+    if (x1 > RESOLUTION_X) {
+        x1 = RESOLUTION_X;
+    }
+    if (y1 > RESOLUTION_Y) {
+        y1 = RESOLUTION_Y;
+    }
+    if (x0 >= x1 || y0 >= y1) {
+        return;
+    }
+
+    pixelsTouched += (x1 - x0) * (y1 - y0);
+    uint16_t pixel = (uint16_t)color;
+    uint32_t pair = ((uint32_t)pixel << 16) | pixel;
+    // long black or white rows are a single byte value, memset uses the widest stores for those
+    bool useMemset = (pixel >> 8) == (pixel & 0xFF) && x1 - x0 >= 64;
+    for (int y = y0; y < y1; y++) {
+        uint16_t *row = (uint16_t *)(pixel_buffer_start + (y << 10));
+        int x = x0;
+        if (useMemset) {
+            memset(row + x0, pixel & 0xFF, (x1 - x0) << 1);
+            continue;
+        }
+        if (x & 1) {
+            row[x++] = pixel;
+        }
+        pixelPair *pairs = (pixelPair *)(row + x);
+        for (; x + 8 <= x1; x += 8) {
+            pairs[0] = pair;
+            pairs[1] = pair;
+            pairs[2] = pair;
+            pairs[3] = pair;
+            pairs += 4;
+        }
+        for (; x + 2 <= x1; x += 2) {
+            *pairs++ = pair;
+        }
+        if (x < x1) {
+            row[x] = pixel;
+        }
+    }
+}
+
+void clear_screen() {
+    fillRect(0, 0, RESOLUTION_X, RESOLUTION_Y, BLACK);
+}
+
+void draw_line(int x0, int y0, int x1, int y1, short int color) {
+    bool is_steep = ABS(y1 - y0) > ABS(x1 - x0);
+
+    if (is_steep) {
+        swap(&x0, &y0);
+        swap(&x1, &y1);
+    }
+    if (x0 > x1) {
+        swap(&x0, &x1);
+        swap(&y0, &y1);
+    }
+
+    int delta_x = x1 - x0;
+    int delta_y = ABS(y1 - y0);
+    int error = -(delta_x / 2);
+    int y = y0;
+    int y_step = y0 < y1 ? 1 : -1;
+
+    pixelsTouched += x1 - x0 + 1;
+    for (int x = x0; x <= x1; x++) {
+        if (is_steep) {
+            plot_pixel(y, x, color);
+        } else {
+            plot_pixel(x, y, color);
+        }
+        error += delta_y;
+        if (error > 0) {
+            y += y_step;
+            error -= delta_x;
+        }
+    }
+}
+
+void clearMainScreen() {
+    fillRect(0, 0, 12 * tileWidth, RESOLUTION_Y, BLACK);
+    draw_line(12 * tileWidth, 0, 12 * tileWidth, RESOLUTION_Y - 1, ORANGE);
+#ifdef TEXT_HUD
+    clearTextArea(0, 0, 12 * tileWidth / TEXT_CELL, TEXT_ROWS);
+#endif
+}
+
+void drawBox(int startX, int startY, int endX, int endY, short int color, bool fill) {
+    if (!fill) {
+        draw_line(startX, startY, endX, startY, color);
+        draw_line(startX, endY, endX, endY, color);
+        draw_line(startX, startY, startX, endY, color);
+        draw_line(endX, startY, endX, endY, color);
+    } else {
+        // rows startY to endY - 1, columns startX to endX inclusive
+        if (startX > endX) {
+            swap(&startX, &endX);
+        }
+        fillRect(startX, startY, endX + 1, endY, color);
+    }
+}
+
+/* Sprites
+ * Every bitmap is drawn through a sprite descriptor. The texels live in the
+ * asset pack (see assets/assetpack.h) and loadAssetPack() points each
+ * descriptor at its entry, found by name. Most sprites hold 4 or 8 bit
+ * palette indices that blitSprite() expands to RGB565 as it copies; their
+ * colour key is palette slot 0 rather than a colour. Sprites with a key are
+ * converted once at start up into runs of opaque texels per row, so
+ * blitSprite() copies whole runs and skips transparent ones without looking
+ * at them again.
+ */
+#define SPRITE_SPAN_POOL 8192
+#define SPRITE_MAX_WIDTH 255  // spans keep their columns in a byte, the pack refuses wider sprites
+#define SPRITE_MAX_ROWS 120  // the tallest sprite, the full screen pages; a taller one is drawn without spans
+#define ROW_SPAN_POOL (SPRITE_COUNT * (SPRITE_MAX_ROWS + 1))  // every sprite's row starts and its end
+
+typedef struct spriteSpan {
+    uint8_t start;
+    uint8_t length;
+} spriteSpan;
+
+typedef struct sprite {
+    const uint8_t *texels;     // RGB565 texels or palette indices, see assets/assetpack.h
+    const uint16_t *palette;   // NULL for 16 bits per texel
+    int bitsPerTexel;          // 4, 8 or 16
+    int width;
+    int height;
+    int pitch;            // bytes from one row to the next
+    int colorKey;         // texel value that is not drawn (a palette index unless 16 bits), or NO_COLOR_KEY
+    spriteSpan *spans;    // opaque runs, NULL until prepareSprites() has run
+    uint16_t *rowSpans;   // spans of row r are rowSpans[r] to rowSpans[r + 1] - 1
+} sprite;
+
+enum spriteId {
+    SPRITE_GAME_TITLE,
+    SPRITE_PRESS_KEY_TO_START,
+    SPRITE_SWITCH00,
+    SPRITE_SWITCH01,
+    SPRITE_BIG_PURPLE_TANK_UP,
+    SPRITE_BIG_BROWN_TANK_UP,
+    SPRITE_HEART,
+    SPRITE_PLAYER1,
+    SPRITE_PLAYER2,
+    SPRITE_PAUSE,
+    SPRITE_UP,
+    SPRITE_DOWN,
+    SPRITE_LEFT,
+    SPRITE_RIGHT,
+    SPRITE_FIRE,
+    SPRITE_P1_TEXT,
+    SPRITE_P2_TEXT,
+    SPRITE_PURPLE_SMALL_TANK,
+    SPRITE_BROWN_SMALL_TANK,
+    SPRITE_BRICK,
+    SPRITE_P1_WON,
+    SPRITE_P2_WON,
+    SPRITE_PAUSE_PAGE,
+    SPRITE_PURPLE_UP,
+    SPRITE_PURPLE_UP_RIGHT,
+    SPRITE_BROWN_UP,
+    SPRITE_BROWN_UP_RIGHT,
+    SPRITE_MAP1,
+    SPRITE_MAP2,
+    SPRITE_COUNT
+};
+
+sprite sprites[SPRITE_COUNT];
+
+// asset pack entry of every sprite
+const char *spriteNames[SPRITE_COUNT] = {
+    [SPRITE_GAME_TITLE] = "gametitle",
+    [SPRITE_PRESS_KEY_TO_START] = "presskeytostart",
+    [SPRITE_SWITCH00] = "switch00",
+    [SPRITE_SWITCH01] = "switch01",
+    [SPRITE_BIG_PURPLE_TANK_UP] = "bigPurpleTankUp",
+    [SPRITE_BIG_BROWN_TANK_UP] = "bigBrownTankUp",
+    [SPRITE_HEART] = "heart",
+    [SPRITE_PLAYER1] = "player1",
+    [SPRITE_PLAYER2] = "player2",
+    [SPRITE_PAUSE] = "pause",
+    [SPRITE_UP] = "up",
+    [SPRITE_DOWN] = "down",
+    [SPRITE_LEFT] = "left",
+    [SPRITE_RIGHT] = "right",
+    [SPRITE_FIRE] = "fire",
+    [SPRITE_P1_TEXT] = "p1Text",
+    [SPRITE_P2_TEXT] = "p2Text",
+    [SPRITE_PURPLE_SMALL_TANK] = "psup",
+    [SPRITE_BROWN_SMALL_TANK] = "bsup",
+    [SPRITE_BRICK] = "brickMain",
+    [SPRITE_P1_WON] = "p1Won",
+    [SPRITE_P2_WON] = "p2Won",
+    [SPRITE_PAUSE_PAGE] = "pausePage",
+    [SPRITE_PURPLE_UP] = "pu",
+    [SPRITE_PURPLE_UP_RIGHT] = "pur",
+    [SPRITE_BROWN_UP] = "bu",
+    [SPRITE_BROWN_UP_RIGHT] = "bur",
+    [SPRITE_MAP1] = "map1",
+    [SPRITE_MAP2] = "map2",
+};
+
+// points every sprite at its texels in the pack, false if the pack is damaged or misses a sprite
+bool loadAssetPack() {
+    size_t size;
+    const uint8_t *pack = platformAssetPack(&size);
+    const assetPackHeader *header = (const assetPackHeader *)pack;
+    if (size < sizeof(assetPackHeader) || header->magic != ASSET_PACK_MAGIC ||
+        header->version != ASSET_PACK_VERSION || header->size > size ||
+        sizeof(assetPackHeader) + header->count * sizeof(assetPackEntry) > header->size) {
+        return false;
+    }
+    const assetPackEntry *entries = (const assetPackEntry *)(header + 1);
+    for (int id = 0; id < SPRITE_COUNT; id++) {
+        const assetPackEntry *entry = NULL;
+        for (uint32_t entryIte = 0; entryIte < header->count; entryIte++) {
+            if (strncmp(entries[entryIte].name, spriteNames[id], ASSET_NAME_LENGTH) == 0) {
+                entry = &entries[entryIte];
+                break;
+            }
+        }
+        if (entry == NULL || (entry->bitsPerTexel != 4 && entry->bitsPerTexel != 8 && entry->bitsPerTexel != 16) ||
+            entry->width > SPRITE_MAX_WIDTH ||
+            entry->offset + entry->height * ((entry->width * entry->bitsPerTexel + 7) / 8) > header->size ||
+            entry->paletteOffset + entry->paletteSize * sizeof(uint16_t) > header->size ||
+            (entry->bitsPerTexel != 16 && entry->paletteSize == 0)) {
+            return false;
+        }
+        sprites[id].texels = pack + entry->offset;
+        sprites[id].palette = entry->paletteSize > 0 ? (const uint16_t *)(pack + entry->paletteOffset) : NULL;
+        sprites[id].bitsPerTexel = entry->bitsPerTexel;
+        sprites[id].width = entry->width;
+        sprites[id].height = entry->height;
+        sprites[id].pitch = (entry->width * entry->bitsPerTexel + 7) / 8;
+        sprites[id].colorKey = entry->colorKey;
+        sprites[id].spans = NULL;
+        sprites[id].rowSpans = NULL;
+    }
+    return true;
+}
+
+
+spriteSpan spanPool[SPRITE_SPAN_POOL];
+uint16_t rowSpanPool[ROW_SPAN_POOL];
+int spanPoolUsed = 0;
+int rowSpanPoolUsed = 0;
+
+// texel col of a row: an RGB565 colour for 16 bit sprites, otherwise a palette index
+int spriteTexel(const sprite *s, const uint8_t *row, int col) {
+    if (s->bitsPerTexel == 16) {
+        return ((const uint16_t *)row)[col];
+    } else if (s->bitsPerTexel == 8) {
+        return row[col];
+    }
+    return (row[col >> 1] >> ((col & 1) << 2)) & 0xF;
+}
+
+// writes texels [start, start + length) of a row to dest as RGB565, looking indices up in the palette
+void expandTexels(const sprite *s, const uint8_t *row, int start, int length, uint16_t *dest) {
+    if (s->bitsPerTexel == 16) {
+        memcpy(dest, row + (start << 1), length << 1);
+    } else if (s->bitsPerTexel == 8) {
+        for (int col = 0; col < length; col++) {
+            dest[col] = s->palette[row[start + col]];
+        }
+    } else {
+        for (int col = start; col < start + length; col++) {
+            dest[col - start] = s->palette[(row[col >> 1] >> ((col & 1) << 2)) & 0xF];
+        }
+    }
+}
+
+// builds the opaque runs of every keyed sprite, run once before anything is drawn
+void prepareSprites() {
+    for (int id = 0; id < SPRITE_COUNT; id++) {
+        sprite *s = &sprites[id];
+        if (s->colorKey == NO_COLOR_KEY || s->spans != NULL) {
+            continue;
+        }
+        int firstSpan = spanPoolUsed;
+        int firstRow = rowSpanPoolUsed;
+        bool fits = s->height <= SPRITE_MAX_ROWS && rowSpanPoolUsed + s->height + 1 <= ROW_SPAN_POOL;
+        for (int row = 0; row < s->height && fits; row++) {
+            rowSpanPool[rowSpanPoolUsed++] = spanPoolUsed - firstSpan;
+            const uint8_t *texels = s->texels + row * s->pitch;
+            int col = 0;
+            while (col < s->width) {
+                if (spriteTexel(s, texels, col) == s->colorKey) {
+                    col++;
+                    continue;
+                }
+                int start = col;
+                while (col < s->width && spriteTexel(s, texels, col) != s->colorKey) {
+                    col++;
+                }
+                if (spanPoolUsed == SPRITE_SPAN_POOL) {
+                    fits = false;
+                    break;
+                }
+                spanPool[spanPoolUsed].start = start;
+                spanPool[spanPoolUsed].length = col - start;
+                spanPoolUsed++;
+            }
+        }
+        if (!fits) {
+            // out of pool space, blitSprite() falls back to testing each texel
+            spanPoolUsed = firstSpan;
+            rowSpanPoolUsed = firstRow;
+            continue;
+        }
+        rowSpanPool[rowSpanPoolUsed++] = spanPoolUsed - firstSpan;
+        s->spans = &spanPool[firstSpan];
+        s->rowSpans = &rowSpanPool[firstRow];
+    }
+}
+
+void blitSprite(const sprite *s, int x, int y) {
+    for (int row = 0; row < s->height; row++) {
+        uint16_t *dest = (uint16_t *)(pixel_buffer_start + ((y + row) << 10) + (x << 1));
+        const uint8_t *texels = s->texels + row * s->pitch;
+        if (s->colorKey == NO_COLOR_KEY) {
+            expandTexels(s, texels, 0, s->width, dest);
+            pixelsTouched += s->width;
+        } else if (s->spans != NULL) {
+            for (int span = s->rowSpans[row]; span < s->rowSpans[row + 1]; span++) {
+                expandTexels(s, texels, s->spans[span].start, s->spans[span].length, dest + s->spans[span].start);
+                pixelsTouched += s->spans[span].length;
+            }
+        } else {
+            for (int col = 0; col < s->width; col++) {
+                if (spriteTexel(s, texels, col) != s->colorKey) {
+                    expandTexels(s, texels, col, 1, dest + col);
+                    pixelsTouched++;
+                }
+            }
+        }
+    }
+}
+
+void drawSprite(int id, int x, int y) {
+    blitSprite(&sprites[id], x, y);
+}
+
+#define SPRITE_TURNS 0x3   // quarter turns clockwise
+#define SPRITE_FLIP_X 0x4  // mirrored left to right after turning
+#define SPRITE_FLIP_Y 0x8  // mirrored top to bottom after turning
+
+// draws s turned and flipped by walking its texels in a different order, one texel at a time
+void blitSpriteTransformed(const sprite *s, int x, int y, int transform) {
+    if (transform == 0) {
+        blitSprite(s, x, y);
+        return;
+    }
+    int turns = transform & SPRITE_TURNS;
+    int outWidth = (turns & 1) ? s->height : s->width;
+    int outHeight = (turns & 1) ? s->width : s->height;
+
+    // source texel of the top left output texel, and how the source moves per output column and row
+    int startX = 0;
+    int startY = 0;
+    int colDx = 1;
+    int colDy = 0;
+    int rowDx = 0;
+    int rowDy = 1;
+    if (turns == 1) {
+        startY = s->height - 1;
+        colDx = 0;
+        colDy = -1;
+        rowDx = 1;
+        rowDy = 0;
+    } else if (turns == 2) {
+        startX = s->width - 1;
+        startY = s->height - 1;
+        colDx = -1;
+        rowDy = -1;
+    } else if (turns == 3) {
+        startX = s->width - 1;
+        colDx = 0;
+        colDy = 1;
+        rowDx = -1;
+        rowDy = 0;
+    }
+    if (transform & SPRITE_FLIP_X) {
+        startX += colDx * (outWidth - 1);
+        startY += colDy * (outWidth - 1);
+        colDx = -colDx;
+        colDy = -colDy;
+    }
+    if (transform & SPRITE_FLIP_Y) {
+        startX += rowDx * (outHeight - 1);
+        startY += rowDy * (outHeight - 1);
+        rowDx = -rowDx;
+        rowDy = -rowDy;
+    }
+
+    for (int row = 0; row < outHeight; row++) {
+        uint16_t *dest = (uint16_t *)(pixel_buffer_start + ((y + row) << 10) + (x << 1));
+        int sourceX = startX + row * rowDx;
+        int sourceY = startY + row * rowDy;
+        for (int col = 0; col < outWidth; col++) {
+            int texel = spriteTexel(s, s->texels + sourceY * s->pitch, sourceX);
+            if (texel != s->colorKey) {
+                dest[col] = s->bitsPerTexel == 16 ? texel : s->palette[texel];
+                pixelsTouched++;
+            }
+            sourceX += colDx;
+            sourceY += colDy;
+        }
+    }
+}
+
+void drawSpriteTransformed(int id, int x, int y, int transform) {
+    blitSpriteTransformed(&sprites[id], x, y, transform);
+}
+
+/* Background layer
+ * The walls and splitters never change during a match, so they are drawn
+ * once into backgroundLayer when a map is selected. Each frame only copies
+ * back the areas that moving objects covered.
+ */
+uint16_t backgroundLayer[RESOLUTION_Y << 9];  // same 512 pixel row pitch as the pixel buffers
+int backgroundMap = -1;                        // map held by backgroundLayer, -1 for none
+
+// copies [x0, x1) x [y0, y1) of the background layer into the back buffer
+void restoreBackground(int x0, int y0, int x1, int y1) {
+    if (x0 < 0) {
+        x0 = 0;
+    }
+    if (y0 < 0) {
+        y0 = 0;
+    }
+    if (x1 > RESOLUTION_X) {
+        x1 = RESOLUTION_X;
+    }
+    if (y1 > RESOLUTION_Y) {
+        y1 = RESOLUTION_Y;
+    }
+    if (x0 >= x1 || y0 >= y1) {
+        return;
+    }
+    pixelsTouched += (x1 - x0) * (y1 - y0);
+    for (int y = y0; y < y1; y++) {
+        memcpy((uint16_t *)(pixel_buffer_start + (y << 10)) + x0, &backgroundLayer[(y << 9) + x0], (x1 - x0) << 1);
+    }
+}
+
+/* Dirty rectangles
+ * Every moving object records the area it drew in the dirty list of the
+ * buffer it drew into. The next time that buffer becomes the back buffer,
+ * two frames later, restoreDirtyRects() copies the background back over
+ * exactly those areas. Overlapping or touching rectangles are merged.
+ */
+#define MAX_DIRTY_RECTS 64
+
+typedef struct rect {
+    int x0;
+    int y0;
+    int x1;  // exclusive
+    int y1;  // exclusive
+} rect;
+
+typedef struct dirtyList {
+    rect rects[MAX_DIRTY_RECTS];
+    int count;
+} dirtyList;
+
+dirtyList dirtyRects[SWAP_CHAIN_LENGTH];  // one list per pixel buffer
+
+int backBufferIndex() {
+    for (int buffer = 1; buffer < SWAP_CHAIN_LENGTH; buffer++) {
+        if (pixel_buffer_start == pixelBufferAddress(buffer)) {
+            return buffer;
+        }
+    }
+    return 0;
+}
+
+dirtyList *backBufferDirtyList() {
+    return &dirtyRects[backBufferIndex()];
+}
+
+void markDirty(int x0, int y0, int x1, int y1) {
+    if (x0 < 0) {
+        x0 = 0;
+    }
+    if (y0 < 0) {
+        y0 = 0;
+    }
+    if (x1 > RESOLUTION_X) {
+        x1 = RESOLUTION_X;
+    }
+    if (y1 > RESOLUTION_Y) {
+        y1 = RESOLUTION_Y;
+    }
+    if (x0 >= x1 || y0 >= y1) {
+        return;
+    }
+
+    dirtyList *list = backBufferDirtyList();
+    int rectIte = 0;
+    while (rectIte < list->count) {
+        rect *r = &list->rects[rectIte];
+        if (r->x0 <= x1 && x0 <= r->x1 && r->y0 <= y1 && y0 <= r->y1) {
+            // absorb it and start over, the bigger rectangle may now reach earlier ones
+            x0 = r->x0 < x0 ? r->x0 : x0;
+            y0 = r->y0 < y0 ? r->y0 : y0;
+            x1 = r->x1 > x1 ? r->x1 : x1;
+            y1 = r->y1 > y1 ? r->y1 : y1;
+            list->rects[rectIte] = list->rects[--list->count];
+            rectIte = 0;
+            continue;
+        }
+        rectIte++;
+    }
+
+    if (list->count == MAX_DIRTY_RECTS) {
+        // list is full, fold the new area into the last entry
+        rect *last = &list->rects[list->count - 1];
+        last->x0 = last->x0 < x0 ? last->x0 : x0;
+        last->y0 = last->y0 < y0 ? last->y0 : y0;
+        last->x1 = last->x1 > x1 ? last->x1 : x1;
+        last->y1 = last->y1 > y1 ? last->y1 : y1;
+        return;
+    }
+    list->rects[list->count].x0 = x0;
+    list->rects[list->count].y0 = y0;
+    list->rects[list->count].x1 = x1;
+    list->rects[list->count].y1 = y1;
+    list->count++;
+}
+
+// puts the background back wherever this buffer was drawn on last time
+void restoreDirtyRects() {
+    dirtyList *list = backBufferDirtyList();
+    for (int rectIte = 0; rectIte < list->count; rectIte++) {
+        rect *r = &list->rects[rectIte];
+        restoreBackground(r->x0, r->y0, r->x1, r->y1);
+    }
+    list->count = 0;
+}
+
+void textOnHex() {
+    if (p1Victory) {
+        writeHexDisplays(0b0111110001111100011111100110111, 0b0111001100000110);
+    } else {
+        writeHexDisplays(0b0111110001111100011111100110111, 0b0111001101011011);
+    }
+}
+
+void drawLowerSmallTank() {
+    int heartLowY = 9 * tileHeight + (tileHeight - tankHeight) / 2;
+    int heartLowX1 = 13 * tileWidth - tankWidth / 2;
+    int heartLowX2 = 14 * tileWidth - tankWidth / 2;
+    int heartLowX3 = 15 * tileWidth - tankWidth / 2;
+    drawSprite(SPRITE_HEART, heartLowX1, heartLowY);
+    drawSprite(SPRITE_HEART, heartLowX2, heartLowY);
+    drawSprite(SPRITE_HEART, heartLowX3, heartLowY);
+}
+
+void drawUpperSmallTank() {
+    int heartUpY = tileHeight + (tileHeight - tankHeight)/2;
+    int heartUpX1 = 13 * tileWidth - tankWidth / 2;
+    int heartUpX2 = 14 * tileWidth - tankWidth / 2;
+    int heartUpX3 = 15 * tileWidth - tankWidth / 2;
+    drawSprite(SPRITE_HEART, heartUpX1, heartUpY);
+    drawSprite(SPRITE_HEART, heartUpX2, heartUpY);
+    drawSprite(SPRITE_HEART, heartUpX3, heartUpY);
+}
+
+void drawStartScreen() {
+    // main window
+    //pause key
+    int pauseX = 10 * tileWidth;
+    drawSprite(SPRITE_PAUSE, pauseX, 0);
+    // game title
+    int titlePosition = 2 * tileWidth;
+    drawSprite(SPRITE_GAME_TITLE, titlePosition, titlePosition);
+    // drawBox(2 * tileWidth, 2 * tileHeight, 10 * tileWidth, 5 * tileHeight, WHITE, false);
+
+    //press to start
+    int presstostartX= 2 * tileWidth;
+    int presstostartY= 6 * tileWidth;
+#ifdef TEXT_HUD
+    drawText(presstostartX / TEXT_CELL, presstostartY / TEXT_CELL + 1, "PRESS KEY0 TO START!");
+#else
+    drawSprite(SPRITE_PRESS_KEY_TO_START, presstostartX, presstostartY);
+#endif
+    
+    //map selection
+    int switch00x = 8 * tileHeight;
+    int switch01x = 2 * tileHeight;
+    int switch0y = 8 * tileHeight - 15;
+    int mapy = 8 * tileHeight;
+    
+#ifdef TEXT_HUD
+    drawText(switch00x / TEXT_CELL, switch0y / TEXT_CELL + 1, "SW0: 0");
+    drawText(switch01x / TEXT_CELL, switch0y / TEXT_CELL + 1, "SW0: 1");
+#else
+    drawSprite(SPRITE_SWITCH00, switch00x, switch0y);
+    drawSprite(SPRITE_SWITCH01, switch01x, switch0y);
+#endif
+    drawSprite(SPRITE_MAP1, switch00x, mapy);
+    drawSprite(SPRITE_MAP2, switch01x, mapy);
+
+
+    // splitter
+    draw_line(12 * tileWidth, 0, 12 * tileWidth, RESOLUTION_Y - 1, ORANGE);
+
+    // status pane
+    draw_line(12 * tileWidth, 4 * tileHeight, 16 * tileWidth, 4 * tileHeight, ORANGE);
+    draw_line(12 * tileWidth, 6 * tileHeight, 16 * tileWidth, 6 * tileHeight, ORANGE);
+    draw_line(12 * tileWidth, 8 * tileHeight, 16 * tileWidth, 8 * tileHeight, ORANGE);
+    
+    // player1
+    int player1X = 12 * tileWidth + 1;
+#ifdef TEXT_HUD
+    drawText(player1X / TEXT_CELL + 1, 1, "PLAYER 1");
+#else
+    drawSprite(SPRITE_PLAYER1, player1X, 1);
+#endif
+    
+    // upper small tanks(hearts)
+    drawUpperSmallTank();
+
+    // upper big Purple tank
+    int bigPurpleX = 13 * tileHeight;
+    int bigPurpleY = 2 * tileHeight;
+    drawSprite(SPRITE_BIG_PURPLE_TANK_UP, bigPurpleX, bigPurpleY);
+    
+    // player1
+    int player2X = 12 * tileWidth + 1;
+    int player2Y = 8 * tileHeight + 1;
+#ifdef TEXT_HUD
+    drawText(player2X / TEXT_CELL + 1, player2Y / TEXT_CELL + 1, "PLAYER 2");
+#else
+    drawSprite(SPRITE_PLAYER2, player2X, player2Y);
+#endif
+    
+    // lower small tanks(hearts)
+    drawLowerSmallTank();
+
+    // lower big tank
+    int bigBrownX = 13 * tileHeight;
+    int bigBrownY = 10 * tileHeight;
+    drawSprite(SPRITE_BIG_BROWN_TANK_UP, bigBrownX, bigBrownY);
+}
+
+bool withInBox(coord pos, coord boxStart, int boxWidth, int boxHeight) {
+    if ((pos.x >= boxStart.x && pos.x <= (boxStart.x + boxWidth)) && (pos.y >= boxStart.y && pos.y <= boxStart.y + boxHeight)) {
+        return true;
+    }
+    return false;
+}
+
+/* Wall grid
+ * Walls always sit on the 20 pixel tile grid of the 12 x 12 play area, so
+ * loadGameMap() also marks them in wallGrid. Collision checks then look at
+ * the few tiles an object overlaps instead of scanning every wall.
+ */
+#define GRID_WIDTH 12
+#define GRID_HEIGHT 12
+
+uint8_t wallGrid[GRID_HEIGHT][GRID_WIDTH];
+
+// tile index of a coordinate, rounding down for negative ones too
+int tileIndex(int value, int tileSize) {
+    return value >= 0 ? value / tileSize : -((tileSize - 1 - value) / tileSize);
+}
+
+bool isWall(int col, int row) {
+    if (col < 0 || col >= GRID_WIDTH || row < 0 || row >= GRID_HEIGHT) {
+        return false;
+    }
+    return wallGrid[row][col];
+}
+
+/* Tile maps
+ * A map is a 12 x 12 grid of tiles written one row per string, '#' for a
+ * brick wall and '.' for open floor. loadGameMap() turns the selected map into
+ * wallGrid and the background layer, so adding a map only means adding an
+ * entry to gameMaps. The tank start tiles in the top left and bottom right
+ * corners must stay open.
+ * SW0 to SW5 select the map and values past the last map wrap around, so SW0
+ * on its own still picks between the two original maps.
+ */
+#define MAP_SWITCHES 0b111111
+#define WALL_TILE '#'
+
+typedef struct tileMap {
+    const char *name;
+    char tiles[GRID_HEIGHT][GRID_WIDTH + 1];
+} tileMap;
+
+const tileMap gameMaps[] = {
+    {"maze",
+     {"............",
+      ".####.#.####",
+      ".#..........",
+      ".#.#######..",
+      ".#.......#..",
+      ".#.#..#..#..",
+      ".#.#.....#..",
+      ".#.###.####.",
+      ".#..........",
+      ".###......#.",
+      ".....##.###.",
+      "............"}},
+    {"scatter",
+     {"........##..",
+      ".####.#.....",
+      ".#........#.",
+      ".#..###...#.",
+      ".#.###...###",
+      "...##.......",
+      ".#.....##...",
+      ".....#.##.#.",
+      "#..#.#......",
+      "#.##......#.",
+      ".....##.###.",
+      ".##...#....."}},
+    {"pillars",
+     {"............",
+      "............",
+      "..##....##..",
+      "..##....##..",
+      "............",
+      ".....##.....",
+      ".....##.....",
+      "............",
+      "..##....##..",
+      "..##....##..",
+      "............",
+      "............"}},
+    {"cross",
+     {"............",
+      ".....##.....",
+      ".....##.....",
+      ".....##.....",
+      "............",
+      ".###....###.",
+      ".###....###.",
+      "............",
+      ".....##.....",
+      ".....##.....",
+      ".....##.....",
+      "............"}},
+    {"corridors",
+     {"............",
+      ".##########.",
+      "............",
+      ".#.######.#.",
+      ".#........#.",
+      ".#.##..##.#.",
+      ".#.##..##.#.",
+      ".#........#.",
+      ".#.######.#.",
+      "............",
+      ".##########.",
+      "............"}},
+    {"checker",
+     {"............",
+      ".#.#.#.#.#..",
+      "............",
+      "..#.#.#.#.#.",
+      "............",
+      ".#.#.#.#.#..",
+      "............",
+      "..#.#.#.#.#.",
+      "............",
+      ".#.#.#.#.#..",
+      "............",
+      "............"}},
+    {"zigzag",
+     {"............",
+      "#######.....",
+      "............",
+      ".....#######",
+      "............",
+      "#######.....",
+      "............",
+      ".....#######",
+      "............",
+      "#######.....",
+      "............",
+      "............"}},
+    {"bunkers",
+     {"............",
+      ".###....###.",
+      ".#........#.",
+      ".#..#..#..#.",
+      "....#..#....",
+      "..###..###..",
+      "..###..###..",
+      "....#..#....",
+      ".#..#..#..#.",
+      ".#........#.",
+      ".###....###.",
+      "............"}},
+};
+
+#define MAP_COUNT (int)(sizeof(gameMaps) / sizeof(gameMaps[0]))
+
+int mapFromSwitches(int switches) {
+    return (switches & MAP_SWITCHES) % MAP_COUNT;
+}
+
+void buildWallGrid(const tileMap *map) {
+    for (int row = 0; row < GRID_HEIGHT; row++) {
+        for (int col = 0; col < GRID_WIDTH; col++) {
+            wallGrid[row][col] = map->tiles[row][col] == WALL_TILE;
+        }
+    }
+}
+
+/* Distance fields
+ * Bots find their way with tables built from wallGrid the first time a map
+ * is loaded and kept for every later match on it. steps[goal][tile] is the
+ * length of the shortest path from tile to goal in moves between edge
+ * adjacent open tiles, found by a breadth first search out of every goal, so
+ * a bot heads for its goal by stepping to the neighbour with the fewest
+ * steps left. aim[from][to] is the direction (an index into aimDirections)
+ * a bullet fired from tile from flies along to reach tile to without
+ * passing a wall, or -1 when to is not on one of the eight lines out of
+ * from. Tiles are numbered row * GRID_WIDTH + col.
+ */
+#define GRID_TILES (GRID_WIDTH * GRID_HEIGHT)
+#define UNREACHABLE 255
+
+typedef struct distanceField {
+    bool built;
+    uint8_t steps[GRID_TILES][GRID_TILES];
+    int8_t aim[GRID_TILES][GRID_TILES];
+} distanceField;
+
+const coord aimDirections[8] = {{1, 0}, {1, 1}, {0, 1}, {-1, 1}, {-1, 0}, {-1, -1}, {0, -1}, {1, -1}};
+
+distanceField distanceFields[MAP_COUNT];
+const distanceField *mapField = &distanceFields[0];  // field of the map in wallGrid
+
+void buildSteps(distanceField *field, int goal) {
+    uint8_t *steps = field->steps[goal];
+    memset(steps, UNREACHABLE, GRID_TILES);
+    if (isWall(goal % GRID_WIDTH, goal / GRID_WIDTH)) {
+        return;
+    }
+    int queue[GRID_TILES];
+    int head = 0;
+    int tail = 0;
+    steps[goal] = 0;
+    queue[tail++] = goal;
+    while (head < tail) {
+        int tile = queue[head++];
+        int col = tile % GRID_WIDTH;
+        int row = tile / GRID_WIDTH;
+        for (int direction = 0; direction < 8; direction += 2) {
+            int nextCol = col + aimDirections[direction].x;
+            int nextRow = row + aimDirections[direction].y;
+            int next = nextRow * GRID_WIDTH + nextCol;
+            if (nextCol < 0 || nextCol >= GRID_WIDTH || nextRow < 0 || nextRow >= GRID_HEIGHT ||
+                isWall(nextCol, nextRow) || steps[next] != UNREACHABLE) {
+                continue;
+            }
+            steps[next] = steps[tile] + 1;
+            queue[tail++] = next;
+        }
+    }
+}
+
+// a diagonal line also needs both tiles beside each step open, a bullet clips their corners
+void buildAim(distanceField *field, int from) {
+    int8_t *aim = field->aim[from];
+    memset(aim, -1, GRID_TILES);
+    int col = from % GRID_WIDTH;
+    int row = from / GRID_WIDTH;
+    if (isWall(col, row)) {
+        return;
+    }
+    for (int direction = 0; direction < 8; direction++) {
+        int dx = aimDirections[direction].x;
+        int dy = aimDirections[direction].y;
+        int lineCol = col + dx;
+        int lineRow = row + dy;
+        while (lineCol >= 0 && lineCol < GRID_WIDTH && lineRow >= 0 && lineRow < GRID_HEIGHT &&
+               !isWall(lineCol, lineRow) && !isWall(lineCol - dx, lineRow) && !isWall(lineCol, lineRow - dy)) {
+            aim[lineRow * GRID_WIDTH + lineCol] = direction;
+            lineCol += dx;
+            lineRow += dy;
+        }
+    }
+}
+
+// call with the map in wallGrid, a map that has been loaded before keeps its field
+void loadDistanceField(int map) {
+    distanceField *field = &distanceFields[map];
+    if (!field->built) {
+        for (int tile = 0; tile < GRID_TILES; tile++) {
+            buildSteps(field, tile);
+            buildAim(field, tile);
+        }
+        field->built = true;
+    }
+    mapField = field;
+}
+
+// stops the tank from driving into a wall it is touching
+void handleWallCollision(const tankStore *tanks, int tank, bool *moveInX, bool *moveInY) {
+    coord corner1 = {tanks->x[tank], tanks->y[tank]};
+    coord corner2 = corner1;
+    coord corner3 = corner1;
+    coord corner4 = corner1;
+
+    corner2.x += tankWidth;
+    corner3.y += tankHeight;
+    corner4.x += tankWidth;
+    corner4.y += tankHeight;
+    for (int row = tileIndex(corner1.y - 1, tileHeight); row <= tileIndex(corner3.y, tileHeight); row++) {
+        for (int col = tileIndex(corner1.x - 1, tileWidth); col <= tileIndex(corner2.x, tileWidth); col++) {
+            if (!isWall(col, row)) {
+                continue;
+            }
+            coord wall;
+            wall.x = col * tileWidth;
+            wall.y = row * tileHeight;
+            if (withInBox(corner1, wall, tileWidth, tileHeight) ||
+                withInBox(corner2, wall, tileWidth, tileHeight) ||
+                withInBox(corner3, wall, tileWidth, tileHeight) ||
+                withInBox(corner4, wall, tileWidth, tileHeight)) {
+                if (corner1.y == wall.y + tileHeight) {
+                    if (corner1.x < (wall.x + tileWidth) && corner2.x > wall.x) {
+                        if (tanks->yDir[tank] == -1) {
+                            *moveInY = false;
+                        }
+                    }
+                } else if (corner3.y == wall.y) {
+                    if (corner1.x < (wall.x + tileWidth) && corner2.x > wall.x) {
+                        if (tanks->yDir[tank] == 1) {
+                            *moveInY = false;
+                        }
+                    }
+                } else if (corner1.x == wall.x + tileWidth) {
+                    if (corner1.y < wall.y + tileHeight && corner3.y > wall.y) {
+                        if (tanks->xDir[tank] == -1) {
+                            *moveInX = false;
+                        }
+                    }
+                } else if (corner2.x == wall.x) {
+                    if (corner1.y < wall.y + tileHeight && corner3.y > wall.y) {
+                        if (tanks->xDir[tank] == 1) {
+                            *moveInX = false;
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+/* Swept bullet collision
+ * A bullet travels from position to position + direction every frame. The
+ * whole segment is tested, so a bullet can not skip over a tank corner or
+ * the edge of a wall however fast it moves. Points on the segment are
+ * p + t * d with t in fixed point, SWEEP_ONE standing for the full step.
+ * Boxes are closed like in withInBox().
+ */
+#define SWEEP_ONE 65536
+#define SWEEP_MISS 0x7FFFFFFF
+
+enum { HIT_NOTHING, HIT_BOUNDARY, HIT_TANK, HIT_WALL };
+
+// narrows [*tEnter, *tExit] to the part of the segment whose coordinate on this axis is within [low, high]
+bool sweepAxis(int start, int delta, int low, int high, int *tEnter, int *tExit) {
+    if (delta == 0) {
+        return start >= low && start <= high;
+    }
+    int t0 = (low - start) * SWEEP_ONE / delta;
+    int t1 = (high - start) * SWEEP_ONE / delta;
+    if (t0 > t1) {
+        swap(&t0, &t1);
+    }
+    if (t0 > *tEnter) {
+        *tEnter = t0;
+    }
+    if (t1 < *tExit) {
+        *tExit = t1;
+    }
+    return *tEnter <= *tExit;
+}
+
+// first t at which the segment is inside [x0, x1] x [y0, y1], SWEEP_MISS if never
+int sweepBox(coord start, coord delta, int x0, int y0, int x1, int y1) {
+    int tEnter = 0;
+    int tExit = SWEEP_ONE;
+    if (!sweepAxis(start.x, delta.x, x0, x1, &tEnter, &tExit) || !sweepAxis(start.y, delta.y, y0, y1, &tEnter, &tExit)) {
+        return SWEEP_MISS;
+    }
+    return tEnter;
+}
+
+// first t at which the segment leaves the open play area (0, 240) x (2, 240)
+int sweepBoundary(coord start, coord delta) {
+    int tLeave = SWEEP_MISS;
+    int lows[2] = {0, 2};
+    int highs[2] = {12 * tileWidth, 12 * tileHeight};
+    int starts[2] = {start.x, start.y};
+    int deltas[2] = {delta.x, delta.y};
+    for (int axis = 0; axis < 2; axis++) {
+        int t = SWEEP_MISS;
+        if (starts[axis] <= lows[axis] || starts[axis] >= highs[axis]) {
+            t = 0;
+        } else if (deltas[axis] < 0) {
+            t = (lows[axis] - starts[axis]) * SWEEP_ONE / deltas[axis];
+        } else if (deltas[axis] > 0) {
+            t = (highs[axis] - starts[axis]) * SWEEP_ONE / deltas[axis];
+        }
+        if (t <= SWEEP_ONE && t < tLeave) {
+            tLeave = t;
+        }
+    }
+    return tLeave;
+}
+
+// closed tile boxes share their borders, so a point in tile (col, row) may also touch the tiles left of and above it
+int sweepWallTile(coord start, coord delta, int col, int row) {
+    int tHit = SWEEP_MISS;
+    for (int dRow = -1; dRow <= 0; dRow++) {
+        for (int dCol = -1; dCol <= 0; dCol++) {
+            if (!isWall(col + dCol, row + dRow)) {
+                continue;
+            }
+            int x0 = (col + dCol) * tileWidth;
+            int y0 = (row + dRow) * tileHeight;
+            int t = sweepBox(start, delta, x0, y0, x0 + tileWidth, y0 + tileHeight);
+            if (t < tHit) {
+                tHit = t;
+            }
+        }
+    }
+    return tHit;
+}
+
+// first t at which the segment touches a wall, walking the tiles it crosses in order (grid DDA)
+int sweepWalls(coord start, coord delta) {
+    int col = tileIndex(start.x, tileWidth);
+    int row = tileIndex(start.y, tileHeight);
+    int endCol = tileIndex(start.x + delta.x, tileWidth);
+    int endRow = tileIndex(start.y + delta.y, tileHeight);
+    int stepX = delta.x > 0 ? 1 : -1;
+    int stepY = delta.y > 0 ? 1 : -1;
+
+    int tHit = SWEEP_MISS;
+    int tTile = 0;  // t at which the segment entered the current tile
+    while (tTile <= tHit) {
+        int t = sweepWallTile(start, delta, col, row);
+        if (t < tHit) {
+            tHit = t;
+        }
+        if (col == endCol && row == endRow) {
+            break;
+        }
+        // t of the next vertical and horizontal tile border, worked out afresh so a corner gives two equal ones
+        int tNextX = delta.x == 0 ? SWEEP_MISS : ((col + (stepX > 0)) * tileWidth - start.x) * SWEEP_ONE / delta.x;
+        int tNextY = delta.y == 0 ? SWEEP_MISS : ((row + (stepY > 0)) * tileHeight - start.y) * SWEEP_ONE / delta.y;
+        if (tNextX == tNextY && tNextX <= tHit) {
+            // through a tile corner, where the tile right of and below it, which the walk steps around, is touched too
+            t = sweepWallTile(start, delta, col + (stepX > 0), row + (stepY > 0));
+            if (t < tHit) {
+                tHit = t;
+            }
+        }
+        if (tNextX <= tNextY) {
+            tTile = tNextX;
+            col += stepX;
+        } else {
+            tTile = tNextY;
+            row += stepY;
+        }
+        if (tTile > SWEEP_ONE) {
+            break;
+        }
+    }
+    return tHit;
+}
+
+// reports the first thing a bullet of team runs into during its next step, earlier hits win and ties go boundary,
+// tank, wall; a tank hit leaves the tank in hitTank, the lowest index of those hit first
+int sweepBullet(coord position, coord direction, const tankStore *tanks, int team, int *hitTank) {
+    int tBoundary = sweepBoundary(position, direction);
+    int tTank = SWEEP_MISS;
+    for (int tank = 0; tank < tanks->count; tank++) {
+        if (tanks->team[tank] == team || !tankAlive(tanks, tank)) {
+            continue;
+        }
+        int t = sweepBox(position, direction, tanks->x[tank], tanks->y[tank], tanks->x[tank] + tankWidth,
+                         tanks->y[tank] + tankHeight);
+        if (t < tTank) {
+            tTank = t;
+            *hitTank = tank;
+        }
+    }
+    int tWall = sweepWalls(position, direction);
+
+    if (tBoundary == SWEEP_MISS && tTank == SWEEP_MISS && tWall == SWEEP_MISS) {
+        return HIT_NOTHING;
+    }
+    if (tBoundary <= tTank && tBoundary <= tWall) {
+        return HIT_BOUNDARY;
+    }
+    if (tTank <= tWall) {
+        return HIT_TANK;
+    }
+    return HIT_WALL;
+}
+
+/* Bullet kernels
+ * Most bullets are in open space and can not hit anything during a step. A
+ * broad phase finds them by testing the box around each step against the
+ * play area edges, the tank the bullet can hit and the walls; only the rest
+ * go through sweepBullet(). The edge and tank tests and the move run over
+ * BULLET_LANES bullets at a time with GCC vector types, which become NEON on
+ * the A9 (-mfpu=neon) and SSE on x86. The plain loops are the fallback on
+ * targets without either, -DNO_BULLET_SIMD forces them.
+ */
+#if (defined(__ARM_NEON) || defined(__SSE2__)) && !defined(NO_BULLET_SIMD)
+#define BULLET_SIMD true
+#else
+#define BULLET_SIMD false
+#endif
+
+typedef int16_t bulletLane __attribute__((vector_size(BULLET_LANES * sizeof(int16_t))));
+
+bulletLane loadLane(const int16_t *source) {
+    bulletLane lane;
+    memcpy(&lane, source, sizeof(lane));
+    return lane;
+}
+
+void storeLane(int16_t *destination, bulletLane lane) {
+    memcpy(destination, &lane, sizeof(lane));
+}
+
+bulletLane splatLane(int16_t value) {
+    bulletLane lane = {0};
+    return lane + value;
+}
+
+// lanes of mask are all ones or all zeros, C has no ?: for vectors
+bulletLane selectLane(bulletLane mask, bulletLane ifSet, bulletLane ifClear) {
+    return (ifSet & mask) | (ifClear & ~mask);
+}
+
+// sets flags[i] to -1 for every bullet whose step touches the play area edge or the box of a tank it can hit
+void flagBulletsScalar(const bulletPool *bullets, const tankStore *tanks, int16_t flags[]) {
+    for (int bulletIte = 0; bulletIte < bullets->count; bulletIte++) {
+        int x = bullets->x[bulletIte];
+        int y = bullets->y[bulletIte];
+        int endX = x + bullets->dx[bulletIte];
+        int endY = y + bullets->dy[bulletIte];
+        int x0 = x < endX ? x : endX;
+        int x1 = x < endX ? endX : x;
+        int y0 = y < endY ? y : endY;
+        int y1 = y < endY ? endY : y;
+        bool hit = x0 <= 0 || x1 >= 12 * tileWidth || y0 <= 2 || y1 >= 12 * tileHeight;
+        for (int tank = 0; tank < tanks->count && !hit; tank++) {
+            hit = tanks->team[tank] != bullets->team[bulletIte] && tankAlive(tanks, tank) &&
+                  x1 >= tanks->x[tank] && x0 <= tanks->x[tank] + tankWidth &&
+                  y1 >= tanks->y[tank] && y0 <= tanks->y[tank] + tankHeight;
+        }
+        flags[bulletIte] = hit ? -1 : 0;
+    }
+}
+
+// the lanes hold bullets and each live tank is splatted across them in turn
+void flagBulletsVector(const bulletPool *bullets, const tankStore *tanks, int16_t flags[]) {
+    bulletLane zero = {0};
+    bulletLane edgeHighX = splatLane(12 * tileWidth);
+    bulletLane edgeLowY = splatLane(2);
+    bulletLane edgeHighY = splatLane(12 * tileHeight);
+    bulletLane tankW = splatLane(tankWidth);
+    bulletLane tankH = splatLane(tankHeight);
+    for (int first = 0; first < bullets->count; first += BULLET_LANES) {
+        bulletLane x = loadLane(&bullets->x[first]);
+        bulletLane y = loadLane(&bullets->y[first]);
+        bulletLane endX = x + loadLane(&bullets->dx[first]);
+        bulletLane endY = y + loadLane(&bullets->dy[first]);
+        bulletLane x0 = selectLane(x < endX, x, endX);
+        bulletLane x1 = selectLane(x < endX, endX, x);
+        bulletLane y0 = selectLane(y < endY, y, endY);
+        bulletLane y1 = selectLane(y < endY, endY, y);
+        bulletLane team = loadLane(&bullets->team[first]);
+
+        bulletLane hit = (x0 <= zero) | (x1 >= edgeHighX) | (y0 <= edgeLowY) | (y1 >= edgeHighY);
+        for (int tank = 0; tank < tanks->count; tank++) {
+            if (!tankAlive(tanks, tank)) {
+                continue;
+            }
+            bulletLane tankX = splatLane(tanks->x[tank]);
+            bulletLane tankY = splatLane(tanks->y[tank]);
+            hit |= (team != splatLane(tanks->team[tank])) & (x1 >= tankX) & (x0 <= tankX + tankW) & (y1 >= tankY) &
+                   (y0 <= tankY + tankH);
+        }
+        storeLane(&flags[first], hit);
+    }
+}
+
+// true if a wall tile touches the box around the bullet's step, see sweepWallTile() for the tile range
+bool bulletNearWall(const bulletPool *bullets, int index) {
+    int x = bullets->x[index];
+    int y = bullets->y[index];
+    int endX = x + bullets->dx[index];
+    int endY = y + bullets->dy[index];
+    int col0 = tileIndex((x < endX ? x : endX) - 1, tileWidth);
+    int col1 = tileIndex(x < endX ? endX : x, tileWidth);
+    int row0 = tileIndex((y < endY ? y : endY) - 1, tileHeight);
+    int row1 = tileIndex(y < endY ? endY : y, tileHeight);
+    for (int row = row0; row <= row1; row++) {
+        for (int col = col0; col <= col1; col++) {
+            if (isWall(col, row)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// moves every bullet whose flag is clear by one step
+void advanceBulletsScalar(bulletPool *bullets, const int16_t flags[]) {
+    for (int bulletIte = 0; bulletIte < bullets->count; bulletIte++) {
+        if (!flags[bulletIte]) {
+            bullets->x[bulletIte] += bullets->dx[bulletIte];
+            bullets->y[bulletIte] += bullets->dy[bulletIte];
+        }
+    }
+}
+
+void advanceBulletsVector(bulletPool *bullets, const int16_t flags[]) {
+    for (int first = 0; first < bullets->count; first += BULLET_LANES) {
+        bulletLane keep = loadLane(&flags[first]);
+        bulletLane x = loadLane(&bullets->x[first]);
+        bulletLane y = loadLane(&bullets->y[first]);
+        storeLane(&bullets->x[first], x + (loadLane(&bullets->dx[first]) & ~keep));
+        storeLane(&bullets->y[first], y + (loadLane(&bullets->dy[first]) & ~keep));
+    }
+}
+
+// the split loop leaves the LEDs to the drawing side, the last hit travels with the next snapshot
+#ifdef SPLIT_LOOP
+int pendingLeds = -1;
+#define writeHitLeds(value) (pendingLeds = (value))
+#else
+#define writeHitLeds(value) writeLeds(value)
+#endif
+
+// moves every bullet one step, removing those that hit the boundary, a wall or a tank
+void updateBullets(bulletPool *bullets, tankStore *tanks, bool vector) {
+    int16_t flags[BULLET_ARRAY_SIZE];
+    if (vector) {
+        flagBulletsVector(bullets, tanks, flags);
+    } else {
+        flagBulletsScalar(bullets, tanks, flags);
+    }
+    for (int bulletIte = 0; bulletIte < bullets->count; bulletIte++) {
+        if (!flags[bulletIte] && bulletNearWall(bullets, bulletIte)) {
+            flags[bulletIte] = -1;
+        }
+    }
+    if (vector) {
+        advanceBulletsVector(bullets, flags);
+    } else {
+        advanceBulletsScalar(bullets, flags);
+    }
+
+    // the flagged ones go through the exact sweep, the LEDs end up showing what happened to the last bullet
+    int ledValue = -1;
+    int bulletIte = 0;
+    while (bulletIte < bullets->count) {
+        if (!flags[bulletIte]) {
+            ledValue = 0b0;
+            bulletIte++;
+            continue;
+        }
+        coord position = {bullets->x[bulletIte], bullets->y[bulletIte]};
+        coord direction = {bullets->dx[bulletIte], bullets->dy[bulletIte]};
+        int hitTank = -1;
+        int hit = sweepBullet(position, direction, tanks, bullets->team[bulletIte], &hitTank);
+        if (hit == HIT_NOTHING) {
+            bullets->x[bulletIte] += direction.x;
+            bullets->y[bulletIte] += direction.y;
+            ledValue = 0b0;
+            bulletIte++;
+            continue;
+        }
+        if (hit == HIT_BOUNDARY) {
+            ledValue = 0b1;
+        } else if (hit == HIT_TANK) {
+            tanks->lifeLeft[hitTank]--;
+            ledValue = 0b10;
+        }
+        // the last bullet takes this slot, its flag comes along
+        flags[bulletIte] = flags[bullets->count - 1];
+        removeBullet(bullets, bulletIte);
+    }
+    if (ledValue >= 0) {
+        writeHitLeds(ledValue);
+    }
+}
+
+// player 1's lives go to the right hand LEDs, player 2's to the left hand ones
+void displayPlayerLife(const tankStore *tanks, int tank) {
+    int ledValue = readLeds();
+    if (tank == 0) {
+        writeLeds(tanks->lifeLeft[tank] | ledValue);
+    } else {
+        writeLeds((tanks->lifeLeft[tank] << 8) | ledValue);
+    }
+}
+
+// blacks out the small tank of every life the player has lost
+void drawLostLives(const tankStore *tanks, int tank) {
+    int heartY = tank == 0 ? tileHeight : 9 * tileHeight;
+    for (int life = 0; life < (3 - tanks->lifeLeft[tank]); life++) {
+        drawBox((13 + life) * tileWidth - tankWidth / 2, heartY + (tileHeight - tankHeight) / 2, (13 + life) * tileWidth + tankWidth / 2,
+                heartY + (tileHeight - tankHeight) / 2 + tankHeight, BLACK, true);
+    }
+}
+
+void drawVictoryScreen() {
+    if (p1Victory) {
+        drawSprite(SPRITE_P1_WON, 2 * tileWidth, 3 * tileHeight);
+    } else {
+        drawSprite(SPRITE_P2_WON, 2 * tileWidth, 3 * tileHeight);
+        // drawBox(2 * tileWidth, 3 * tileHeight, 10 * tileWidth, 9 * tileHeight, RED, true);
+    }
+    textOnHex();
+}
+
+const short int teamColors[TEAM_COUNT] = {BLUE, RED};
+
+void drawBullets(const bulletPool *bullets) {
+    for (int bulletIte = 0; bulletIte < bullets->count; bulletIte++) {
+        int x0 = bullets->x[bulletIte];
+        int y0 = bullets->y[bulletIte];
+        int x1 = x0 - bullets->dx[bulletIte] * 2;
+        int y1 = y0 - bullets->dy[bulletIte] * 2;
+        draw_line(x0, y0, x1, y1, teamColors[bullets->team[bulletIte]]);
+        markDirty(x0 < x1 ? x0 : x1, y0 < y1 ? y0 : y1, (x0 > x1 ? x0 : x1) + 1, (y0 > y1 ? y0 : y1) + 1);
+    }
+}
+
+void drawWalls(int x, int y) {
+    drawSprite(SPRITE_BRICK, x, y);
+    // drawBox(pos.x, pos.y, pos.x + tileWidth, pos.y + tileHeight, ORANGE, true);
+    // drawBox(pos.x + 5, pos.y + 5, pos.x + tileWidth - 5, pos.y + tileHeight - 5, GREY, true);
+}
+
+// the small tanks only have an up facing image, moving diagonally they face up or down
+void drawTank(const tankStore *tanks, int tank, coord position) {
+    int turns = 0;
+    if (tanks->lastDirectionY[tank] > 0) {
+        turns = 2;
+    } else if (tanks->lastDirectionY[tank] == 0 && tanks->lastDirectionX[tank] > 0) {
+        turns = 1;
+    } else if (tanks->lastDirectionY[tank] == 0 && tanks->lastDirectionX[tank] < 0) {
+        turns = 3;
+    }
+    drawSpriteTransformed(tanks->sprite[tank], position.x, position.y, turns);
+    markDirty(position.x, position.y, position.x + tankWidth, position.y + tankHeight);
+}
+
+// draws the selected map into the background layer and fills wallGrid, skipped if that map is already there
+void loadGameMap() {
+    if (selectedMap == backgroundMap) {
+        return;
+    }
+
+    const tileMap *map = &gameMaps[selectedMap];
+    intptr_t target = pixel_buffer_start;
+    pixel_buffer_start = (intptr_t)backgroundLayer;
+    clear_screen();
+    for (int row = 0; row < GRID_HEIGHT; row++) {
+        for (int col = 0; col < GRID_WIDTH; col++) {
+            if (map->tiles[row][col] == WALL_TILE) {
+                drawWalls(col * tileWidth, row * tileHeight);
+            }
+        }
+    }
+    buildWallGrid(map);
+    loadDistanceField(selectedMap);
+
+    // splitters
+    draw_line(12 * tileWidth, 0, 12 * tileWidth, RESOLUTION_Y - 1, ORANGE);
+    draw_line(12 * tileWidth, 4 * tileHeight, 16 * tileWidth, 4 * tileHeight, ORANGE);
+    draw_line(12 * tileWidth, 6 * tileHeight, 16 * tileWidth, 6 * tileHeight, ORANGE);
+    draw_line(12 * tileWidth, 8 * tileHeight, 16 * tileWidth, 8 * tileHeight, ORANGE);
+    pixel_buffer_start = target;
+    backgroundMap = selectedMap;
+}
+
+// the whole play area including the splitter on its right edge
+void drawArena() {
+    restoreBackground(0, 0, 12 * tileWidth + 1, RESOLUTION_Y);
+    backBufferDirtyList()->count = 0;
+}
+
+void drawSideLabel() {
+    int manualY = 4 * tileHeight + 1;
+    int iconsY = 5 * tileHeight + 2;
+
+    int upX = 12 * tileWidth;
+    int downX = 13 * tileWidth - 4;
+    int leftX = 14 * tileWidth - 8;
+    int rightX = 15 * tileWidth - 12;
+    int fireX = 16 * tileWidth - 16;
+#ifdef TEXT_HUD
+    drawText(upX / TEXT_CELL, manualY / TEXT_CELL + 2, "SW3 SW2 SW1 SW0 KEY0");
+#else
+    drawSprite(SPRITE_P1_TEXT, upX + 1, manualY);
+#endif
+    drawSprite(SPRITE_UP, upX, iconsY);
+    drawSprite(SPRITE_DOWN, downX, iconsY);
+    drawSprite(SPRITE_LEFT, leftX, iconsY);
+    drawSprite(SPRITE_RIGHT, rightX, iconsY);
+    drawSprite(SPRITE_FIRE, fireX, iconsY);
+    
+    int manualDownY = 6 * tileHeight + 1;
+    int iconsDownY = 7 * tileHeight + 2;
+#ifdef TEXT_HUD
+    drawText(upX / TEXT_CELL, manualDownY / TEXT_CELL + 2, "SW9 SW8 SW7 SW6 KEY3");
+#else
+    drawSprite(SPRITE_P2_TEXT, upX + 1, manualDownY);
+#endif
+    drawSprite(SPRITE_UP, upX, iconsDownY);
+    drawSprite(SPRITE_DOWN, downX, iconsDownY);
+    drawSprite(SPRITE_LEFT, leftX, iconsDownY);
+    drawSprite(SPRITE_RIGHT, rightX, iconsDownY);
+    drawSprite(SPRITE_FIRE, fireX, iconsDownY);
+}
+
+// quarter turns that point the up or up-right big tank along [lastDirection.x + 1][lastDirection.y + 1], -1 for none
+const int bigTankTurns[3][3] = {
+    {3, 3, 2},
+    {0, -1, 2},
+    {0, 1, 1},
+};
+
+void drawBigTank(const tankStore *tanks, int tank) {
+    int bigTankX = 13 * tileHeight;
+    int bigTankY = tank == 0 ? 2 * tileHeight : 10 * tileHeight;
+    int turns = bigTankTurns[tanks->lastDirectionX[tank] + 1][tanks->lastDirectionY[tank] + 1];
+    if (turns < 0) {
+        return;
+    }
+    bool diagonal = tanks->lastDirectionX[tank] != 0 && tanks->lastDirectionY[tank] != 0;
+    int id;
+    if (tank == 0) {
+        id = diagonal ? SPRITE_PURPLE_UP_RIGHT : SPRITE_PURPLE_UP;
+    } else {
+        id = diagonal ? SPRITE_BROWN_UP_RIGHT : SPRITE_BROWN_UP;
+    }
+    drawBox(bigTankX, bigTankY, bigTankX + 40, bigTankY + 40, BLACK, true);
+    drawSpriteTransformed(id, bigTankX, bigTankY, turns);
+}
+
+/* Side panel HUD
+ * The side panel shows the two player tanks and only changes when one of
+ * them turns or loses a life. Each
+ * buffer remembers what its side panel shows and drawHud() repaints only
+ * the parts that differ, so a change is drawn exactly once per buffer.
+ */
+typedef struct hudState {
+    bool valid;  // false once something else may have drawn over the side panel
+    coord tankDirection[PLAYER_TANKS];
+    int lifeLeft[PLAYER_TANKS];
+} hudState;
+
+hudState hudStates[SWAP_CHAIN_LENGTH];  // one per pixel buffer
+
+void invalidateHud() {
+    for (int buffer = 0; buffer < SWAP_CHAIN_LENGTH; buffer++) {
+        hudStates[buffer].valid = false;
+    }
+}
+
+void drawHud(const tankStore *tanks) {
+    hudState *hud = &hudStates[backBufferIndex()];
+
+    if (!hud->valid) {
+        drawSideLabel();
+    }
+    for (int tank = 0; tank < PLAYER_TANKS; tank++) {
+        coord direction = {tanks->lastDirectionX[tank], tanks->lastDirectionY[tank]};
+        if (!hud->valid || direction.x != hud->tankDirection[tank].x || direction.y != hud->tankDirection[tank].y) {
+            drawBigTank(tanks, tank);
+            hud->tankDirection[tank] = direction;
+        }
+        if (!hud->valid || tanks->lifeLeft[tank] != hud->lifeLeft[tank]) {
+            drawLostLives(tanks, tank);
+            hud->lifeLeft[tank] = tanks->lifeLeft[tank];
+        }
+    }
+    hud->valid = true;
+}
+
+void drawPauseScreen() {
+    drawSprite(SPRITE_PAUSE_PAGE, 2 * tileWidth + 1, 3 * tileHeight);
+//    drawBox(2 * tileWidth, 3 * tileHeight, 10 * tileWidth, 9 * tileHeight, PINK, true);
+}
+
+
+/* Frame phases
+ * Building with -DPROFILE_PHASES (implied by -DBENCHMARK) times the parts of
+ * every frame. PHASE_MARK(phase) charges the time since the previous mark to
+ * phase, so the marks cut a frame into consecutive slices and several marks
+ * of the same phase add up. PHASE_START() drops the time since the last mark,
+ * PHASE_END_FRAME() moves the frame's totals to lastFramePhases and into the
+ * frameHistory ring. Every PROFILE_HISTORY frames the HEX displays show the
+ * mean over the ring in microseconds: the whole frame with SW0 to SW2 off,
+ * otherwise phase n - 1 for switch value n, with n on HEX5. On the board the
+ * global timer is the clock, -DPROFILE_PMU uses the PMU cycle counter.
+ * Without the flag the macros compile to nothing.
+ */
+#if defined(BENCHMARK) && !defined(PROFILE_PHASES)
+#define PROFILE_PHASES
+#endif
+
+enum framePhase {
+    PHASE_INPUT,     // reading and decoding keys, switches and PS/2, and the bots' decisions
+    PHASE_MOVEMENT,  // tank movement and wall collision
+    PHASE_BULLETS,   // firing and the bullet update
+    PHASE_RESTORE,   // copying the background over last frame's objects
+    PHASE_MAP,       // drawing a map into the background layer
+    PHASE_SPRITES,   // tanks, bullets and the side panel
+    PHASE_SWAP,      // waiting for the buffer swap
+    PHASE_COUNT
+};
+
+const char *phaseNames[PHASE_COUNT] = {"input", "movement", "bullets", "restore", "map", "sprites", "swap"};
+
+#ifdef PROFILE_PHASES
+#define PROFILE_HISTORY 64
+#define PROFILE_SWITCHES 0b111
+
+// a simulation thread keeps its own slices, the frames report the drawing side; the board has no thread local
+// storage, so the marks of the simulation core are dropped instead
+#if defined(SPLIT_LOOP) && defined(HOST_BUILD)
+#define PHASE_LOCAL __thread
+#define PHASE_DROPPED() false
+#elif defined(SPLIT_LOOP)
+#define PHASE_LOCAL
+#define PHASE_DROPPED() (coreId() != 0)
+#else
+#define PHASE_LOCAL
+#define PHASE_DROPPED() false
+#endif
+
+PHASE_LOCAL uint32_t phaseTicks[PHASE_COUNT];  // current frame so far, in profile ticks
+uint32_t lastFramePhases[PHASE_COUNT];         // the last complete frame
+PHASE_LOCAL uint32_t lastPhaseMark = 0;
+uint32_t frameHistory[PROFILE_HISTORY][PHASE_COUNT];
+int frameHistoryNext = 0;
+
+const uint8_t sevenSegmentDigits[10] = {0x3F, 0x06, 0x5B, 0x4F, 0x66, 0x6D, 0x7D, 0x07, 0x7F, 0x6F};
+
+// mean microseconds over the ring, of the whole frame for 0 or of phase shown - 1
+uint32_t historyMicros(int shown) {
+    uint64_t ticks = 0;
+    for (int frame = 0; frame < PROFILE_HISTORY; frame++) {
+        for (int phase = 0; phase < PHASE_COUNT; phase++) {
+            if (shown == 0 || shown == phase + 1) {
+                ticks += frameHistory[frame][phase];
+            }
+        }
+    }
+    return ticks * 1000000 / PROFILE_TICKS_PER_SECOND / PROFILE_HISTORY;
+}
+
+// every phase and then the whole frame, along the bottom rows of the play area on the text overlay
+void showFrameStatsText() {
+    int columns = 12 * tileWidth / TEXT_CELL;
+    int column = 0;
+    int row = TEXT_ROWS - 2;
+    clearTextArea(0, row, columns, TEXT_ROWS);
+    for (int shown = 1; shown <= PHASE_COUNT + 1; shown++) {
+        char item[32];
+        int length;
+        if (shown <= PHASE_COUNT) {
+            length = snprintf(item, sizeof(item), "%s %u ", phaseNames[shown - 1], historyMicros(shown));
+        } else {
+            length = snprintf(item, sizeof(item), "frame %u us", historyMicros(0));
+        }
+        if (column + length > columns) {
+            column = 0;
+            row++;
+        }
+        drawText(column, row, item);
+        column += length;
+    }
+}
+
+void showFrameStats() {
+    int shown = readSwitches() & PROFILE_SWITCHES;
+    uint32_t micros = historyMicros(shown);
+    if (micros > 99999) {
+        micros = 99999;
+    }
+
+    int hex4to0[5];
+    for (int digit = 0; digit < 5; digit++) {
+        hex4to0[digit] = sevenSegmentDigits[micros % 10];
+        micros /= 10;
+    }
+    writeHexDisplays(hex4to0[0] | hex4to0[1] << 8 | hex4to0[2] << 16 | hex4to0[3] << 24,
+                     hex4to0[4] | sevenSegmentDigits[shown] << 8);
+    showFrameStatsText();
+}
+
+void markPhase(int phase) {
+    if (PHASE_DROPPED()) {
+        return;
+    }
+    uint32_t now = profileTicks();
+    phaseTicks[phase] += now - lastPhaseMark;
+    lastPhaseMark = now;
+}
+
+void endFramePhases() {
+    memcpy(lastFramePhases, phaseTicks, sizeof(phaseTicks));
+    memcpy(frameHistory[frameHistoryNext], phaseTicks, sizeof(phaseTicks));
+    memset(phaseTicks, 0, sizeof(phaseTicks));
+    frameHistoryNext = (frameHistoryNext + 1) % PROFILE_HISTORY;
+    if (frameHistoryNext == 0) {
+        showFrameStats();
+    }
+}
+
+#define PHASE_START() (lastPhaseMark = profileTicks())
+#define PHASE_MARK(phase) markPhase(phase)
+#define PHASE_END_FRAME() endFramePhases()
+#else
+#define PHASE_START()
+#define PHASE_MARK(phase)
+#define PHASE_END_FRAME()
+#endif
+
+/* Fixed timestep
+ * The game state moves on in ticks of 1 / SIM_TICK_HZ seconds whatever the
+ * frame rate is. Each frame adds the time since the previous one to an
+ * accumulator and runs one simulationStep() per whole tick in it before
+ * drawing. Tank and bullet speeds are per tick. Build with -DSIM_INTERPOLATE
+ * to draw tanks and bullets between their last two ticks instead of at the
+ * latest one, which smooths motion when ticks and frames do not line up.
+ */
+#ifndef SIM_TICK_HZ
+#define SIM_TICK_HZ 60
+#endif
+#define SIM_TICK_TICKS (PLATFORM_TICKS_PER_SECOND / SIM_TICK_HZ)
+#define SIM_MAX_STEPS_PER_FRAME 4  // after a long stall the game slows down rather than jumping ahead
+#define SIM_ALPHA_ONE 256          // interpolation factor for a full tick
+
+bool replayPending = false;  // a loaded replay waits for the next match started from the start screen
+bool replaying = false;
+
+// false if the recording does not fit this build, a replay then would not play out as recorded
+bool loadReplay(const uint8_t *data, size_t size) {
+    if (!startReplay(data, size) || replayInfo.map >= MAP_COUNT || replayInfo.maxBullets != MAX_BULLETS ||
+        replayInfo.bots != BOT_TANKS) {
+        return false;
+    }
+    replayPending = true;
+    return true;
+}
+
+#ifdef TEXT_HUD
+// names the map the switches pick while the start screen waits for KEY0
+void drawMapChoice() {
+    char line[32];
+    int map = mapFromSwitches(readSwitches());
+    snprintf(line, sizeof(line), "SW5-SW0: MAP %d %-10s", map, gameMaps[map].name);
+    drawText(2 * tileWidth / TEXT_CELL, 11 * tileHeight / TEXT_CELL, line);
+}
+#endif
+
+// a match started from the start screen plays a pending replay on its map, otherwise the switches pick the map
+void startMatch() {
+#ifdef TEXT_HUD
+    matchTicks = 0;
+#endif
+    if (replayPending) {
+        selectedMap = replayInfo.map;
+        replaying = true;
+        replayPending = false;
+    } else {
+        selectedMap = mapFromSwitches(readSwitches());
+    }
+    startRecording(selectedMap, MAX_BULLETS, BOT_TANKS);
+}
+
+// samples everything a tick reacts to, the replay overrides it until it runs out
+void readTickInput(tickInput *input) {
+    updateKeyboard();
+    input->arrows = (keyDown(KEY_UP_ARROW) ? ARROW_UP : 0) | (keyDown(KEY_DOWN_ARROW) ? ARROW_DOWN : 0) |
+                    (keyDown(KEY_LEFT_ARROW) ? ARROW_LEFT : 0) | (keyDown(KEY_RIGHT_ARROW) ? ARROW_RIGHT : 0);
+    input->keyEdges = readKeyEdges() & 0b1111;
+    input->switches = readSwitches() & 0b1111111111;
+    if (replaying && !replayTick(input)) {
+        replaying = false;
+    }
+    recordTick(input);
+}
+
+const int teamSprites[TEAM_COUNT] = {SPRITE_PURPLE_SMALL_TANK, SPRITE_BROWN_SMALL_TANK};
+
+// puts player 1 back at the bottom right and player 2 at the top left, with no other tanks
+void resetPlayerTanks(tankStore *tanks) {
+    clearTanks(tanks);
+    addTank(tanks, 222, 220, 0, teamSprites[0]);
+    addTank(tanks, 2, 4, 1, teamSprites[1]);
+}
+
+// a tank steers by four held buttons, opposite ones held together cancel out
+void steerTank(tankStore *tanks, int tank, bool up, bool down, bool left, bool right) {
+    tanks->yDir[tank] = up ? -1 : down ? 1
+                                       : 0;
+    tanks->xDir[tank] = left ? -1 : right ? 1
+                                          : 0;
+
+    if (up && down) {
+        tanks->yDir[tank] = 0;
+    }
+    if (left && right) {
+        tanks->xDir[tank] = 0;
+    }
+}
+
+// player 1 steers with the arrow keys, player 2 with SW9 to SW6
+void steerPlayers(tankStore *tanks, const tickInput *input) {
+    steerTank(tanks, 0, input->arrows & ARROW_UP, input->arrows & ARROW_DOWN, input->arrows & ARROW_LEFT,
+              input->arrows & ARROW_RIGHT);
+    if (!tanks->bot[1]) {
+        steerTank(tanks, 1, input->switches & 0b1000000000, input->switches & 0b100000000,
+                  input->switches & 0b10000000, input->switches & 0b1000000);
+    }
+}
+
+// moves a tank one pixel along its direction unless it is at the arena edge or runs into a wall
+void moveTank(tankStore *tanks, int tank) {
+    int x = tanks->x[tank];
+    int y = tanks->y[tank];
+    bool moveInX = false;
+    bool moveInY = false;
+    if ((x != 0 && x + tankWidth != 12 * tileWidth) ||
+        (x == 0 && tanks->xDir[tank] == 1) ||
+        (x == 12 * tileWidth - tankWidth && tanks->xDir[tank] == -1)) {
+        moveInX = true;
+    }
+    if ((y != 0 && y + tankHeight != 12 * tileHeight) ||
+        (y == 0 && tanks->yDir[tank] == 1) ||
+        (y == 12 * tileHeight - tankHeight && tanks->yDir[tank] == -1)) {
+        moveInY = true;
+    }
+
+    handleWallCollision(tanks, tank, &moveInX, &moveInY);
+
+    if (moveInX) {
+        tanks->x[tank] += tanks->xDir[tank];
+    }
+    if (moveInY) {
+        tanks->y[tank] += tanks->yDir[tank];
+    }
+}
+
+// a tank turns to face where it drives, destroyed tanks stay where they are
+void moveTanks(tankStore *tanks) {
+    for (int tank = 0; tank < tanks->count; tank++) {
+        if (!tankAlive(tanks, tank)) {
+            continue;
+        }
+        if (tanks->xDir[tank] != 0 || tanks->yDir[tank] != 0) {
+            tanks->lastDirectionX[tank] = tanks->xDir[tank];
+            tanks->lastDirectionY[tank] = tanks->yDir[tank];
+        }
+        moveTank(tanks, tank);
+    }
+}
+
+// fires from the middle of the tank, nothing happens while the pool is full
+void fireBullet(bulletPool *bullets, const tankStore *tanks, int tank) {
+    coord position = {tanks->x[tank] + tankWidth / 2, tanks->y[tank] + tankHeight / 2};
+    coord direction = {tanks->lastDirectionX[tank] * bulletSpeed, tanks->lastDirectionY[tank] * bulletSpeed};
+    spawnBullet(bullets, position, direction, tank, tanks->team[tank]);
+}
+
+/* Bots
+ * Building with -DBOT_TANKS=<n> puts n computer driven tanks into every
+ * match. The first drives player 2's tank, so one player can play alone,
+ * and the others join player 1's and player 2's teams in turn, starting on
+ * the open tiles nearest their team's corner. Every BOT_THINK_TICKS a bot
+ * picks the enemy with the shortest path to it as its quarry; even bots
+ * chase it and odd ones flank it by heading for the tiles behind it. On the
+ * ticks in between a bot only looks things up in the map's distanceField:
+ * it steps towards its goal, and once the quarry is on a clear line it
+ * turns to face it and fires every BOT_RELOAD_TICKS. Bots leave the last
+ * PLAYER_TANKS slots of the bullet pool to the players.
+ */
+#define BOT_THINK_TICKS 16
+#define BOT_RELOAD_TICKS 40
+#define BOT_AIM_SLACK 4
+
+int sign(int value) {
+    return (value > 0) - (value < 0);
+}
+
+// the tile under the middle of the tank
+int tankTile(const tankStore *tanks, int tank) {
+    return tileIndex(tanks->y[tank] + tankHeight / 2, tileHeight) * GRID_WIDTH +
+           tileIndex(tanks->x[tank] + tankWidth / 2, tileWidth);
+}
+
+// where a tank sits in the middle of the tile
+int restX(int tile) {
+    return tile % GRID_WIDTH * tileWidth + (tileWidth - tankWidth) / 2;
+}
+
+int restY(int tile) {
+    return tile / GRID_WIDTH * tileHeight + (tileHeight - tankHeight) / 2;
+}
+
+// spreads the bots' thinking over the ticks
+void makeBot(tankStore *tanks, int tank) {
+    tanks->bot[tank] = true;
+    tanks->goal[tank] = tankTile(tanks, tank);
+    tanks->quarry[tank] = -1;
+    tanks->thinkIn[tank] = 1 + tank % BOT_THINK_TICKS;
+    tanks->reload[tank] = BOT_RELOAD_TICKS;
+}
+
+// the open tile nearest to the start tile that no tank stands on, -1 if there is none
+int freeTileNear(const tankStore *tanks, int start) {
+    const uint8_t *steps = mapField->steps[start];
+    int best = -1;
+    for (int tile = 0; tile < GRID_TILES; tile++) {
+        if (steps[tile] == UNREACHABLE || (best >= 0 && steps[tile] >= steps[best])) {
+            continue;
+        }
+        bool taken = false;
+        for (int tank = 0; tank < tanks->count && !taken; tank++) {
+            taken = tankTile(tanks, tank) == tile;
+        }
+        if (!taken) {
+            best = tile;
+        }
+    }
+    return best;
+}
+
+// fills the match up to BOT_TANKS bots with the map in wallGrid, a match that has them already keeps them
+void addBots(tankStore *tanks) {
+    if (BOT_TANKS == 0 || tanks->bot[1]) {
+        return;
+    }
+    makeBot(tanks, 1);
+    while (tanks->count < BOT_TANKS + 1) {
+        int team = tanks->count % TEAM_COUNT;
+        int tile = freeTileNear(tanks, tankTile(tanks, team));  // the team's player tank is still in its corner
+        if (tile < 0) {
+            return;
+        }
+        int tank = addTank(tanks, restX(tile), restY(tile), team, teamSprites[team]);
+        makeBot(tanks, tank);
+    }
+}
+
+// the one of aimDirections nearest to pointing along (dx, dy), -1 for none
+int aimAlong(int dx, int dy) {
+    int x = ABS(dx) * 2 > ABS(dy) ? sign(dx) : 0;
+    int y = ABS(dy) * 2 > ABS(dx) ? sign(dy) : 0;
+    for (int direction = 0; direction < 8; direction++) {
+        if (aimDirections[direction].x == x && aimDirections[direction].y == y) {
+            return direction;
+        }
+    }
+    return -1;
+}
+
+// picks the nearest live enemy by path length as the quarry, and its tile or a tile behind it as the goal
+void botThink(tankStore *tanks, int tank) {
+    int here = tankTile(tanks, tank);
+    int nearest = UNREACHABLE + 1;
+    tanks->quarry[tank] = -1;
+    tanks->goal[tank] = here;
+    for (int other = 0; other < tanks->count; other++) {
+        if (tanks->team[other] == tanks->team[tank] || !tankAlive(tanks, other)) {
+            continue;
+        }
+        int steps = mapField->steps[tankTile(tanks, other)][here];
+        if (steps < nearest) {
+            nearest = steps;
+            tanks->quarry[tank] = other;
+        }
+    }
+    int quarry = tanks->quarry[tank];
+    if (quarry < 0) {
+        return;
+    }
+
+    int quarryTile = tankTile(tanks, quarry);
+    tanks->goal[tank] = quarryTile;
+    for (int behind = (tank & 1) ? 2 : 0; behind > 0; behind--) {
+        int col = quarryTile % GRID_WIDTH - behind * tanks->lastDirectionX[quarry];
+        int row = quarryTile / GRID_WIDTH - behind * tanks->lastDirectionY[quarry];
+        if (col >= 0 && col < GRID_WIDTH && row >= 0 && row < GRID_HEIGHT &&
+            mapField->steps[row * GRID_WIDTH + col][here] != UNREACHABLE) {
+            tanks->goal[tank] = row * GRID_WIDTH + col;
+            break;
+        }
+    }
+}
+
+// the index of aimDirections in which a shot from the bot hits its quarry, -1 for none: the quarry must be on the
+// bot's tile or on a clear line from it, and a bullet from the middle of the bot must pass through its box. The aim
+// table holds for bullets through the middle of the tiles, so a straight shot also needs the bot within
+// BOT_AIM_SLACK of the middle of its tile across the line.
+int botAim(const tankStore *tanks, int tank) {
+    int quarry = tanks->quarry[tank];
+    if (quarry < 0 || !tankAlive(tanks, quarry)) {
+        return -1;
+    }
+    int dx = tanks->x[quarry] - tanks->x[tank];
+    int dy = tanks->y[quarry] - tanks->y[tank];
+    if (ABS(dx) <= tankWidth / 2 && ABS(dy) <= tankHeight / 2) {
+        // a bullet that starts inside the box hits it whichever way it flies
+        int facing = aimAlong(tanks->lastDirectionX[tank], tanks->lastDirectionY[tank]);
+        return facing >= 0 ? facing : aimAlong(dx, dy);
+    }
+    int here = tankTile(tanks, tank);
+    int quarryTile = tankTile(tanks, quarry);
+    int direction = quarryTile == here ? aimAlong(dx, dy) : mapField->aim[here][quarryTile];
+    if (direction < 0 || ABS(dx * aimDirections[direction].y - dy * aimDirections[direction].x) > tankWidth / 2) {
+        return -1;
+    }
+    bool offX = aimDirections[direction].x == 0 && ABS(tanks->x[tank] - restX(here)) > BOT_AIM_SLACK;
+    bool offY = aimDirections[direction].y == 0 && ABS(tanks->y[tank] - restY(here)) > BOT_AIM_SLACK;
+    if (quarryTile != here && (offX || offY)) {
+        return -1;
+    }
+    return direction;
+}
+
+// sets where every bot drives this tick: it turns to a quarry it can shoot and waits there until it has reloaded,
+// it moves to the middle of its tile to get a quarry on a clear line into its sights, and otherwise it goes one
+// tile along the field towards its goal
+void updateBots(tankStore *tanks) {
+    for (int tank = 0; tank < tanks->count; tank++) {
+        if (!tanks->bot[tank] || !tankAlive(tanks, tank)) {
+            continue;
+        }
+        if (--tanks->thinkIn[tank] == 0) {
+            botThink(tanks, tank);
+            tanks->thinkIn[tank] = BOT_THINK_TICKS;
+        }
+        if (tanks->reload[tank] > 0) {
+            tanks->reload[tank]--;
+        }
+
+        int direction = botAim(tanks, tank);
+        if (direction >= 0) {
+            bool facing = aimDirections[direction].x == tanks->lastDirectionX[tank] &&
+                          aimDirections[direction].y == tanks->lastDirectionY[tank];
+            tanks->xDir[tank] = facing ? 0 : aimDirections[direction].x;
+            tanks->yDir[tank] = facing ? 0 : aimDirections[direction].y;
+            if (!facing || tanks->reload[tank] == 0) {
+                continue;
+            }
+        }
+
+        int here = tankTile(tanks, tank);
+        int next = here;
+        int quarry = tanks->quarry[tank];
+        bool inLine = direction < 0 && quarry >= 0 && mapField->aim[here][tankTile(tanks, quarry)] >= 0;
+        if (!inLine || (tanks->x[tank] == restX(here) && tanks->y[tank] == restY(here))) {
+            const uint8_t *steps = mapField->steps[tanks->goal[tank]];
+            int col = here % GRID_WIDTH;
+            int row = here / GRID_WIDTH;
+            for (int step = 0; step < 8; step += 2) {
+                int nextCol = col + aimDirections[step].x;
+                int nextRow = row + aimDirections[step].y;
+                int tile = nextRow * GRID_WIDTH + nextCol;
+                if (nextCol >= 0 && nextCol < GRID_WIDTH && nextRow >= 0 && nextRow < GRID_HEIGHT &&
+                    steps[tile] < steps[next]) {
+                    next = tile;
+                }
+            }
+        }
+        tanks->xDir[tank] = sign(restX(next) - tanks->x[tank]);
+        tanks->yDir[tank] = sign(restY(next) - tanks->y[tank]);
+    }
+}
+
+// runs after the move, so a bot that turned to its quarry on this tick fires at once
+void fireBots(tankStore *tanks, bulletPool *bullets) {
+    for (int tank = 0; tank < tanks->count; tank++) {
+        if (!tanks->bot[tank] || !tankAlive(tanks, tank) || tanks->reload[tank] > 0 ||
+            bullets->count >= MAX_BULLETS - PLAYER_TANKS) {
+            continue;
+        }
+        int direction = botAim(tanks, tank);
+        if (direction >= 0 && aimDirections[direction].x == tanks->lastDirectionX[tank] &&
+            aimDirections[direction].y == tanks->lastDirectionY[tank]) {
+            fireBullet(bullets, tanks, tank);
+            tanks->reload[tank] = BOT_RELOAD_TICKS;
+        }
+    }
+}
+
+// advances the match by one tick: input, movement, firing, bullet hits and the win check, nothing is drawn
+void simulationStep(tankStore *tanks, bulletPool *bullets) {
+    for (int tank = 0; tank < tanks->count; tank++) {
+        tanks->previousX[tank] = tanks->x[tank];
+        tanks->previousY[tank] = tanks->y[tank];
+    }
+    for (int bulletIte = 0; bulletIte < bullets->count; bulletIte++) {
+        bullets->previousX[bulletIte] = bullets->x[bulletIte];
+        bullets->previousY[bulletIte] = bullets->y[bulletIte];
+    }
+
+    tickInput input;
+    readTickInput(&input);
+    steerPlayers(tanks, &input);
+    updateBots(tanks);
+    PHASE_MARK(PHASE_INPUT);
+
+    moveTanks(tanks);
+    PHASE_MARK(PHASE_MOVEMENT);
+
+    // handles bullets fire, a tank that has not moved yet has no direction to fire in
+    if (input.keyEdges & 0b1) {  // key 0 is pressed, p1 shoots bullets
+        if (tanks->lastDirectionX[0] != 0 || tanks->lastDirectionY[0] != 0) {
+            fireBullet(bullets, tanks, 0);
+            clearKeyEdges(0b1);  // reset key 0
+        }
+    } else if ((input.keyEdges & 0b1000) && !tanks->bot[1]) {  // key 3 is pressed
+        if (tanks->lastDirectionX[1] != 0 || tanks->lastDirectionY[1] != 0) {
+            fireBullet(bullets, tanks, 1);
+            clearKeyEdges(0b1000);  // reset key 3
+        }
+    }
+    fireBots(tanks, bullets);
+
+    updateBullets(bullets, tanks, BULLET_SIMD);
+    PHASE_MARK(PHASE_BULLETS);
+
+    if (!teamAlive(tanks, 0)) {
+        gameRunning = false;
+        p1Victory = false;
+    } else if (!teamAlive(tanks, 1)) {
+        gameRunning = false;
+        p1Victory = true;
+    }
+#ifdef TEXT_HUD
+    matchTicks++;
+    if (!gameRunning) {
+        matchWins[p1Victory ? 0 : 1]++;
+    }
+#endif
+}
+
+#ifdef SIM_INTERPOLATE
+coord interpolatePosition(coord from, coord to, int alpha) {
+    coord result;
+    result.x = from.x + (to.x - from.x) * alpha / SIM_ALPHA_ONE;
+    result.y = from.y + (to.y - from.y) * alpha / SIM_ALPHA_ONE;
+    return result;
+}
+#endif
+
+#ifdef TEXT_HUD
+// rewritten on every frame, a few bytes of character buffer cost less than working out what changed; ticks and wins
+// are those of the state being drawn, with the split loop the snapshot's rather than the simulation's own
+void drawHudText(int ticks, const int wins[2]) {
+    int panelColumn = 12 * tileWidth / TEXT_CELL + 1;
+    char line[16];
+    int seconds = ticks / SIM_TICK_HZ;
+    snprintf(line, sizeof(line), "TIME %2d:%02d", seconds / 60 % 100, seconds % 60);
+    drawText(panelColumn, 3, line);
+    snprintf(line, sizeof(line), "WINS %-2d", wins[0] % 100);
+    drawText(panelColumn + 12, 1, line);
+    snprintf(line, sizeof(line), "WINS %-2d", wins[1] % 100);
+    drawText(panelColumn + 12, (8 * tileHeight + 1) / TEXT_CELL + 1, line);
+}
+#endif
+
+// draws the tanks, bullets and side panel, alpha is how far into the next tick the frame is; the player tanks
+// stay on the field once destroyed, any other tank disappears
+void renderFrame(tankStore *tanks, bulletPool *bullets, int alpha) {
+    for (int tank = 0; tank < tanks->count; tank++) {
+        if (tank >= PLAYER_TANKS && !tankAlive(tanks, tank)) {
+            continue;
+        }
+        coord position = {tanks->x[tank], tanks->y[tank]};
+#ifdef SIM_INTERPOLATE
+        coord previous = {tanks->previousX[tank], tanks->previousY[tank]};
+        position = interpolatePosition(previous, position, alpha);
+#endif
+        drawTank(tanks, tank, position);
+    }
+
+    bulletPool *drawnBullets = bullets;
+#ifdef SIM_INTERPOLATE
+    static bulletPool interpolatedBullets;
+    interpolatedBullets = *bullets;
+    for (int bulletIte = 0; bulletIte < bullets->count; bulletIte++) {
+        coord previous = {bullets->previousX[bulletIte], bullets->previousY[bulletIte]};
+        coord current = {bullets->x[bulletIte], bullets->y[bulletIte]};
+        coord drawn = interpolatePosition(previous, current, alpha);
+        interpolatedBullets.x[bulletIte] = drawn.x;
+        interpolatedBullets.y[bulletIte] = drawn.y;
+    }
+    drawnBullets = &interpolatedBullets;
+#else
+    (void)alpha;
+#endif
+
+    drawBullets(drawnBullets);
+
+    drawHud(tanks);
+    displayPlayerLife(tanks, 0);
+    displayPlayerLife(tanks, 1);
+}
+
+// one frame of a running match: the ticks that are due, then drawing and the buffer swap
+void gameFrame(tankStore *tanks, bulletPool *bullets, uint32_t *lastClock, uint32_t *simAccumulator) {
+    uint32_t now = gameClock();
+    *simAccumulator += now - *lastClock;
+    *lastClock = now;
+
+    restoreDirtyRects();
+    PHASE_MARK(PHASE_RESTORE);
+
+    int steps = 0;
+    while (gameRunning && *simAccumulator >= SIM_TICK_TICKS) {
+        if (steps == SIM_MAX_STEPS_PER_FRAME) {
+            *simAccumulator = 0;
+            break;
+        }
+        simulationStep(tanks, bullets);
+        *simAccumulator -= SIM_TICK_TICKS;
+        steps++;
+    }
+    renderFrame(tanks, bullets, *simAccumulator * SIM_ALPHA_ONE / SIM_TICK_TICKS);
+#ifdef TEXT_HUD
+    drawHudText(matchTicks, matchWins);
+#endif
+    PHASE_MARK(PHASE_SPRITES);
+
+    wait_for_vsync();
+    pixel_buffer_start = backBuffer();
+    PHASE_MARK(PHASE_SWAP);
+    PHASE_END_FRAME();
+}
+
+#ifdef SPLIT_LOOP
+/* Split loop
+ * Building with -DSPLIT_LOOP (which implies -DUSE_INTERRUPTS) takes the
+ * ticks of a match off the drawing loop. On Linux they run on a pthread of
+ * their own, on the board on the second A9 core. Whenever ticks have run,
+ * the simulation copies the match into a gameSnapshot and publishes it
+ * through a triple buffer: the simulation fills one slot, the newest
+ * complete snapshot waits in snapshotLatest and the renderer draws another,
+ * and publishing or taking the newest is a single atomic exchange, so
+ * neither side ever waits for the other.
+ */
+#define SNAPSHOT_INDEX 0b11
+#define SNAPSHOT_FRESH 0b100  // snapshotLatest has not been taken yet
+
+typedef struct gameSnapshot {
+    tankStore tanks;
+    bulletPool bullets;
+    uint32_t clock;  // gameClock() when it was published
+    int leds;        // LEDs the last bullet hit set, -1 for none since the previous snapshot
+    bool running;    // false once the match is won
+    int matchTicks;  // the text HUD's clock and score, which the simulation keeps
+    int matchWins[2];
+} gameSnapshot;
+
+gameSnapshot snapshots[3];
+int snapshotWriting = 0;      // only used by the simulation
+volatile int snapshotLatest = 1;
+int snapshotReading = 2;      // only used by the renderer
+
+// owned by the simulation while it runs
+tankStore *simTanks;
+bulletPool *simBullets;
+uint32_t simLastClock;
+uint32_t simAccumulator;
+volatile uint32_t simClock;  // gameClock() the simulation has caught up with
+
+void publishSnapshot(uint32_t clock) {
+    gameSnapshot *snapshot = &snapshots[snapshotWriting];
+    snapshot->tanks = *simTanks;
+    snapshot->bullets = *simBullets;
+    snapshot->clock = clock;
+    snapshot->leds = pendingLeds;
+    snapshot->running = gameRunning;
+    snapshot->matchTicks = matchTicks;
+    memcpy(snapshot->matchWins, matchWins, sizeof(matchWins));
+    pendingLeds = -1;
+    snapshotWriting = __atomic_exchange_n(&snapshotLatest, snapshotWriting | SNAPSHOT_FRESH, __ATOMIC_ACQ_REL) &
+                      SNAPSHOT_INDEX;
+}
+
+// moves the newest published snapshot to snapshotReading, false if the one there is still the newest
+bool takeSnapshot() {
+    if (!(__atomic_load_n(&snapshotLatest, __ATOMIC_ACQUIRE) & SNAPSHOT_FRESH)) {
+        return false;
+    }
+    snapshotReading = __atomic_exchange_n(&snapshotLatest, snapshotReading, __ATOMIC_ACQ_REL) & SNAPSHOT_INDEX;
+    return true;
+}
+
+// the simulation task: runs the ticks that are due, like gameFrame() does in the single loop
+void runDueTicks() {
+    uint32_t now = gameClock();
+    simAccumulator += now - simLastClock;
+    simLastClock = now;
+
+    int steps = 0;
+    while (gameRunning && simAccumulator >= SIM_TICK_TICKS) {
+        if (steps == SIM_MAX_STEPS_PER_FRAME) {
+            simAccumulator = 0;
+            break;
+        }
+        simulationStep(simTanks, simBullets);
+        simAccumulator -= SIM_TICK_TICKS;
+        steps++;
+    }
+    if (steps > 0) {
+        publishSnapshot(now);
+    }
+    __atomic_store_n(&simClock, now, __ATOMIC_RELEASE);
+}
+
+// hands the match to task on the simulation side, the caller must not touch it until stopSplitMatch()
+void startSplitMatch(tankStore *tanks, bulletPool *bullets, void (*task)()) {
+    simTanks = tanks;
+    simBullets = bullets;
+    simLastClock = gameClock();
+    simAccumulator = SIM_TICK_TICKS;
+    simClock = simLastClock - 1;
+    publishSnapshot(simLastClock);
+    takeSnapshot();
+    startSimulationTask(task);
+}
+
+void stopSplitMatch() {
+    stopSimulationTask();
+}
+
+// one frame of the drawing side, returns false once the shown snapshot is the end of the match
+bool splitFrame() {
+    restoreDirtyRects();
+    PHASE_MARK(PHASE_RESTORE);
+
+#ifdef HOST_BUILD
+    // no display paces the frames on Linux, so a frame waits until the ticks of the previous one are done and
+    // draws while the simulation works on its own ticks
+    while (gameClock() - __atomic_load_n(&simClock, __ATOMIC_ACQUIRE) > PLATFORM_TICKS_PER_SECOND / HOST_FRAME_RATE) {
+        sched_yield();
+    }
+    PHASE_MARK(PHASE_SWAP);
+#endif
+    if (takeSnapshot() && snapshots[snapshotReading].leds >= 0) {
+        writeLeds(snapshots[snapshotReading].leds);
+    }
+    gameSnapshot *shown = &snapshots[snapshotReading];
+    uint32_t sinceTick = gameClock() - shown->clock;
+    int alpha = sinceTick >= SIM_TICK_TICKS ? SIM_ALPHA_ONE : sinceTick * SIM_ALPHA_ONE / SIM_TICK_TICKS;
+    renderFrame(&shown->tanks, &shown->bullets, alpha);
+#ifdef TEXT_HUD
+    drawHudText(shown->matchTicks, shown->matchWins);
+#endif
+    PHASE_MARK(PHASE_SPRITES);
+
+    wait_for_vsync();
+    pixel_buffer_start = backBuffer();
+    PHASE_MARK(PHASE_SWAP);
+    PHASE_END_FRAME();
+    return shown->running;
+}
+#endif
+
+#ifdef BENCHMARK
+/* Micro-benchmarks
+ * Build with -DBENCHMARK (plus -DHOST_BUILD to run on Linux) to replace the
+ * game with a set of timing loops. Each case is repeated for a quarter of a
+ * second per pixel buffer and reported in millions of pixels per second.
+ */
+typedef struct benchCase {
+    const char *name;
+    void (*run)(short int color);
+    int pixels;  // pixels written by one run
+} benchCase;
+
+// clear_screen() before fillRect(): column by column, one plot_pixel each
+void benchClearColumns(short int color) {
+    for (int x = 0; x < 320; x++) {
+        for (int y = 0; y < 240; y++) {
+            plot_pixel(x, y, color);
+        }
+    }
+}
+
+void benchClearRows(short int color) {
+    fillRect(0, 0, RESOLUTION_X, RESOLUTION_Y, color);
+}
+
+// drawBox(..., true) before fillRect(): one draw_line per scanline of a trace sized box
+void benchBoxLines(short int color) {
+    for (int iterator = 0; iterator < tileHeight; iterator++) {
+        draw_line(101, 100 + iterator, 101 + tileWidth, 100 + iterator, color);
+    }
+}
+
+void benchBoxFill(short int color) {
+    drawBox(101, 100, 101 + tileWidth, 100 + tileHeight, color, true);
+}
+
+benchCase benchCases[] = {
+    {"clear per-pixel", benchClearColumns, RESOLUTION_X * RESOLUTION_Y},
+    {"clear fillRect", benchClearRows, RESOLUTION_X * RESOLUTION_Y},
+    {"box draw_line", benchBoxLines, 21 * 20},
+    {"box fillRect", benchBoxFill, 21 * 20},
+};
+
+void runBenchCase(const char *bufferName, benchCase *bench, short int color, const char *colorName) {
+    uint32_t budget = PLATFORM_TICKS_PER_SECOND / 4;
+    uint32_t start = platformTicks();
+    uint32_t elapsed = 0;
+    long runs = 0;
+    while (elapsed < budget) {
+        bench->run(color);
+        runs++;
+        elapsed = platformTicks() - start;
+    }
+    double seconds = (double)elapsed / PLATFORM_TICKS_PER_SECOND;
+    printf("%-8s %-16s %-6s %9.2f Mpixels/s\n", bufferName, bench->name, colorName,
+           runs * bench->pixels / seconds / 1000000.0);
+}
+
+// the first map with both tanks at their start and bullets scattered over the arena in all eight directions
+bulletPool benchBulletsStart;
+tankStore benchTanksStart;
+
+void setupBulletBench(int count) {
+    loadGameMap();
+    resetPlayerTanks(&benchTanksStart);
+
+    srand(1);
+    clearBullets(&benchBulletsStart);
+    for (int bulletIte = 0; bulletIte < count; bulletIte++) {
+        coord position = {1 + rand() % (12 * tileWidth - 2), 3 + rand() % (12 * tileHeight - 4)};
+        coord direction = {0, 0};
+        while (direction.x == 0 && direction.y == 0) {
+            direction.x = (rand() % 3 - 1) * bulletSpeed;
+            direction.y = (rand() % 3 - 1) * bulletSpeed;
+        }
+        spawnBullet(&benchBulletsStart, position, direction, bulletIte & 1, bulletIte & 1);
+    }
+}
+
+// one tick of updateBullets() from the same start every run, in nanoseconds per bullet
+double runBulletBench(bool vector, bulletPool *result) {
+    uint32_t budget = PLATFORM_TICKS_PER_SECOND / 4;
+    uint32_t start = platformTicks();
+    uint32_t elapsed = 0;
+    long runs = 0;
+    while (elapsed < budget) {
+        static tankStore tanks;
+        tanks = benchTanksStart;
+        *result = benchBulletsStart;
+        updateBullets(result, &tanks, vector);
+        runs++;
+        elapsed = platformTicks() - start;
+    }
+    double seconds = (double)elapsed / PLATFORM_TICKS_PER_SECOND;
+    return seconds * 1000000000.0 / runs / benchBulletsStart.count;
+}
+
+bool sameBullets(const bulletPool *first, const bulletPool *second) {
+    if (first->count != second->count) {
+        return false;
+    }
+    for (int bulletIte = 0; bulletIte < first->count; bulletIte++) {
+        if (first->x[bulletIte] != second->x[bulletIte] || first->y[bulletIte] != second->y[bulletIte] ||
+            first->owner[bulletIte] != second->owner[bulletIte] || first->team[bulletIte] != second->team[bulletIte]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* Sweep check
+ * ./bench sweep fires a bullet from every start offset within a tile, in
+ * every direction at every speed up to SWEEP_CHECK_SPEED pixels a tick, on
+ * every map with a few enemy tanks about, and checks one step of it against
+ * a reference that walks the same segment in 1/SWEEP_CHECK_STEPS pixel
+ * steps, testing each point on its own. Whenever the walk touches something
+ * sweepBullet() has to report a hit no later than the walk does, and
+ * updateBullets() has to stop the bullet with both kernels. When
+ * sweepBullet() names something else than the walk's first touch, it must
+ * have found a real contact before the walk's, a corner grazed between two
+ * of its points.
+ */
+#define SWEEP_CHECK_SPEED 24  // more than a tile, so a step can cross a whole wall
+#define SWEEP_CHECK_STEPS 8
+#define SWEEP_CHECK_TANKS 4
+#define SWEEP_CHECK_REPORTS 10
+
+// 1 << HIT_* of everything the point start + delta * k / m touches, boxes grown by slack / m pixels
+int sweepCheckTouches(coord start, coord delta, int k, int m, int slack, const tankStore *tanks, int team) {
+    int x = start.x * m + delta.x * k;
+    int y = start.y * m + delta.y * k;
+    int touches = 0;
+    if (x <= slack || x >= 12 * tileWidth * m - slack || y <= 2 * m + slack || y >= 12 * tileHeight * m - slack) {
+        touches |= 1 << HIT_BOUNDARY;
+    }
+    for (int tank = 0; tank < tanks->count; tank++) {
+        if (tanks->team[tank] != team && tankAlive(tanks, tank) && x >= tanks->x[tank] * m - slack &&
+            x <= (tanks->x[tank] + tankWidth) * m + slack && y >= tanks->y[tank] * m - slack &&
+            y <= (tanks->y[tank] + tankHeight) * m + slack) {
+            touches |= 1 << HIT_TANK;
+        }
+    }
+    int col = tileIndex(x, tileWidth * m);
+    int row = tileIndex(y, tileHeight * m);
+    for (int wallRow = row - 1; wallRow <= row + 1; wallRow++) {
+        for (int wallCol = col - 1; wallCol <= col + 1; wallCol++) {
+            if (isWall(wallCol, wallRow) && x >= wallCol * tileWidth * m - slack &&
+                x <= (wallCol + 1) * tileWidth * m + slack && y >= wallRow * tileHeight * m - slack &&
+                y <= (wallRow + 1) * tileHeight * m + slack) {
+                touches |= 1 << HIT_WALL;
+            }
+        }
+    }
+    return touches;
+}
+
+// the first kind the walk touches and the t of the point it touches it at, HIT_NOTHING if it never does
+int sweepCheckWalk(coord start, coord delta, const tankStore *tanks, int team, int *tTouch) {
+    int steps = (ABS(delta.x) > ABS(delta.y) ? ABS(delta.x) : ABS(delta.y)) * SWEEP_CHECK_STEPS;
+    for (int k = 0; k <= steps; k++) {
+        int touches = sweepCheckTouches(start, delta, k, steps, 0, tanks, team);
+        for (int hit = HIT_BOUNDARY; hit <= HIT_WALL; hit++) {
+            if (touches & (1 << hit)) {
+                *tTouch = k * SWEEP_ONE / steps;
+                return hit;
+            }
+        }
+    }
+    return HIT_NOTHING;
+}
+
+// t of the first contact sweepBullet() finds, built from the same parts
+int sweepCheckContact(coord start, coord delta, const tankStore *tanks, int team) {
+    int tContact = sweepBoundary(start, delta);
+    int tWall = sweepWalls(start, delta);
+    if (tWall < tContact) {
+        tContact = tWall;
+    }
+    for (int tank = 0; tank < tanks->count; tank++) {
+        if (tanks->team[tank] == team || !tankAlive(tanks, tank)) {
+            continue;
+        }
+        int t = sweepBox(start, delta, tanks->x[tank], tanks->y[tank], tanks->x[tank] + tankWidth,
+                         tanks->y[tank] + tankHeight);
+        if (t < tContact) {
+            tContact = t;
+        }
+    }
+    return tContact;
+}
+
+// true if one updateBullets() step with the kernel lets the bullet fly on
+bool sweepCheckSurvives(coord start, coord delta, tankStore *tanks, bool vector) {
+    static bulletPool bullets;
+    clearBullets(&bullets);
+    spawnBullet(&bullets, start, delta, 0, 0);
+    updateBullets(&bullets, tanks, vector);
+    for (int tank = 0; tank < tanks->count; tank++) {
+        tanks->lifeLeft[tank] = 3;
+    }
+    return bullets.count == 1;
+}
+
+// returns the number of failed cases
+int runSweepCheck() {
+    const char *hitNames[] = {"nothing", "boundary", "tank", "wall"};
+    static tankStore tanks;
+    long cases = 0;
+    int failures = 0;
+    srand(3);
+    for (int speed = 1; speed <= SWEEP_CHECK_SPEED; speed++) {
+        const tileMap *map = &gameMaps[speed % MAP_COUNT];
+        buildWallGrid(map);
+        // every direction with speed pixels along its longer axis
+        for (int direction = 0; direction < (2 * speed + 1) * (2 * speed + 1); direction++) {
+            coord delta = {direction % (2 * speed + 1) - speed, direction / (2 * speed + 1) - speed};
+            if (ABS(delta.x) != speed && ABS(delta.y) != speed) {
+                continue;
+            }
+            clearTanks(&tanks);
+            addTank(&tanks, rand() % (12 * tileWidth), rand() % (12 * tileHeight), 0, teamSprites[0]);
+            for (int tank = 1; tank < SWEEP_CHECK_TANKS; tank++) {
+                addTank(&tanks, rand() % (12 * tileWidth), rand() % (12 * tileHeight), 1, teamSprites[1]);
+            }
+            int col = rand() % GRID_WIDTH;
+            int row = rand() % GRID_HEIGHT;
+            for (int offset = 0; offset < tileWidth * tileHeight; offset++) {
+                coord start = {col * tileWidth + offset % tileWidth, row * tileHeight + offset / tileWidth};
+                int hitTank = -1;
+                int hit = sweepBullet(start, delta, &tanks, 0, &hitTank);
+                int tContact = sweepCheckContact(start, delta, &tanks, 0);
+                int tTouch = SWEEP_MISS;
+                int touched = sweepCheckWalk(start, delta, &tanks, 0, &tTouch);
+                const char *failure = NULL;
+                if (touched != HIT_NOTHING && hit == HIT_NOTHING) {
+                    failure = "tunnelled";
+                } else if (touched != HIT_NOTHING && tContact > tTouch + 1) {
+                    failure = "late";
+                } else if (hit != touched && (tContact >= tTouch || !(sweepCheckTouches(start, delta, tContact,
+                           SWEEP_ONE, SWEEP_CHECK_SPEED, &tanks, 0) & (1 << hit)))) {
+                    failure = "wrong kind";
+                } else if (touched != HIT_NOTHING && (sweepCheckSurvives(start, delta, &tanks, false) ||
+                                                      sweepCheckSurvives(start, delta, &tanks, true))) {
+                    failure = "flew through updateBullets";
+                }
+                if (failure != NULL) {
+                    if (failures < SWEEP_CHECK_REPORTS) {
+                        printf("%s: map %s from (%d, %d) by (%d, %d): sweep %s at %d, walk %s at %d\n", failure,
+                               map->name, start.x, start.y, delta.x, delta.y, hitNames[hit], tContact,
+                               hitNames[touched], tTouch);
+                    }
+                    failures++;
+                }
+                cases++;
+            }
+        }
+    }
+    printf("sweep %ld cases %d failed\n", cases, failures);
+    return failures;
+}
+
+// adds tanks up to count, or as many as fit, on random open tiles, alternating between the teams
+void addBenchTanks(tankStore *tanks, int count) {
+    while (tanks->count < count && tanks->count < MAX_TANKS) {
+        int col = rand() % GRID_WIDTH;
+        int row = rand() % GRID_HEIGHT;
+        if (isWall(col, row)) {
+            continue;
+        }
+        int team = tanks->count % TEAM_COUNT;
+        addTank(tanks, col * tileWidth + (tileWidth - tankWidth) / 2, row * tileHeight + (tileHeight - tankHeight) / 2,
+                team, teamSprites[team]);
+    }
+}
+
+// every tank but the players' and the bots picks a new random direction now and then and fires now and then
+void driveBenchTanks(tankStore *tanks, bulletPool *bullets) {
+    for (int tank = 0; tank < tanks->count; tank++) {
+        tanks->lifeLeft[tank] = 3;
+        if (tank < PLAYER_TANKS || tanks->bot[tank]) {
+            continue;
+        }
+        if (rand() % 40 == 0) {
+            tanks->xDir[tank] = rand() % 3 - 1;
+            tanks->yDir[tank] = rand() % 3 - 1;
+        }
+        if (rand() % 30 == 0 && (tanks->lastDirectionX[tank] != 0 || tanks->lastDirectionY[tank] != 0)) {
+            fireBullet(bullets, tanks, tank);
+        }
+    }
+}
+
+// the bullet bench's 100 bullets among count tanks, each driving in a random direction or, with bots, all but
+// the players hunting each other
+void setupTankBench(int count, bool bots) {
+    setupBulletBench(100);
+    srand(2);
+    addBenchTanks(&benchTanksStart, count);
+    for (int tank = 0; tank < count; tank++) {
+        while (benchTanksStart.xDir[tank] == 0 && benchTanksStart.yDir[tank] == 0) {
+            benchTanksStart.xDir[tank] = rand() % 3 - 1;
+            benchTanksStart.yDir[tank] = rand() % 3 - 1;
+        }
+        if (bots && tank >= PLAYER_TANKS) {
+            makeBot(&benchTanksStart, tank);
+        }
+    }
+}
+
+// the bot, movement and bullet parts of BOT_THINK_TICKS ticks from the same start every run, so every bot
+// thinks once, in nanoseconds per tick
+double runTankBench() {
+    uint32_t budget = PLATFORM_TICKS_PER_SECOND / 4;
+    uint32_t start = platformTicks();
+    uint32_t elapsed = 0;
+    long runs = 0;
+    while (elapsed < budget) {
+        static tankStore tanks;
+        static bulletPool bullets;
+        tanks = benchTanksStart;
+        bullets = benchBulletsStart;
+        for (int tick = 0; tick < BOT_THINK_TICKS; tick++) {
+            updateBots(&tanks);
+            moveTanks(&tanks);
+            fireBots(&tanks, &bullets);
+            updateBullets(&bullets, &tanks, BULLET_SIMD);
+        }
+        runs++;
+        elapsed = platformTicks() - start;
+    }
+    double seconds = (double)elapsed / PLATFORM_TICKS_PER_SECOND;
+    return seconds * 1000000000.0 / runs / BOT_THINK_TICKS;
+}
+
+/* Game scenarios
+ * Plays frames of the real match loop, gameFrame(), headless and reports the
+ * frame rate and how each frame's time splits into the phases of framePhase.
+ * The tanks are driven by a replay, the same input path a recorded match
+ * uses: the duel scenarios generate one in which both tanks wander and fire,
+ * and a replay given to the platform (TANK_REPLAY on Linux) is played as one
+ * more scenario. A scenario with more tanks adds them on open tiles, where
+ * they wander and fire at random or play as bots. Tanks never die, a match
+ * that would end goes on. With -DSPLIT_LOOP every scenario is played a
+ * second time through splitFrame();
+ * there the drawing side's wait for the simulation counts as swap time.
+ * Frame times are also counted in a histogram of power of two buckets, which
+ * shows how often a frame missed a refresh once TANK_VSYNC paces the swaps;
+ * build with different -DSWAP_CHAIN_LENGTH values to compare swap chains.
+ */
+#define BENCH_MAX_FRAMES 3600
+#define BENCH_DEFAULT_FRAMES 600
+#define BENCH_HISTOGRAM_BUCKETS 18  // bucket n counts frames of 2^n to 2^(n+1) - 1 microseconds, the last one up
+
+enum { BENCH_TEXT, BENCH_CSV, BENCH_JSON };
+
+typedef struct benchScenario {
+    const char *name;
+    int map;
+    bool fillBullets;  // tops the bullet pool up to MAX_BULLETS before every frame
+    bool redrawMap;    // draws the map into the background layer on every frame
+    int tanks;         // tanks in the match, the two players and the wanderers
+    bool bots;         // the tanks past the players are bots instead of wanderers
+} benchScenario;
+
+benchScenario benchScenarios[] = {
+    {"maze", 0, false, false, 2, false},
+    {"scatter", 1, false, false, 2, false},
+    {"max bullets", 0, true, false, 2, false},
+    {"checker", 5, false, false, 2, false},
+    {"corridors redraw", 4, false, true, 2, false},
+    {"32 tanks", 1, false, false, 32, false},
+    {"32 bots", 1, false, false, 32, true},
+};
+
+uint32_t benchFrames[BENCH_MAX_FRAMES][PHASE_COUNT];
+const benchScenario *benchCurrent;
+uint8_t benchScript[REPLAY_BUFFER_SIZE] __attribute__((aligned(4)));
+
+// a seeded random walk for both tanks, each firing every few ticks
+int makeDuelScript(int map, int ticks) {
+    srand(map + 1);
+    startRecording(map, MAX_BULLETS, BOT_TANKS);
+    tickInput input = {0, 0, 0};
+    int p1Directions[] = {ARROW_UP, ARROW_DOWN, ARROW_LEFT, ARROW_RIGHT, ARROW_UP | ARROW_LEFT, ARROW_DOWN | ARROW_RIGHT};
+    int p2Directions[] = {0b1000000000, 0b0100000000, 0b0010000000, 0b0001000000, 0b1010000000, 0b0101000000};
+    for (int tick = 0; tick < ticks; tick++) {
+        if (tick % 40 == 0) {
+            input.arrows = p1Directions[rand() % 6];
+            input.switches = p2Directions[rand() % 6];
+        }
+        input.keyEdges = (tick % 9 == 0 ? 0b1 : 0) | (tick % 13 == 0 ? 0b1000 : 0);
+        recordTick(&input);
+    }
+    memcpy(benchScript, inputRecording, recordingSize);
+    return recordingSize;
+}
+
+// keeps the pool full with bullets starting on open tiles, flying in all eight directions
+void fillBenchBullets(bulletPool *bullets) {
+    while (bullets->count < MAX_BULLETS) {
+        int col = rand() % GRID_WIDTH;
+        int row = rand() % GRID_HEIGHT;
+        if (isWall(col, row)) {
+            continue;
+        }
+        coord position = {col * tileWidth + 2 + rand() % (tileWidth - 4), row * tileHeight + 2 + rand() % (tileHeight - 4)};
+        coord direction = {0, 0};
+        while (direction.x == 0 && direction.y == 0) {
+            direction.x = (rand() % 3 - 1) * bulletSpeed;
+            direction.y = (rand() % 3 - 1) * bulletSpeed;
+        }
+        spawnBullet(bullets, position, direction, bullets->count & 1, bullets->count & 1);
+    }
+}
+
+#ifdef SPLIT_LOOP
+// the per frame set up of runScenario(), done on the simulation side once it owns the match
+void benchSimulationTask() {
+    if (gameClock() == simClock) {
+        return;
+    }
+    if (benchCurrent->fillBullets) {
+        fillBenchBullets(simBullets);
+    }
+    driveBenchTanks(simTanks, simBullets);
+    gameRunning = true;
+    runDueTicks();
+}
+#endif
+
+// plays the scenario from the replay in data and fills benchFrames, returns the frames played
+int runScenario(const benchScenario *scenario, const uint8_t *data, int size, int frames, bool split) {
+    static bulletPool bullets;
+    static tankStore tanks;
+    if (!loadReplay(data, size)) {
+        return 0;
+    }
+    startMatch();
+    resetPlayerTanks(&tanks);
+    clearBullets(&bullets);
+    gameRunning = true;
+
+    backgroundMap = -1;
+    pixel_buffer_start = backBuffer();
+    loadGameMap();
+    addBenchTanks(&tanks, scenario->tanks);
+    for (int tank = PLAYER_TANKS; tank < tanks.count && scenario->bots; tank++) {
+        makeBot(&tanks, tank);
+    }
+    invalidateHud();
+    drawEveryBuffer(drawArena);
+
+    benchCurrent = scenario;
+#ifdef SPLIT_LOOP
+    if (split) {
+        PHASE_START();
+        startSplitMatch(&tanks, &bullets, benchSimulationTask);
+        for (int frame = 0; frame < frames; frame++) {
+            if (scenario->redrawMap) {
+                backgroundMap = -1;
+                loadGameMap();
+                drawArena();
+                PHASE_MARK(PHASE_MAP);
+            }
+            splitFrame();
+            memcpy(benchFrames[frame], lastFramePhases, sizeof(lastFramePhases));
+        }
+        stopSplitMatch();
+        replaying = false;
+        return frames;
+    }
+#else
+    (void)split;
+#endif
+
+    uint32_t lastClock = gameClock();
+    uint32_t simAccumulator = SIM_TICK_TICKS;
+    for (int frame = 0; frame < frames; frame++) {
+        if (scenario->fillBullets) {
+            fillBenchBullets(&bullets);
+        }
+        driveBenchTanks(&tanks, &bullets);
+        gameRunning = true;
+
+        PHASE_START();
+        if (scenario->redrawMap) {
+            backgroundMap = -1;
+            loadGameMap();
+            drawArena();
+            PHASE_MARK(PHASE_MAP);
+        }
+        gameFrame(&tanks, &bullets, &lastClock, &simAccumulator);
+        memcpy(benchFrames[frame], lastFramePhases, sizeof(lastFramePhases));
+    }
+    replaying = false;
+    return frames;
+}
+
+double ticksToMicroseconds(uint32_t ticks) {
+    return ticks * 1000000.0 / PROFILE_TICKS_PER_SECOND;
+}
+
+void reportScenario(const char *name, int map, int frames, int format, bool first) {
+    double phaseTotals[PHASE_COUNT] = {0};
+    double total = 0;
+    int histogram[BENCH_HISTOGRAM_BUCKETS] = {0};
+    for (int frame = 0; frame < frames; frame++) {
+        double frameTotal = 0;
+        for (int phase = 0; phase < PHASE_COUNT; phase++) {
+            phaseTotals[phase] += ticksToMicroseconds(benchFrames[frame][phase]);
+            frameTotal += ticksToMicroseconds(benchFrames[frame][phase]);
+        }
+        total += frameTotal;
+        int bucket = 0;
+        while (bucket < BENCH_HISTOGRAM_BUCKETS - 1 && frameTotal >= 2 << bucket) {
+            bucket++;
+        }
+        histogram[bucket]++;
+    }
+    double fps = total > 0 ? frames * 1000000.0 / total : 0;
+
+    if (format == BENCH_TEXT) {
+        printf("%-18s %-10s %9.1f fps", name, gameMaps[map].name, fps);
+        for (int phase = 0; phase < PHASE_COUNT; phase++) {
+            printf(" %s %.2f", phaseNames[phase], phaseTotals[phase] / frames);
+        }
+        printf(" us/frame\n%-18s", "");
+        for (int bucket = 0; bucket < BENCH_HISTOGRAM_BUCKETS; bucket++) {
+            if (histogram[bucket] > 0) {
+                printf(" %d-%dus %d", bucket ? 1 << bucket : 0, (2 << bucket) - 1, histogram[bucket]);
+            }
+        }
+        printf("\n");
+    } else if (format == BENCH_CSV) {
+        for (int frame = 0; frame < frames; frame++) {
+            double frameTotal = 0;
+            printf("%s,%s,%d", name, gameMaps[map].name, frame);
+            for (int phase = 0; phase < PHASE_COUNT; phase++) {
+                printf(",%.3f", ticksToMicroseconds(benchFrames[frame][phase]));
+                frameTotal += ticksToMicroseconds(benchFrames[frame][phase]);
+            }
+            printf(",%.3f\n", frameTotal);
+        }
+    } else {
+        printf("%s    {\"name\": \"%s\", \"map\": \"%s\", \"frames\": %d, \"fps\": %.1f,\n", first ? "" : ",\n", name,
+               gameMaps[map].name, frames, fps);
+        printf("     \"mean\": {");
+        for (int phase = 0; phase < PHASE_COUNT; phase++) {
+            printf("%s\"%s\": %.3f", phase ? ", " : "", phaseNames[phase], phaseTotals[phase] / frames);
+        }
+        printf("},\n     \"histogram\": [");
+        for (int bucket = 0; bucket < BENCH_HISTOGRAM_BUCKETS; bucket++) {
+            printf("%s%d", bucket ? ", " : "", histogram[bucket]);
+        }
+        printf("],\n     \"perFrame\": [");
+        for (int frame = 0; frame < frames; frame++) {
+            printf("%s[", frame ? ", " : "");
+            for (int phase = 0; phase < PHASE_COUNT; phase++) {
+                printf("%s%.3f", phase ? ", " : "", ticksToMicroseconds(benchFrames[frame][phase]));
+            }
+            printf("]");
+        }
+        printf("]}");
+    }
+}
+
+void runScenarios(int format, int frames) {
+    if (format == BENCH_CSV) {
+        printf("scenario,map,frame");
+        for (int phase = 0; phase < PHASE_COUNT; phase++) {
+            printf(",%s_us", phaseNames[phase]);
+        }
+        printf(",total_us\n");
+    } else if (format == BENCH_JSON) {
+        printf("{\"unit\": \"us\", \"swapChain\": %d, \"phases\": [", SWAP_CHAIN_LENGTH);
+        for (int phase = 0; phase < PHASE_COUNT; phase++) {
+            printf("%s\"%s\"", phase ? ", " : "", phaseNames[phase]);
+        }
+        printf("],\n \"scenarios\": [\n");
+    } else {
+        printf("swap chain of %d buffers\n", SWAP_CHAIN_LENGTH);
+    }
+
+    // a frame runs at most SIM_MAX_STEPS_PER_FRAME ticks, the script must not run out before the frames do
+    int scenarioCount = sizeof(benchScenarios) / sizeof(benchScenarios[0]);
+    size_t replayBytes;
+    const uint8_t *replay = platformReplay(&replayBytes);
+    benchScenario recorded = {"replay", 0, false, false, 2, false};
+#ifdef SPLIT_LOOP
+    int loops = 2;
+#else
+    int loops = 1;
+#endif
+    for (int loop = 0; loop < loops; loop++) {
+        bool split = loop == 1;
+        for (int scenarioIte = 0; scenarioIte < scenarioCount; scenarioIte++) {
+            benchScenario *scenario = &benchScenarios[scenarioIte];
+            char name[32];
+            snprintf(name, sizeof(name), split ? "%s split" : "%s", scenario->name);
+            int size = makeDuelScript(scenario->map, frames * SIM_MAX_STEPS_PER_FRAME);
+            int played = runScenario(scenario, benchScript, size, frames, split);
+            reportScenario(name, scenario->map, played, format, loop == 0 && scenarioIte == 0);
+        }
+
+        if (replay != NULL) {
+            int played = runScenario(&recorded, replay, replayBytes, frames, split);
+            if (played == 0) {
+                fprintf(stderr, "replay: not a recording of this build\n");
+            } else {
+                reportScenario(split ? "replay split" : "replay", selectedMap, played, format, false);
+            }
+        }
+    }
+
+    if (format == BENCH_JSON) {
+        printf("\n ]}\n");
+    }
+}
+
+// bench [text|csv|json|sweep] [frames]: csv and json only play the game scenarios, sweep only runs the sweep check
+int main(int argc, char **argv) {
+    const char *bufferNames[] = {"on-chip", "sdram"};
+    int format = BENCH_TEXT;
+    int frames = BENCH_DEFAULT_FRAMES;
+    if (argc > 1) {
+        format = strcmp(argv[1], "csv") == 0 ? BENCH_CSV : strcmp(argv[1], "json") == 0 ? BENCH_JSON : BENCH_TEXT;
+    }
+    if (argc > 2) {
+        frames = atoi(argv[2]);
+        frames = frames < 1 ? 1 : frames > BENCH_MAX_FRAMES ? BENCH_MAX_FRAMES : frames;
+    }
+    platformInit();
+    if (!loadAssetPack()) {
+        return 1;
+    }
+    prepareSprites();
+    if (argc > 1 && strcmp(argv[1], "sweep") == 0) {
+        return runSweepCheck() == 0 ? 0 : 1;
+    }
+    if (format != BENCH_TEXT) {
+        runScenarios(format, frames);
+        return 0;
+    }
+    for (int buffer = 0; buffer < 2; buffer++) {
+        pixel_buffer_start = pixelBufferAddress(buffer);
+        for (int benchIte = 0; benchIte < (int)(sizeof(benchCases) / sizeof(benchCases[0])); benchIte++) {
+            // black takes the memset path in fillRect, orange the word stores
+            runBenchCase(bufferNames[buffer], &benchCases[benchIte], BLACK, "black");
+            runBenchCase(bufferNames[buffer], &benchCases[benchIte], ORANGE, "orange");
+        }
+    }
+
+    static bulletPool scalarResult;
+    static bulletPool vectorResult;
+    int bulletCounts[] = {10, 100, 1000};
+    for (int countIte = 0; countIte < 3; countIte++) {
+        if (bulletCounts[countIte] > MAX_BULLETS) {
+            break;
+        }
+        setupBulletBench(bulletCounts[countIte]);
+        double scalar = runBulletBench(false, &scalarResult);
+        double vector = runBulletBench(true, &vectorResult);
+        printf("bullets %4d scalar %7.1f ns/bullet vector %7.1f ns/bullet %s\n", bulletCounts[countIte], scalar, vector,
+               sameBullets(&scalarResult, &vectorResult) ? "" : "MISMATCH");
+    }
+
+    int tankCounts[] = {2, 8, 16, 32, 64};
+    for (int countIte = 0; countIte < 5; countIte++) {
+        if (tankCounts[countIte] > MAX_TANKS) {
+            break;
+        }
+        setupTankBench(tankCounts[countIte], false);
+        double tick = runTankBench();
+        setupTankBench(tankCounts[countIte], true);
+        double botTick = runTankBench();
+        printf("tanks %4d %9.1f ns/tick %7.1f ns/tank, as bots %9.1f ns/tick %7.1f ns/tank\n", tankCounts[countIte],
+               tick, tick / tankCounts[countIte], botTick, botTick / tankCounts[countIte]);
+    }
+
+    runScenarios(format, frames);
+    return 0;
+}
+
+#else
+
+void drawStartPage() {
+    drawStartScreen();
+    drawSideLabel();
+}
+
+void drawMatchScreen() {
+    drawArena();
+    drawUpperSmallTank();
+    drawLowerSmallTank();
+#ifdef TEXT_HUD
+    clearTextArea(0, 0, 12 * tileWidth / TEXT_CELL, TEXT_ROWS);
+#endif
+}
+
+int main(void) {
+    platformInit();
+    if (!loadAssetPack()) {
+        return 1;
+    }
+    prepareSprites();
+    size_t replayBytes;
+    const uint8_t *replay = platformReplay(&replayBytes);
+    if (replay != NULL && !loadReplay(replay, replayBytes)) {
+        return 1;
+    }
+    wait_for_vsync();  // puts buffer 0 on screen, whatever the display showed before
+    clearText();
+    for (int buffer = 0; buffer < SWAP_CHAIN_LENGTH; buffer++) {
+        pixel_buffer_start = pixelBufferAddress(buffer);
+        clear_screen();
+    }
+    pixel_buffer_start = backBuffer();
+
+    // draw start screen
+    drawEveryBuffer(drawStartPage);
+
+    // pool for the map switches and key 0
+    // key 0 starts the map picked by sw0 to sw5
+    while (startScreen) {
+#ifdef TEXT_HUD
+        drawMapChoice();
+#endif
+        if (replayPending || (readKeyEdges() & 0x1)) {  // if bit 0 is set to 1
+            startMatch();
+            startScreen = false;   // breaks out of start screen
+            gameRunning = true;    // set game running flag to true
+            clearKeyEdges(0b1111);  // reset all keys
+        }
+        waitForInput();
+    }
+
+    drawEveryBuffer(clearMainScreen);
+
+    tankStore tanks;
+    resetPlayerTanks(&tanks);
+
+    bulletPool bullets;
+    clearBullets(&bullets);
+    while (1) {
+        if (!gamePaused) {
+            if (startScreen) {
+                drawEveryBuffer(drawStartScreen);
+            }
+
+            while (startScreen) {
+#ifdef TEXT_HUD
+                drawMapChoice();
+#endif
+                if (replayPending || (readKeyEdges() & 0x1)) {  // if bit 0 is set to 1
+                    startMatch();
+                    startScreen = false;   // breaks out of start screen
+                    gameRunning = true;    // set game running flag to true
+                    clearKeyEdges(0b1111);  // reset all keys
+                }
+                // reset the tanks and bullets
+                resetPlayerTanks(&tanks);
+                clearBullets(&bullets);
+
+                waitForInput();
+            }
+
+            loadGameMap();
+            addBots(&tanks);
+            invalidateHud();
+            drawEveryBuffer(drawMatchScreen);
+
+            writeHexDisplays(0b0, 0b0);
+
+            // one tick is due on the first frame, the rest come from the time between frames
+            PHASE_START();
+#ifdef SPLIT_LOOP
+            startSplitMatch(&tanks, &bullets, runDueTicks);
+            bool running = true;
+            while (running) {
+                if (readKeyEdges() & 0b10) {  // press key 1 to pause game
+                    gamePaused = true;
+                    clearKeyEdges(0b10);  // reset key 1
+                    break;
+                }
+                running = splitFrame();
+            }
+            stopSplitMatch();
+#else
+            uint32_t lastClock = gameClock();
+            uint32_t simAccumulator = SIM_TICK_TICKS;
+            while (gameRunning) {
+                if (readKeyEdges() & 0b10) {  // press key 1 to pause game
+                    gamePaused = true;
+                    clearKeyEdges(0b10);  // reset key 1
+                    break;
+                }
+                gameFrame(&tanks, &bullets, &lastClock, &simAccumulator);
+            }
+#endif
+
+            if (!gamePaused) {
+                clearBullets(&bullets);
+            }
+
+            while (!gameRunning && !gamePaused) {
+                drawVictoryScreen();
+
+                if (readKeyEdges() & 0b1) {  // press key 0 to restart
+                    startScreen = false;
+                    gameRunning = true;
+                    startRecording(selectedMap, MAX_BULLETS, BOT_TANKS);
+#ifdef TEXT_HUD
+                    matchTicks = 0;
+#endif
+                    break;
+                } else if (readKeyEdges() & 0b10) {  // press key1 to go main
+                    startScreen = true;
+                    break;
+                }
+
+                wait_for_vsync();
+                pixel_buffer_start = backBuffer();
+            }
+
+            clearKeyEdges(0b1111);
+
+            if (!gamePaused) {
+                resetPlayerTanks(&tanks);
+            }
+
+            if (!gamePaused) {
+                drawEveryBuffer(clearMainScreen);
+            }
+        } else {
+            // clearMainScreen();
+            drawPauseScreen();
+
+            if (readKeyEdges() & 0b1) {  // press key 0 to restart
+                startScreen = false;
+                gameRunning = true;
+                gamePaused = false;
+            } else if (readKeyEdges() & 0b10) {
+                startScreen = true;
+                gameRunning = false;
+                gamePaused = false;
+            }
+
+            if (!gamePaused && startScreen && !gameRunning) {
+                clearKeyEdges(0b1111);
+                clearMainScreen();
+                for (int buffer = 1; buffer < SWAP_CHAIN_LENGTH; buffer++) {
+                    wait_for_vsync();
+                    pixel_buffer_start = backBuffer();
+                    clear_screen();
+                }
+                clearText();
+            }
+
+            wait_for_vsync();
+            pixel_buffer_start = backBuffer();
+        }
+    }
+    return 0;
+}
+
+#endif
@@ -0,0 +1,190 @@
+/* Asset compiler
+ * Packs the sprite tables of assets/sprites.c into the binary pack the game
+ * loads at start up. Build and run it from the repository root whenever the
+ * art changes:
+ *     gcc -o assetpack tools/assetpack.c && ./assetpack assets/sprites.pack
+ */
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../assets/assetpack.h"
+#include "../assets/sprites.c"
+
+typedef struct assetSource {
+    const char *name;
+    const uint16_t *texels;
+    int width;
+    int height;
+    int colorKey;
+} assetSource;
+
+#define ASSET(table, key) \
+    {#table, &table[0][0], sizeof(table[0]) / sizeof(table[0][0]), sizeof(table) / sizeof(table[0]), key}
+
+// the game looks sprites up by these names, see spriteNames in game_main.c
+assetSource assetSources[] = {
+    ASSET(gametitle, NO_COLOR_KEY),
+    ASSET(presskeytostart, NO_COLOR_KEY),
+    ASSET(switch00, NO_COLOR_KEY),
+    ASSET(switch01, NO_COLOR_KEY),
+    ASSET(bigPurpleTankUp, NO_COLOR_KEY),
+    ASSET(bigBrownTankUp, NO_COLOR_KEY),
+    ASSET(heart, 63422),
+    ASSET(player1, NO_COLOR_KEY),
+    ASSET(player2, NO_COLOR_KEY),
+    ASSET(pause, NO_COLOR_KEY),
+    ASSET(up, 65535),
+    ASSET(down, 65535),
+    ASSET(left, 65535),
+    ASSET(right, 65535),
+    ASSET(fire, NO_COLOR_KEY),
+    ASSET(p1Text, NO_COLOR_KEY),
+    ASSET(p2Text, NO_COLOR_KEY),
+    ASSET(psup, NO_COLOR_KEY),
+    ASSET(bsup, NO_COLOR_KEY),
+    ASSET(brickMain, NO_COLOR_KEY),
+    ASSET(p1Won, NO_COLOR_KEY),
+    ASSET(p2Won, NO_COLOR_KEY),
+    ASSET(pausePage, NO_COLOR_KEY),
+    ASSET(pu, 65535),
+    ASSET(pur, 65535),
+    ASSET(bu, 65535),
+    ASSET(bur, 65535),
+    ASSET(map1, NO_COLOR_KEY),
+    ASSET(map2, NO_COLOR_KEY),
+};
+
+#define ASSET_COUNT (int)(sizeof(assetSources) / sizeof(assetSources[0]))
+
+uint32_t alignOffset(uint32_t offset) {
+    return (offset + ASSET_PACK_ALIGN - 1) / ASSET_PACK_ALIGN * ASSET_PACK_ALIGN;
+}
+
+// the encoded form of one sprite
+typedef struct assetImage {
+    uint16_t palette[256];
+    int paletteSize;
+    int bitsPerTexel;
+    int colorKey;
+    int pitch;  // bytes per row
+    uint8_t *texels;
+} assetImage;
+
+int paletteIndex(const assetImage *image, uint16_t color) {
+    for (int index = 0; index < image->paletteSize; index++) {
+        if (image->palette[index] == color) {
+            return index;
+        }
+    }
+    return -1;
+}
+
+// picks the smallest format that holds every colour exactly, the colour key goes into palette slot 0
+void encodeImage(const assetSource *source, assetImage *image) {
+    int pixelCount = source->width * source->height;
+    image->paletteSize = 0;
+    if (source->colorKey != NO_COLOR_KEY) {
+        image->palette[image->paletteSize++] = source->colorKey;
+    }
+    bool fits = true;
+    for (int pixel = 0; pixel < pixelCount && fits; pixel++) {
+        if (paletteIndex(image, source->texels[pixel]) < 0) {
+            if (image->paletteSize == 256) {
+                fits = false;
+            } else {
+                image->palette[image->paletteSize++] = source->texels[pixel];
+            }
+        }
+    }
+
+    if (!fits) {
+        image->paletteSize = 0;
+        image->bitsPerTexel = 16;
+        image->colorKey = source->colorKey;
+    } else {
+        image->bitsPerTexel = image->paletteSize <= 16 ? 4 : 8;
+        image->colorKey = source->colorKey == NO_COLOR_KEY ? NO_COLOR_KEY : 0;
+    }
+    image->pitch = (source->width * image->bitsPerTexel + 7) / 8;
+    image->texels = calloc(image->pitch * source->height, 1);
+    for (int row = 0; row < source->height; row++) {
+        uint8_t *dest = image->texels + row * image->pitch;
+        for (int col = 0; col < source->width; col++) {
+            uint16_t color = source->texels[row * source->width + col];
+            if (image->bitsPerTexel == 16) {
+                dest[col * 2] = color & 0xFF;
+                dest[col * 2 + 1] = color >> 8;
+            } else if (image->bitsPerTexel == 8) {
+                dest[col] = paletteIndex(image, color);
+            } else {
+                dest[col >> 1] |= paletteIndex(image, color) << ((col & 1) * 4);
+            }
+        }
+    }
+}
+
+void padTo(FILE *file, uint32_t offset) {
+    while (ftell(file) < (long)offset) {
+        fputc(0, file);
+    }
+}
+
+// little endian on every target the game runs on, so headers are written the way they sit in memory
+int main(int argc, char **argv) {
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s <output pack>\n", argv[0]);
+        return 1;
+    }
+
+    assetPackHeader header = {ASSET_PACK_MAGIC, ASSET_PACK_VERSION, ASSET_COUNT, 0};
+    assetPackEntry entries[ASSET_COUNT];
+    assetImage images[ASSET_COUNT];
+    memset(entries, 0, sizeof(entries));
+
+    uint32_t offset = alignOffset(sizeof(header) + sizeof(entries));
+    uint32_t rgb565Size = 0;
+    for (int assetIte = 0; assetIte < ASSET_COUNT; assetIte++) {
+        assetSource *source = &assetSources[assetIte];
+        if (strlen(source->name) >= ASSET_NAME_LENGTH) {
+            fprintf(stderr, "%s: name longer than %d characters\n", source->name, ASSET_NAME_LENGTH - 1);
+            return 1;
+        }
+        encodeImage(source, &images[assetIte]);
+        strcpy(entries[assetIte].name, source->name);
+        entries[assetIte].width = source->width;
+        entries[assetIte].height = source->height;
+        entries[assetIte].colorKey = images[assetIte].colorKey;
+        entries[assetIte].bitsPerTexel = images[assetIte].bitsPerTexel;
+        entries[assetIte].paletteSize = images[assetIte].paletteSize;
+        entries[assetIte].paletteOffset = offset;
+        offset = alignOffset(offset + images[assetIte].paletteSize * sizeof(uint16_t));
+        entries[assetIte].offset = offset;
+        offset = alignOffset(offset + images[assetIte].pitch * source->height);
+        rgb565Size += source->width * source->height * sizeof(uint16_t);
+    }
+    header.size = offset;
+
+    FILE *file = fopen(argv[1], "wb");
+    if (file == NULL) {
+        perror(argv[1]);
+        return 1;
+    }
+    fwrite(&header, sizeof(header), 1, file);
+    fwrite(entries, sizeof(entries), 1, file);
+    for (int assetIte = 0; assetIte < ASSET_COUNT; assetIte++) {
+        padTo(file, entries[assetIte].paletteOffset);
+        fwrite(images[assetIte].palette, sizeof(uint16_t), images[assetIte].paletteSize, file);
+        padTo(file, entries[assetIte].offset);
+        fwrite(images[assetIte].texels, 1, images[assetIte].pitch * assetSources[assetIte].height, file);
+        free(images[assetIte].texels);
+    }
+    padTo(file, header.size);
+    if (fclose(file) != 0) {
+        perror(argv[1]);
+        return 1;
+    }
+    printf("%s: %d sprites, %u bytes (%u as plain RGB565)\n", argv[1], ASSET_COUNT, header.size, rgb565Size);
+    return 0;
+}